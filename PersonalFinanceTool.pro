@@ -7,45 +7,17 @@
 #   Relative Location:  PersonalFinanceTool/
 ###################################################################################
 
-QT += core
-QT += gui
+TEMPLATE = subdirs
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+# The core library holds everything but the GUI, so the command-line tool builds without it
+SUBDIRS += \
+    core \
+    gui \
+    cli
 
-CONFIG += c++17
+core.file = core/PersonalFinanceCore.pro
+gui.file = gui/PersonalFinanceTool.pro
+cli.file = cli/pft.pro
 
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-# The name of the binary
-TARGET = PersonalFinanceTool
-
-# The directory where the binary is generated
-DESTDIR = ./bin
-
-# Store unnecessary files in hidden folders
-OBJECTS_DIR = ./obj
-MOC_DIR = ./moc
-UI_DIR = ./ui
-
-SOURCES += \
-    src/Bill.cpp \
-    src/BillWidget.cpp \
-    src/main.cpp \
-    src/MainWindow.cpp
-
-HEADERS += \
-    src/Bill.h \
-    src/BillWidget.h \
-    src/MainWindow.h
-
-#Track the config file and README in the IDE
-OTHER_FILES += \
-    config/PersonalFinanceTool.ini \
-    README.md
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
+gui.depends = core
+cli.depends = core
@@ -0,0 +1,26 @@
+###################################################################################
+#   File name:          AutomationBenchmark.pro
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Project file for the AutomationBenchmark
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/benchmarks/AutomationBenchmark/
+###################################################################################
+
+QT += core
+QT += network
+QT -= gui
+
+CONFIG += c++17
+CONFIG += console
+CONFIG -= app_bundle
+
+# The name of the binary
+TARGET = AutomationBenchmark
+
+# Store unnecessary files in hidden folders
+OBJECTS_DIR = ./obj
+MOC_DIR = ./moc
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,197 @@
+/*##################################################################################
+#   File name:          main.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Main file for the AutomationBenchmark
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/benchmarks/AutomationBenchmark/
+##################################################################################*/
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocalSocket>
+#include <QTextStream>
+
+namespace
+{
+    const QString DEFAULT_SERVER_NAME = "PersonalFinanceTool"; //!< The name of the local socket the PFT listens on.
+    const int CONNECT_TIMEOUT_MSECS = 3000; //!< How long to wait for the PFT to accept the connection.
+    const int RESPONSE_TIMEOUT_MSECS = 30000; //!< How long to wait for responses before giving up.
+    const QString MUTATE_OPERATION = "mutate"; //!< Operation which funds and defunds a bill of the benchmark's own in turn, so every request moves funds and writes the transaction history.
+    const QString BENCHMARK_BILL_NAME = "AutomationBenchmark Bill"; //!< The name of the bill the mutating operation adds, and deletes when it is done.
+
+    /**
+     * @brief Sends a single request and waits for its response.
+     * @param p_socket - The connected socket.
+     * @param p_request - The request.
+     * @param p_response - Receives the response.
+     * @return False if the server stopped responding or refused the request.
+     */
+    bool sendRequest(QLocalSocket &p_socket, const QJsonObject &p_request, QJsonObject &p_response)
+    {
+        p_socket.write(QJsonDocument(p_request).toJson(QJsonDocument::Compact) + '\n');
+        p_socket.flush();
+
+        while(!p_socket.canReadLine())
+        {
+            if(!p_socket.waitForReadyRead(RESPONSE_TIMEOUT_MSECS))
+            {
+                return false;
+            }
+        }
+
+        p_response = QJsonDocument::fromJson(p_socket.readLine()).object();
+        return p_response.value("ok").toBool();
+    }
+
+    /**
+     * @brief Sends requests in groups and waits for every response of a group before sending the next.
+     * @param p_socket - The connected socket.
+     * @param p_requestLines - The requests to send in turn, each ending in a newline.
+     * @param p_requestCount - The total number of requests to send.
+     * @param p_depth - How many requests to send before waiting for their responses, 1 sends them one at a time.
+     * @return The number of requests answered per second, or a negative number if the server stopped responding.
+     */
+    double measureRequestsPerSecond(QLocalSocket &p_socket, const QByteArrayList &p_requestLines, int p_requestCount, int p_depth)
+    {
+        QElapsedTimer elapsedTimer;
+        elapsedTimer.start();
+        int sentCount = 0;
+
+        while(sentCount < p_requestCount)
+        {
+            // Send a whole group at once, taking the requests in turn
+            int groupSize = qMin(p_depth, p_requestCount - sentCount);
+            QByteArray groupLines;
+
+            for(int requestIndex = sentCount; requestIndex < sentCount + groupSize; requestIndex++)
+            {
+                groupLines.append(p_requestLines.at(requestIndex % p_requestLines.size()));
+            }
+
+            p_socket.write(groupLines);
+            p_socket.flush();
+            sentCount += groupSize;
+
+            // Read until every response of the group has arrived
+            int answeredCount = 0;
+
+            while(answeredCount < groupSize)
+            {
+                if(!p_socket.canReadLine() && !p_socket.waitForReadyRead(RESPONSE_TIMEOUT_MSECS))
+                {
+                    return -1.0;
+                }
+
+                while(p_socket.canReadLine())
+                {
+                    p_socket.readLine();
+                    answeredCount++;
+                }
+            }
+        }
+
+        return p_requestCount * 1000.0 / qMax<qint64>(elapsedTimer.elapsed(), 1);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    QTextStream output(stdout);
+
+    // Read the options, which default to a read-only request so the benchmark does not change the user's bills
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures how many automation requests per second the PFT answers one at a time and pipelined. Pipelined requests are handled as batches.");
+    parser.addHelpOption();
+    QCommandLineOption serverOption("server", "Name of the local socket the PFT listens on.", "name", DEFAULT_SERVER_NAME);
+    QCommandLineOption operationOption("op", "Operation to request, totals or list, which only read, or mutate, which adds a bill, funds and defunds it in turn, and deletes it again.", "operation", "totals");
+    QCommandLineOption requestsOption("requests", "Number of requests to send in each mode.", "count", "10000");
+    QCommandLineOption depthOption("depth", "Number of requests sent before waiting for responses when pipelining.", "count", "256");
+    parser.addOptions({serverOption, operationOption, requestsOption, depthOption});
+    parser.process(application);
+
+    int requestCount = qMax(parser.value(requestsOption).toInt(), 1);
+    int depth = qMax(parser.value(depthOption).toInt(), 1);
+    bool isMutating = parser.value(operationOption) == MUTATE_OPERATION;
+
+    // Connect to the running PFT
+    QLocalSocket socket;
+    socket.connectToServer(parser.value(serverOption));
+
+    if(!socket.waitForConnected(CONNECT_TIMEOUT_MSECS))
+    {
+        output << "Could not connect to \"" << parser.value(serverOption) << "\": " << socket.errorString() << Qt::endl;
+        return 1;
+    }
+
+    // The mutating operation works on a bill of its own, added unfunded so funding and defunding it in turn leaves the amount available as it was
+    QByteArrayList requestLines;
+    QString billKey;
+
+    if(isMutating)
+    {
+        QJsonObject addRequest;
+        QJsonObject addResponse;
+        addRequest.insert("op", "add");
+        addRequest.insert("name", BENCHMARK_BILL_NAME);
+        addRequest.insert("amountDue", 1.0);
+        addRequest.insert("allowDuplicate", true);
+
+        if(!sendRequest(socket, addRequest, addResponse))
+        {
+            output << "Could not add the benchmark's bill: " << addResponse.value("error").toString() << Qt::endl;
+            return 1;
+        }
+
+        billKey = addResponse.value("key").toString();
+
+        for(const QString &operation : {QString("fund"), QString("defund")})
+        {
+            QJsonObject request;
+            request.insert("op", operation);
+            request.insert("key", billKey);
+            requestLines.append(QJsonDocument(request).toJson(QJsonDocument::Compact) + '\n');
+        }
+    }
+    else
+    {
+        QJsonObject request;
+        request.insert("op", parser.value(operationOption));
+        requestLines.append(QJsonDocument(request).toJson(QJsonDocument::Compact) + '\n');
+    }
+
+    // Measure the same number of requests sent one at a time and then pipelined, an even number so a mutated bill ends up unfunded
+    int measuredCount = isMutating ? requestCount + requestCount % 2 : requestCount;
+    double sequentialRate = measureRequestsPerSecond(socket, requestLines, measuredCount, 1);
+    double pipelinedRate = measureRequestsPerSecond(socket, requestLines, measuredCount, depth);
+
+    // Remove the benchmark's bill again
+    if(isMutating && sequentialRate >= 0.0 && pipelinedRate >= 0.0)
+    {
+        QJsonObject deleteRequest;
+        QJsonObject deleteResponse;
+        deleteRequest.insert("op", "delete");
+        deleteRequest.insert("key", billKey);
+
+        if(!sendRequest(socket, deleteRequest, deleteResponse))
+        {
+            output << "Could not delete the benchmark's bill \"" << billKey << "\": " << deleteResponse.value("error").toString() << Qt::endl;
+        }
+    }
+
+    if(sequentialRate < 0.0 || pipelinedRate < 0.0)
+    {
+        output << "The PFT stopped responding" << Qt::endl;
+        return 1;
+    }
+
+    output << "Operation:  " << parser.value(operationOption) << ", " << measuredCount << " requests per mode" << Qt::endl;
+    output << "Sequential: " << QString::number(sequentialRate, 'f', 0) << " requests/s" << Qt::endl;
+    output << "Pipelined:  " << QString::number(pipelinedRate, 'f', 0) << " requests/s (depth " << depth << ", "
+           << QString::number(pipelinedRate / qMax(sequentialRate, 1.0), 'f', 1) << "x)" << Qt::endl;
+    return 0;
+}
@@ -0,0 +1,54 @@
+###################################################################################
+#   File name:          LoadBenchmark.pro
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Project file for the LoadBenchmark
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/benchmarks/LoadBenchmark/
+###################################################################################
+
+QT += core
+QT += concurrent
+QT -= gui
+
+CONFIG += c++17
+CONFIG += console
+CONFIG -= app_bundle
+
+# The name of the binary
+TARGET = LoadBenchmark
+
+# Store unnecessary files in hidden folders
+OBJECTS_DIR = ./obj
+MOC_DIR = ./moc
+
+# Build the PFT's loading classes straight from its source folder
+INCLUDEPATH += ../../src
+
+# Peak memory is read from the process memory counters on Windows
+win32: LIBS += -lpsapi
+
+SOURCES += \
+    main.cpp \
+    ../../src/Bill.cpp \
+    ../../src/CategoryRollup.cpp \
+    ../../src/ConfigFileReader.cpp \
+    ../../src/ConfigSectionIndex.cpp \
+    ../../src/CurrencyRegistry.cpp \
+    ../../src/LabelRegistry.cpp \
+    ../../src/LoadArena.cpp \
+    ../../src/Profiler.cpp \
+    ../../src/ProfilerAllocator.cpp \
+    ../../src/StagedLedger.cpp
+
+HEADERS += \
+    ../../src/Bill.h \
+    ../../src/CategoryRollup.h \
+    ../../src/ConfigFileReader.h \
+    ../../src/ConfigSectionIndex.h \
+    ../../src/CurrencyRegistry.h \
+    ../../src/LabelRegistry.h \
+    ../../src/LedgerSnapshot.h \
+    ../../src/LoadArena.h \
+    ../../src/Profiler.h \
+    ../../src/StagedLedger.h
@@ -0,0 +1,751 @@
+/*##################################################################################
+#   File name:          main.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Main file for the LoadBenchmark
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/benchmarks/LoadBenchmark/
+##################################################################################*/
+
+#include "CategoryRollup.h"
+#include "ConfigFileReader.h"
+#include "ConfigSectionIndex.h"
+#include "LedgerSnapshot.h"
+#include "LoadArena.h"
+#include "Profiler.h"
+#include "StagedLedger.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#if defined(__GLIBC__)
+// glibc's own allocator, which the counting replacements of malloc, calloc, and realloc below forward to
+extern "C" void* __libc_malloc(size_t p_byteCount);
+extern "C" void* __libc_calloc(size_t p_elementCount, size_t p_elementSize);
+extern "C" void* __libc_realloc(void *p_memory, size_t p_byteCount);
+#endif
+
+namespace
+{
+    // The counters are constant initialized, so allocations made before main() are safe to count
+    std::atomic<bool> isCountingMalloc(false); //!< Whether or not the malloc replacements count calls, only set while the file is loaded.
+    std::atomic<quint64> mallocCount(0); //!< The number of heap allocations made while counting, through new or malloc alike.
+    std::atomic<quint64> mallocBytes(0); //!< The number of bytes of those allocations.
+
+    /**
+     * @brief Counts a heap allocation if counting is enabled, called by the malloc replacements.
+     * @param p_byteCount - The number of bytes requested.
+     */
+    void countMalloc(size_t p_byteCount)
+    {
+        if(isCountingMalloc.load(std::memory_order_relaxed))
+        {
+            mallocCount.fetch_add(1, std::memory_order_relaxed);
+            mallocBytes.fetch_add(p_byteCount, std::memory_order_relaxed);
+        }
+    }
+
+    // The config file's group labels, keys, and values, as the PFT writes them
+    const QString FUNDS_INFORMATION_GROUP_LABEL = "FundsInformation"; //!< The group label of the funds information section.
+    const QString TOTAL_FUNDS_AVAILABLE_KEY = "TotalFundsAvailable"; //!< The key of the total funds available.
+    const QString AMOUNT_DUE_KEY = "AmountDue"; //!< The key of a bill's amount due.
+    const QString DUE_DATE_KEY = "DueDate"; //!< The key of a bill's due date.
+    const QString CURRENCY_KEY = "Currency"; //!< The key of a currency.
+    const QString CATEGORY_KEY = "Category"; //!< The key of a bill's category.
+    const QString TAGS_KEY = "Tags"; //!< The key of a bill's tags.
+    const QString FUNDED_STRING = "Funded"; //!< The funding status of a funded bill.
+    const QString DATE_STRING_FORMAT = "M/d/yyyy"; //!< The format due dates are written in.
+
+    const QString ARENA_LOADER = "arena"; //!< Loader which reads the file the way the PFT does, staging bills in a LoadArena.
+    const QString SETTINGS_LOADER = "settings"; //!< Loader which reads the file through QSettings, the way the PFT used to.
+    const size_t ARENA_BYTES_PER_FILE_BYTE = 3; //!< The size of the arena's first block per byte of the file, as the PFT sizes it.
+
+#if defined(__GLIBC__)
+    const bool IS_MALLOC_COUNTED = true; //!< Whether or not malloc is replaced, so every heap allocation is counted rather than only those made through new.
+#else
+    const bool IS_MALLOC_COUNTED = false; //!< Whether or not malloc is replaced, so every heap allocation is counted rather than only those made through new.
+#endif
+
+    /**
+     * @brief Returns the most memory the process has had resident at once.
+     * @return The peak resident set size in bytes, or -1 if it cannot be read.
+     */
+    qint64 peakResidentBytes()
+    {
+#if defined(Q_OS_WIN)
+        PROCESS_MEMORY_COUNTERS memoryCounters;
+        return GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)) ? static_cast<qint64>(memoryCounters.PeakWorkingSetSize) : -1;
+#else
+        struct rusage resourceUsage;
+
+        if(getrusage(RUSAGE_SELF, &resourceUsage) != 0)
+        {
+            return -1;
+        }
+
+        // macOS reports the peak in bytes, other systems in kilobytes
+#if defined(Q_OS_MACOS)
+        return static_cast<qint64>(resourceUsage.ru_maxrss);
+#else
+        return static_cast<qint64>(resourceUsage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    /**
+     * @brief Writes a config file with a number of bills in the format QSettings writes, one line at a time so writing it barely raises the peak memory.
+     * @param p_filePath - The path of the file.
+     * @param p_billCount - The number of bills.
+     * @return False if the file could not be written.
+     */
+    bool writeConfigFile(const QString &p_filePath, int p_billCount)
+    {
+        QFile configFile(p_filePath);
+
+        if(!configFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        QTextStream configStream(&configFile);
+        configStream << "[" << FUNDS_INFORMATION_GROUP_LABEL << "]\n" << CURRENCY_KEY << "=USD\n" << TOTAL_FUNDS_AVAILABLE_KEY << "=1000000\n";
+
+        // Give every bill a due date and funding status, a quarter of them a category, an eighth tags, and a tenth another currency, as a real ledger might
+        for(int billIndex = 0; billIndex < p_billCount; billIndex++)
+        {
+            configStream << "\n[Bill" << QString::number(billIndex).rightJustified(8, QLatin1Char('0')) << "]\n";
+            configStream << AMOUNT_DUE_KEY << "=" << QString::number(10 + billIndex % 990) << "." << QString::number(billIndex % 100).rightJustified(2, QLatin1Char('0')) << "\n";
+
+            if(billIndex % 4 == 0)
+            {
+                configStream << CATEGORY_KEY << "=Utilities\n";
+            }
+
+            configStream << CURRENCY_KEY << "=" << (billIndex % 10 == 0 ? "EUR" : "USD") << "\n";
+            configStream << DUE_DATE_KEY << "=" << QDate(2026, 1 + billIndex % 12, 1 + billIndex % 28).toString(DATE_STRING_FORMAT) << "\n";
+            configStream << "FundingStatus=" << (billIndex % 2 == 0 ? FUNDED_STRING : "Not Funded") << "\n";
+
+            if(billIndex % 8 == 0)
+            {
+                configStream << TAGS_KEY << "=\"home, monthly\"\n";
+            }
+        }
+
+        configStream.flush();
+        return configStream.status() == QTextStream::Ok;
+    }
+
+    /**
+     * @brief Loads a config file through QSettings, splitting every key and converting every value into a string, as the PFT did before it staged bills in an arena.
+     * @param p_filePath - The path of the file.
+     * @param p_loadedLedger - The snapshot to fill in.
+     */
+    void loadWithSettings(const QString &p_filePath, LedgerSnapshot &p_loadedLedger)
+    {
+        QSettings configSettings(p_filePath, QSettings::IniFormat);
+        QStringList configFileKeys = configSettings.allKeys();
+
+        for(const QString &configFileKey : configFileKeys)
+        {
+            QStringList splitKeys = configFileKey.split(QLatin1Char('/'));
+
+            if(splitKeys.size() < 2)
+            {
+                continue;
+            }
+
+            QString groupLabel = splitKeys.at(0);
+            QString keyLabel = splitKeys.at(1);
+            QVariant keyVariant = configSettings.value(configFileKey);
+            QString keyValue = keyVariant.userType() == QMetaType::QStringList ? keyVariant.toStringList().join(", ") : keyVariant.toString();
+
+            if(groupLabel == FUNDS_INFORMATION_GROUP_LABEL)
+            {
+                if(keyLabel == TOTAL_FUNDS_AVAILABLE_KEY)
+                {
+                    p_loadedLedger.totalAmountAvailable = keyValue.toDouble();
+                }
+
+                continue;
+            }
+
+            // The first key of a bill, its amount due, inserts it into the map
+            QMap<QString, Bill>::iterator billMapIterator = p_loadedLedger.billMap.find(groupLabel);
+
+            if(billMapIterator == p_loadedLedger.billMap.end())
+            {
+                Bill &readBill = p_loadedLedger.billMap[groupLabel];
+                readBill.setName(groupLabel);
+                readBill.setAmountDue(keyValue.toDouble());
+            }
+            else if(keyLabel == DUE_DATE_KEY)
+            {
+                billMapIterator->setDueDate(QDate::fromString(keyValue.simplified().replace(" ", ""), DATE_STRING_FORMAT));
+            }
+            else if(keyLabel == CURRENCY_KEY)
+            {
+                billMapIterator->setCurrencyCode(keyValue);
+            }
+            else if(keyLabel == CATEGORY_KEY)
+            {
+                billMapIterator->setCategory(keyValue.trimmed());
+            }
+            else if(keyLabel == TAGS_KEY)
+            {
+                billMapIterator->setTags(CategoryRollup::splitTags(keyValue));
+            }
+            else
+            {
+                billMapIterator->setFundedStatus(keyValue == FUNDED_STRING);
+
+                if(billMapIterator->isFunded())
+                {
+                    p_loadedLedger.fundedBillsList.append(billMapIterator->getName());
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief The ArenaChunk struct holds one chunk of the config file and what one worker reads from it into its own arena.
+     */
+    struct ArenaChunk
+    {
+        int firstByteIndex = 0; //!< The offset of the first byte of the chunk.
+        int endByteIndex = 0; //!< The offset one past the last byte of the chunk.
+        std::shared_ptr<LoadArena> loadArena; //!< The arena the chunk's decoded text and staged bills are allocated from.
+        std::shared_ptr<StagedLedger> stagedLedger; //!< The bills read from the chunk.
+        double totalAmountAvailable = -1.0; //!< The total amount available read from the chunk, negative if it held none.
+        size_t arenaReservedBytes = 0; //!< The number of bytes the arena held at its largest.
+        int arenaBlockCount = 0; //!< The number of blocks the arena allocated.
+    };
+
+    /**
+     * @brief Reads one chunk of a config file the way the PFT does, decoding it with a ConfigFileReader, staging the bills in the chunk's LoadArena, and building them.
+     * @param p_configFileContents - The contents of the file.
+     * @param p_chunk - The chunk to read.
+     */
+    void loadArenaChunk(const QByteArray &p_configFileContents, ArenaChunk &p_chunk)
+    {
+        ConfigFileReader configFileReader(p_configFileContents, p_chunk.firstByteIndex, p_chunk.endByteIndex, *p_chunk.loadArena);
+        StagedLedger &stagedLedger = *p_chunk.stagedLedger;
+        ConfigFileReader::Entry configEntry;
+
+        while(configFileReader.readEntry(configEntry))
+        {
+            if(configEntry.groupLabel.isEmpty())
+            {
+                continue;
+            }
+
+            if(configEntry.groupLabel == FUNDS_INFORMATION_GROUP_LABEL)
+            {
+                if(configEntry.key == TOTAL_FUNDS_AVAILABLE_KEY)
+                {
+                    p_chunk.totalAmountAvailable = configEntry.value.toDouble();
+                }
+
+                continue;
+            }
+
+            stagedLedger.stageBill(configEntry.groupLabel);
+
+            if(configEntry.key == AMOUNT_DUE_KEY)
+            {
+                stagedLedger.setAmountDue(configEntry.value.toDouble());
+            }
+            else if(configEntry.key == DUE_DATE_KEY)
+            {
+                stagedLedger.setDueDate(StagedLedger::parseDate(configEntry.value));
+            }
+            else if(configEntry.key == CURRENCY_KEY)
+            {
+                stagedLedger.setCurrencyCode(configEntry.value);
+            }
+            else if(configEntry.key == CATEGORY_KEY)
+            {
+                stagedLedger.setCategory(configEntry.value.trimmed());
+            }
+            else if(configEntry.key == TAGS_KEY)
+            {
+                stagedLedger.setTags(configEntry.value);
+            }
+            else
+            {
+                stagedLedger.setFundedStatus(configEntry.value == FUNDED_STRING);
+            }
+        }
+
+        // Build the chunk's bills on this thread and give back its arena, as the PFT does
+        stagedLedger.buildBills();
+        p_chunk.arenaReservedBytes = p_chunk.loadArena->getReservedBytes();
+        p_chunk.arenaBlockCount = p_chunk.loadArena->getBlockCount();
+        p_chunk.loadArena->release();
+    }
+
+    /**
+     * @brief Loads a config file the way the PFT does, splitting it into chunks at section headers which are read concurrently, then merging their bills in file order.
+     * @param p_filePath - The path of the file.
+     * @param p_threadCount - The number of chunks to split the file into, at most.
+     * @param p_loadedLedger - The snapshot to fill in.
+     * @param p_chunkCount - Receives the number of chunks the file was split into.
+     * @param p_arenaReservedBytes - Receives the number of bytes the chunks' arenas held at their largest, added together.
+     * @param p_arenaBlockCount - Receives the number of blocks the chunks' arenas allocated.
+     */
+    void loadWithArena(const QString &p_filePath, int p_threadCount, LedgerSnapshot &p_loadedLedger, int &p_chunkCount, size_t &p_arenaReservedBytes, int &p_arenaBlockCount)
+    {
+        QFile configFile(p_filePath);
+        QByteArray configFileContents = configFile.open(QIODevice::ReadOnly) ? configFile.readAll() : QByteArray();
+
+        QVector<int> chunkBoundaries = ConfigFileReader::findChunkBoundaries(configFileContents, p_threadCount);
+        QVector<ArenaChunk> chunks;
+
+        for(int chunkIndex = 0; chunkIndex + 1 < chunkBoundaries.size(); chunkIndex++)
+        {
+            ArenaChunk chunk;
+            chunk.firstByteIndex = chunkBoundaries.at(chunkIndex);
+            chunk.endByteIndex = chunkBoundaries.at(chunkIndex + 1);
+            chunk.loadArena = std::make_shared<LoadArena>(static_cast<size_t>(chunk.endByteIndex - chunk.firstByteIndex) * ARENA_BYTES_PER_FILE_BYTE);
+            chunk.stagedLedger = std::make_shared<StagedLedger>(*chunk.loadArena);
+            chunks.append(chunk);
+        }
+
+        // A single chunk is read on the calling thread, several are read concurrently
+        auto loadChunk = [&configFileContents](ArenaChunk &p_chunk)
+        {
+            loadArenaChunk(configFileContents, p_chunk);
+        };
+
+        if(chunks.size() == 1)
+        {
+            loadChunk(chunks.first());
+        }
+        else
+        {
+            QtConcurrent::blockingMap(chunks, loadChunk);
+        }
+
+        QVector<StagedLedger*> stagedLedgers;
+        p_chunkCount = chunks.size();
+        p_arenaReservedBytes = 0;
+        p_arenaBlockCount = 0;
+
+        for(const ArenaChunk &chunk : chunks)
+        {
+            if(chunk.totalAmountAvailable >= 0.0)
+            {
+                p_loadedLedger.totalAmountAvailable = chunk.totalAmountAvailable;
+            }
+
+            stagedLedgers.append(chunk.stagedLedger.get());
+            p_arenaReservedBytes += chunk.arenaReservedBytes;
+            p_arenaBlockCount += chunk.arenaBlockCount;
+        }
+
+        StagedLedger::mergeInto(stagedLedgers, p_loadedLedger);
+    }
+
+    /**
+     * @brief Returns the keys and values QSettings writes into the generated config file the parser is checked against, between them covering every escape QSettings writes.
+     * @return Map of (full key, value), a full key being a group label and key joined by "/".
+     */
+    QMap<QString, QVariant> verifyConfigValues()
+    {
+        QMap<QString, QVariant> configValues;
+
+        // Values needing quotes, backslash escapes, hexadecimal and octal escapes, UTF-8, or a doubled leading "@"
+        QStringList escapedValues = {"plain", "", "  padded  ", "   ", "\tleading tab", "trailing tab\t", "comma, separated", "semi;colon", " ; comment-like", "equals=sign",
+                                     "quote\"inside", "\"fully quoted\"", "quote at end\"", "back\\slash", "trailing backslash\\", "line\nbreak", "carriage\rreturn", "crlf\r\nend",
+                                     "bell\a backspace\b formfeed\f vtab\v", QString("control") + QChar(0x01) + "1", QString("unit separator") + QChar(0x1F) + "F", QString("nul") + QChar(0x00) + "7",
+                                     QString("delete") + QChar(0x7F), "@at", "@@double", "@ByteArray", "#hash", "[bracket]", "%percent", QString::fromUtf8("caf\xC3\xA9"),
+                                     QString::fromUtf8("\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E"), QString::fromUtf8("na\xC3\xAFve, r\xC3\xA9sum\xC3\xA9")};
+
+        for(int valueIndex = 0; valueIndex < escapedValues.size(); valueIndex++)
+        {
+            configValues.insert("Values/value" + QString::number(valueIndex), escapedValues.at(valueIndex));
+        }
+
+        // Lists, which QSettings writes with unquoted commas between the items
+        configValues.insert("Values/list0", QStringList({"alpha", "beta"}));
+        configValues.insert("Values/list1", QStringList({"with, comma", "plain"}));
+        configValues.insert("Values/list2", QStringList({" spaced ", "x"}));
+        configValues.insert("Values/list3", QStringList({"quote\"d", "line\nbreak", "tab\t"}));
+
+        // Keys, which QSettings percent encodes, writing slashes as backslashes
+        QStringList escapedKeys = {"Key%", QString::fromUtf8("\xD0\x9A\xD0\xBB\xD1\x8E\xD1\x87"), "sub/key", "key with spaces", "key=equals", "key;semi", "key\"quote", "key#hash",
+                                   QString::fromUtf8("caf\xC3\xA9"), "UPPER_lower-dot.", "[bracket]", "%U0041"};
+
+        for(const QString &escapedKey : escapedKeys)
+        {
+            configValues.insert("Keys/" + escapedKey, "value");
+        }
+
+        // Group labels, including one really named General and keys outside any group, which QSettings writes into the General section
+        QStringList escapedGroupLabels = {"Bill %20 50%", QString::fromUtf8("Caf\xC3\xA9"), QString::fromUtf8("\xE6\x97\xA5\xE6\x9C\xAC"), "Semi;Group=Label", "General"};
+
+        for(const QString &escapedGroupLabel : escapedGroupLabels)
+        {
+            configValues.insert(escapedGroupLabel + "/" + AMOUNT_DUE_KEY, "12.34");
+        }
+
+        configValues.insert("TopLevel", "outside any group");
+        return configValues;
+    }
+
+    /**
+     * @brief Returns a hand-edited config file the parser is checked against, with what QSettings reads but never writes, such as unquoted lists, line continuations, escapes QSettings
+     * does not write, comments, and quoted values running over several lines. Lines starting with "#" are left out, the ConfigFileReader deliberately reading them as comments.
+     * @param p_lineBreak - The line break the file uses.
+     * @return The contents of the file.
+     */
+    QByteArray handEditedConfigFile(const QByteArray &p_lineBreak)
+    {
+        QByteArrayList lines = {"[Hand]", "unquotedList = a , b,c  ", "quotedItems = \"x, y\" , z", "emptyItem = a,,b", "continued = first \\", "  second", "octal = \\101\\102x",
+                                "hex = \\x41\\x4a\\x4Z", "hexWithoutDigits = a\\xzb", "unknownEscape = a\\qb", "tabbed = \\tx\\t", "trailingComment = value ; comment",
+                                "quotedSemicolon = \"a;b\"", "quotedEquals = \"a=b\"", "mixedQuotes = pre\"quoted part\"post  ", "spacedQuotes = \"  kept  \"  ", "emptyValue =",
+                                "   indentedKey   =   value   ", "; a comment line", "doubleAt = @@at", "singleAt = @at", "caf\xC3\xA9 = \xE6\x97\xA5\xE6\x9C\xAC",
+                                "quotedLines = \"first", "second\"", "quotedHeader = \"first", "[NotAHeader]\"", "trailingBackslash = value\\",
+                                "", "  [  Spaced Label  ]  ", "key=value", "[general]", "rootKey=root", "[%general]", "groupKey=group", "[Bill%41%U00e9\\Sub]", "key=value"};
+
+        return lines.join(p_lineBreak) + p_lineBreak;
+    }
+
+    /**
+     * @brief Reads every value of a config file through QSettings, joining lists with ", " as the PFT always has.
+     * @param p_filePath - The path of the file.
+     * @return Map of (full key, value).
+     */
+    QMap<QString, QString> readWithSettings(const QString &p_filePath)
+    {
+        QMap<QString, QString> configValues;
+        QSettings configSettings(p_filePath, QSettings::IniFormat);
+
+        for(const QString &configFileKey : configSettings.allKeys())
+        {
+            QVariant keyVariant = configSettings.value(configFileKey);
+            configValues.insert(configFileKey, keyVariant.userType() == QMetaType::QStringList ? keyVariant.toStringList().join(", ") : keyVariant.toString());
+        }
+
+        return configValues;
+    }
+
+    /**
+     * @brief Reads every value of a config file's contents with the ConfigFileReader, as the PFT loads the file.
+     * @param p_fileContents - The contents of the file.
+     * @return Map of (full key, value).
+     */
+    QMap<QString, QString> readWithConfigFileReader(const QByteArray &p_fileContents)
+    {
+        QMap<QString, QString> configValues;
+        LoadArena loadArena;
+        ConfigFileReader configFileReader(p_fileContents, loadArena);
+        ConfigFileReader::Entry configEntry;
+
+        while(configFileReader.readEntry(configEntry))
+        {
+            configValues.insert(configEntry.groupLabel.isEmpty() ? configEntry.key.toString() : configEntry.groupLabel.toString() + "/" + configEntry.key.toString(), configEntry.value.toString());
+        }
+
+        return configValues;
+    }
+
+    /**
+     * @brief Reads every value of a config file's contents section by section with the ConfigSectionIndex, as the PFT re-reads externally edited sections and merges on save.
+     * @param p_fileContents - The contents of the file.
+     * @return Map of (full key, value).
+     */
+    QMap<QString, QString> readWithConfigSectionIndex(const QByteArray &p_fileContents)
+    {
+        QMap<QString, QString> configValues;
+
+        for(const ConfigSectionIndex::SectionSpan &sectionSpan : ConfigSectionIndex::splitSections(p_fileContents))
+        {
+            QHash<QString, QString> sectionValues = ConfigSectionIndex::parseSection(p_fileContents, sectionSpan);
+
+            for(QHash<QString, QString>::const_iterator sectionIterator = sectionValues.constBegin(); sectionIterator != sectionValues.constEnd(); ++sectionIterator)
+            {
+                configValues.insert(sectionSpan.groupLabel.isEmpty() ? sectionIterator.key() : sectionSpan.groupLabel + "/" + sectionIterator.key(), sectionIterator.value());
+            }
+        }
+
+        return configValues;
+    }
+
+    /**
+     * @brief Shows control characters and non-ASCII text as escapes, so mismatched values can be told apart in the output.
+     * @param p_text - The text.
+     * @return The text in quotes with its special characters escaped.
+     */
+    QString describeText(const QString &p_text)
+    {
+        QString describedText = "\"";
+
+        for(QChar character : p_text)
+        {
+            describedText += character.unicode() < 0x20 || character.unicode() >= 0x7F ? QString("\\u%1").arg(static_cast<uint>(character.unicode()), 4, 16, QLatin1Char('0')) : QString(character);
+        }
+
+        return describedText + "\"";
+    }
+
+    /**
+     * @brief Compares what a parser read against what QSettings read, listing every difference.
+     * @param p_description - What was read and by which parser.
+     * @param p_settingsValues - The values QSettings read.
+     * @param p_parsedValues - The values the parser read.
+     * @param p_output - The stream differences are listed on.
+     * @return The number of keys which differ.
+     */
+    int compareWithSettings(const QString &p_description, const QMap<QString, QString> &p_settingsValues, const QMap<QString, QString> &p_parsedValues, QTextStream &p_output)
+    {
+        QStringList fullKeys = p_settingsValues.keys() + p_parsedValues.keys();
+        fullKeys.removeDuplicates();
+        int mismatchCount = 0;
+
+        for(const QString &fullKey : fullKeys)
+        {
+            if(p_settingsValues.contains(fullKey) && p_parsedValues.contains(fullKey) && p_settingsValues.value(fullKey) == p_parsedValues.value(fullKey))
+            {
+                continue;
+            }
+
+            p_output << "  " << p_description << ": " << describeText(fullKey) << " is " << (p_settingsValues.contains(fullKey) ? describeText(p_settingsValues.value(fullKey)) : "missing")
+                     << " through QSettings but " << (p_parsedValues.contains(fullKey) ? describeText(p_parsedValues.value(fullKey)) : "missing") << Qt::endl;
+            mismatchCount++;
+        }
+
+        return mismatchCount;
+    }
+
+    /**
+     * @brief Checks that the ConfigFileReader and ConfigSectionIndex read a config file written by QSettings, and hand-edited ones with either line break, exactly as QSettings does.
+     * @param p_directoryPath - The directory the files are written to.
+     * @param p_output - The stream the results are written to.
+     * @return The number of keys read differently, zero if the parsers match QSettings.
+     */
+    int verifyParser(const QString &p_directoryPath, QTextStream &p_output)
+    {
+        QMap<QString, QByteArray> configFiles;
+
+        // Let QSettings write the generated file, so it is escaped exactly as the PFT's saves were
+        QString generatedFilePath = p_directoryPath + "/Generated.ini";
+
+        {
+            QSettings configSettings(generatedFilePath, QSettings::IniFormat);
+            QMap<QString, QVariant> configValues = verifyConfigValues();
+
+            for(QMap<QString, QVariant>::const_iterator valueIterator = configValues.constBegin(); valueIterator != configValues.constEnd(); ++valueIterator)
+            {
+                configSettings.setValue(valueIterator.key(), valueIterator.value());
+            }
+
+            configSettings.sync();
+        }
+
+        QFile generatedFile(generatedFilePath);
+        configFiles.insert(generatedFilePath, generatedFile.open(QIODevice::ReadOnly) ? generatedFile.readAll() : QByteArray());
+
+        // Write the hand-edited file with both line breaks
+        configFiles.insert(p_directoryPath + "/HandEditedLf.ini", handEditedConfigFile("\n"));
+        configFiles.insert(p_directoryPath + "/HandEditedCrLf.ini", handEditedConfigFile("\r\n"));
+        int mismatchCount = 0;
+
+        for(QMap<QString, QByteArray>::const_iterator fileIterator = configFiles.constBegin(); fileIterator != configFiles.constEnd(); ++fileIterator)
+        {
+            QFile configFile(fileIterator.key());
+
+            if(fileIterator.key() != generatedFilePath && (!configFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || configFile.write(fileIterator.value()) != fileIterator.value().size()))
+            {
+                p_output << "Could not write " << fileIterator.key() << Qt::endl;
+                return 1;
+            }
+
+            configFile.close();
+
+            // Compare both of the PFT's ways of reading the file against QSettings
+            QString fileName = QFileInfo(fileIterator.key()).fileName();
+            QMap<QString, QString> settingsValues = readWithSettings(fileIterator.key());
+            int fileMismatchCount = compareWithSettings(fileName + " read whole", settingsValues, readWithConfigFileReader(fileIterator.value()), p_output);
+            fileMismatchCount += compareWithSettings(fileName + " read by section", settingsValues, readWithConfigSectionIndex(fileIterator.value()), p_output);
+
+            p_output << fileName << ": " << settingsValues.size() << " keys, " << fileMismatchCount << " read differently from QSettings" << Qt::endl;
+            mismatchCount += fileMismatchCount;
+        }
+
+        return mismatchCount;
+    }
+
+    /**
+     * @brief Formats a number of bytes in mebibytes.
+     * @param p_byteCount - The number of bytes.
+     * @return The formatted size.
+     */
+    QString formatMebibytes(qint64 p_byteCount)
+    {
+        return QString::number(p_byteCount / (1024.0 * 1024.0), 'f', 1) + " MiB";
+    }
+}
+
+
+#if defined(__GLIBC__)
+/**
+ * @brief Replaces glibc's malloc, counting the allocation while the file is loaded. The PFT itself keeps glibc's malloc.
+ * @param p_byteCount - The number of bytes requested.
+ * @return The memory, or null if it could not be allocated.
+ */
+extern "C" void* malloc(size_t p_byteCount) noexcept
+{
+    countMalloc(p_byteCount);
+    return __libc_malloc(p_byteCount);
+}
+
+/**
+ * @brief Replaces glibc's calloc, counting the allocation while the file is loaded.
+ * @param p_elementCount - The number of elements requested.
+ * @param p_elementSize - The size of each element in bytes.
+ * @return The zeroed memory, or null if it could not be allocated.
+ */
+extern "C" void* calloc(size_t p_elementCount, size_t p_elementSize) noexcept
+{
+    countMalloc(p_elementCount * p_elementSize);
+    return __libc_calloc(p_elementCount, p_elementSize);
+}
+
+/**
+ * @brief Replaces glibc's realloc, counting it as an allocation while the file is loaded, as growing a buffer usually moves it.
+ * @param p_memory - The memory to resize, which may be null.
+ * @param p_byteCount - The number of bytes requested.
+ * @return The resized memory, or null if it could not be allocated.
+ */
+extern "C" void* realloc(void *p_memory, size_t p_byteCount) noexcept
+{
+    countMalloc(p_byteCount);
+    return __libc_realloc(p_memory, p_byteCount);
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication application(argc, argv);
+    QTextStream output(stdout);
+
+    // Read the options
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures the time, heap allocations, and peak memory of loading a config file. Run once per loader, since the peak memory of a process never goes down.");
+    parser.addHelpOption();
+    QCommandLineOption loaderOption("loader", "Loader to measure, arena (the PFT's) or settings (QSettings, as the PFT used to load).", "loader", ARENA_LOADER);
+    QCommandLineOption billsOption("bills", "Number of bills in the generated config file.", "count", "100000");
+    QCommandLineOption fileOption("file", "Load an existing config file instead of generating one.", "path");
+    QCommandLineOption threadsOption("threads", "Number of chunks the arena loader reads concurrently, one per core by default.", "count", QString::number(QThread::idealThreadCount()));
+    QCommandLineOption verifyOption("verify", "Check that the arena loader reads config files exactly as QSettings does, then exit without measuring anything.");
+    parser.addOptions({loaderOption, billsOption, fileOption, threadsOption, verifyOption});
+    parser.process(application);
+
+    // Compare the PFT's parser against QSettings, failing if any key is read differently
+    QTemporaryDir temporaryDirectory;
+
+    if(parser.isSet(verifyOption))
+    {
+        if(!temporaryDirectory.isValid())
+        {
+            output << "Could not create a directory for the config files" << Qt::endl;
+            return 1;
+        }
+
+        return verifyParser(temporaryDirectory.path(), output) == 0 ? 0 : 1;
+    }
+
+    QString loader = parser.value(loaderOption);
+
+    if(loader != ARENA_LOADER && loader != SETTINGS_LOADER)
+    {
+        output << "Unknown loader \"" << loader << "\", expected " << ARENA_LOADER << " or " << SETTINGS_LOADER << Qt::endl;
+        return 1;
+    }
+
+    // Generate the config file unless one was given
+    QString configFilePath = parser.value(fileOption);
+
+    if(configFilePath.isEmpty())
+    {
+        configFilePath = temporaryDirectory.filePath("PersonalFinanceTool.ini");
+
+        if(!temporaryDirectory.isValid() || !writeConfigFile(configFilePath, qMax(parser.value(billsOption).toInt(), 0)))
+        {
+            output << "Could not write the config file" << Qt::endl;
+            return 1;
+        }
+    }
+
+    // Load the file, counting the allocations made during the load alone
+    LedgerSnapshot loadedLedger;
+    size_t arenaReservedBytes = 0;
+    int arenaBlockCount = 0;
+    int chunkCount = 1;
+    qint64 peakBytesBefore = peakResidentBytes();
+    QElapsedTimer loadTimer;
+
+    Profiler::setEnabled(true);
+    isCountingMalloc.store(true, std::memory_order_relaxed);
+    loadTimer.start();
+
+    if(loader == ARENA_LOADER)
+    {
+        loadWithArena(configFilePath, qMax(parser.value(threadsOption).toInt(), 1), loadedLedger, chunkCount, arenaReservedBytes, arenaBlockCount);
+    }
+    else
+    {
+        loadWithSettings(configFilePath, loadedLedger);
+    }
+
+    qint64 loadNsecs = loadTimer.nsecsElapsed();
+    isCountingMalloc.store(false, std::memory_order_relaxed);
+    Profiler::setEnabled(false);
+    qint64 peakBytesAfter = peakResidentBytes();
+    quint64 newCount = Profiler::getAllocationCount();
+    int billCount = loadedLedger.billMap.size();
+
+    output << "Loader:       " << loader << ", " << billCount << " bills from " << QFileInfo(configFilePath).size() << " bytes" << Qt::endl;
+    output << "Load time:    " << QString::number(loadNsecs / 1000000.0, 'f', 1) << " ms (" << QString::number(billCount * 1.0e9 / qMax<qint64>(loadNsecs, 1), 'f', 0) << " bills/s)" << Qt::endl;
+
+    // Qt allocates the buffers of its strings and containers with malloc, so only counting malloc gives every heap allocation, otherwise only the calls to operator new are shown
+    if(IS_MALLOC_COUNTED)
+    {
+        quint64 allocationCount = mallocCount.load(std::memory_order_relaxed);
+        output << "Allocations:  " << allocationCount << " malloc calls (" << QString::number(static_cast<double>(allocationCount) / qMax(billCount, 1), 'f', 1) << " per bill), "
+               << formatMebibytes(static_cast<qint64>(mallocBytes.load(std::memory_order_relaxed))) << ", " << newCount << " of them through operator new" << Qt::endl;
+    }
+    else
+    {
+        output << "Allocations:  " << newCount << " operator new calls (" << QString::number(static_cast<double>(newCount) / qMax(billCount, 1), 'f', 1) << " per bill), "
+               << formatMebibytes(static_cast<qint64>(Profiler::getAllocatedBytes())) << ", malloc calls are not counted on this platform" << Qt::endl;
+    }
+
+    output << "Peak RSS:     " << formatMebibytes(peakBytesAfter) << " (" << formatMebibytes(peakBytesAfter - peakBytesBefore) << " above the peak before loading)" << Qt::endl;
+
+    if(loader == ARENA_LOADER)
+    {
+        output << "Arena:        " << chunkCount << " chunk(s) read concurrently, " << arenaBlockCount << " block(s), " << formatMebibytes(static_cast<qint64>(arenaReservedBytes)) << " reserved, released after the load" << Qt::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1039 @@
+/*##################################################################################
+#   File name:          main.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Main file for pft, the PersonalFinanceTool's command-line tool
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/cli/
+##################################################################################*/
+
+#include "BalanceHistory.h"
+#include "BillKeyIndex.h"
+#include "BillPasteParser.h"
+#include "CategoryRollup.h"
+#include "CurrencyRegistry.h"
+#include "ExchangeRateTable.h"
+#include "LedgerFunds.h"
+#include "LedgerStore.h"
+#include "LoanBook.h"
+#include "TransactionLedger.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+#include <cmath>
+
+namespace
+{
+    const QString DEFAULT_CONFIG_FILE_PATH = "config/PersonalFinanceTool.ini"; //!< The config file the PFT reads, relative to the directory it is run from.
+    const QString EXCHANGE_RATE_FILE_NAME = "ExchangeRates.ini"; //!< The exchange rate file, kept beside the config file.
+    const QString LEDGER_FILE_SUFFIX = ".ledger"; //!< The suffix of the transaction ledger, kept beside the config file under the same base name.
+    const QString LOAN_FILE_NAME = "Loans.ini"; //!< The loan terms, kept beside the config file.
+    const QString HISTORY_FILE_SUFFIX = ".history"; //!< The suffix of the balance history, kept beside the config file under the same base name.
+
+    const QString LIST_COMMAND = "list"; //!< Lists every bill.
+    const QString DUE_BEFORE_COMMAND = "due-before"; //!< Lists the bills due before a date.
+    const QString FUNDED_COMMAND = "funded"; //!< Lists the funded bills.
+    const QString TOTALS_COMMAND = "totals"; //!< Reports the amount available, the amount left to fund, and the number of bills.
+    const QString ADD_COMMAND = "add"; //!< Adds bills from rows in the bill widget's paste format.
+    const QString FUND_COMMAND = "fund"; //!< Funds bills.
+    const QString DEFUND_COMMAND = "defund"; //!< Releases the funds of bills.
+    const QString DELETE_COMMAND = "delete"; //!< Deletes bills.
+    const QString CONVERT_COMMAND = "convert"; //!< Converts bills between file formats.
+    const QString LOANS_COMMAND = "loans"; //!< Summarizes the loans, or lists the schedule of one.
+    const QString HISTORY_COMMAND = "history"; //!< Lists the totals saved over a range of days.
+
+    const QString TEXT_FORMAT = "text"; //!< Tab separated output, one bill per line.
+    const QString CSV_FORMAT = "csv"; //!< CSV output with a header row, in the bill widget's paste column order.
+    const QString JSON_FORMAT = "json"; //!< JSON output, using the same names as automation responses.
+    const QString INI_FORMAT = "ini"; //!< The config file format, only used by convert.
+    const QString STANDARD_STREAM_PATH = "-"; //!< Path standing for standard input or output.
+
+    const QString AUTOMATIC_RESOLUTION = "auto"; //!< Lists the history at the finest resolution which fits in MAX_AUTOMATIC_HISTORY_ROW_COUNT rows.
+    const QStringList RESOLUTION_NAMES = {"saves", "daily", "weekly", "monthly"}; //!< The names of the history resolutions, in the order of BalanceHistory::Resolution.
+    const int MAX_AUTOMATIC_HISTORY_ROW_COUNT = 200; //!< The most rows the history is listed in when its resolution is chosen automatically.
+    const int DEFAULT_HISTORY_RANGE_MONTHS = 3; //!< How many months before today the history covers when no start is given.
+
+    const QString AMOUNT_AVAILABLE_JSON_KEY = "amountAvailable"; //!< The key of the amount available.
+    const QString LEFT_TO_FUND_JSON_KEY = "leftToFund"; //!< The key of the amount due of the unfunded bills.
+    const QString BILL_COUNT_JSON_KEY = "billCount"; //!< The key of the number of bills.
+    const QString FUNDED_BILL_COUNT_JSON_KEY = "fundedBillCount"; //!< The key of the number of funded bills.
+    const QString MISSING_RATES_JSON_KEY = "missingRates"; //!< The key of the currencies left out of the left to fund total for lack of a rate.
+    const QString BILLS_JSON_KEY = "bills"; //!< The key of the list of bills.
+    const QString KEY_JSON_KEY = "key"; //!< The key of a bill's bill map key.
+    const QString NAME_JSON_KEY = "name"; //!< The key of a bill's name.
+    const QString AMOUNT_DUE_JSON_KEY = "amountDue"; //!< The key of a bill's amount due.
+    const QString DUE_DATE_JSON_KEY = "dueDate"; //!< The key of a bill's due date, in the config file's date format.
+    const QString CURRENCY_JSON_KEY = "currency"; //!< The key of a currency code.
+    const QString CATEGORY_JSON_KEY = "category"; //!< The key of a bill's category.
+    const QString TAGS_JSON_KEY = "tags"; //!< The key of a bill's tags, an array of strings.
+    const QString FUNDED_JSON_KEY = "funded"; //!< The key saying whether or not a bill is funded.
+    const QString FUNDING_STATUS_COLUMN_TITLE = "Funding Status"; //!< The title of the CSV column following the paste format's columns.
+    const QString BALANCE_JSON_KEY = "balance"; //!< The key of a loan's balance today, or of the balance left after a payment.
+    const QString PAYMENT_JSON_KEY = "payment"; //!< The key of a loan's scheduled monthly payment, or of the amount of a payment.
+    const QString PAYOFF_DATE_JSON_KEY = "payoffDate"; //!< The key of the date of a loan's last payment.
+    const QString INTEREST_JSON_KEY = "interest"; //!< The key of the interest paid over a loan's life, or by a payment.
+    const QString WHAT_IF_PAYOFF_DATE_JSON_KEY = "whatIfPayoffDate"; //!< The key of the date of a loan's last payment with the extra payment.
+    const QString MONTHS_SAVED_JSON_KEY = "monthsSaved"; //!< The key of how many fewer payments the extra payment takes.
+    const QString INTEREST_SAVED_JSON_KEY = "interestSaved"; //!< The key of how much less interest the extra payment costs.
+    const QString PAYMENT_NUMBER_JSON_KEY = "number"; //!< The key of the number of a payment.
+    const QString DATE_JSON_KEY = "date"; //!< The key of the date of a payment.
+    const QString PRINCIPAL_JSON_KEY = "principal"; //!< The key of the part of a payment which pays down the balance.
+    const QString PERIOD_JSON_KEY = "period"; //!< The key of the start of a history period, or the time of a single save.
+    const QString OPEN_JSON_KEY = "open"; //!< The key of the amount available at a period's first save.
+    const QString CLOSE_JSON_KEY = "close"; //!< The key of the amount available at a period's last save.
+    const QString LOW_JSON_KEY = "low"; //!< The key of the lowest amount available during a period.
+    const QString HIGH_JSON_KEY = "high"; //!< The key of the highest amount available during a period.
+    const QString FUNDED_TOTAL_JSON_KEY = "fundedTotal"; //!< The key of the amount due of the funded bills at a period's last save.
+    const QString OUTSTANDING_JSON_KEY = "outstanding"; //!< The key of the amount due of the unfunded bills at a period's last save.
+    const QString SAVES_JSON_KEY = "saves"; //!< The key of the number of saves in a period.
+
+    const int SUCCESS_EXIT_CODE = 0; //!< Everything requested was done.
+    const int USAGE_EXIT_CODE = 1; //!< The command or its arguments were not understood, nothing was changed.
+    const int FILE_EXIT_CODE = 2; //!< A file could not be read or written, nothing was changed unless the bills were saved and only the ledger or balance history could not be written.
+    const int PARTIAL_EXIT_CODE = 3; //!< Some bills or rows were not found or invalid, the rest were changed.
+
+    /**
+     * @brief Returns whether or not a bill is due before a date, bills without a due date never being.
+     * @param p_bill - The bill.
+     * @param p_date - The date.
+     * @return True if the bill's due date is earlier than the date.
+     */
+    bool isDueBefore(const Bill &p_bill, const QDate &p_date)
+    {
+        return p_bill.getDueDate().isValid() && p_bill.getDueDate() < p_date;
+    }
+
+    /**
+     * @brief Reads a date given on the command line, as the config file writes them or as an ISO 8601 date.
+     * @param p_ledgerStore - The ledger store, which reads the config file's date format.
+     * @param p_dateText - The date as given.
+     * @return The date, or a null date if it is neither.
+     */
+    QDate readCommandLineDate(const LedgerStore &p_ledgerStore, const QString &p_dateText)
+    {
+        QDate date = p_ledgerStore.parseDate(p_dateText);
+        return date.isValid() ? date : QDate::fromString(p_dateText, Qt::ISODate);
+    }
+
+    /**
+     * @brief Quotes a CSV field if it holds a comma, quote, or line break, doubling any quotes.
+     * @param p_field - The field.
+     * @return The field as written to a CSV file.
+     */
+    QString quoteCsvField(QString p_field)
+    {
+        if(!p_field.contains(QLatin1Char(',')) && !p_field.contains(QLatin1Char('"')) && !p_field.contains(QLatin1Char('\n')))
+        {
+            return p_field;
+        }
+
+        return QLatin1Char('"') + p_field.replace(QLatin1Char('"'), QLatin1String("\"\"")) + QLatin1Char('"');
+    }
+
+    /**
+     * @brief Describes a bill in the form automation responses use.
+     * @param p_ledgerStore - The ledger store, which formats the due date.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     * @return The bill as a JSON object.
+     */
+    QJsonObject billToJson(const LedgerStore &p_ledgerStore, const QString &p_billKey, const Bill &p_bill)
+    {
+        QJsonObject billObject;
+        billObject.insert(KEY_JSON_KEY, p_billKey);
+        billObject.insert(NAME_JSON_KEY, p_bill.getName());
+        billObject.insert(AMOUNT_DUE_JSON_KEY, p_bill.getAmountDue());
+        billObject.insert(DUE_DATE_JSON_KEY, p_ledgerStore.formatDate(p_bill.getDueDate()));
+        billObject.insert(CURRENCY_JSON_KEY, p_bill.getCurrencyCode());
+        billObject.insert(CATEGORY_JSON_KEY, p_bill.getCategory());
+        billObject.insert(TAGS_JSON_KEY, QJsonArray::fromStringList(p_bill.getTags()));
+        billObject.insert(FUNDED_JSON_KEY, p_bill.isFunded());
+        return billObject;
+    }
+
+    /**
+     * @brief Writes bills in one of the output formats.
+     * @param p_output - The stream written to.
+     * @param p_ledgerStore - The ledger store, which formats due dates and funding statuses.
+     * @param p_billMap - The bills, keyed by bill map key.
+     * @param p_format - The text, csv, or json format.
+     * @param p_includeBill - Decides which bills are written.
+     */
+    template <typename Predicate>
+    void writeBills(QTextStream &p_output, const LedgerStore &p_ledgerStore, const QMap<QString, Bill> &p_billMap, const QString &p_format, Predicate p_includeBill)
+    {
+        QJsonArray billArray;
+
+        if(p_format == CSV_FORMAT)
+        {
+            QStringList columnTitles;
+
+            for(int column = 0; column < BillPasteParser::PastedColumnCount; column++)
+            {
+                columnTitles.append(BillPasteParser::columnTitle(static_cast<BillPasteParser::PastedColumn>(column)));
+            }
+
+            columnTitles.append(FUNDING_STATUS_COLUMN_TITLE);
+            p_output << columnTitles.join(QLatin1Char(',')) << '\n';
+        }
+
+        for(QMap<QString, Bill>::const_iterator billMapIterator = p_billMap.cbegin(); billMapIterator != p_billMap.cend(); ++billMapIterator)
+        {
+            const Bill &bill = billMapIterator.value();
+
+            if(!p_includeBill(bill))
+            {
+                continue;
+            }
+
+            // Bills are written in the column order the bill widget accepts pasted bills in, so the output can be pasted or added back
+            QStringList fields = {bill.getName(), QString::number(bill.getAmountDue(), 'f', 2), p_ledgerStore.formatDate(bill.getDueDate()), bill.getCurrencyCode(), bill.getCategory(),
+                                  CategoryRollup::joinTags(bill.getTags()), p_ledgerStore.fundingStatusToString(bill.isFunded())};
+
+            if(p_format == JSON_FORMAT)
+            {
+                billArray.append(billToJson(p_ledgerStore, billMapIterator.key(), bill));
+            }
+            else if(p_format == CSV_FORMAT)
+            {
+                for(QString &field : fields)
+                {
+                    field = quoteCsvField(field);
+                }
+
+                p_output << fields.join(QLatin1Char(',')) << '\n';
+            }
+            else
+            {
+                p_output << fields.join(QLatin1Char('\t')) << '\n';
+            }
+        }
+
+        if(p_format == JSON_FORMAT)
+        {
+            p_output << QJsonDocument(billArray).toJson(QJsonDocument::Indented);
+        }
+    }
+
+    /**
+     * @brief Writes the amount available, the amount left to fund converted into its currency, and the number of bills.
+     * @param p_output - The stream written to.
+     * @param p_ledger - The bills and funds information.
+     * @param p_ledgerFunds - Converts bills into the currency of the amount available.
+     * @param p_format - The text or json format, csv being written as text.
+     */
+    void writeTotals(QTextStream &p_output, const LedgerSnapshot &p_ledger, const LedgerFunds &p_ledgerFunds, const QString &p_format)
+    {
+        // Sum the unfunded amounts per currency in one pass, then convert once per currency as the left to fund label does
+        LedgerFunds::BillTotals billTotals = LedgerFunds::totalBills(p_ledger.billMap);
+        int fundedBillCount = billTotals.fundedBillCount;
+        QStringList missingCurrencyCodes;
+        qint64 leftToFundCents = p_ledgerFunds.convertTotals(billTotals.unfundedCentsByCurrency, &missingCurrencyCodes);
+
+        if(p_format == JSON_FORMAT)
+        {
+            QJsonObject totalsObject;
+            totalsObject.insert(AMOUNT_AVAILABLE_JSON_KEY, p_ledger.totalAmountAvailable);
+            totalsObject.insert(CURRENCY_JSON_KEY, p_ledger.availableCurrencyCode);
+            totalsObject.insert(LEFT_TO_FUND_JSON_KEY, leftToFundCents / 100.0);
+            totalsObject.insert(BILL_COUNT_JSON_KEY, p_ledger.billMap.size());
+            totalsObject.insert(FUNDED_BILL_COUNT_JSON_KEY, fundedBillCount);
+            totalsObject.insert(MISSING_RATES_JSON_KEY, QJsonArray::fromStringList(missingCurrencyCodes));
+            p_output << QJsonDocument(totalsObject).toJson(QJsonDocument::Indented);
+            return;
+        }
+
+        p_output << "Amount available:\t" << QString::number(p_ledger.totalAmountAvailable, 'f', 2) << ' ' << p_ledger.availableCurrencyCode << '\n';
+        p_output << "Left to fund:\t" << QString::number(leftToFundCents / 100.0, 'f', 2) << ' ' << p_ledger.availableCurrencyCode;
+
+        // Mark the total when some bills had no rate and were left out of it
+        if(!missingCurrencyCodes.isEmpty())
+        {
+            p_output << " (excludes bills in " << missingCurrencyCodes.join(", ") << ", which have no rate)";
+        }
+
+        p_output << '\n' << "Bills:\t" << p_ledger.billMap.size() << " (" << fundedBillCount << " funded)" << '\n';
+    }
+
+    /**
+     * @brief Reads a JSON file written by convert into a LedgerSnapshot.
+     * @param p_filePath - The JSON file.
+     * @param p_ledgerStore - The ledger store, which reads due dates and names bill map keys.
+     * @param p_ledger - Receives the bills and funds information.
+     * @return False if the file could not be read or is not a JSON object.
+     */
+    bool readJsonLedger(const QString &p_filePath, const LedgerStore &p_ledgerStore, LedgerSnapshot &p_ledger)
+    {
+        QFile jsonFile(p_filePath);
+
+        if(!jsonFile.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        QJsonDocument jsonDocument = QJsonDocument::fromJson(jsonFile.readAll());
+
+        if(!jsonDocument.isObject())
+        {
+            return false;
+        }
+
+        QJsonObject ledgerObject = jsonDocument.object();
+        QString availableCurrencyCode = CurrencyRegistry::normalizeCode(ledgerObject.value(CURRENCY_JSON_KEY).toString());
+        p_ledger.totalAmountAvailable = ledgerObject.value(AMOUNT_AVAILABLE_JSON_KEY).toDouble();
+        p_ledger.availableCurrencyCode = availableCurrencyCode.isEmpty() ? CurrencyRegistry::defaultCurrencyCode() : availableCurrencyCode;
+
+        for(const QJsonValue &billValue : ledgerObject.value(BILLS_JSON_KEY).toArray())
+        {
+            QJsonObject billObject = billValue.toObject();
+            QStringList tags;
+            Bill bill;
+
+            for(const QJsonValue &tagValue : billObject.value(TAGS_JSON_KEY).toArray())
+            {
+                tags.append(tagValue.toString());
+            }
+
+            // Bills without a currency are in the default currency, as in the config file
+            bill.setName(billObject.value(NAME_JSON_KEY).toString());
+            bill.setAmountDue(billObject.value(AMOUNT_DUE_JSON_KEY).toDouble());
+            bill.setDueDate(readCommandLineDate(p_ledgerStore, billObject.value(DUE_DATE_JSON_KEY).toString()));
+            bill.setCurrencyCode(billObject.value(CURRENCY_JSON_KEY).toString());
+            bill.setCategory(billObject.value(CATEGORY_JSON_KEY).toString().trimmed());
+            bill.setTags(tags);
+            bill.setFundedStatus(billObject.value(FUNDED_JSON_KEY).toBool());
+
+            QString billKey = p_ledgerStore.billKeyForName(bill.getName());
+
+            // Bills whose amount due is too large to hold are reported rather than converted clamped
+            if(!Bill::isAmountDueInRange(billObject.value(AMOUNT_DUE_JSON_KEY).toDouble()))
+            {
+                p_ledger.outOfRangeBillKeys.append(billKey);
+            }
+            else if(!billKey.isEmpty())
+            {
+                p_ledger.billMap.insert(billKey, bill);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Writes a LedgerSnapshot to a JSON file which readJsonLedger() reads back.
+     * @param p_filePath - The JSON file, or "-" for standard output.
+     * @param p_ledgerStore - The ledger store, which formats due dates.
+     * @param p_ledger - The bills and funds information.
+     * @return False if the file could not be written.
+     */
+    bool writeJsonLedger(const QString &p_filePath, const LedgerStore &p_ledgerStore, const LedgerSnapshot &p_ledger)
+    {
+        QJsonObject ledgerObject;
+        QJsonArray billArray;
+        ledgerObject.insert(AMOUNT_AVAILABLE_JSON_KEY, p_ledger.totalAmountAvailable);
+        ledgerObject.insert(CURRENCY_JSON_KEY, p_ledger.availableCurrencyCode);
+
+        for(QMap<QString, Bill>::const_iterator billMapIterator = p_ledger.billMap.cbegin(); billMapIterator != p_ledger.billMap.cend(); ++billMapIterator)
+        {
+            billArray.append(billToJson(p_ledgerStore, billMapIterator.key(), billMapIterator.value()));
+        }
+
+        ledgerObject.insert(BILLS_JSON_KEY, billArray);
+
+        QFile jsonFile;
+        bool isOpen = p_filePath == STANDARD_STREAM_PATH ? jsonFile.open(stdout, QIODevice::WriteOnly) : (jsonFile.setFileName(p_filePath), jsonFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        return isOpen && jsonFile.write(QJsonDocument(ledgerObject).toJson(QJsonDocument::Indented)) >= 0;
+    }
+
+    /**
+     * @brief Writes fields in one of the output formats, quoting CSV fields as needed.
+     * @param p_output - The stream written to.
+     * @param p_fields - The fields of one row.
+     * @param p_format - The text or csv format.
+     */
+    void writeRow(QTextStream &p_output, QStringList p_fields, const QString &p_format)
+    {
+        if(p_format == CSV_FORMAT)
+        {
+            for(QString &field : p_fields)
+            {
+                field = quoteCsvField(field);
+            }
+        }
+
+        p_output << p_fields.join(p_format == CSV_FORMAT ? QLatin1Char(',') : QLatin1Char('\t')) << '\n';
+    }
+
+    /**
+     * @brief Writes how each loan is paid off as it stands and with an extra payment each month from today on.
+     * @param p_output - The stream written to.
+     * @param p_ledgerStore - The ledger store, which formats dates.
+     * @param p_ledger - The bills, loans whose bills were deleted being left out.
+     * @param p_loanBook - The loans.
+     * @param p_whatIfExtraCents - The extra payment in cents, zero to leave the what-if columns out.
+     * @param p_format - The text, csv, or json format.
+     */
+    void writeLoans(QTextStream &p_output, const LedgerStore &p_ledgerStore, const LedgerSnapshot &p_ledger, const LoanBook &p_loanBook, qint64 p_whatIfExtraCents, const QString &p_format)
+    {
+        QStringList billKeys;
+        QVector<LoanSchedule::LoanTerms> loans;
+
+        for(const QString &billKey : p_loanBook.billKeys())
+        {
+            if(p_ledger.billMap.contains(billKey))
+            {
+                billKeys.append(billKey);
+                loans.append(p_loanBook.loanTerms(billKey));
+            }
+        }
+
+        // Every loan is summarized in one pass with and one without the extra payment
+        QDate today = QDate::currentDate();
+        QVector<LoanSchedule::PayoffSummary> payoffSummaries = LoanSchedule::summarize(loans, 0, today);
+        QVector<LoanSchedule::PayoffSummary> whatIfSummaries = p_whatIfExtraCents > 0 ? LoanSchedule::summarize(loans, p_whatIfExtraCents, today) : payoffSummaries;
+        QJsonArray loanArray;
+
+        if(p_format == CSV_FORMAT)
+        {
+            writeRow(p_output, p_whatIfExtraCents > 0 ? QStringList{"Bill Name", "Balance", "Payment", "Payoff Date", "Interest", "What-If Payoff Date", "Months Saved", "Interest Saved", "Currency"}
+                                                      : QStringList{"Bill Name", "Balance", "Payment", "Payoff Date", "Interest", "Currency"}, p_format);
+        }
+
+        for(int loanIndex = 0; loanIndex < billKeys.size(); loanIndex++)
+        {
+            const Bill &bill = p_ledger.billMap[billKeys.at(loanIndex)];
+            const LoanSchedule::PayoffSummary &payoffSummary = payoffSummaries.at(loanIndex);
+            const LoanSchedule::PayoffSummary &whatIfSummary = whatIfSummaries.at(loanIndex);
+
+            if(p_format == JSON_FORMAT)
+            {
+                QJsonObject loanObject;
+                loanObject.insert(KEY_JSON_KEY, billKeys.at(loanIndex));
+                loanObject.insert(NAME_JSON_KEY, bill.getName());
+                loanObject.insert(BALANCE_JSON_KEY, payoffSummary.currentBalanceCents / 100.0);
+                loanObject.insert(PAYMENT_JSON_KEY, payoffSummary.scheduledPaymentCents / 100.0);
+                loanObject.insert(PAYOFF_DATE_JSON_KEY, p_ledgerStore.formatDate(payoffSummary.payoffDate));
+                loanObject.insert(INTEREST_JSON_KEY, payoffSummary.totalInterestCents / 100.0);
+                loanObject.insert(CURRENCY_JSON_KEY, bill.getCurrencyCode());
+
+                if(p_whatIfExtraCents > 0)
+                {
+                    loanObject.insert(WHAT_IF_PAYOFF_DATE_JSON_KEY, p_ledgerStore.formatDate(whatIfSummary.payoffDate));
+                    loanObject.insert(MONTHS_SAVED_JSON_KEY, payoffSummary.paymentCount - whatIfSummary.paymentCount);
+                    loanObject.insert(INTEREST_SAVED_JSON_KEY, (payoffSummary.totalInterestCents - whatIfSummary.totalInterestCents) / 100.0);
+                }
+
+                loanArray.append(loanObject);
+                continue;
+            }
+
+            QStringList fields = {bill.getName(), QString::number(payoffSummary.currentBalanceCents / 100.0, 'f', 2), QString::number(payoffSummary.scheduledPaymentCents / 100.0, 'f', 2),
+                                  p_ledgerStore.formatDate(payoffSummary.payoffDate), QString::number(payoffSummary.totalInterestCents / 100.0, 'f', 2)};
+
+            if(p_whatIfExtraCents > 0)
+            {
+                fields << p_ledgerStore.formatDate(whatIfSummary.payoffDate) << QString::number(payoffSummary.paymentCount - whatIfSummary.paymentCount)
+                       << QString::number((payoffSummary.totalInterestCents - whatIfSummary.totalInterestCents) / 100.0, 'f', 2);
+            }
+
+            fields << bill.getCurrencyCode();
+            writeRow(p_output, fields, p_format);
+        }
+
+        if(p_format == JSON_FORMAT)
+        {
+            p_output << QJsonDocument(loanArray).toJson(QJsonDocument::Indented);
+        }
+    }
+
+    /**
+     * @brief Writes every payment of a loan, with an extra payment each month from today on.
+     * @param p_output - The stream written to.
+     * @param p_ledgerStore - The ledger store, which formats dates.
+     * @param p_loanTerms - The loan.
+     * @param p_whatIfExtraCents - The extra payment in cents.
+     * @param p_format - The text, csv, or json format.
+     */
+    void writeLoanSchedule(QTextStream &p_output, const LedgerStore &p_ledgerStore, const LoanSchedule::LoanTerms &p_loanTerms, qint64 p_whatIfExtraCents, const QString &p_format)
+    {
+        QJsonArray installmentArray;
+
+        if(p_format == CSV_FORMAT)
+        {
+            writeRow(p_output, {"Number", "Date", "Payment", "Interest", "Principal", "Balance"}, p_format);
+        }
+
+        for(const LoanSchedule::Installment &installment : LoanSchedule::schedule(p_loanTerms, p_whatIfExtraCents, QDate::currentDate()))
+        {
+            if(p_format == JSON_FORMAT)
+            {
+                QJsonObject installmentObject;
+                installmentObject.insert(PAYMENT_NUMBER_JSON_KEY, installment.paymentNumber);
+                installmentObject.insert(DATE_JSON_KEY, p_ledgerStore.formatDate(installment.paymentDate));
+                installmentObject.insert(PAYMENT_JSON_KEY, installment.paymentCents / 100.0);
+                installmentObject.insert(INTEREST_JSON_KEY, installment.interestCents / 100.0);
+                installmentObject.insert(PRINCIPAL_JSON_KEY, installment.principalCents / 100.0);
+                installmentObject.insert(BALANCE_JSON_KEY, installment.balanceCents / 100.0);
+                installmentArray.append(installmentObject);
+                continue;
+            }
+
+            writeRow(p_output, {QString::number(installment.paymentNumber), p_ledgerStore.formatDate(installment.paymentDate), QString::number(installment.paymentCents / 100.0, 'f', 2),
+                                QString::number(installment.interestCents / 100.0, 'f', 2), QString::number(installment.principalCents / 100.0, 'f', 2),
+                                QString::number(installment.balanceCents / 100.0, 'f', 2)}, p_format);
+        }
+
+        if(p_format == JSON_FORMAT)
+        {
+            p_output << QJsonDocument(installmentArray).toJson(QJsonDocument::Indented);
+        }
+    }
+
+    /**
+     * @brief Writes the periods of the balance history.
+     * @param p_output - The stream written to.
+     * @param p_ledgerStore - The ledger store, which formats dates.
+     * @param p_periods - The periods, in time order.
+     * @param p_resolution - The resolution the periods are of, single saves being named by their time as well as their day.
+     * @param p_format - The text, csv, or json format.
+     */
+    void writeBalanceHistory(QTextStream &p_output, const LedgerStore &p_ledgerStore, const QVector<BalanceHistory::Period> &p_periods, BalanceHistory::Resolution p_resolution, const QString &p_format)
+    {
+        QJsonArray periodArray;
+
+        if(p_format == CSV_FORMAT)
+        {
+            writeRow(p_output, {"Period", "Open", "Close", "Low", "High", "Funded", "Outstanding", "Currency", "Saves"}, p_format);
+        }
+
+        for(const BalanceHistory::Period &period : p_periods)
+        {
+            QString periodName = p_ledgerStore.formatDate(period.startDate);
+
+            if(p_resolution == BalanceHistory::Snapshots)
+            {
+                periodName += ' ' + QDateTime::fromMSecsSinceEpoch(period.firstTimestampMsecs).time().toString("hh:mm:ss");
+            }
+
+            if(p_format == JSON_FORMAT)
+            {
+                QJsonObject periodObject;
+                periodObject.insert(PERIOD_JSON_KEY, periodName);
+                periodObject.insert(OPEN_JSON_KEY, period.openAvailableCents / 100.0);
+                periodObject.insert(CLOSE_JSON_KEY, period.closeAvailableCents / 100.0);
+                periodObject.insert(LOW_JSON_KEY, period.lowAvailableCents / 100.0);
+                periodObject.insert(HIGH_JSON_KEY, period.highAvailableCents / 100.0);
+                periodObject.insert(FUNDED_TOTAL_JSON_KEY, period.closeFundedCents / 100.0);
+                periodObject.insert(OUTSTANDING_JSON_KEY, period.closeOutstandingCents / 100.0);
+                periodObject.insert(CURRENCY_JSON_KEY, CurrencyRegistry::codeForIndex(period.currencyIndex));
+                periodObject.insert(SAVES_JSON_KEY, period.snapshotCount);
+                periodArray.append(periodObject);
+                continue;
+            }
+
+            writeRow(p_output, {periodName, QString::number(period.openAvailableCents / 100.0, 'f', 2), QString::number(period.closeAvailableCents / 100.0, 'f', 2),
+                                QString::number(period.lowAvailableCents / 100.0, 'f', 2), QString::number(period.highAvailableCents / 100.0, 'f', 2),
+                                QString::number(period.closeFundedCents / 100.0, 'f', 2), QString::number(period.closeOutstandingCents / 100.0, 'f', 2),
+                                CurrencyRegistry::codeForIndex(period.currencyIndex), QString::number(period.snapshotCount)}, p_format);
+        }
+
+        if(p_format == JSON_FORMAT)
+        {
+            p_output << QJsonDocument(periodArray).toJson(QJsonDocument::Indented);
+        }
+    }
+
+    /**
+     * @brief Returns the format of a file given to convert, from its suffix.
+     * @param p_filePath - The file.
+     * @return The ini, csv, or json format, or an empty string for any other suffix.
+     */
+    QString formatForPath(const QString &p_filePath)
+    {
+        QString suffix = QFileInfo(p_filePath).suffix().toLower();
+        return suffix == INI_FORMAT || suffix == CSV_FORMAT || suffix == JSON_FORMAT ? suffix : QString();
+    }
+
+    /**
+     * @brief Finds the bill map key of a bill named on the command line, which may be given by name or key and in any case.
+     * @param p_billMap - The bills.
+     * @param p_ledgerStore - The ledger store, which names bill map keys.
+     * @param p_billName - The bill as given.
+     * @return The bill map key, or an empty string if no bill matches.
+     */
+    QString findBillKey(const QMap<QString, Bill> &p_billMap, const LedgerStore &p_ledgerStore, const QString &p_billName)
+    {
+        QString billKey = p_ledgerStore.billKeyForName(p_billName);
+
+        if(p_billMap.contains(billKey))
+        {
+            return billKey;
+        }
+
+        // Fall back to comparing normalized keys, as duplicate detection does
+        QString normalizedKey = BillKeyIndex::normalizeKey(p_billName);
+
+        for(QMap<QString, Bill>::const_iterator billMapIterator = p_billMap.cbegin(); billMapIterator != p_billMap.cend(); ++billMapIterator)
+        {
+            if(BillKeyIndex::normalizeKey(billMapIterator.key()) == normalizedKey)
+            {
+                return billMapIterator.key();
+            }
+        }
+
+        return QString();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QElapsedTimer commandTimer;
+    commandTimer.start();
+
+    QCoreApplication application(argc, argv);
+    QCoreApplication::setApplicationName("pft");
+    QTextStream output(stdout);
+    QTextStream errorOutput(stderr);
+
+    // Read the options
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Queries and changes the PersonalFinanceTool's bills without a display.\n\n"
+                                     "Commands:\n"
+                                     "  list                      List every bill.\n"
+                                     "  due-before <date>         List the bills due before a date, M/d/yyyy or yyyy-MM-dd.\n"
+                                     "  funded                    List the funded bills.\n"
+                                     "  totals                    Report the amount available, the amount left to fund, and the number of bills.\n"
+                                     "  add [<file>|-]            Add bills from rows in the bill widget's paste format, read from standard input by default.\n"
+                                     "  fund <bill>...            Fund bills, setting their amount due aside from the amount available.\n"
+                                     "  defund <bill>...          Return the funds of bills to the amount available.\n"
+                                     "  delete <bill>...          Delete bills, returning their funds if they were funded.\n"
+                                     "  convert <input> <output>  Convert bills between .ini config files, .json, and .csv, \"-\" writing to standard output.\n"
+                                     "  loans [<bill>]            Summarize how each loan is paid off, or list every payment of one loan.\n"
+                                     "  history [<from> [<to>]]   List the amount available and the funded and outstanding totals saved between two dates, the past three months by default.");
+    parser.addHelpOption();
+    QCommandLineOption configOption("config", "The config file, " + DEFAULT_CONFIG_FILE_PATH + " by default.", "path", DEFAULT_CONFIG_FILE_PATH);
+    QCommandLineOption formatOption("format", "Output format of queries, text, csv, or json.", "format", TEXT_FORMAT);
+    QCommandLineOption timingOption("timing", "Report how long loading and the command took on standard error.");
+    QCommandLineOption extraOption("extra", "Extra amount paid towards every loan each month from today on, to see how much sooner they are paid off.", "amount", "0");
+    QCommandLineOption resolutionOption("resolution", "Resolution of the history, " + AUTOMATIC_RESOLUTION + " or one of " + RESOLUTION_NAMES.join(", ") + ".", "resolution", AUTOMATIC_RESOLUTION);
+    parser.addOptions({configOption, formatOption, timingOption, extraOption, resolutionOption});
+    parser.addPositionalArgument("command", "The command to run.");
+    parser.addPositionalArgument("arguments", "The command's arguments.", "[arguments...]");
+    parser.process(application);
+
+    QStringList arguments = parser.positionalArguments();
+    QString command = arguments.isEmpty() ? QString() : arguments.takeFirst();
+    QString format = parser.value(formatOption).toLower();
+
+    if(format != TEXT_FORMAT && format != CSV_FORMAT && format != JSON_FORMAT)
+    {
+        errorOutput << "Unknown format \"" << format << "\", expected " << TEXT_FORMAT << ", " << CSV_FORMAT << ", or " << JSON_FORMAT << Qt::endl;
+        return USAGE_EXIT_CODE;
+    }
+
+    // Every command but convert works on the config file, whose exchange rates, transaction ledger, and balance history sit beside it
+    QString configFilePath = parser.value(configOption);
+    QFileInfo configFileInfo(configFilePath);
+    QString exchangeRateFilePath = configFileInfo.dir().filePath(EXCHANGE_RATE_FILE_NAME);
+    QString ledgerFilePath = configFileInfo.dir().filePath(configFileInfo.completeBaseName() + LEDGER_FILE_SUFFIX);
+    QString loanFilePath = configFileInfo.dir().filePath(LOAN_FILE_NAME);
+    QString historyFilePath = configFileInfo.dir().filePath(configFileInfo.completeBaseName() + HISTORY_FILE_SUFFIX);
+    LedgerStore ledgerStore(configFilePath);
+    int exitCode = SUCCESS_EXIT_CODE;
+    qint64 loadNsecs = 0;
+
+    if(command == CONVERT_COMMAND)
+    {
+        QString inputPath = arguments.value(0);
+        QString outputPath = arguments.value(1);
+        QString inputFormat = formatForPath(inputPath);
+        QString outputFormat = outputPath == STANDARD_STREAM_PATH ? format : formatForPath(outputPath);
+
+        // CSV files hold no funds information, so they are only written
+        if(arguments.size() != 2 || (inputFormat != INI_FORMAT && inputFormat != JSON_FORMAT) || outputFormat.isEmpty() || (outputPath == STANDARD_STREAM_PATH && outputFormat == INI_FORMAT))
+        {
+            errorOutput << "Usage: pft convert <input.ini|input.json> <output.ini|output.json|output.csv|->" << Qt::endl;
+            return USAGE_EXIT_CODE;
+        }
+
+        LedgerSnapshot convertedLedger;
+        LedgerStore inputStore(inputPath);
+
+        if(inputFormat == INI_FORMAT)
+        {
+            convertedLedger = inputStore.load();
+        }
+        else
+        {
+            convertedLedger.isConfigReadable = readJsonLedger(inputPath, ledgerStore, convertedLedger);
+        }
+
+        if(!convertedLedger.isConfigReadable || convertedLedger.invalidKeyCount > 0)
+        {
+            errorOutput << "Could not read " << inputPath << Qt::endl;
+            return FILE_EXIT_CODE;
+        }
+
+        // Converting without them would drop them from the output
+        if(!convertedLedger.outOfRangeBillKeys.isEmpty())
+        {
+            errorOutput << "Could not convert " << inputPath << ", these bills have an amount due larger than " << QString::number(Bill::getMaxAmountDueCents() / 100.0, 'f', 2)
+                        << ": " << convertedLedger.outOfRangeBillKeys.join(", ") << Qt::endl;
+            return FILE_EXIT_CODE;
+        }
+
+        bool isWritten = true;
+
+        if(outputFormat == INI_FORMAT)
+        {
+            isWritten = LedgerStore(outputPath).replace(convertedLedger);
+        }
+        else if(outputFormat == JSON_FORMAT)
+        {
+            isWritten = writeJsonLedger(outputPath, ledgerStore, convertedLedger);
+        }
+        else
+        {
+            QFile csvFile;
+            isWritten = outputPath == STANDARD_STREAM_PATH ? csvFile.open(stdout, QIODevice::WriteOnly) : (csvFile.setFileName(outputPath), csvFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+
+            if(isWritten)
+            {
+                QTextStream csvOutput(&csvFile);
+                writeBills(csvOutput, ledgerStore, convertedLedger.billMap, CSV_FORMAT, [](const Bill&) { return true; });
+            }
+        }
+
+        if(!isWritten)
+        {
+            errorOutput << "Could not write " << outputPath << Qt::endl;
+            return FILE_EXIT_CODE;
+        }
+
+        output << "Converted " << convertedLedger.billMap.size() << " bill(s) from " << inputPath << " to " << outputPath << Qt::endl;
+    }
+    else if(command == HISTORY_COMMAND)
+    {
+        // Check the arguments before touching the history, which is read without the config file
+        QDate fromDate = arguments.isEmpty() ? QDate::currentDate().addMonths(-DEFAULT_HISTORY_RANGE_MONTHS) : readCommandLineDate(ledgerStore, arguments.value(0));
+        QDate toDate = arguments.size() < 2 ? QDate::currentDate() : readCommandLineDate(ledgerStore, arguments.value(1));
+        QString resolutionName = parser.value(resolutionOption).toLower();
+        int resolutionIndex = RESOLUTION_NAMES.indexOf(resolutionName);
+
+        if(arguments.size() > 2 || !fromDate.isValid() || !toDate.isValid() || (resolutionIndex < 0 && resolutionName != AUTOMATIC_RESOLUTION))
+        {
+            errorOutput << "Invalid arguments for " << command << ", see pft --help" << Qt::endl;
+            return USAGE_EXIT_CODE;
+        }
+
+        QElapsedTimer loadTimer;
+        loadTimer.start();
+        BalanceHistory balanceHistory;
+
+        if(!balanceHistory.open(historyFilePath))
+        {
+            errorOutput << "Could not read " << historyFilePath << Qt::endl;
+            return FILE_EXIT_CODE;
+        }
+
+        loadNsecs = loadTimer.nsecsElapsed();
+
+        // Cover the whole of both days, at the finest resolution which fits in a page of rows unless one was given
+        QDateTime fromDateTime(fromDate, QTime(0, 0));
+        QDateTime toDateTime(toDate, QTime(23, 59, 59, 999));
+        BalanceHistory::Resolution resolution = resolutionIndex < 0 ? balanceHistory.resolutionFor(fromDateTime, toDateTime, MAX_AUTOMATIC_HISTORY_ROW_COUNT)
+                                                                    : static_cast<BalanceHistory::Resolution>(resolutionIndex);
+        writeBalanceHistory(output, ledgerStore, balanceHistory.periodsBetween(fromDateTime, toDateTime, resolution), resolution, format);
+    }
+    else if(command == LIST_COMMAND || command == DUE_BEFORE_COMMAND || command == FUNDED_COMMAND || command == TOTALS_COMMAND || command == ADD_COMMAND
+            || command == FUND_COMMAND || command == DEFUND_COMMAND || command == DELETE_COMMAND || command == LOANS_COMMAND)
+    {
+        // Check the arguments before touching any file
+        QDate dueBeforeDate = command == DUE_BEFORE_COMMAND ? readCommandLineDate(ledgerStore, arguments.value(0)) : QDate();
+        bool isExtraValid = false;
+        double extraAmount = parser.value(extraOption).toDouble(&isExtraValid);
+
+        if((command == DUE_BEFORE_COMMAND && (arguments.size() != 1 || !dueBeforeDate.isValid())) || ((command == FUND_COMMAND || command == DEFUND_COMMAND || command == DELETE_COMMAND) && arguments.isEmpty())
+           || (command == ADD_COMMAND && arguments.size() > 1) || ((command == LIST_COMMAND || command == FUNDED_COMMAND || command == TOTALS_COMMAND) && !arguments.isEmpty())
+           || (command == LOANS_COMMAND && (arguments.size() > 1 || !isExtraValid || !std::isfinite(extraAmount) || extraAmount < 0.0)))
+        {
+            errorOutput << "Invalid arguments for " << command << ", see pft --help" << Qt::endl;
+            return USAGE_EXIT_CODE;
+        }
+
+        // Load the config file on this thread, large files are still read by one worker per core
+        QElapsedTimer loadTimer;
+        loadTimer.start();
+        LedgerSnapshot ledger = ledgerStore.load();
+        LedgerSnapshot loadedLedger = ledger;
+        loadNsecs = loadTimer.nsecsElapsed();
+
+        if(!ledger.isConfigReadable || ledger.invalidKeyCount > 0)
+        {
+            errorOutput << "Could not read " << configFilePath << ", it cannot be opened or a line is malformed" << Qt::endl;
+            return FILE_EXIT_CODE;
+        }
+
+        // Bills whose amount due is too large to hold are left out rather than clamped, and kept in the config file as they are when it is saved
+        if(!ledger.outOfRangeBillKeys.isEmpty())
+        {
+            errorOutput << "Bills with an amount due larger than " << QString::number(Bill::getMaxAmountDueCents() / 100.0, 'f', 2) << " were left out: " << ledger.outOfRangeBillKeys.join(", ") << Qt::endl;
+            exitCode = PARTIAL_EXIT_CODE;
+        }
+
+        // Bills are totalled and funds moved in the currency of the amount available as the PFT does, the exchange rates only being read by commands which use them
+        bool isChangingBills = command == ADD_COMMAND || command == FUND_COMMAND || command == DEFUND_COMMAND || command == DELETE_COMMAND;
+        ExchangeRateTable exchangeRateTable;
+
+        if(isChangingBills || command == TOTALS_COMMAND)
+        {
+            exchangeRateTable.load(exchangeRateFilePath);
+        }
+
+        LedgerFunds ledgerFunds(exchangeRateTable, CurrencyRegistry::indexForCode(ledger.availableCurrencyCode));
+        QVector<QPair<QString, LedgerFunds::FundsChange>> fundsChanges;
+
+        if(command == LIST_COMMAND)
+        {
+            writeBills(output, ledgerStore, ledger.billMap, format, [](const Bill&) { return true; });
+        }
+        else if(command == DUE_BEFORE_COMMAND)
+        {
+            writeBills(output, ledgerStore, ledger.billMap, format, [&dueBeforeDate](const Bill &p_bill) { return isDueBefore(p_bill, dueBeforeDate); });
+        }
+        else if(command == FUNDED_COMMAND)
+        {
+            writeBills(output, ledgerStore, ledger.billMap, format, [](const Bill &p_bill) { return p_bill.isFunded(); });
+        }
+        else if(command == TOTALS_COMMAND)
+        {
+            writeTotals(output, ledger, ledgerFunds, format);
+        }
+        else if(command == LOANS_COMMAND)
+        {
+            LoanBook loanBook;
+
+            if(!loanBook.load(loanFilePath))
+            {
+                errorOutput << "Could not read " << loanFilePath << Qt::endl;
+                return FILE_EXIT_CODE;
+            }
+
+            qint64 extraCents = std::llround(extraAmount * 100.0);
+
+            // List every loan, or every payment of the one named
+            if(arguments.isEmpty())
+            {
+                writeLoans(output, ledgerStore, ledger, loanBook, extraCents, format);
+            }
+            else
+            {
+                QString billKey = findBillKey(ledger.billMap, ledgerStore, arguments.first());
+
+                if(!loanBook.contains(billKey))
+                {
+                    errorOutput << "No loan named \"" << arguments.first() << "\"" << Qt::endl;
+                    return PARTIAL_EXIT_CODE;
+                }
+
+                writeLoanSchedule(output, ledgerStore, loanBook.loanTerms(billKey), extraCents, format);
+            }
+        }
+        else if(command == ADD_COMMAND)
+        {
+            // Read the rows from the file, or from standard input so they can be piped in
+            QString inputPath = arguments.value(0, STANDARD_STREAM_PATH);
+            QFile inputFile;
+            bool isOpen = inputPath == STANDARD_STREAM_PATH ? inputFile.open(stdin, QIODevice::ReadOnly) : (inputFile.setFileName(inputPath), inputFile.open(QIODevice::ReadOnly));
+
+            if(!isOpen)
+            {
+                errorOutput << "Could not read " << inputPath << Qt::endl;
+                return FILE_EXIT_CODE;
+            }
+
+            // Index the stored bills so colliding and near duplicate rows are found as in the bill widget
+            QVector<BillPasteParser::PastedRow> pastedRows = BillPasteParser::parse(QString::fromUtf8(inputFile.readAll()), ledger.availableCurrencyCode);
+            BillKeyIndex billKeyIndex;
+            billKeyIndex.reset(ledger.billMap.size() + pastedRows.size());
+
+            for(QMap<QString, Bill>::const_iterator billMapIterator = ledger.billMap.cbegin(); billMapIterator != ledger.billMap.cend(); ++billMapIterator)
+            {
+                billKeyIndex.insertBill(billMapIterator.key(), billMapIterator.value());
+            }
+
+            int addedBillCount = 0;
+
+            for(const BillPasteParser::PastedRow &pastedRow : pastedRows)
+            {
+                QString billKey = ledgerStore.billKeyForName(pastedRow.bill.getName());
+                BillKeyIndex::Collision collision = pastedRow.bill.getName().isEmpty() ? BillKeyIndex::Collision() : billKeyIndex.findCollision(billKey, pastedRow.bill);
+                QStringList rowErrors;
+
+                for(int column = 0; column < BillPasteParser::PastedColumnCount; column++)
+                {
+                    if(!pastedRow.fieldErrors.at(column).isEmpty())
+                    {
+                        rowErrors.append(BillPasteParser::columnTitle(static_cast<BillPasteParser::PastedColumn>(column)) + ": " + pastedRow.fieldErrors.at(column));
+                    }
+                }
+
+                // Bills added by earlier rows are indexed too, so repeated rows collide with them
+                if(collision.kind == BillKeyIndex::KeyCollision || ledgerStore.isFundsInformationGroup(billKey))
+                {
+                    rowErrors.append("Would be saved under the same name as \"" + (collision.existingBillKey.isEmpty() ? billKey : collision.existingBillKey) + "\"");
+                }
+
+                if(!rowErrors.isEmpty())
+                {
+                    errorOutput << "Line " << pastedRow.lineNumber << " not added, " << rowErrors.join("; ") << Qt::endl;
+                    exitCode = PARTIAL_EXIT_CODE;
+                    continue;
+                }
+
+                if(collision.kind == BillKeyIndex::NearDuplicate)
+                {
+                    errorOutput << "Line " << pastedRow.lineNumber << " may duplicate \"" << collision.existingBillKey << "\", added anyway" << Qt::endl;
+                }
+
+                ledger.billMap.insert(billKey, pastedRow.bill);
+                billKeyIndex.insertBill(billKey, pastedRow.bill);
+                addedBillCount++;
+            }
+
+            output << "Added " << addedBillCount << " bill(s)" << Qt::endl;
+        }
+        else
+        {
+            // Funds move in the currency of the amount available, as the Fund, Defund, and Delete buttons do, and are recorded in the transaction ledger once saved
+            int changedBillCount = 0;
+
+            for(const QString &billName : arguments)
+            {
+                QString billKey = findBillKey(ledger.billMap, ledgerStore, billName);
+
+                if(billKey.isEmpty())
+                {
+                    errorOutput << "No bill named \"" << billName << "\"" << Qt::endl;
+                    exitCode = PARTIAL_EXIT_CODE;
+                    continue;
+                }
+
+                Bill &bill = ledger.billMap[billKey];
+                LedgerFunds::FundsChange fundsChange = command == DELETE_COMMAND ? ledgerFunds.deletionChange(bill) : ledgerFunds.fundingChange(bill, command == FUND_COMMAND);
+
+                // Bills already in the requested state are left alone
+                if(!fundsChange.isChanged)
+                {
+                    continue;
+                }
+
+                // Funds in another currency cannot be moved without a rate, so the bill is left as it is
+                if(!fundsChange.isConverted)
+                {
+                    errorOutput << "No exchange rate between " << bill.getCurrencyCode() << " and " << ledger.availableCurrencyCode << ", \"" << billKey << "\" was not changed" << Qt::endl;
+                    exitCode = PARTIAL_EXIT_CODE;
+                    continue;
+                }
+
+                ledger.totalAmountAvailable += fundsChange.amountAvailableChangeCents / 100.0;
+                fundsChanges.append(qMakePair(billKey, fundsChange));
+                changedBillCount++;
+
+                if(command == DELETE_COMMAND)
+                {
+                    ledger.billMap.remove(billKey);
+                }
+                else
+                {
+                    bill.setFundedStatus(command == FUND_COMMAND);
+                }
+            }
+
+            output << "Changed " << changedBillCount << " bill(s), amount available " << QString::number(ledger.totalAmountAvailable, 'f', 2) << ' ' << ledger.availableCurrencyCode << Qt::endl;
+        }
+
+        // Write every change at once, merged with anything the PFT or another pft saved since the config file was loaded
+        if(isChangingBills)
+        {
+            // Bills funded by another instance in the meantime are converted with the same rates when the amounts they set aside are merged
+            LedgerStore::SaveResult saveResult = ledgerStore.save(ledger, loadedLedger, exchangeRateTable);
+
+            if(!saveResult.isWritten)
+            {
+                errorOutput << "Could not write " << configFilePath << (saveResult.isLockTimedOut ? ", another instance is holding its lock" : "") << Qt::endl;
+                return FILE_EXIT_CODE;
+            }
+
+            if(!saveResult.mergedBillKeys.isEmpty() || !saveResult.mergedRemovedBillKeys.isEmpty() || saveResult.mergedAmountAvailableChange != 0.00)
+            {
+                errorOutput << "Merged " << saveResult.mergedBillKeys.size() + saveResult.mergedRemovedBillKeys.size() << " bill change(s) saved by another instance while this command ran" << Qt::endl;
+            }
+
+            if(!saveResult.conflictingBillKeys.isEmpty())
+            {
+                errorOutput << "Bills also changed by another instance, merged field by field: " << saveResult.conflictingBillKeys.join(", ") << Qt::endl;
+            }
+
+            // Record the moved funds in the transaction ledger with a single append only once they are saved, so a failed save leaves no record of changes which never happened
+            if(!fundsChanges.isEmpty())
+            {
+                QVector<TransactionLedger::Transaction> transactions;
+                transactions.reserve(fundsChanges.size());
+
+                for(const QPair<QString, LedgerFunds::FundsChange> &fundsChange : qAsConst(fundsChanges))
+                {
+                    TransactionLedger::Transaction transaction;
+                    transaction.type = fundsChange.second.transactionType;
+                    transaction.amountCents = fundsChange.second.amountAvailableChangeCents;
+                    transaction.billKey = fundsChange.first;
+                    transactions.append(transaction);
+                }
+
+                TransactionLedger transactionLedger;
+
+                if(!transactionLedger.open(ledgerFilePath, static_cast<qint64>(std::llround(loadedLedger.totalAmountAvailable * 100.0))) || !transactionLedger.appendBatch(transactions))
+                {
+                    errorOutput << "Could not write " << ledgerFilePath << ", the bills were saved without recording their funds moves" << Qt::endl;
+                    exitCode = FILE_EXIT_CODE;
+                }
+            }
+
+            // Record the totals the save took in the balance history, as the PFT does after each save, unless bills without a rate were left out of them
+            BalanceHistory balanceHistory;
+
+            if(!saveResult.missingRateCurrencyCodes.isEmpty())
+            {
+                errorOutput << "No exchange rate for " << saveResult.missingRateCurrencyCodes.join(", ") << ", the bills were saved without updating " << historyFilePath << Qt::endl;
+            }
+            else if(!balanceHistory.open(historyFilePath) || !balanceHistory.append(saveResult.balanceSnapshot))
+            {
+                errorOutput << "Could not write " << historyFilePath << ", the bills were saved without it" << Qt::endl;
+                exitCode = FILE_EXIT_CODE;
+            }
+        }
+    }
+    else
+    {
+        errorOutput << (command.isEmpty() ? QString("No command given") : "Unknown command \"" + command + "\"") << ", see pft --help" << Qt::endl;
+        return USAGE_EXIT_CODE;
+    }
+
+    output.flush();
+
+    if(parser.isSet(timingOption))
+    {
+        errorOutput << "Load: " << QString::number(loadNsecs / 1000000.0, 'f', 2) << " ms, total: " << QString::number(commandTimer.nsecsElapsed() / 1000000.0, 'f', 2) << " ms" << Qt::endl;
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,36 @@
+###################################################################################
+#   File name:          pft.pro
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Project file for pft, the PersonalFinanceTool's command-line tool
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/cli/
+###################################################################################
+
+QT += core
+QT -= gui
+
+CONFIG += c++17
+CONFIG += console
+CONFIG -= app_bundle
+
+# The name of the binary
+TARGET = pft
+
+# The directory where the binary is generated, beside the PersonalFinanceTool so both find the config folder the same way
+DESTDIR = ../bin
+
+# Store unnecessary files in hidden folders
+OBJECTS_DIR = ./obj
+MOC_DIR = ./moc
+
+# Share the bills, config file, and ledger classes with the PersonalFinanceTool
+include(../core/PersonalFinanceCore.pri)
+
+SOURCES += \
+    main.cpp
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
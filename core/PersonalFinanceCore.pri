@@ -0,0 +1,19 @@
+###################################################################################
+#   File name:          PersonalFinanceCore.pri
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Include file linking a project against the PersonalFinanceCore
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/core/
+###################################################################################
+
+QT += concurrent
+
+# Find the core's headers in the source folder and its library beside the including project's build folder
+INCLUDEPATH += $$PWD/../src
+DEPENDPATH += $$PWD/../src
+LIBS += -L$$OUT_PWD/../lib -lPersonalFinanceCore
+
+# Relink whenever the core library changes
+win32-msvc*: PRE_TARGETDEPS += $$OUT_PWD/../lib/PersonalFinanceCore.lib
+else: PRE_TARGETDEPS += $$OUT_PWD/../lib/libPersonalFinanceCore.a
@@ -0,0 +1,96 @@
+###################################################################################
+#   File name:          PersonalFinanceCore.pro
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Project file for the PersonalFinanceCore
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/core/
+###################################################################################
+
+QT += core
+QT += concurrent
+QT -= gui
+
+CONFIG += c++17
+CONFIG += staticlib
+
+TEMPLATE = lib
+
+# The name of the library
+TARGET = PersonalFinanceCore
+
+# The directory where the library is generated, shared with the GUI and command-line tool
+DESTDIR = ../lib
+
+# Store unnecessary files in hidden folders
+OBJECTS_DIR = ./obj
+MOC_DIR = ./moc
+
+# Build the bills, config file, and ledger classes straight from the source folder, none of which depend on the GUI
+INCLUDEPATH += ../src
+
+SOURCES += \
+    ../src/BalanceHistory.cpp \
+    ../src/Bill.cpp \
+    ../src/BillArchive.cpp \
+    ../src/BillCalendar.cpp \
+    ../src/BillKeyIndex.cpp \
+    ../src/BillPasteParser.cpp \
+    ../src/BillSearchIndex.cpp \
+    ../src/BillSorter.cpp \
+    ../src/BloomFilter.cpp \
+    ../src/CashFlowSimulation.cpp \
+    ../src/CategoryRollup.cpp \
+    ../src/ConfigFileReader.cpp \
+    ../src/ConfigSectionIndex.cpp \
+    ../src/CurrencyRegistry.cpp \
+    ../src/ExchangeRateTable.cpp \
+    ../src/JobManager.cpp \
+    ../src/JobPool.cpp \
+    ../src/LabelRegistry.cpp \
+    ../src/LedgerFunds.cpp \
+    ../src/LedgerScenario.cpp \
+    ../src/LedgerStore.cpp \
+    ../src/LoadArena.cpp \
+    ../src/LoanBook.cpp \
+    ../src/LoanSchedule.cpp \
+    ../src/PeriodReport.cpp \
+    ../src/Profiler.cpp \
+    ../src/ReminderScheduler.cpp \
+    ../src/StagedLedger.cpp \
+    ../src/StatementReconciler.cpp \
+    ../src/TransactionLedger.cpp
+
+HEADERS += \
+    ../src/BalanceHistory.h \
+    ../src/Bill.h \
+    ../src/BillArchive.h \
+    ../src/BillCalendar.h \
+    ../src/BillKeyIndex.h \
+    ../src/BillPasteParser.h \
+    ../src/BillSearchIndex.h \
+    ../src/BillSorter.h \
+    ../src/BloomFilter.h \
+    ../src/CashFlowSimulation.h \
+    ../src/CategoryRollup.h \
+    ../src/ConfigFileReader.h \
+    ../src/ConfigSectionIndex.h \
+    ../src/CurrencyRegistry.h \
+    ../src/ExchangeRateTable.h \
+    ../src/JobManager.h \
+    ../src/JobPool.h \
+    ../src/LabelRegistry.h \
+    ../src/LedgerFunds.h \
+    ../src/LedgerScenario.h \
+    ../src/LedgerSnapshot.h \
+    ../src/LedgerStore.h \
+    ../src/LoadArena.h \
+    ../src/LoanBook.h \
+    ../src/LoanSchedule.h \
+    ../src/PeriodReport.h \
+    ../src/Profiler.h \
+    ../src/ReminderScheduler.h \
+    ../src/SpscQueue.h \
+    ../src/StagedLedger.h \
+    ../src/StatementReconciler.h \
+    ../src/TransactionLedger.h
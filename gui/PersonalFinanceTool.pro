@@ -0,0 +1,75 @@
+###################################################################################
+#   File name:          PersonalFinanceTool.pro
+#   Created on:         08/30/2024
+#   Author:             stwomey
+#   Description:        Project file for the PersonalFinanceTool
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/gui/
+###################################################################################
+
+QT += core
+QT += gui
+QT += network
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+# The name of the binary
+TARGET = PersonalFinanceTool
+
+# The directory where the binary is generated
+DESTDIR = ../bin
+
+# Store unnecessary files in hidden folders
+OBJECTS_DIR = ./obj
+MOC_DIR = ./moc
+UI_DIR = ./ui
+
+# Link the bills, config file, and ledger classes shared with the command-line tool, the Profiler's operator new replacements being built into the PFT alone
+include(../core/PersonalFinanceCore.pri)
+
+SOURCES += \
+    ../src/AutomationServer.cpp \
+    ../src/BalanceHistoryWidget.cpp \
+    ../src/BillArchiveWidget.cpp \
+    ../src/BillCalendarWidget.cpp \
+    ../src/BillWidget.cpp \
+    ../src/CashFlowSimulationWidget.cpp \
+    ../src/LedgerHistoryWidget.cpp \
+    ../src/LoanWidget.cpp \
+    ../src/main.cpp \
+    ../src/MainWindow.cpp \
+    ../src/PeriodReportWidget.cpp \
+    ../src/ProfilerAllocator.cpp \
+    ../src/ReconciliationWidget.cpp \
+    ../src/ScenarioWidget.cpp
+
+HEADERS += \
+    ../src/AutomationServer.h \
+    ../src/BalanceHistoryWidget.h \
+    ../src/BillArchiveWidget.h \
+    ../src/BillCalendarWidget.h \
+    ../src/BillWidget.h \
+    ../src/CashFlowSimulationWidget.h \
+    ../src/LedgerHistoryWidget.h \
+    ../src/LoanWidget.h \
+    ../src/MainWindow.h \
+    ../src/PeriodReportWidget.h \
+    ../src/ReconciliationWidget.h \
+    ../src/ScenarioWidget.h
+
+#Track the config file and README in the IDE
+OTHER_FILES += \
+    ../config/PersonalFinanceTool.ini \
+    ../config/ExchangeRates.ini \
+    ../README.md
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,283 @@
+/*##################################################################################
+#   File name:          AutomationServer.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for an AutomationServer
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "AutomationServer.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+namespace
+{
+    const QString ID_KEY = "id"; //!< The key of a request whose value is copied into its response so clients can match them up.
+    const QString OK_KEY = "ok"; //!< The key of a response saying whether or not its request succeeded.
+    const QString ERROR_KEY = "error"; //!< The key of a response describing why its request failed.
+    const QString OPERATION_KEY = "op"; //!< The key of a request holding the name of its operation.
+    const QString BATCH_OPERATION = "batch"; //!< The operation grouping several requests into one line.
+    const QString BATCH_REQUESTS_KEY = "requests"; //!< The key of a batch request holding its requests.
+    const QString BATCH_RESPONSES_KEY = "responses"; //!< The key of a batch response holding the responses of its requests.
+    const int STALE_SOCKET_PROBE_MSECS = 200; //!< How long to wait when checking whether another instance is listening on the socket.
+
+    /**
+     * @brief The LineResponse struct records which of a batch's responses answer one line, so the responses can be written back line by line.
+     */
+    struct LineResponse
+    {
+        int firstRequestIndex = 0; //!< The index of the line's first request within the batch.
+        int requestCount = 0; //!< The number of requests the line held.
+        bool isBatch = false; //!< Whether or not the line was a batch request, answered with an array of responses.
+        QJsonObject lineRequest; //!< The request the line held, used to answer batch and unparseable lines.
+        QString errorText; //!< Why the line could not be parsed, empty if it was.
+    };
+}
+
+AutomationServer::AutomationServer(BatchHandler p_batchHandler, QObject *p_parent) : QObject(p_parent), m_batchHandler(std::move(p_batchHandler))
+{
+    // Create the server, only the user running the application may connect to it
+    m_localServer = new QLocalServer(this);
+    m_localServer->setSocketOptions(QLocalServer::UserAccessOption);
+
+    // When a client connects, start reading its requests
+    connect(m_localServer, SIGNAL(newConnection()), this, SLOT(acceptConnections()), Qt::AutoConnection);
+}
+
+AutomationServer::~AutomationServer()
+{
+    // Close every connection before the server is destroyed along with this object
+    stop();
+}
+
+bool AutomationServer::start(const QString &p_serverName)
+{
+    if(m_localServer->isListening())
+    {
+        return true;
+    }
+
+    if(m_localServer->listen(p_serverName))
+    {
+        return true;
+    }
+
+    // A socket left behind by an instance which crashed refuses connections, so it can be replaced, but one another instance is listening on is left alone
+    if(m_localServer->serverError() == QAbstractSocket::AddressInUseError)
+    {
+        QLocalSocket probeSocket;
+        probeSocket.connectToServer(p_serverName);
+
+        if(probeSocket.waitForConnected(STALE_SOCKET_PROBE_MSECS))
+        {
+            probeSocket.abort();
+            return false;
+        }
+
+        QLocalServer::removeServer(p_serverName);
+        return m_localServer->listen(p_serverName);
+    }
+
+    return false;
+}
+
+void AutomationServer::stop()
+{
+    // Close the connections first so no further requests arrive
+    const QList<QLocalSocket*> connectedSockets = m_partialLineBySocket.keys();
+
+    for(QLocalSocket *connectedSocket : connectedSockets)
+    {
+        connectedSocket->disconnect(this);
+        connectedSocket->abort();
+        connectedSocket->deleteLater();
+    }
+
+    m_partialLineBySocket.clear();
+    m_localServer->close();
+}
+
+bool AutomationServer::isListening() const
+{
+    return m_localServer->isListening();
+}
+
+QString AutomationServer::errorString() const
+{
+    return m_localServer->errorString();
+}
+
+quint64 AutomationServer::handledRequestCount() const
+{
+    return m_handledRequestCount;
+}
+
+QJsonObject AutomationServer::errorResponse(const QJsonObject &p_request, const QString &p_errorText)
+{
+    QJsonObject response;
+    response.insert(ID_KEY, p_request.value(ID_KEY));
+    response.insert(OK_KEY, false);
+    response.insert(ERROR_KEY, p_errorText);
+    return response;
+}
+
+QJsonObject AutomationServer::successResponse(const QJsonObject &p_request)
+{
+    QJsonObject response;
+    response.insert(ID_KEY, p_request.value(ID_KEY));
+    response.insert(OK_KEY, true);
+    return response;
+}
+
+void AutomationServer::acceptConnections()
+{
+    // Take every connection which is waiting
+    while(m_localServer->hasPendingConnections())
+    {
+        QLocalSocket *clientSocket = m_localServer->nextPendingConnection();
+        m_partialLineBySocket.insert(clientSocket, QByteArray());
+
+        // Read the client's requests as they arrive, and forget it once it disconnects
+        connect(clientSocket, SIGNAL(readyRead()), this, SLOT(readRequests()), Qt::AutoConnection);
+        connect(clientSocket, SIGNAL(disconnected()), this, SLOT(discardConnection()), Qt::AutoConnection);
+    }
+}
+
+void AutomationServer::readRequests()
+{
+    QLocalSocket *clientSocket = qobject_cast<QLocalSocket*>(sender());
+
+    if(clientSocket == nullptr || !m_partialLineBySocket.contains(clientSocket))
+    {
+        return;
+    }
+
+    // Add the new data after whatever was left over from the last read
+    QByteArray &pendingData = m_partialLineBySocket[clientSocket];
+    pendingData.append(clientSocket->readAll());
+    int lastNewlineIndex = pendingData.lastIndexOf('\n');
+
+    // Wait for the rest of an incomplete line, unless it has grown unreasonably long
+    if(lastNewlineIndex < 0)
+    {
+        if(pendingData.size() > m_MAX_LINE_LENGTH)
+        {
+            clientSocket->abort();
+        }
+
+        return;
+    }
+
+    // Take every complete line, keeping an incomplete last line for the next read
+    const QList<QByteArray> requestLines = pendingData.left(lastNewlineIndex).split('\n');
+    pendingData.remove(0, lastNewlineIndex + 1);
+
+    // An incomplete last line which is already unreasonably long is refused just as one arriving without any complete line before it
+    if(pendingData.size() > m_MAX_LINE_LENGTH)
+    {
+        clientSocket->abort();
+        return;
+    }
+
+    // Flatten the lines, including the requests of batch lines, into a single batch
+    QVector<QJsonObject> batchRequests;
+    QVector<LineResponse> lineResponses;
+
+    for(const QByteArray &requestLine : requestLines)
+    {
+        if(requestLine.trimmed().isEmpty())
+        {
+            continue;
+        }
+
+        LineResponse lineResponse;
+        lineResponse.firstRequestIndex = batchRequests.size();
+
+        QJsonParseError parseError;
+        QJsonDocument requestDocument = QJsonDocument::fromJson(requestLine, &parseError);
+
+        // Lines which are not JSON objects are answered with an error without reaching the handler
+        if(!requestDocument.isObject())
+        {
+            lineResponse.errorText = m_PARSE_ERROR_TEXT.arg(parseError.errorString());
+            lineResponses.append(lineResponse);
+            continue;
+        }
+
+        lineResponse.lineRequest = requestDocument.object();
+
+        if(lineResponse.lineRequest.value(OPERATION_KEY).toString() == BATCH_OPERATION)
+        {
+            lineResponse.isBatch = true;
+
+            for(const QJsonValue &batchedRequest : lineResponse.lineRequest.value(BATCH_REQUESTS_KEY).toArray())
+            {
+                batchRequests.append(batchedRequest.toObject());
+            }
+        }
+        else
+        {
+            batchRequests.append(lineResponse.lineRequest);
+        }
+
+        lineResponse.requestCount = batchRequests.size() - lineResponse.firstRequestIndex;
+        lineResponses.append(lineResponse);
+    }
+
+    // Apply every request read together, as a single change to the bills
+    QVector<QJsonObject> batchResponses;
+
+    if(!batchRequests.isEmpty())
+    {
+        batchResponses = m_batchHandler(batchRequests);
+        m_handledRequestCount += batchRequests.size();
+    }
+
+    // Answer each line in the order it was received, writing every response at once
+    QByteArray responseData;
+
+    for(const LineResponse &lineResponse : lineResponses)
+    {
+        QJsonObject response;
+
+        if(!lineResponse.errorText.isEmpty())
+        {
+            response = errorResponse(lineResponse.lineRequest, lineResponse.errorText);
+        }
+        else if(lineResponse.isBatch)
+        {
+            QJsonArray batchedResponses;
+
+            for(int requestIndex = lineResponse.firstRequestIndex; requestIndex < lineResponse.firstRequestIndex + lineResponse.requestCount; requestIndex++)
+            {
+                batchedResponses.append(batchResponses.value(requestIndex));
+            }
+
+            response = successResponse(lineResponse.lineRequest);
+            response.insert(BATCH_RESPONSES_KEY, batchedResponses);
+        }
+        else
+        {
+            response = batchResponses.value(lineResponse.firstRequestIndex);
+        }
+
+        responseData.append(QJsonDocument(response).toJson(QJsonDocument::Compact));
+        responseData.append('\n');
+    }
+
+    clientSocket->write(responseData);
+}
+
+void AutomationServer::discardConnection()
+{
+    QLocalSocket *clientSocket = qobject_cast<QLocalSocket*>(sender());
+
+    // Forget the client and let Qt delete its socket once it is safe to
+    if(clientSocket != nullptr && m_partialLineBySocket.remove(clientSocket) > 0)
+    {
+        clientSocket->deleteLater();
+    }
+}
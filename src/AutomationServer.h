@@ -0,0 +1,123 @@
+/*##################################################################################
+#   File name:          AutomationServer.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for an AutomationServer
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef AUTOMATIONSERVER_H
+#define AUTOMATIONSERVER_H
+
+// Qt includes
+#include <QHash>
+#include <QJsonObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QObject>
+#include <QVector>
+
+#include <functional>
+
+/**
+ * @brief The AutomationServer class lets scripts on the same machine manage bills through a local socket, rather than editing the config file behind the application's back.
+ * Requests and responses are JSON objects, one per line. A client may pipeline requests by sending many lines without waiting for their responses,
+ * and may group requests into a single line with the "batch" operation. Every request read from a connection at once is handed to the batch handler together,
+ * so thousands of pipelined operations are applied as one change to the bills and saved once. Responses are written in the order the requests were received.
+ * The socket only accepts connections from the user running the application.
+ */
+class AutomationServer : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    using BatchHandler = std::function<QVector<QJsonObject>(const QVector<QJsonObject>&)>; //!< Applies a batch of requests together and returns one response per request, in order.
+
+    /**
+     * @brief Constructs an AutomationServer which is not yet listening.
+     * @param p_batchHandler - Applies each batch of requests read from a connection.
+     * @param p_parent - Parent object used for object tree tracking.
+     */
+    explicit AutomationServer(BatchHandler p_batchHandler, QObject *p_parent = nullptr);
+
+    /**
+     * @brief Destructs the AutomationServer by closing every connection.
+     */
+    ~AutomationServer();
+
+    /**
+     * @brief Starts listening for connections, replacing a socket left behind by an instance which exited without closing it.
+     * @param p_serverName - The name of the local socket clients connect to.
+     * @return True if the server is listening.
+     */
+    bool start(const QString &p_serverName);
+
+    /**
+     * @brief Stops listening and closes every connection.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether or not the server is listening for connections.
+     * @return True if listening.
+     */
+    bool isListening() const;
+
+    /**
+     * @brief Returns a human readable description of the last error, such as why the server could not start listening.
+     * @return The error description.
+     */
+    QString errorString() const;
+
+    /**
+     * @brief Returns the number of requests handled since the server was constructed.
+     * @return The number of requests.
+     */
+    quint64 handledRequestCount() const;
+
+    /**
+     * @brief Creates a response reporting that a request failed.
+     * @param p_request - The request which failed, whose id is copied into the response.
+     * @param p_errorText - Why the request failed.
+     * @return The response.
+     */
+    static QJsonObject errorResponse(const QJsonObject &p_request, const QString &p_errorText);
+
+    /**
+     * @brief Creates a response reporting that a request succeeded, to which any results can be added.
+     * @param p_request - The request which succeeded, whose id is copied into the response.
+     * @return The response.
+     */
+    static QJsonObject successResponse(const QJsonObject &p_request);
+
+private slots:
+
+    /**
+     * @brief Called when a client connects. Starts buffering the lines it sends.
+     */
+    void acceptConnections();
+
+    /**
+     * @brief Called when a client sends data. Handles every complete line received so far as one batch and writes the responses back.
+     */
+    void readRequests();
+
+    /**
+     * @brief Called when a client disconnects. Discards its buffered data.
+     */
+    void discardConnection();
+
+private:
+
+    const int m_MAX_LINE_LENGTH = 64 * 1024 * 1024; //!< The longest line accepted, clients sending longer lines are disconnected rather than buffered indefinitely.
+    const QString m_PARSE_ERROR_TEXT = "Request is not a JSON object: %1"; //!< Response text for lines which cannot be parsed.
+
+    BatchHandler m_batchHandler; //!< Applies each batch of requests read from a connection.
+    QLocalServer *m_localServer = nullptr; //!< The server listening on the local socket.
+    QHash<QLocalSocket*, QByteArray> m_partialLineBySocket; //!< The data received from each connection after its last complete line.
+    quint64 m_handledRequestCount = 0; //!< The number of requests handled since construction.
+};
+
+#endif // AUTOMATIONSERVER_H
@@ -0,0 +1,392 @@
+/*##################################################################################
+#   File name:          BalanceHistory.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BalanceHistory
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BalanceHistory.h"
+
+#include <QFile>
+
+#include <algorithm>
+
+namespace
+{
+    const QDataStream::Version HISTORY_STREAM_VERSION = QDataStream::Qt_5_12; //!< Pinned so history files read the same across Qt versions.
+}
+
+bool BalanceHistory::Snapshot::hasSameTotals(const Snapshot &p_otherSnapshot) const
+{
+    return availableCents == p_otherSnapshot.availableCents && fundedCents == p_otherSnapshot.fundedCents && outstandingCents == p_otherSnapshot.outstandingCents
+           && currencyIndex == p_otherSnapshot.currencyIndex;
+}
+
+QString BalanceHistory::resolutionToString(Resolution p_resolution)
+{
+    switch(p_resolution)
+    {
+        case Daily :
+        {
+            return "Daily";
+        }
+
+        case Weekly :
+        {
+            return "Weekly";
+        }
+
+        case Monthly :
+        {
+            return "Monthly";
+        }
+
+        default :
+        {
+            return "Every Save";
+        }
+    }
+}
+
+bool BalanceHistory::open(const QString &p_historyFilePath)
+{
+    m_historyFilePath = p_historyFilePath;
+    m_readFileSize = 0;
+    m_snapshots.clear();
+
+    for(int resolution = 0; resolution < ResolutionCount; resolution++)
+    {
+        m_rollups[resolution].clear();
+    }
+
+    QFile historyFile(m_historyFilePath);
+
+    // A missing history is created by the first snapshot appended
+    if(!historyFile.exists())
+    {
+        return true;
+    }
+
+    // If the history cannot be opened or does not start with the history header, set it aside and start fresh rather than lose it
+    quint32 fileMagic = 0;
+    quint16 fileVersion = 0;
+    bool isHeaderValid = false;
+    qint64 completeRecordsEnd = 0;
+    qint64 historyFileSize = historyFile.size();
+
+    if(historyFile.open(QIODevice::ReadOnly))
+    {
+        QDataStream historyStream(&historyFile);
+        historyStream.setVersion(HISTORY_STREAM_VERSION);
+        historyStream >> fileMagic >> fileVersion;
+        isHeaderValid = historyStream.status() == QDataStream::Ok && fileMagic == m_HISTORY_FILE_MAGIC && fileVersion == m_HISTORY_FILE_VERSION;
+        completeRecordsEnd = historyFile.pos();
+
+        // Read every complete snapshot, rolling each up as it is read so opening takes a single pass
+        if(isHeaderValid)
+        {
+            completeRecordsEnd = readSnapshots(historyStream);
+        }
+
+        historyFile.close();
+    }
+
+    if(!isHeaderValid)
+    {
+        m_snapshots.clear();
+
+        for(int resolution = 0; resolution < ResolutionCount; resolution++)
+        {
+            m_rollups[resolution].clear();
+        }
+
+        QFile::remove(m_historyFilePath + ".corrupt");
+        return QFile::rename(m_historyFilePath, m_historyFilePath + ".corrupt");
+    }
+
+    // Cut off a partial snapshot left over from an interrupted append, so later appends start on a record boundary
+    m_readFileSize = completeRecordsEnd;
+
+    if(completeRecordsEnd < historyFileSize)
+    {
+        return QFile::resize(m_historyFilePath, completeRecordsEnd);
+    }
+
+    return true;
+}
+
+bool BalanceHistory::refresh()
+{
+    if(m_historyFilePath.isEmpty())
+    {
+        return false;
+    }
+
+    QFile historyFile(m_historyFilePath);
+    qint64 historyFileSize = historyFile.exists() ? historyFile.size() : 0;
+
+    // Nothing was appended since the last read
+    if(historyFileSize == m_readFileSize)
+    {
+        return true;
+    }
+
+    // A history which was replaced, cut short, or started since is read from the beginning
+    if(historyFileSize < m_readFileSize || m_readFileSize == 0)
+    {
+        return open(m_historyFilePath);
+    }
+
+    if(!historyFile.open(QIODevice::ReadOnly) || !historyFile.seek(m_readFileSize))
+    {
+        return false;
+    }
+
+    // Read on from the end of the last snapshot read, the rollups only ever growing at their ends
+    QDataStream historyStream(&historyFile);
+    historyStream.setVersion(HISTORY_STREAM_VERSION);
+    m_readFileSize = readSnapshots(historyStream);
+    return true;
+}
+
+bool BalanceHistory::append(Snapshot p_snapshot)
+{
+    // Compare with the last snapshot saved by any instance, not just this one
+    if(!refresh())
+    {
+        return false;
+    }
+
+    if(!m_snapshots.isEmpty())
+    {
+        // Saves which left the totals as they were add nothing to the history
+        if(p_snapshot.hasSameTotals(m_snapshots.last()))
+        {
+            return true;
+        }
+
+        // Keep timestamps non-decreasing even if the system clock steps backwards, since every lookup relies on time order
+        p_snapshot.timestampMsecs = std::max(p_snapshot.timestampMsecs, m_snapshots.last().timestampMsecs);
+    }
+
+    // Open the history file for appending only, earlier snapshots are never rewritten
+    QFile historyFile(m_historyFilePath);
+
+    if(!historyFile.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        return false;
+    }
+
+    qint64 previousFileSize = historyFile.size();
+    QDataStream historyStream(&historyFile);
+    historyStream.setVersion(HISTORY_STREAM_VERSION);
+
+    if(previousFileSize == 0)
+    {
+        historyStream << m_HISTORY_FILE_MAGIC << m_HISTORY_FILE_VERSION;
+    }
+
+    // Write the fields in a fixed order, every snapshot taking the same number of bytes
+    historyStream << p_snapshot.timestampMsecs << p_snapshot.availableCents << p_snapshot.fundedCents << p_snapshot.outstandingCents << p_snapshot.currencyIndex;
+
+    // Cut off whatever part of the snapshot was written if the write failed, so the next append does not start mid-record
+    if(historyStream.status() != QDataStream::Ok || !historyFile.flush())
+    {
+        historyFile.resize(previousFileSize);
+        return false;
+    }
+
+    qint64 writtenFileSize = historyFile.size();
+    historyFile.close();
+
+    // If another instance appended between the refresh and this write, read the history again so its snapshots are kept in file order
+    if(previousFileSize != m_readFileSize)
+    {
+        return open(m_historyFilePath);
+    }
+
+    // Mirror the append in memory
+    m_readFileSize = writtenFileSize;
+    m_snapshots.append(p_snapshot);
+    rollUp(p_snapshot);
+    return true;
+}
+
+qint64 BalanceHistory::readSnapshots(QDataStream &p_historyStream)
+{
+    qint64 completeRecordsEnd = p_historyStream.device()->pos();
+
+    while(!p_historyStream.atEnd())
+    {
+        Snapshot snapshot;
+        p_historyStream >> snapshot.timestampMsecs >> snapshot.availableCents >> snapshot.fundedCents >> snapshot.outstandingCents >> snapshot.currencyIndex;
+
+        // A partially written snapshot at the end of the file is still being appended, or was left over from an interrupted append
+        if(p_historyStream.status() != QDataStream::Ok)
+        {
+            break;
+        }
+
+        // Keep the snapshots in time order even if two instances' clocks disagree
+        if(!m_snapshots.isEmpty())
+        {
+            snapshot.timestampMsecs = std::max(snapshot.timestampMsecs, m_snapshots.last().timestampMsecs);
+        }
+
+        m_snapshots.append(snapshot);
+        rollUp(snapshot);
+        completeRecordsEnd = p_historyStream.device()->pos();
+    }
+
+    return completeRecordsEnd;
+}
+
+void BalanceHistory::rollUp(const Snapshot &p_snapshot)
+{
+    QDate snapshotDate = QDateTime::fromMSecsSinceEpoch(p_snapshot.timestampMsecs).date();
+
+    for(int resolution = Daily; resolution < ResolutionCount; resolution++)
+    {
+        QVector<Period> &periods = m_rollups[resolution];
+        QDate startDate = periodStartDate(snapshotDate, static_cast<Resolution>(resolution));
+
+        // Snapshots arrive in time order, so only the last period can still change, a snapshot dated earlier after a time zone change joining it too
+        if(periods.isEmpty() || startDate > periods.last().startDate)
+        {
+            Period period = periodForSnapshot(p_snapshot);
+            period.startDate = startDate;
+            periods.append(period);
+            continue;
+        }
+
+        Period &lastPeriod = periods.last();
+        lastPeriod.lastTimestampMsecs = p_snapshot.timestampMsecs;
+        lastPeriod.closeAvailableCents = p_snapshot.availableCents;
+        lastPeriod.lowAvailableCents = std::min(lastPeriod.lowAvailableCents, p_snapshot.availableCents);
+        lastPeriod.highAvailableCents = std::max(lastPeriod.highAvailableCents, p_snapshot.availableCents);
+        lastPeriod.closeFundedCents = p_snapshot.fundedCents;
+        lastPeriod.closeOutstandingCents = p_snapshot.outstandingCents;
+        lastPeriod.highOutstandingCents = std::max(lastPeriod.highOutstandingCents, p_snapshot.outstandingCents);
+        lastPeriod.currencyIndex = p_snapshot.currencyIndex;
+        lastPeriod.snapshotCount++;
+    }
+}
+
+QDate BalanceHistory::periodStartDate(const QDate &p_date, Resolution p_resolution)
+{
+    switch(p_resolution)
+    {
+        case Weekly :
+        {
+            return p_date.addDays(1 - p_date.dayOfWeek());
+        }
+
+        case Monthly :
+        {
+            return QDate(p_date.year(), p_date.month(), 1);
+        }
+
+        default :
+        {
+            return p_date;
+        }
+    }
+}
+
+BalanceHistory::Period BalanceHistory::periodForSnapshot(const Snapshot &p_snapshot)
+{
+    Period period;
+    period.startDate = QDateTime::fromMSecsSinceEpoch(p_snapshot.timestampMsecs).date();
+    period.firstTimestampMsecs = p_snapshot.timestampMsecs;
+    period.lastTimestampMsecs = p_snapshot.timestampMsecs;
+    period.openAvailableCents = p_snapshot.availableCents;
+    period.closeAvailableCents = p_snapshot.availableCents;
+    period.lowAvailableCents = p_snapshot.availableCents;
+    period.highAvailableCents = p_snapshot.availableCents;
+    period.closeFundedCents = p_snapshot.fundedCents;
+    period.closeOutstandingCents = p_snapshot.outstandingCents;
+    period.highOutstandingCents = p_snapshot.outstandingCents;
+    period.currencyIndex = p_snapshot.currencyIndex;
+    period.snapshotCount = 1;
+    return period;
+}
+
+void BalanceHistory::findRange(const QDateTime &p_from, const QDateTime &p_to, Resolution p_resolution, int &p_firstPosition, int &p_endPosition) const
+{
+    qint64 fromMsecs = p_from.toMSecsSinceEpoch();
+    qint64 toMsecs = p_to.toMSecsSinceEpoch();
+
+    if(p_resolution == Snapshots)
+    {
+        // Binary search for the first snapshot in range and the first one after it
+        p_firstPosition = std::lower_bound(m_snapshots.cbegin(), m_snapshots.cend(), fromMsecs, [](const Snapshot &p_snapshot, qint64 p_fromMsecs)
+        {
+            return p_snapshot.timestampMsecs < p_fromMsecs;
+        }) - m_snapshots.cbegin();
+
+        p_endPosition = std::upper_bound(m_snapshots.cbegin(), m_snapshots.cend(), toMsecs, [](qint64 p_toMsecs, const Snapshot &p_snapshot)
+        {
+            return p_toMsecs < p_snapshot.timestampMsecs;
+        }) - m_snapshots.cbegin();
+    }
+    else
+    {
+        const QVector<Period> &periods = m_rollups[p_resolution];
+
+        // A period overlaps the range if it ends at or after its start and begins at or before its end, both of which only ever grow along the rollup
+        p_firstPosition = std::lower_bound(periods.cbegin(), periods.cend(), fromMsecs, [](const Period &p_period, qint64 p_fromMsecs)
+        {
+            return p_period.lastTimestampMsecs < p_fromMsecs;
+        }) - periods.cbegin();
+
+        p_endPosition = std::upper_bound(periods.cbegin(), periods.cend(), toMsecs, [](qint64 p_toMsecs, const Period &p_period)
+        {
+            return p_toMsecs < p_period.firstTimestampMsecs;
+        }) - periods.cbegin();
+    }
+
+    p_endPosition = std::max(p_firstPosition, p_endPosition);
+}
+
+QVector<BalanceHistory::Period> BalanceHistory::periodsBetween(const QDateTime &p_from, const QDateTime &p_to, Resolution p_resolution) const
+{
+    QVector<Period> periods;
+    int firstPosition = 0;
+    int endPosition = 0;
+    findRange(p_from, p_to, p_resolution, firstPosition, endPosition);
+    periods.reserve(endPosition - firstPosition);
+
+    // Copy out only the periods in range
+    for(int position = firstPosition; position < endPosition; position++)
+    {
+        periods.append(p_resolution == Snapshots ? periodForSnapshot(m_snapshots.at(position)) : m_rollups[p_resolution].at(position));
+    }
+
+    return periods;
+}
+
+BalanceHistory::Resolution BalanceHistory::resolutionFor(const QDateTime &p_from, const QDateTime &p_to, int p_maxPeriodCount) const
+{
+    // Try each resolution from the finest, counting its periods in range without reading them
+    for(int resolution = Snapshots; resolution < Monthly; resolution++)
+    {
+        int firstPosition = 0;
+        int endPosition = 0;
+        findRange(p_from, p_to, static_cast<Resolution>(resolution), firstPosition, endPosition);
+
+        if(endPosition - firstPosition <= p_maxPeriodCount)
+        {
+            return static_cast<Resolution>(resolution);
+        }
+    }
+
+    return Monthly;
+}
+
+int BalanceHistory::snapshotCount() const
+{
+    // Return the number of snapshots, not counting the rollups
+    return m_snapshots.size();
+}
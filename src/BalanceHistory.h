@@ -0,0 +1,183 @@
+/*##################################################################################
+#   File name:          BalanceHistory.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BalanceHistory
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BALANCEHISTORY_H
+#define BALANCEHISTORY_H
+
+// Qt includes
+#include <QDataStream>
+#include <QDate>
+#include <QDateTime>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The BalanceHistory class is an append-only time series of the amount available and the funded and outstanding totals, with a snapshot appended to a binary history file on every save.
+ * Alongside the snapshots, daily, weekly, and monthly rollups holding the opening, closing, lowest, and highest amount available of each period are kept up to date as each snapshot is appended.
+ * Every resolution is kept in time order, so a range of any length is found by binary search and read in time proportional to the points returned, however many years of snapshots there are.
+ */
+class BalanceHistory
+{
+
+public:
+
+    /**
+     * @brief The Resolution enum lists the zoom levels the history can be read at.
+     */
+    enum Resolution
+    {
+        Snapshots,
+        Daily,
+        Weekly,
+        Monthly,
+        ResolutionCount
+    };
+
+    /**
+     * @brief The Snapshot struct is the totals as they were saved at one moment.
+     */
+    struct Snapshot
+    {
+        qint64 timestampMsecs = 0; //!< When the totals were saved, in milliseconds since the epoch.
+        qint64 availableCents = 0; //!< The amount available in cents.
+        qint64 fundedCents = 0; //!< The amount due of the funded bills in cents, in the currency of the amount available.
+        qint64 outstandingCents = 0; //!< The amount due of the unfunded bills in cents, in the currency of the amount available.
+        quint8 currencyIndex = 0; //!< The CurrencyRegistry index of the currency of the amount available.
+
+        /**
+         * @brief Returns whether or not two snapshots hold the same totals, whenever they were taken.
+         * @param p_otherSnapshot - The other snapshot.
+         * @return True if the totals and currency are the same.
+         */
+        bool hasSameTotals(const Snapshot &p_otherSnapshot) const;
+    };
+
+    /**
+     * @brief The Period struct is the totals over one period of a resolution, or over a single snapshot.
+     */
+    struct Period
+    {
+        QDate startDate; //!< The first day of the period, the day of the snapshot for single snapshots.
+        qint64 firstTimestampMsecs = 0; //!< When the period's first snapshot was taken.
+        qint64 lastTimestampMsecs = 0; //!< When the period's last snapshot was taken.
+        qint64 openAvailableCents = 0; //!< The amount available at the period's first snapshot.
+        qint64 closeAvailableCents = 0; //!< The amount available at the period's last snapshot.
+        qint64 lowAvailableCents = 0; //!< The lowest amount available during the period.
+        qint64 highAvailableCents = 0; //!< The highest amount available during the period.
+        qint64 closeFundedCents = 0; //!< The amount due of the funded bills at the period's last snapshot.
+        qint64 closeOutstandingCents = 0; //!< The amount due of the unfunded bills at the period's last snapshot.
+        qint64 highOutstandingCents = 0; //!< The highest amount due of the unfunded bills during the period.
+        quint8 currencyIndex = 0; //!< The currency of the amounts at the period's last snapshot.
+        int snapshotCount = 0; //!< The number of snapshots in the period.
+    };
+
+    /**
+     * @brief Opens a history file, reading its snapshots and rolling them up. A missing history file is created once the first snapshot is appended.
+     * If the file is unreadable, it is set aside with a ".corrupt" suffix and a fresh history is started.
+     * @param p_historyFilePath - The path of the history file.
+     * @return True if the history is ready to be appended to.
+     */
+    bool open(const QString &p_historyFilePath);
+
+    /**
+     * @brief Reads the snapshots other instances, such as pft, appended since the history was opened or last read, reopening it if it was replaced or cut short.
+     * A snapshot still being written is left for the next refresh.
+     * @return False if the history file could not be read.
+     */
+    bool refresh();
+
+    /**
+     * @brief Appends a snapshot and folds it into the rollups, after reading any snapshots other instances appended. A snapshot whose totals are the same as the last one's is skipped,
+     * so saves which changed nothing do not grow the history.
+     * @param p_snapshot - The snapshot, whose timestamp is moved up to the last snapshot's if the system clock stepped backwards.
+     * @return True if the snapshot was written or skipped, false if the history file could not be written, in which case it is cut back to the size it had before.
+     */
+    bool append(Snapshot p_snapshot);
+
+    /**
+     * @brief Returns the periods of a resolution which overlap a time range, found by binary search.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @param p_resolution - The resolution, snapshots being returned as periods of one snapshot each.
+     * @return The periods in time order.
+     */
+    QVector<Period> periodsBetween(const QDateTime &p_from, const QDateTime &p_to, Resolution p_resolution) const;
+
+    /**
+     * @brief Chooses the finest resolution whose periods overlapping a time range number no more than a limit, counting them by binary search rather than reading them.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @param p_maxPeriodCount - The most periods wanted, such as the number of rows or pixels available.
+     * @return The finest resolution within the limit, or Monthly if none is.
+     */
+    Resolution resolutionFor(const QDateTime &p_from, const QDateTime &p_to, int p_maxPeriodCount) const;
+
+    /**
+     * @brief Returns the number of snapshots in the history.
+     * @return The number of snapshots.
+     */
+    int snapshotCount() const;
+
+    /**
+     * @brief Returns the human readable name of a resolution.
+     * @param p_resolution - The resolution.
+     * @return The name of the resolution.
+     */
+    static QString resolutionToString(Resolution p_resolution);
+
+private:
+
+    /**
+     * @brief Folds a snapshot into the last period of each rollup, or starts a new period if the snapshot falls after it.
+     * @param p_snapshot - The snapshot.
+     */
+    void rollUp(const Snapshot &p_snapshot);
+
+    /**
+     * @brief Reads the complete snapshots from a history stream's position to the end of the file, adding each to the history and rolling it up.
+     * @param p_historyStream - The stream, positioned at the start of a snapshot.
+     * @return The file position just past the last complete snapshot read.
+     */
+    qint64 readSnapshots(QDataStream &p_historyStream);
+
+    /**
+     * @brief Returns the first day of the period of a resolution which a day falls in.
+     * @param p_date - The day.
+     * @param p_resolution - The resolution.
+     * @return The day itself for daily periods, the Monday on or before it for weekly periods, and the first of its month for monthly periods.
+     */
+    static QDate periodStartDate(const QDate &p_date, Resolution p_resolution);
+
+    /**
+     * @brief Returns a snapshot as a period of one snapshot.
+     * @param p_snapshot - The snapshot.
+     * @return The period.
+     */
+    static Period periodForSnapshot(const Snapshot &p_snapshot);
+
+    /**
+     * @brief Finds the positions of the snapshots or periods of a resolution which overlap a time range.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @param p_resolution - The resolution.
+     * @param p_firstPosition - Set to the position of the first overlapping snapshot or period.
+     * @param p_endPosition - Set to one past the position of the last overlapping snapshot or period.
+     */
+    void findRange(const QDateTime &p_from, const QDateTime &p_to, Resolution p_resolution, int &p_firstPosition, int &p_endPosition) const;
+
+    const quint32 m_HISTORY_FILE_MAGIC = 0x50465448; //!< Identifies a history file, "PFTH" in ASCII.
+    const quint16 m_HISTORY_FILE_VERSION = 1; //!< The version of the history file format.
+
+    QString m_historyFilePath; //!< The path of the history file.
+    qint64 m_readFileSize = 0; //!< How many bytes of the history file have been read or written, the next refresh reading on from there.
+    QVector<Snapshot> m_snapshots; //!< Every snapshot in the history, in time order.
+    QVector<Period> m_rollups[ResolutionCount]; //!< The periods of each rolled up resolution in time order, the Snapshots entry being unused.
+};
+
+#endif // BALANCEHISTORY_H
@@ -0,0 +1,191 @@
+/*##################################################################################
+#   File name:          BalanceHistoryWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BalanceHistoryWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BalanceHistoryWidget.h"
+#include "BillWidget.h"
+#include "CurrencyRegistry.h"
+
+#include <QHeaderView>
+
+BalanceHistoryWidget::BalanceHistoryWidget(const BalanceHistory *p_balanceHistory) : m_balanceHistory(p_balanceHistory)
+{
+    // Set the title and size of the BalanceHistoryWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(700, 400);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When either end of the range or the resolution changes, list the history again
+    connect(m_fromDateInput, SIGNAL(dateChanged(QDate)), this, SLOT(refreshHistory()), Qt::AutoConnection);
+    connect(m_toDateInput, SIGNAL(dateChanged(QDate)), this, SLOT(refreshHistory()), Qt::AutoConnection);
+    connect(m_resolutionInput, SIGNAL(currentIndexChanged(int)), this, SLOT(refreshHistory()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the BalanceHistoryWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+BalanceHistoryWidget::~BalanceHistoryWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_fromDateLabel);
+    deleteLabelIfNonNull(m_toDateLabel);
+    deleteLabelIfNonNull(m_resolutionLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the start of range date edit was created successfully
+    if(m_fromDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_fromDateInput;
+        m_fromDateInput = nullptr;
+    }
+
+    // If the end of range date edit was created successfully
+    if(m_toDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_toDateInput;
+        m_toDateInput = nullptr;
+    }
+
+    // If the resolution combo box was created successfully
+    if(m_resolutionInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_resolutionInput;
+        m_resolutionInput = nullptr;
+    }
+
+    // If the history table widget was created successfully
+    if(m_historyTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_historyTableWidget;
+        m_historyTableWidget = nullptr;
+    }
+}
+
+void BalanceHistoryWidget::initializeWidget()
+{
+    // Create the range date labels and associated date edits, covering the past few months by default
+    m_fromDateLabel = new QLabel(this);
+    m_fromDateLabel->setText(m_FROM_DATE_LABEL_TEXT);
+    m_fromDateInput = new QDateEdit(this);
+    m_fromDateInput->setCalendarPopup(true);
+    m_fromDateInput->setDate(QDate::currentDate().addMonths(-m_DEFAULT_RANGE_MONTHS));
+
+    m_toDateLabel = new QLabel(this);
+    m_toDateLabel->setText(m_TO_DATE_LABEL_TEXT);
+    m_toDateInput = new QDateEdit(this);
+    m_toDateInput->setCalendarPopup(true);
+    m_toDateInput->setDate(QDate::currentDate());
+
+    // Create the resolution label and combo box, chosen automatically by default
+    m_resolutionLabel = new QLabel(this);
+    m_resolutionLabel->setText(m_RESOLUTION_LABEL_TEXT);
+    m_resolutionInput = new QComboBox(this);
+    m_resolutionInput->addItems(m_RESOLUTION_STRING.split(";"));
+
+    // Create the summary label
+    m_summaryLabel = new QLabel(this);
+
+    // Create the read-only history table
+    m_historyTableWidget = new QTableWidget(this);
+    m_historyTableWidget->setColumnCount(m_HISTORY_TABLE_HEADER_STRING.split(";").size());
+    m_historyTableWidget->setHorizontalHeaderLabels(m_HISTORY_TABLE_HEADER_STRING.split(";"));
+    m_historyTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_historyTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the Close button
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_fromDateLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_fromDateInput, 0, 1);
+    m_gridLayout->addWidget(m_toDateLabel, 0, 2);
+    m_gridLayout->addWidget(m_toDateInput, 0, 3);
+    m_gridLayout->addWidget(m_resolutionLabel, 1, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_resolutionInput, 1, 1);
+    m_gridLayout->addWidget(m_summaryLabel, 2, 0, 1, 4);
+    m_gridLayout->addWidget(m_historyTableWidget, 3, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 4, 3);
+}
+
+void BalanceHistoryWidget::refreshHistory()
+{
+    // Cover the whole of both days at the ends of the range
+    QDateTime fromDateTime(m_fromDateInput->date(), QTime(0, 0));
+    QDateTime toDateTime(m_toDateInput->date(), QTime(23, 59, 59, 999));
+
+    // Use the finest resolution which fits in a page of rows, unless one was chosen, the combo box listing automatic before the resolutions
+    BalanceHistory::Resolution resolution = m_resolutionInput->currentIndex() == 0 ? m_balanceHistory->resolutionFor(fromDateTime, toDateTime, m_MAX_AUTOMATIC_ROW_COUNT)
+                                                                                   : static_cast<BalanceHistory::Resolution>(m_resolutionInput->currentIndex() - 1);
+
+    // Retrieve only the periods in range
+    QVector<BalanceHistory::Period> periods = m_balanceHistory->periodsBetween(fromDateTime, toDateTime, resolution);
+    m_historyTableWidget->setRowCount(periods.size());
+    int periodSnapshotCount = 0;
+
+    // List each period in chronological order
+    for(int row = 0; row < periods.size(); row++)
+    {
+        const BalanceHistory::Period &period = periods.at(row);
+
+        m_historyTableWidget->setItem(row, 0, new QTableWidgetItem(periodName(period, resolution)));
+        m_historyTableWidget->setItem(row, 1, new QTableWidgetItem(formatCents(period.openAvailableCents)));
+        m_historyTableWidget->setItem(row, 2, new QTableWidgetItem(formatCents(period.closeAvailableCents)));
+        m_historyTableWidget->setItem(row, 3, new QTableWidgetItem(formatCents(period.lowAvailableCents)));
+        m_historyTableWidget->setItem(row, 4, new QTableWidgetItem(formatCents(period.highAvailableCents)));
+        m_historyTableWidget->setItem(row, 5, new QTableWidgetItem(formatCents(period.closeFundedCents)));
+        m_historyTableWidget->setItem(row, 6, new QTableWidgetItem(formatCents(period.closeOutstandingCents)));
+        m_historyTableWidget->setItem(row, 7, new QTableWidgetItem(CurrencyRegistry::codeForIndex(period.currencyIndex)));
+        m_historyTableWidget->setItem(row, 8, new QTableWidgetItem(QString::number(period.snapshotCount)));
+        periodSnapshotCount += period.snapshotCount;
+    }
+
+    // Summarize what was listed
+    m_summaryLabel->setText(periods.isEmpty() ? m_EMPTY_HISTORY_TEXT
+                                              : m_SUMMARY_LABEL_TEXT.arg(periods.size()).arg(BalanceHistory::resolutionToString(resolution).toLower())
+                                                .arg(periodSnapshotCount).arg(m_balanceHistory->snapshotCount()));
+}
+
+QString BalanceHistoryWidget::periodName(const BalanceHistory::Period &p_period, BalanceHistory::Resolution p_resolution) const
+{
+    switch(p_resolution)
+    {
+        case BalanceHistory::Daily :
+        {
+            return p_period.startDate.toString(m_DAY_STRING_FORMAT);
+        }
+
+        case BalanceHistory::Weekly :
+        {
+            return m_WEEK_STRING_FORMAT.arg(p_period.startDate.toString(m_DAY_STRING_FORMAT));
+        }
+
+        case BalanceHistory::Monthly :
+        {
+            return p_period.startDate.toString(m_MONTH_STRING_FORMAT);
+        }
+
+        default :
+        {
+            return QDateTime::fromMSecsSinceEpoch(p_period.firstTimestampMsecs).toString(m_SNAPSHOT_STRING_FORMAT);
+        }
+    }
+}
+
+QString BalanceHistoryWidget::formatCents(qint64 p_cents)
+{
+    return QString::number(p_cents / 100.0, 'f', 2);
+}
@@ -0,0 +1,113 @@
+/*##################################################################################
+#   File name:          BalanceHistoryWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BalanceHistoryWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BALANCEHISTORYWIDGET_H
+#define BALANCEHISTORYWIDGET_H
+
+// Local file includes
+#include "BalanceHistory.h"
+
+// Qt includes
+#include <QComboBox>
+#include <QDateEdit>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The BalanceHistoryWidget class represents a pop-up window which shows how the amount available and the funded and outstanding totals changed over a chosen range, as saved into the BalanceHistory.
+ * The range can be listed at every save or by day, week, or month, and is listed at the finest of these which fits in a page of rows unless one is chosen.
+ */
+class BalanceHistoryWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget displaying a balance history.
+     * @param p_balanceHistory - The history displayed, owned by the caller.
+     */
+    BalanceHistoryWidget(const BalanceHistory *p_balanceHistory);
+
+    /**
+     * @brief Destructs the BalanceHistoryWidget by deleting objects which were dynamically allocated.
+     */
+    ~BalanceHistoryWidget();
+
+public slots:
+
+    /**
+     * @brief Lists the periods of the history which overlap the selected range at the selected resolution.
+     */
+    void refreshHistory();
+
+private:
+
+    /**
+     * @brief Creates the labels, date edits, combo box, table, and button of the BalanceHistoryWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Returns the name of a period as shown in the table, such as "3/14/2026 9:30 AM", "3/14/2026", "Week of 3/9/2026", or "Mar 2026".
+     * @param p_period - The period.
+     * @param p_resolution - The resolution the period is of.
+     * @return The name of the period.
+     */
+    QString periodName(const BalanceHistory::Period &p_period, BalanceHistory::Resolution p_resolution) const;
+
+    /**
+     * @brief Formats an amount in cents with two decimal places.
+     * @param p_cents - The amount in cents.
+     * @return The amount in dollars.
+     */
+    static QString formatCents(qint64 p_cents);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Balance History"; //!< Title of the BalanceHistoryWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the BalanceHistoryWidget.
+    const BalanceHistory *m_balanceHistory = nullptr; //!< The history displayed.
+
+    // Date range fields
+    QLabel *m_fromDateLabel = nullptr; //!< Label for the date edit used for choosing the start of the range.
+    const QString m_FROM_DATE_LABEL_TEXT = "From:"; //!< Text for the label for the start of the range.
+    QDateEdit *m_fromDateInput = nullptr; //!< The date edit used for choosing the start of the range.
+    QLabel *m_toDateLabel = nullptr; //!< Label for the date edit used for choosing the end of the range.
+    const QString m_TO_DATE_LABEL_TEXT = "To:"; //!< Text for the label for the end of the range.
+    QDateEdit *m_toDateInput = nullptr; //!< The date edit used for choosing the end of the range.
+    const int m_DEFAULT_RANGE_MONTHS = 3; //!< How many months before the current date the range covers when the widget is first shown.
+
+    // Resolution fields
+    QLabel *m_resolutionLabel = nullptr; //!< Label for the combo box used for choosing the resolution.
+    const QString m_RESOLUTION_LABEL_TEXT = "Show:"; //!< Text for the label for the resolution.
+    QComboBox *m_resolutionInput = nullptr; //!< The combo box used for choosing the resolution, automatic first and then the BalanceHistory::Resolution values in order.
+    const QString m_RESOLUTION_STRING = "Automatic;Every Save;Daily;Weekly;Monthly"; //!< The resolutions listed, separated by semicolons.
+    const int m_MAX_AUTOMATIC_ROW_COUNT = 200; //!< The most rows listed when the resolution is chosen automatically.
+
+    // Summary fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the range listed.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 rows listed %2, from %3 of %4 saves recorded"; //!< Text of the summary label, given the rows, the resolution, and the saves in range and in all.
+    const QString m_EMPTY_HISTORY_TEXT = "Nothing has been saved in this range yet."; //!< Text of the summary label when nothing was saved in the range.
+
+    // History table fields
+    QTableWidget *m_historyTableWidget = nullptr; //!< Table listing the totals of each period.
+    const QString m_HISTORY_TABLE_HEADER_STRING = "Period;Open;Close;Low;High;Funded;Outstanding;Currency;Saves"; //!< The history table column titles, separated by semicolons.
+    const QString m_SNAPSHOT_STRING_FORMAT = "M/d/yyyy h:mm AP"; //!< The format used to name single saves.
+    const QString m_DAY_STRING_FORMAT = "M/d/yyyy"; //!< The format used to name daily periods, the same as the bill table's dates.
+    const QString m_WEEK_STRING_FORMAT = "Week of %1"; //!< The format used to name weekly periods, from their Monday.
+    const QString m_MONTH_STRING_FORMAT = "MMM yyyy"; //!< The format used to name monthly periods.
+
+    // Button and button text variables
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the BalanceHistoryWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // BALANCEHISTORYWIDGET_H
@@ -9,58 +9,153 @@
 
 #include "Bill.h"
 
-QString Bill::getName()
+#include <utility>
+
+const QString& Bill::getName() const noexcept
 {
-    // Return the name of the bill
+    // Return the name of the bill without copying it
     return m_name;
 }
 
-void Bill::setName(QString p_updatedName)
+void Bill::setName(const QString &p_updatedName) noexcept
 {
-    // Update the name of the bill
+    // Update the name of the bill, which shares the string's data rather than copying it
     m_name = p_updatedName;
 }
 
-double Bill::getAmountDue()
+void Bill::setName(QString &&p_updatedName) noexcept
+{
+    // Update the name of the bill by taking over the string
+    m_name = std::move(p_updatedName);
+}
+
+double Bill::getAmountDue() const noexcept
+{
+    // Return the amount due in dollars
+    return m_amountDueCents / 100.0;
+}
+
+qint64 Bill::getAmountDueCents() const noexcept
+{
+    // Return the amount due in cents
+    return m_amountDueCents;
+}
+
+void Bill::setAmountDue(double p_updatedAmountDue) noexcept
+{
+    // Update the amount due, rounded to the nearest cent so amounts such as 0.29 which are not exact in binary do not lose a cent
+    setAmountDueCents(qRound64(p_updatedAmountDue * 100.0));
+}
+
+void Bill::setAmountDueCents(qint64 p_updatedAmountDueCents) noexcept
+{
+    // Update the amount due, clamped so it fits in its bits
+    m_amountDueCents = qBound(-m_MAX_AMOUNT_DUE_CENTS, p_updatedAmountDueCents, m_MAX_AMOUNT_DUE_CENTS);
+}
+
+QDate Bill::getDueDate() const noexcept
+{
+    // Return the due date, or a null date if none was set
+    return m_dueDateDay == m_NULL_DUE_DATE_DAY ? QDate() : QDate::fromJulianDay(m_DUE_DATE_EPOCH_JULIAN_DAY + static_cast<qint64>(m_dueDateDay));
+}
+
+void Bill::setDueDate(const QDate &p_updatedDueDate) noexcept
+{
+    qint64 dueDateDay = p_updatedDueDate.toJulianDay() - m_DUE_DATE_EPOCH_JULIAN_DAY;
+
+    // Update the due date, storing dates which are invalid or do not fit in its bits as a null date
+    m_dueDateDay = (p_updatedDueDate.isValid() && dueDateDay > m_NULL_DUE_DATE_DAY && dueDateDay <= m_MAX_DUE_DATE_DAY) ? dueDateDay : m_NULL_DUE_DATE_DAY;
+}
+
+quint8 Bill::getCurrencyIndex() const noexcept
 {
-    // Return the amount due
-    return m_amountDueDollars;
+    // Return the index of the currency
+    return static_cast<quint8>(m_currencyIndex);
 }
 
-void Bill::setAmountDue(double p_updatedAmountDue)
+QString Bill::getCurrencyCode() const
 {
-    // Update the amount due
-    m_amountDueDollars = p_updatedAmountDue;
+    // Look the currency code up from its index
+    return CurrencyRegistry::codeForIndex(getCurrencyIndex());
 }
 
-QDate Bill::getDueDate()
+void Bill::setCurrencyIndex(quint8 p_updatedCurrencyIndex) noexcept
 {
-    // Return the due date
-    return m_dueDate;
+    // Update the index of the currency
+    m_currencyIndex = p_updatedCurrencyIndex;
 }
 
-void Bill::setDueDate(QDate p_updatedDueDate)
+void Bill::setCurrencyCode(const QString &p_updatedCurrencyCode)
 {
-    // Update the due date
-    m_dueDate = p_updatedDueDate;
+    // Store the currency by its index, registering it if needed
+    m_currencyIndex = CurrencyRegistry::indexForCode(p_updatedCurrencyCode);
 }
 
-bool Bill::isFunded()
+const QString& Bill::getCategory() const
+{
+    // Return the interned category without copying it
+    return LabelRegistry::categoryForIndex(m_categoryIndex);
+}
+
+const QStringList& Bill::getTags() const
+{
+    // Return the interned tags without copying them
+    return LabelRegistry::tagsForIndex(m_tagsIndex);
+}
+
+void Bill::setCategory(const QString &p_updatedCategory)
+{
+    // Store the category by its index, registering it if needed
+    m_categoryIndex = LabelRegistry::indexForCategory(p_updatedCategory);
+}
+
+void Bill::setTags(const QStringList &p_updatedTags)
+{
+    // Store the tags by their index, registering them if needed
+    m_tagsIndex = LabelRegistry::indexForTags(p_updatedTags);
+}
+
+bool Bill::isFunded() const noexcept
 {
     // Return the funded status
-    return m_isFunded;
+    return (m_flags & m_FUNDED_FLAG) != 0;
 }
 
-void Bill::setFundedStatus(bool p_updatedFundingStatus)
+void Bill::setFundedStatus(bool p_updatedFundingStatus) noexcept
 {
     // Update the funded status
-    m_isFunded = p_updatedFundingStatus;
+    m_flags = p_updatedFundingStatus ? (m_flags | m_FUNDED_FLAG) : (m_flags & ~m_FUNDED_FLAG);
+}
+
+qint64 Bill::getMaxAmountDueCents() noexcept
+{
+    // Return the largest amount due in cents which fits in its bits
+    return m_MAX_AMOUNT_DUE_CENTS;
+}
+
+bool Bill::isAmountDueInRange(double p_amountDue) noexcept
+{
+    // Compare before rounding, which is undefined for amounts far beyond what a qint64 holds, amounts which are not numbers never fitting
+    return qAbs(p_amountDue * 100.0) <= static_cast<double>(m_MAX_AMOUNT_DUE_CENTS);
+}
+
+QDate Bill::getMinDueDate() noexcept
+{
+    // Return the first day after the due date epoch, which is stored as a null date
+    return QDate::fromJulianDay(m_DUE_DATE_EPOCH_JULIAN_DAY + m_NULL_DUE_DATE_DAY + 1);
+}
+
+QDate Bill::getMaxDueDate() noexcept
+{
+    // Return the last day which fits in its bits
+    return QDate::fromJulianDay(m_DUE_DATE_EPOCH_JULIAN_DAY + m_MAX_DUE_DATE_DAY);
 }
 
 
-bool operator == (const Bill &p_firstBill, const Bill &p_secondBill)
+bool operator == (const Bill &p_firstBill, const Bill &p_secondBill) noexcept
 {
-    // If the two Bill objects have equivalent names, amounts due, due dates, and funded status, true is returned. False otherwise
-    return (p_firstBill.m_name == p_secondBill.m_name && p_firstBill.m_amountDueDollars == p_secondBill.m_amountDueDollars
-            && p_firstBill.m_dueDate == p_secondBill.m_dueDate && p_firstBill.m_isFunded == p_secondBill.m_isFunded);
+    // If the two Bill objects have equivalent names, amounts due, due dates, currencies, funded status, categories, and tags, true is returned. False otherwise, interned labels being equal exactly when their indexes are
+    return (p_firstBill.m_name == p_secondBill.m_name && p_firstBill.m_amountDueCents == p_secondBill.m_amountDueCents
+            && p_firstBill.m_dueDateDay == p_secondBill.m_dueDateDay && p_firstBill.m_currencyIndex == p_secondBill.m_currencyIndex
+            && p_firstBill.m_flags == p_secondBill.m_flags && p_firstBill.m_categoryIndex == p_secondBill.m_categoryIndex && p_firstBill.m_tagsIndex == p_secondBill.m_tagsIndex);
 }
@@ -10,10 +10,19 @@
 #ifndef BILL_H
 #define BILL_H
 
+// Local file includes
+#include "CurrencyRegistry.h"
+#include "LabelRegistry.h"
+
+// Qt includes
 #include <QDate>
+#include <QString>
+#include <QStringList>
 
 /**
  * @brief The Bill class represents a bill which a user needs to pay.
+ * Apart from its name, a Bill is packed into a single 64-bit word holding the amount due in cents, the due date as a Julian day, the CurrencyRegistry index of its currency, and flag bits, so it takes half the memory of storing a double, a QDate, and a bool side by side.
+ * That word has no bits to spare, so the category and tags are interned by the LabelRegistry and held as two 32-bit indexes beside it, every bill with the same labels sharing one copy of them.
  */
 class Bill
 {
@@ -23,76 +32,210 @@ public:
     /**
      * @brief Constructs a Bill.
      */
-    Bill() {};
+    Bill() noexcept : m_amountDueCents(0), m_dueDateDay(m_NULL_DUE_DATE_DAY), m_currencyIndex(CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX), m_flags(0),
+                      m_categoryIndex(LabelRegistry::m_EMPTY_LABEL_INDEX), m_tagsIndex(LabelRegistry::m_EMPTY_LABEL_INDEX) {};
 
     /**
      * Destructs a Bill.
      */
     ~Bill() {};
 
+    /**
+     * @brief Constructs a copy of a Bill, which shares the name's string data rather than copying it.
+     * @param p_otherBill - The Bill to copy.
+     */
+    Bill(const Bill &p_otherBill) = default;
+
+    /**
+     * @brief Constructs a Bill by taking over another Bill's name. Declared explicitly since the user-declared destructor would otherwise suppress it.
+     * @param p_otherBill - The Bill to move from.
+     */
+    Bill(Bill &&p_otherBill) noexcept = default;
+
+    /**
+     * @brief Copies another Bill into this one.
+     * @param p_otherBill - The Bill to copy.
+     * @return This Bill.
+     */
+    Bill& operator = (const Bill &p_otherBill) = default;
+
+    /**
+     * @brief Moves another Bill into this one, taking over its name.
+     * @param p_otherBill - The Bill to move from.
+     * @return This Bill.
+     */
+    Bill& operator = (Bill &&p_otherBill) noexcept = default;
+
     /**
      * @brief Allows for the comparison of Bill objects for equality.
      * @param p_firstBill - The first Bill object to compare.
      * @param p_secondBill - The second Bill object to compare.
-     * @return True if the Bill objects are equal based on their name, amount due, due date, and funded status. False otherwise.
+     * @return True if the Bill objects are equal based on their name, amount due, due date, currency, funded status, category, and tags. False otherwise.
      */
-    friend bool operator == (const Bill &p_firstBill, const Bill &p_secondBill);
+    friend bool operator == (const Bill &p_firstBill, const Bill &p_secondBill) noexcept;
 
     /**
      * @brief Returns the bill's name.
      * @return The name of the bill.
      */
-    QString getName();
+    const QString& getName() const noexcept;
 
     /**
      * @brief Returns the bill's amount due.
-     * @return The amount of money due for the bill.
+     * @return The amount of money due for the bill in dollars.
+     */
+    double getAmountDue() const noexcept;
+
+    /**
+     * @brief Returns the bill's amount due in whole cents, which is how it is stored.
+     * @return The amount of money due for the bill in cents.
      */
-    double getAmountDue();
+    qint64 getAmountDueCents() const noexcept;
 
     /**
      * @brief Returns the bill's due date.
-     * @return The due date of the bill.
+     * @return The due date of the bill, or a null date if none was set.
+     */
+    QDate getDueDate() const noexcept;
+
+    /**
+     * @brief Returns the index of the currency the amount due is in.
+     * @return The CurrencyRegistry index of the bill's currency.
      */
-    QDate getDueDate();
+    quint8 getCurrencyIndex() const noexcept;
+
+    /**
+     * @brief Returns the code of the currency the amount due is in.
+     * @return The bill's currency code, such as "USD".
+     */
+    QString getCurrencyCode() const;
+
+    /**
+     * @brief Returns the budget category of the bill.
+     * @return The bill's category, or an empty string if it has none.
+     */
+    const QString& getCategory() const;
+
+    /**
+     * @brief Returns the tags of the bill.
+     * @return The bill's tags.
+     */
+    const QStringList& getTags() const;
 
     /**
      * @brief Returns the funded status of the bill.
      * @return Whether or not the bill has been funded.
      */
-    bool isFunded();
+    bool isFunded() const noexcept;
 
     /**
      * @brief Updates the bill's name.
-     * @param The bill name.
+     * @param p_updatedName - The bill name.
      */
-    void setName(QString p_updatedName);
+    void setName(const QString &p_updatedName) noexcept;
+
+    /**
+     * @brief Updates the bill's name, taking ownership of the string rather than copying it.
+     * @param p_updatedName - The bill name.
+     */
+    void setName(QString &&p_updatedName) noexcept;
+
+    /**
+     * @brief Updates the bill's amount due, rounded to the nearest cent.
+     * @param p_updatedAmountDue - Updated amount due in dollars.
+     */
+    void setAmountDue(double p_updatedAmountDue) noexcept;
 
     /**
      * @brief Updates the bill's amount due.
-     * @param p_updatedAmountDue - Updated amount due.
+     * @param p_updatedAmountDueCents - Updated amount due in cents, clamped to the range which can be stored.
      */
-    void setAmountDue(double p_updatedAmountDue);
+    void setAmountDueCents(qint64 p_updatedAmountDueCents) noexcept;
 
     /**
      * @brief Updates the bill's due date.
-     * @param p_updatedDueDate - Updated due date.
+     * @param p_updatedDueDate - Updated due date, dates which are invalid or out of range are stored as a null date.
      */
-    void setDueDate(QDate p_updatedDueDate);
+    void setDueDate(const QDate &p_updatedDueDate) noexcept;
+
+    /**
+     * @brief Updates the currency the amount due is in.
+     * @param p_updatedCurrencyIndex - The CurrencyRegistry index of the updated currency.
+     */
+    void setCurrencyIndex(quint8 p_updatedCurrencyIndex) noexcept;
+
+    /**
+     * @brief Updates the currency the amount due is in, registering the currency if it has not been seen before.
+     * @param p_updatedCurrencyCode - The updated currency code, invalid codes are stored as the default currency.
+     */
+    void setCurrencyCode(const QString &p_updatedCurrencyCode);
+
+    /**
+     * @brief Updates the budget category of the bill, registering the category if it has not been seen before.
+     * @param p_updatedCategory - The updated category, empty for none.
+     */
+    void setCategory(const QString &p_updatedCategory);
+
+    /**
+     * @brief Updates the tags of the bill, registering the tag list if it has not been seen before.
+     * @param p_updatedTags - The updated tags.
+     */
+    void setTags(const QStringList &p_updatedTags);
 
     /**
      * @brief Updates the bill's funded status.
      * @param p_updatedFundedStatus - Updated funded status.
      */
-    void setFundedStatus(bool p_updatedFundedStatus);
+    void setFundedStatus(bool p_updatedFundedStatus) noexcept;
+
+    /**
+     * @brief Returns the largest amount due a bill can hold, larger amounts being clamped to it.
+     * @return The largest amount due in cents.
+     */
+    static qint64 getMaxAmountDueCents() noexcept;
+
+    /**
+     * @brief Returns whether or not an amount due fits in a bill without being clamped, so bills read from a file can be rejected rather than silently changed.
+     * @param p_amountDue - The amount due in dollars.
+     * @return True if the amount due fits.
+     */
+    static bool isAmountDueInRange(double p_amountDue) noexcept;
+
+    /**
+     * @brief Returns the earliest due date a bill can hold, earlier dates being stored as a null date.
+     * @return The earliest due date.
+     */
+    static QDate getMinDueDate() noexcept;
+
+    /**
+     * @brief Returns the latest due date a bill can hold, later dates being stored as a null date.
+     * @return The latest due date.
+     */
+    static QDate getMaxDueDate() noexcept;
 
 private:
 
-    QString m_name = ""; //!< The name of the bill, defaulted to an empty string.
-    double m_amountDueDollars = 0.00; //!< The amount of money owed for the bill in dollars and cents, defaulted to zero.
-    QDate m_dueDate; //!< The date that the bill is due, no default for now.
-    bool m_isFunded = false; //!< Whether or not the bill has been funded yet, defaulted to false.
+    static constexpr int m_AMOUNT_DUE_BITS = 38; //!< The number of bits holding the amount due in cents, enough for roughly 1.3 billion either side of zero.
+    static constexpr int m_DUE_DATE_BITS = 17; //!< The number of bits holding the due date as a day counted from the due date epoch, enough for dates from 1900 up until the year 2258.
+    static constexpr int m_CURRENCY_BITS = 8; //!< The number of bits holding the currency's CurrencyRegistry index.
+    static constexpr qint64 m_MAX_AMOUNT_DUE_CENTS = (Q_INT64_C(1) << (m_AMOUNT_DUE_BITS - 1)) - 1; //!< The largest amount due in cents which can be stored.
+    static constexpr qint64 m_DUE_DATE_EPOCH_JULIAN_DAY = 2415020; //!< The Julian day of 12/31/1899, which due dates are counted from so the first day stored is 1/1/1900.
+    static constexpr qint64 m_MAX_DUE_DATE_DAY = (Q_INT64_C(1) << m_DUE_DATE_BITS) - 1; //!< The largest day counted from the due date epoch which can be stored.
+    static constexpr qint64 m_NULL_DUE_DATE_DAY = 0; //!< The day stored for a null due date, which is the due date epoch itself and so never a real due date.
+    static constexpr quint64 m_FUNDED_FLAG = 0x1; //!< The flag bit set when the bill has been funded.
+    static_assert(m_AMOUNT_DUE_BITS + m_DUE_DATE_BITS + m_CURRENCY_BITS + 1 == 64, "Bill fields must fill exactly one 64-bit word");
+    static_assert(CurrencyRegistry::m_MAX_CURRENCY_COUNT <= (1 << m_CURRENCY_BITS), "Every registered currency index must fit in a Bill");
+
+    QString m_name; //!< The name of the bill, defaulted to an empty string.
+    qint64 m_amountDueCents : m_AMOUNT_DUE_BITS; //!< The amount of money owed for the bill in cents, defaulted to zero.
+    quint64 m_dueDateDay : m_DUE_DATE_BITS; //!< The day that the bill is due, counted from the due date epoch, defaulted to a null date.
+    quint64 m_currencyIndex : m_CURRENCY_BITS; //!< The CurrencyRegistry index of the currency the amount due is in, defaulted to the default currency.
+    quint64 m_flags : 1; //!< Flag bits such as whether or not the bill has been funded yet, defaulted to none set.
+    quint32 m_categoryIndex; //!< The LabelRegistry index of the budget category of the bill, such as "Housing", defaulted to none.
+    quint32 m_tagsIndex; //!< The LabelRegistry index of the free-form tags on the bill, defaulted to none.
 
 };
 
+static_assert(sizeof(Bill) == sizeof(QString) + 2 * sizeof(quint64), "Bill fields beyond its name must pack into a single 64-bit word and two label indexes");
+
 #endif // BILL_H
@@ -0,0 +1,401 @@
+/*##################################################################################
+#   File name:          BillArchive.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillArchive
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillArchive.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QMap>
+#include <QPair>
+#include <QSaveFile>
+#include <QSet>
+
+#include <algorithm>
+
+namespace
+{
+    const QDataStream::Version ARCHIVE_STREAM_VERSION = QDataStream::Qt_5_12; //!< Pinned so segment files read the same across Qt versions.
+}
+
+bool BillArchive::open(const QString &p_archiveDirectoryPath)
+{
+    m_archiveDirectoryPath = p_archiveDirectoryPath;
+    m_segments.clear();
+    m_segmentCache.clear();
+    m_segmentLoadCount = 0;
+
+    // Create the archive directory the first time it is needed
+    QDir archiveDirectory;
+
+    if(!archiveDirectory.mkpath(m_archiveDirectoryPath))
+    {
+        return false;
+    }
+
+    // Read only the footer of each segment, the bills themselves stay on disk until they are browsed
+    QStringList segmentFileNames = QDir(m_archiveDirectoryPath).entryList(QStringList() << "*" + m_SEGMENT_FILE_SUFFIX, QDir::Files);
+
+    for(const QString &segmentFileName : segmentFileNames)
+    {
+        SegmentInfo segmentInfo;
+
+        // Segments without a valid footer, such as a partially copied file, are skipped
+        if(readFooter(m_archiveDirectoryPath + "/" + segmentFileName, segmentInfo))
+        {
+            m_segments.append(segmentInfo);
+        }
+    }
+
+    // Order the segments by date so range lookups can stop early
+    std::sort(m_segments.begin(), m_segments.end(), [](const SegmentInfo &p_firstSegment, const SegmentInfo &p_secondSegment)
+    {
+        return p_firstSegment.firstDueDate < p_secondSegment.firstDueDate;
+    });
+
+    return true;
+}
+
+bool BillArchive::readFooter(const QString &p_filePath, SegmentInfo &p_segmentInfo) const
+{
+    QFile segmentFile(p_filePath);
+
+    // The footer sits at the very end of the file
+    if(!segmentFile.open(QIODevice::ReadOnly) || segmentFile.size() < m_SEGMENT_FOOTER_SIZE || !segmentFile.seek(segmentFile.size() - m_SEGMENT_FOOTER_SIZE))
+    {
+        return false;
+    }
+
+    QDataStream footerStream(&segmentFile);
+    footerStream.setVersion(ARCHIVE_STREAM_VERSION);
+
+    quint32 footerMagic = 0;
+    quint16 formatVersion = 0;
+    quint16 reservedField = 0;
+    qint64 firstJulianDay = 0;
+    qint64 lastJulianDay = 0;
+    footerStream >> footerMagic >> formatVersion >> reservedField >> p_segmentInfo.billCount >> firstJulianDay >> lastJulianDay >> p_segmentInfo.compressedSize >> p_segmentInfo.checksum;
+
+    // Reject files which are not segments or whose footer disagrees with their size
+    if(footerStream.status() != QDataStream::Ok || footerMagic != m_SEGMENT_FOOTER_MAGIC || formatVersion < m_OLDEST_SEGMENT_FORMAT_VERSION || formatVersion > m_SEGMENT_FORMAT_VERSION || p_segmentInfo.compressedSize + m_SEGMENT_FOOTER_SIZE != segmentFile.size())
+    {
+        return false;
+    }
+
+    p_segmentInfo.filePath = p_filePath;
+    p_segmentInfo.formatVersion = formatVersion;
+    p_segmentInfo.firstDueDate = QDate::fromJulianDay(firstJulianDay);
+    p_segmentInfo.lastDueDate = QDate::fromJulianDay(lastJulianDay);
+    return true;
+}
+
+bool BillArchive::archiveBills(const QVector<ArchivedBill> &p_archivedBills, QVector<ArchivedBill> *p_writtenBills)
+{
+    // Partition the bills by the month they were due in
+    QMap<QString, QVector<ArchivedBill>> billsByMonth;
+
+    for(const ArchivedBill &archivedBill : p_archivedBills)
+    {
+        billsByMonth[archivedBill.bill.getDueDate().toString(m_SEGMENT_MONTH_FORMAT)].append(archivedBill);
+    }
+
+    QStringList writtenSegmentPaths;
+    QVector<ArchivedBill> writtenBills;
+
+    // Write each month's bills into a segment of its own
+    for(QMap<QString, QVector<ArchivedBill>>::const_iterator monthIterator = billsByMonth.cbegin(); monthIterator != billsByMonth.cend(); ++monthIterator)
+    {
+        // Note the bills the month's earlier segments already hold, which were archived by a run whose save did not remove them from the config file
+        QDate monthStartDate = monthIterator.value().first().bill.getDueDate();
+        monthStartDate = QDate(monthStartDate.year(), monthStartDate.month(), 1);
+        QSet<QPair<QString, qint64>> archivedBillKeys;
+
+        for(const SegmentInfo &segmentInfo : segmentsBetween(monthStartDate, monthStartDate.addMonths(1).addDays(-1)))
+        {
+            for(const ArchivedBill &archivedBill : loadSegment(segmentInfo))
+            {
+                archivedBillKeys.insert(qMakePair(archivedBill.billKey, archivedBill.bill.getDueDate().toJulianDay()));
+            }
+        }
+
+        QVector<ArchivedBill> monthBills;
+
+        for(const ArchivedBill &archivedBill : monthIterator.value())
+        {
+            if(!archivedBillKeys.contains(qMakePair(archivedBill.billKey, archivedBill.bill.getDueDate().toJulianDay())))
+            {
+                monthBills.append(archivedBill);
+            }
+        }
+
+        if(monthBills.isEmpty())
+        {
+            continue;
+        }
+
+        QString segmentFilePath;
+
+        // If a month cannot be written, remove the months already written so the bills are archived again as a whole rather than in part
+        if(!writeSegment(monthBills, segmentFilePath))
+        {
+            for(const QString &writtenSegmentPath : qAsConst(writtenSegmentPaths))
+            {
+                removeSegment(writtenSegmentPath);
+            }
+
+            return false;
+        }
+
+        writtenSegmentPaths.append(segmentFilePath);
+        writtenBills.append(monthBills);
+    }
+
+    if(p_writtenBills != nullptr)
+    {
+        *p_writtenBills = writtenBills;
+    }
+
+    return true;
+}
+
+void BillArchive::removeSegment(const QString &p_filePath)
+{
+    QFile::remove(p_filePath);
+    m_segmentCache.remove(p_filePath);
+
+    m_segments.erase(std::remove_if(m_segments.begin(), m_segments.end(), [&p_filePath](const SegmentInfo &p_segmentInfo)
+    {
+        return p_segmentInfo.filePath == p_filePath;
+    }), m_segments.end());
+}
+
+bool BillArchive::writeSegment(const QVector<ArchivedBill> &p_monthBills, QString &p_segmentFilePath)
+{
+    // Order the month's bills by due date so loaded segments need no sorting
+    QVector<ArchivedBill> sortedBills = p_monthBills;
+    std::stable_sort(sortedBills.begin(), sortedBills.end(), [](const ArchivedBill &p_firstBill, const ArchivedBill &p_secondBill)
+    {
+        return p_firstBill.bill.getDueDate() < p_secondBill.bill.getDueDate();
+    });
+
+    // Serialize the bills and compress them as a single block
+    QByteArray serializedBills;
+    QDataStream billStream(&serializedBills, QIODevice::WriteOnly);
+    billStream.setVersion(ARCHIVE_STREAM_VERSION);
+    billStream << static_cast<quint32>(sortedBills.size());
+
+    for(const ArchivedBill &archivedBill : sortedBills)
+    {
+        billStream << archivedBill.billKey << archivedBill.bill.getName() << archivedBill.bill.getAmountDueCents() << archivedBill.bill.getDueDate().toJulianDay() << archivedBill.bill.isFunded()
+                   << archivedBill.bill.getCurrencyCode() << archivedBill.bill.getCategory() << archivedBill.bill.getTags();
+    }
+
+    QByteArray compressedBills = qCompress(serializedBills);
+
+    // Describe the segment in its footer
+    SegmentInfo segmentInfo;
+    segmentInfo.firstDueDate = sortedBills.first().bill.getDueDate();
+    segmentInfo.lastDueDate = sortedBills.last().bill.getDueDate();
+    segmentInfo.billCount = static_cast<quint32>(sortedBills.size());
+    segmentInfo.compressedSize = static_cast<quint32>(compressedBills.size());
+    segmentInfo.checksum = computeChecksum(compressedBills);
+    segmentInfo.formatVersion = m_SEGMENT_FORMAT_VERSION;
+
+    // Segments are immutable, so a month archived again gets the next unused sequence number rather than rewriting its earlier segment
+    QString monthPrefix = m_archiveDirectoryPath + "/" + segmentInfo.firstDueDate.toString(m_SEGMENT_MONTH_FORMAT) + "-";
+    int sequenceNumber = 1;
+
+    while(QFile::exists(monthPrefix + QString::number(sequenceNumber) + m_SEGMENT_FILE_SUFFIX))
+    {
+        sequenceNumber++;
+    }
+
+    segmentInfo.filePath = monthPrefix + QString::number(sequenceNumber) + m_SEGMENT_FILE_SUFFIX;
+
+    // Write the compressed bills followed by the footer, only making the file visible once it is complete
+    QSaveFile segmentFile(segmentInfo.filePath);
+
+    if(!segmentFile.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    QDataStream segmentStream(&segmentFile);
+    segmentStream.setVersion(ARCHIVE_STREAM_VERSION);
+    segmentStream.writeRawData(compressedBills.constData(), static_cast<int>(compressedBills.size()));
+    segmentStream << m_SEGMENT_FOOTER_MAGIC << m_SEGMENT_FORMAT_VERSION << static_cast<quint16>(0) << segmentInfo.billCount << segmentInfo.firstDueDate.toJulianDay()
+                  << segmentInfo.lastDueDate.toJulianDay() << segmentInfo.compressedSize << segmentInfo.checksum;
+
+    if(!segmentFile.commit())
+    {
+        return false;
+    }
+
+    // Keep the segment list ordered by date
+    QVector<SegmentInfo>::iterator insertPosition = std::upper_bound(m_segments.begin(), m_segments.end(), segmentInfo, [](const SegmentInfo &p_firstSegment, const SegmentInfo &p_secondSegment)
+    {
+        return p_firstSegment.firstDueDate < p_secondSegment.firstDueDate;
+    });
+
+    m_segments.insert(insertPosition, segmentInfo);
+    p_segmentFilePath = segmentInfo.filePath;
+    return true;
+}
+
+QVector<BillArchive::SegmentInfo> BillArchive::segmentsBetween(const QDate &p_from, const QDate &p_to) const
+{
+    QVector<SegmentInfo> overlappingSegments;
+
+    // Segments are ordered by their earliest due date, so once one starts after the range none of the rest can overlap it
+    for(const SegmentInfo &segmentInfo : m_segments)
+    {
+        if(segmentInfo.firstDueDate > p_to)
+        {
+            break;
+        }
+
+        if(segmentInfo.lastDueDate >= p_from)
+        {
+            overlappingSegments.append(segmentInfo);
+        }
+    }
+
+    return overlappingSegments;
+}
+
+QVector<BillArchive::ArchivedBill> BillArchive::billsBetween(const QDate &p_from, const QDate &p_to)
+{
+    QVector<ArchivedBill> billsInRange;
+
+    // Load only the segments which overlap the range, keeping only their bills which fall inside it
+    for(const SegmentInfo &segmentInfo : segmentsBetween(p_from, p_to))
+    {
+        for(const ArchivedBill &archivedBill : loadSegment(segmentInfo))
+        {
+            if(archivedBill.bill.getDueDate() >= p_from && archivedBill.bill.getDueDate() <= p_to)
+            {
+                billsInRange.append(archivedBill);
+            }
+        }
+    }
+
+    // Segments of the same month may each span the whole month, so order the combined bills by due date
+    std::stable_sort(billsInRange.begin(), billsInRange.end(), [](const ArchivedBill &p_firstBill, const ArchivedBill &p_secondBill)
+    {
+        return p_firstBill.bill.getDueDate() < p_secondBill.bill.getDueDate();
+    });
+
+    return billsInRange;
+}
+
+QVector<BillArchive::ArchivedBill> BillArchive::loadSegment(const SegmentInfo &p_segmentInfo)
+{
+    // Reuse the segment if it was loaded recently
+    if(QVector<ArchivedBill> *cachedBills = m_segmentCache.object(p_segmentInfo.filePath))
+    {
+        return *cachedBills;
+    }
+
+    QVector<ArchivedBill> segmentBills;
+    QFile segmentFile(p_segmentInfo.filePath);
+
+    if(!segmentFile.open(QIODevice::ReadOnly))
+    {
+        return segmentBills;
+    }
+
+    // Read the compressed bills which precede the footer, skipping segments which were damaged since the archive was opened
+    QByteArray compressedBills = segmentFile.read(p_segmentInfo.compressedSize);
+
+    if(static_cast<quint32>(compressedBills.size()) != p_segmentInfo.compressedSize || computeChecksum(compressedBills) != p_segmentInfo.checksum)
+    {
+        return segmentBills;
+    }
+
+    // Decompress and deserialize the bills
+    QByteArray serializedBills = qUncompress(compressedBills);
+    QDataStream billStream(serializedBills);
+    billStream.setVersion(ARCHIVE_STREAM_VERSION);
+
+    quint32 billCount = 0;
+    billStream >> billCount;
+    segmentBills.reserve(static_cast<int>(qMin(billCount, p_segmentInfo.billCount)));
+
+    for(quint32 billIndex = 0; billIndex < billCount && billStream.status() == QDataStream::Ok; billIndex++)
+    {
+        ArchivedBill archivedBill;
+        QString billName;
+        qint64 amountDueCents = 0;
+        qint64 dueDateJulianDay = 0;
+        bool isFunded = false;
+        billStream >> archivedBill.billKey >> billName >> amountDueCents >> dueDateJulianDay >> isFunded;
+
+        // Segments written before currencies were tracked hold bills in the default currency
+        if(p_segmentInfo.formatVersion >= 2)
+        {
+            QString currencyCode;
+            billStream >> currencyCode;
+            archivedBill.bill.setCurrencyCode(currencyCode);
+        }
+
+        // Segments written before categories were tracked hold bills without a category or tags
+        if(p_segmentInfo.formatVersion >= 3)
+        {
+            QString category;
+            QStringList tags;
+            billStream >> category >> tags;
+            archivedBill.bill.setCategory(category);
+            archivedBill.bill.setTags(tags);
+        }
+
+        archivedBill.bill.setName(std::move(billName));
+        archivedBill.bill.setAmountDueCents(amountDueCents);
+        archivedBill.bill.setDueDate(QDate::fromJulianDay(dueDateJulianDay));
+        archivedBill.bill.setFundedStatus(isFunded);
+        segmentBills.append(archivedBill);
+    }
+
+    // Cache the loaded segment, weighted by its number of bills
+    m_segmentLoadCount++;
+    m_segmentCache.insert(p_segmentInfo.filePath, new QVector<ArchivedBill>(segmentBills), qMax(1, static_cast<int>(segmentBills.size())));
+    return segmentBills;
+}
+
+int BillArchive::archivedBillCount() const
+{
+    int billCount = 0;
+
+    // Sum the counts recorded in the footers
+    for(const SegmentInfo &segmentInfo : m_segments)
+    {
+        billCount += static_cast<int>(segmentInfo.billCount);
+    }
+
+    return billCount;
+}
+
+int BillArchive::segmentLoadCount() const
+{
+    // Return the number of segments decompressed so far
+    return m_segmentLoadCount;
+}
+
+quint32 BillArchive::computeChecksum(const QByteArray &p_bytes)
+{
+    quint32 checksum = 2166136261u;
+
+    // Fold each byte into the checksum
+    for(char byte : p_bytes)
+    {
+        checksum ^= static_cast<quint8>(byte);
+        checksum *= 16777619u;
+    }
+
+    return checksum;
+}
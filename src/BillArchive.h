@@ -0,0 +1,152 @@
+/*##################################################################################
+#   File name:          BillArchive.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillArchive
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLARCHIVE_H
+#define BILLARCHIVE_H
+
+// Local file includes
+#include "Bill.h"
+
+// Qt includes
+#include <QCache>
+#include <QDate>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The BillArchive class is the cold tier for bills which have been paid, keeping them out of the config file so startup and saving only deal with current obligations.
+ * Archived bills are written into compressed, immutable segment files partitioned by the month they were due. Each segment ends with a small fixed size footer recording its date range and bill count,
+ * so opening the archive only reads footers, and a segment's bills are decompressed only when a date range overlapping it is browsed. Recently loaded segments are kept in a cache.
+ */
+class BillArchive
+{
+
+public:
+
+    /**
+     * @brief The ArchivedBill struct pairs an archived bill with the bill map key it was stored under.
+     */
+    struct ArchivedBill
+    {
+        QString billKey; //!< The bill map key the bill was stored under.
+        Bill bill; //!< The archived bill.
+    };
+
+    /**
+     * @brief The SegmentInfo struct describes a segment file from its footer alone.
+     */
+    struct SegmentInfo
+    {
+        QString filePath; //!< The path of the segment file.
+        QDate firstDueDate; //!< The earliest due date of the bills in the segment.
+        QDate lastDueDate; //!< The latest due date of the bills in the segment.
+        quint32 billCount = 0; //!< The number of bills in the segment.
+        quint32 compressedSize = 0; //!< The size of the segment's compressed bills in bytes.
+        quint32 checksum = 0; //!< Checksum of the compressed bills, used to detect a damaged segment.
+        quint16 formatVersion = 0; //!< The version of the format the segment was written in.
+    };
+
+    /**
+     * @brief Opens the archive in a directory, creating the directory if needed, and reads the footer of every segment in it.
+     * @param p_archiveDirectoryPath - The directory holding the segment files.
+     * @return True if the directory could be created or read.
+     */
+    bool open(const QString &p_archiveDirectoryPath);
+
+    /**
+     * @brief Archives bills by writing one new segment per month they were due in. Existing segments are never modified.
+     * Bills already archived under the same key and due date are skipped, so archiving bills again after a save which would have removed them failed adds nothing.
+     * Either every month is written or none is, segments written before a month fails being removed again.
+     * @param p_archivedBills - The bills to archive.
+     * @param p_writtenBills - If not null, filled with the bills which were written, leaving out those already archived.
+     * @return True if every bill is now archived, false if nothing was written.
+     */
+    bool archiveBills(const QVector<ArchivedBill> &p_archivedBills, QVector<ArchivedBill> *p_writtenBills = nullptr);
+
+    /**
+     * @brief Returns the segments whose bills were due within a date range, reading nothing but the footers already in memory.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @return The overlapping segments, earliest first.
+     */
+    QVector<SegmentInfo> segmentsBetween(const QDate &p_from, const QDate &p_to) const;
+
+    /**
+     * @brief Returns the archived bills due within a date range, loading only the segments which overlap it.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @return The archived bills in the range, ordered by due date.
+     */
+    QVector<ArchivedBill> billsBetween(const QDate &p_from, const QDate &p_to);
+
+    /**
+     * @brief Returns the total number of archived bills, taken from the segment footers.
+     * @return The number of archived bills.
+     */
+    int archivedBillCount() const;
+
+    /**
+     * @brief Returns the number of segments which have been decompressed since the archive was opened, useful for confirming loading is lazy.
+     * @return The number of segment loads.
+     */
+    int segmentLoadCount() const;
+
+private:
+
+    /**
+     * @brief Reads the footer at the end of a segment file.
+     * @param p_filePath - The path of the segment file.
+     * @param p_segmentInfo - Filled in from the footer.
+     * @return True if the file ends with a valid footer.
+     */
+    bool readFooter(const QString &p_filePath, SegmentInfo &p_segmentInfo) const;
+
+    /**
+     * @brief Writes the bills of a single month into a new segment file.
+     * @param p_monthBills - The bills to write, all due in the same month.
+     * @param p_segmentFilePath - Set to the path of the segment written.
+     * @return True if the segment was written.
+     */
+    bool writeSegment(const QVector<ArchivedBill> &p_monthBills, QString &p_segmentFilePath);
+
+    /**
+     * @brief Deletes a segment file and forgets its footer and cached bills.
+     * @param p_filePath - The path of the segment file.
+     */
+    void removeSegment(const QString &p_filePath);
+
+    /**
+     * @brief Returns the bills of a segment, decompressing it unless it is already cached.
+     * @param p_segmentInfo - The segment to load.
+     * @return The bills of the segment, empty if it is damaged.
+     */
+    QVector<ArchivedBill> loadSegment(const SegmentInfo &p_segmentInfo);
+
+    /**
+     * @brief Computes the FNV-1a checksum of a block of bytes, which is stable across Qt versions unlike qHash.
+     * @param p_bytes - The bytes to checksum.
+     * @return The checksum.
+     */
+    static quint32 computeChecksum(const QByteArray &p_bytes);
+
+    const quint32 m_SEGMENT_FOOTER_MAGIC = 0x50465441; //!< Identifies a segment footer, "PFTA" in ASCII.
+    const quint16 m_SEGMENT_FORMAT_VERSION = 3; //!< The version of the segment file format written, version 2 added each bill's currency code and version 3 its category and tags.
+    const quint16 m_OLDEST_SEGMENT_FORMAT_VERSION = 1; //!< The oldest version of the segment file format which can still be read, whose bills are in the default currency.
+    const int m_SEGMENT_FOOTER_SIZE = 36; //!< The size of a segment footer in bytes.
+    const QString m_SEGMENT_FILE_SUFFIX = ".pftseg"; //!< The file name suffix of segment files.
+    const QString m_SEGMENT_MONTH_FORMAT = "yyyy-MM"; //!< The format of the month which begins each segment's file name.
+    const int m_SEGMENT_CACHE_BILL_LIMIT = 100000; //!< The number of decompressed bills kept in the cache.
+
+    QString m_archiveDirectoryPath; //!< The directory holding the segment files.
+    QVector<SegmentInfo> m_segments; //!< The footer of every segment, ordered by earliest due date.
+    QCache<QString, QVector<ArchivedBill>> m_segmentCache{m_SEGMENT_CACHE_BILL_LIMIT}; //!< Recently decompressed segments keyed by file path, each costing its bill count.
+    int m_segmentLoadCount = 0; //!< The number of segments decompressed since the archive was opened.
+};
+
+#endif // BILLARCHIVE_H
@@ -0,0 +1,143 @@
+/*##################################################################################
+#   File name:          BillArchiveWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillArchiveWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillArchiveWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+BillArchiveWidget::BillArchiveWidget(BillArchive *p_billArchive) : m_billArchive(p_billArchive)
+{
+    // Set the title and size of the BillArchiveWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(500, 400);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When either end of the range changes, list the bills in the new range
+    connect(m_fromDateInput, SIGNAL(dateChanged(QDate)), this, SLOT(refreshArchive()), Qt::AutoConnection);
+    connect(m_toDateInput, SIGNAL(dateChanged(QDate)), this, SLOT(refreshArchive()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the BillArchiveWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+BillArchiveWidget::~BillArchiveWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_fromDateLabel);
+    deleteLabelIfNonNull(m_toDateLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the start of range date edit was created successfully
+    if(m_fromDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_fromDateInput;
+        m_fromDateInput = nullptr;
+    }
+
+    // If the end of range date edit was created successfully
+    if(m_toDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_toDateInput;
+        m_toDateInput = nullptr;
+    }
+
+    // If the archived bill table widget was created successfully
+    if(m_archiveTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_archiveTableWidget;
+        m_archiveTableWidget = nullptr;
+    }
+}
+
+void BillArchiveWidget::initializeWidget()
+{
+    // Create the range date labels and associated date edits, covering the past year by default
+    m_fromDateLabel = new QLabel(this);
+    m_fromDateLabel->setText(m_FROM_DATE_LABEL_TEXT);
+    m_fromDateInput = new QDateEdit(this);
+    m_fromDateInput->setCalendarPopup(true);
+    m_fromDateInput->setDate(QDate::currentDate().addMonths(-m_DEFAULT_RANGE_MONTHS));
+
+    m_toDateLabel = new QLabel(this);
+    m_toDateLabel->setText(m_TO_DATE_LABEL_TEXT);
+    m_toDateInput = new QDateEdit(this);
+    m_toDateInput->setCalendarPopup(true);
+    m_toDateInput->setDate(QDate::currentDate());
+
+    // Create the summary label
+    m_summaryLabel = new QLabel(this);
+
+    // Create the read-only archived bill table
+    m_archiveTableWidget = new QTableWidget(this);
+    m_archiveTableWidget->setColumnCount(m_ARCHIVE_TABLE_HEADER_STRING.split(";").size());
+    m_archiveTableWidget->setHorizontalHeaderLabels(m_ARCHIVE_TABLE_HEADER_STRING.split(";"));
+    m_archiveTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_archiveTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the Close button
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_fromDateLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_fromDateInput, 0, 1);
+    m_gridLayout->addWidget(m_toDateLabel, 0, 2);
+    m_gridLayout->addWidget(m_toDateInput, 0, 3);
+    m_gridLayout->addWidget(m_summaryLabel, 1, 0, 1, 4);
+    m_gridLayout->addWidget(m_archiveTableWidget, 2, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 3, 3);
+}
+
+void BillArchiveWidget::refreshArchive()
+{
+    // Load only the archive segments overlapping the selected range
+    QVector<BillArchive::ArchivedBill> archivedBills = m_billArchive->billsBetween(m_fromDateInput->date(), m_toDateInput->date());
+    m_archiveTableWidget->setRowCount(archivedBills.size());
+
+    // Total each currency separately, since the archive has no exchange rates to combine them with
+    QVector<qint64> centsByCurrency(CurrencyRegistry::m_MAX_CURRENCY_COUNT, 0);
+
+    // List each archived bill in due date order
+    for(int row = 0; row < archivedBills.size(); row++)
+    {
+        const Bill &archivedBill = archivedBills.at(row).bill;
+
+        m_archiveTableWidget->setItem(row, 0, new QTableWidgetItem(archivedBill.getName()));
+        m_archiveTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(archivedBill.getAmountDue(), 'f', 2)));
+        m_archiveTableWidget->setItem(row, 2, new QTableWidgetItem(archivedBill.getDueDate().toString(m_DATE_STRING_FORMAT)));
+        m_archiveTableWidget->setItem(row, 3, new QTableWidgetItem(archivedBill.getCurrencyCode()));
+        centsByCurrency[archivedBill.getCurrencyIndex()] += archivedBill.getAmountDueCents();
+    }
+
+    QStringList currencyTotals;
+
+    for(int currencyIndex = 0; currencyIndex < CurrencyRegistry::currencyCount(); currencyIndex++)
+    {
+        if(centsByCurrency.at(currencyIndex) != 0)
+        {
+            currencyTotals.append(QString::number(centsByCurrency.at(currencyIndex) / 100.0, 'f', 2) + " " + CurrencyRegistry::codeForIndex(static_cast<quint8>(currencyIndex)));
+        }
+    }
+
+    if(currencyTotals.isEmpty())
+    {
+        currencyTotals.append(QString::number(0.0, 'f', 2));
+    }
+
+    // Summarize the range against the whole archive
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(archivedBills.size()).arg(m_billArchive->archivedBillCount()).arg(currencyTotals.join(", ")));
+}
@@ -0,0 +1,85 @@
+/*##################################################################################
+#   File name:          BillArchiveWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillArchiveWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLARCHIVEWIDGET_H
+#define BILLARCHIVEWIDGET_H
+
+// Local file includes
+#include "BillArchive.h"
+
+// Qt includes
+#include <QDateEdit>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The BillArchiveWidget class represents a pop-up window for browsing paid bills which were moved into the BillArchive, loading only the archive segments which overlap the chosen date range.
+ */
+class BillArchiveWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget for browsing a bill archive.
+     * @param p_billArchive - The archive whose bills are displayed, owned by the caller.
+     */
+    BillArchiveWidget(BillArchive *p_billArchive);
+
+    /**
+     * @brief Destructs the BillArchiveWidget by deleting objects which were dynamically allocated.
+     */
+    ~BillArchiveWidget();
+
+public slots:
+
+    /**
+     * @brief Lists the archived bills due within the selected date range.
+     */
+    void refreshArchive();
+
+private:
+
+    /**
+     * @brief Creates the labels, date edits, table, and button of the BillArchiveWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Bill Archive"; //!< Title of the BillArchiveWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the BillArchiveWidget.
+    BillArchive *m_billArchive = nullptr; //!< The archive whose bills are displayed.
+
+    // Date range fields
+    QLabel *m_fromDateLabel = nullptr; //!< Label for the date edit used for choosing the start of the range.
+    const QString m_FROM_DATE_LABEL_TEXT = "Due From:"; //!< Text for the label for the start of the range.
+    QDateEdit *m_fromDateInput = nullptr; //!< The date edit used for choosing the start of the range.
+    QLabel *m_toDateLabel = nullptr; //!< Label for the date edit used for choosing the end of the range.
+    const QString m_TO_DATE_LABEL_TEXT = "Due To:"; //!< Text for the label for the end of the range.
+    QDateEdit *m_toDateInput = nullptr; //!< The date edit used for choosing the end of the range.
+    const int m_DEFAULT_RANGE_MONTHS = 12; //!< How many months back the range starts when the widget is first shown.
+
+    // Summary fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the archive and the bills in the range.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 of %2 archived bills shown, totalling %3"; //!< Text of the summary label, whose total lists each currency separately.
+
+    // Archived bill table fields
+    QTableWidget *m_archiveTableWidget = nullptr; //!< Table listing the archived bills in the range.
+    const QString m_ARCHIVE_TABLE_HEADER_STRING = "Bill Name;Amount Due;Due Date;Currency"; //!< The archived bill table column titles, separated by semicolons.
+    const QString m_DATE_STRING_FORMAT = "M/d/yyyy"; //!< The format used to display due dates.
+
+    // Button and button text variables
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the BillArchiveWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // BILLARCHIVEWIDGET_H
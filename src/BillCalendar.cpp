@@ -0,0 +1,110 @@
+/*##################################################################################
+#   File name:          BillCalendar.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillCalendar
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillCalendar.h"
+
+void BillCalendar::setBill(const QString &p_billKey, const QDate &p_dueDate, qint64 p_amountDueCents, bool p_isFunded)
+{
+    QHash<QString, BucketedBill>::const_iterator bucketedIterator = m_bucketedBillByKey.constFind(p_billKey);
+
+    // Saving a bill which did not change leaves its bucket as it is
+    if(bucketedIterator != m_bucketedBillByKey.cend() && p_dueDate.isValid() && bucketedIterator->dueDay == p_dueDate.toJulianDay()
+       && bucketedIterator->amountDueCents == p_amountDueCents && bucketedIterator->isFunded == p_isFunded)
+    {
+        return;
+    }
+
+    // Take the bill's previous contribution out before adding its current one
+    removeBill(p_billKey);
+
+    if(!p_dueDate.isValid())
+    {
+        return;
+    }
+
+    BucketedBill bucketedBill;
+    bucketedBill.dueDay = p_dueDate.toJulianDay();
+    bucketedBill.amountDueCents = p_amountDueCents;
+    bucketedBill.isFunded = p_isFunded;
+
+    DayBucket &dayBucket = m_bucketByDay[bucketedBill.dueDay];
+    dayBucket.totals.dueCents += p_amountDueCents;
+    dayBucket.totals.fundedCents += p_isFunded ? p_amountDueCents : 0;
+    dayBucket.totals.billCount++;
+    dayBucket.billKeys.append(p_billKey);
+
+    m_bucketedBillByKey.insert(p_billKey, bucketedBill);
+}
+
+void BillCalendar::removeBill(const QString &p_billKey)
+{
+    QHash<QString, BucketedBill>::iterator bucketedIterator = m_bucketedBillByKey.find(p_billKey);
+
+    if(bucketedIterator == m_bucketedBillByKey.end())
+    {
+        return;
+    }
+
+    QHash<qint64, DayBucket>::iterator bucketIterator = m_bucketByDay.find(bucketedIterator->dueDay);
+
+    if(bucketIterator != m_bucketByDay.end())
+    {
+        // Drop the bucket once its last bill leaves, so only days with bills due are kept
+        if(bucketIterator->totals.billCount <= 1)
+        {
+            m_bucketByDay.erase(bucketIterator);
+        }
+        else
+        {
+            bucketIterator->totals.dueCents -= bucketedIterator->amountDueCents;
+            bucketIterator->totals.fundedCents -= bucketedIterator->isFunded ? bucketedIterator->amountDueCents : 0;
+            bucketIterator->totals.billCount--;
+            bucketIterator->billKeys.removeOne(p_billKey);
+        }
+    }
+
+    m_bucketedBillByKey.erase(bucketedIterator);
+}
+
+void BillCalendar::clear()
+{
+    m_bucketByDay.clear();
+    m_bucketedBillByKey.clear();
+}
+
+BillCalendar::DayTotals BillCalendar::dayTotals(const QDate &p_date) const
+{
+    return m_bucketByDay.value(p_date.toJulianDay()).totals;
+}
+
+QVector<BillCalendar::DayTotals> BillCalendar::rangeTotals(const QDate &p_firstDate, const QDate &p_lastDate) const
+{
+    QVector<DayTotals> rangeTotals;
+
+    if(!p_firstDate.isValid() || !p_lastDate.isValid() || p_lastDate < p_firstDate)
+    {
+        return rangeTotals;
+    }
+
+    // Look each day up directly, days without a bucket have no bills due
+    rangeTotals.reserve(static_cast<int>(p_firstDate.daysTo(p_lastDate) + 1));
+
+    for(qint64 day = p_firstDate.toJulianDay(); day <= p_lastDate.toJulianDay(); day++)
+    {
+        QHash<qint64, DayBucket>::const_iterator bucketIterator = m_bucketByDay.constFind(day);
+        rangeTotals.append(bucketIterator != m_bucketByDay.cend() ? bucketIterator->totals : DayTotals());
+    }
+
+    return rangeTotals;
+}
+
+QStringList BillCalendar::billKeysDueOn(const QDate &p_date) const
+{
+    return m_bucketByDay.value(p_date.toJulianDay()).billKeys;
+}
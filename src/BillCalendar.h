@@ -0,0 +1,112 @@
+/*##################################################################################
+#   File name:          BillCalendar.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillCalendar
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLCALENDAR_H
+#define BILLCALENDAR_H
+
+// Qt includes
+#include <QDate>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The BillCalendar class keeps the bills in the bill map bucketed by the day they are due, along with each day's totals.
+ * A bill's amount only moves between buckets when it is stored, edited, or removed, so showing a month reads one bucket per day rather than scanning every bill.
+ */
+class BillCalendar
+{
+
+public:
+
+    /**
+     * @brief The DayTotals struct holds the totals of the bills due on one day, in cents.
+     */
+    struct DayTotals
+    {
+        qint64 dueCents = 0; //!< The total amount due of the bills.
+        qint64 fundedCents = 0; //!< The total amount due of the bills which have been funded.
+        int billCount = 0; //!< The number of bills.
+
+        /**
+         * @brief Returns the amount due which has not been funded yet.
+         * @return The unfunded amount in cents.
+         */
+        qint64 unfundedCents() const { return dueCents - fundedCents; }
+    };
+
+    /**
+     * @brief Records a bill in its day's bucket, moving it out of the bucket of the day it was previously due if that changed.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_dueDate - The bill's due date, bills without a valid due date are left out of the calendar.
+     * @param p_amountDueCents - The bill's amount due in cents, in the currency the calendar is totalled in.
+     * @param p_isFunded - Whether or not the bill has been funded.
+     */
+    void setBill(const QString &p_billKey, const QDate &p_dueDate, qint64 p_amountDueCents, bool p_isFunded);
+
+    /**
+     * @brief Removes a bill from its day's bucket, does nothing if the bill was never recorded.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBill(const QString &p_billKey);
+
+    /**
+     * @brief Empties every bucket, needed when the bills are reloaded or the currency the calendar is totalled in changes.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the totals of the bills due on a day.
+     * @param p_date - The day.
+     * @return The totals, which are zero if no bills are due that day.
+     */
+    DayTotals dayTotals(const QDate &p_date) const;
+
+    /**
+     * @brief Returns the totals of every day of a range, reading one bucket per day.
+     * @param p_firstDate - The first day of the range.
+     * @param p_lastDate - The last day of the range.
+     * @return The totals of each day in order, starting with the first day.
+     */
+    QVector<DayTotals> rangeTotals(const QDate &p_firstDate, const QDate &p_lastDate) const;
+
+    /**
+     * @brief Returns the keys of the bills due on a day.
+     * @param p_date - The day.
+     * @return The bill map keys, in the order the bills were recorded.
+     */
+    QStringList billKeysDueOn(const QDate &p_date) const;
+
+private:
+
+    /**
+     * @brief The DayBucket struct holds the bills due on one day and their totals.
+     */
+    struct DayBucket
+    {
+        DayTotals totals; //!< The totals of the bills due on the day.
+        QStringList billKeys; //!< The bill map keys of the bills due on the day.
+    };
+
+    /**
+     * @brief The BucketedBill struct holds the values a bill was last recorded with, so its contribution can be taken back out of its bucket.
+     */
+    struct BucketedBill
+    {
+        qint64 dueDay = 0; //!< The day the bill is due, as a day number.
+        qint64 amountDueCents = 0; //!< The bill's amount due in cents.
+        bool isFunded = false; //!< Whether or not the bill has been funded.
+    };
+
+    QHash<qint64, DayBucket> m_bucketByDay; //!< Map of (day number, bills due that day), holding only days with bills due.
+    QHash<QString, BucketedBill> m_bucketedBillByKey; //!< Map of (bill map key, values the bill was recorded with).
+};
+
+#endif // BILLCALENDAR_H
@@ -0,0 +1,239 @@
+/*##################################################################################
+#   File name:          BillCalendarWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillCalendarWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillCalendarWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+BillCalendarWidget::BillCalendarWidget()
+{
+    // Set the title and size of the BillCalendarWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(750, 650);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When the Previous, Today, or Next button is clicked, page to that month
+    connect(m_previousButton, SIGNAL(clicked()), this, SLOT(showPreviousMonth()), Qt::AutoConnection);
+    connect(m_todayButton, SIGNAL(clicked()), this, SLOT(showToday()), Qt::AutoConnection);
+    connect(m_nextButton, SIGNAL(clicked()), this, SLOT(showNextMonth()), Qt::AutoConnection);
+
+    // When a day is clicked, list the bills due on it
+    connect(m_calendarTableWidget, SIGNAL(cellClicked(int,int)), this, SLOT(selectCell(int,int)), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the BillCalendarWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+BillCalendarWidget::~BillCalendarWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_monthLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteLabelIfNonNull(m_dayLabel);
+    deleteButtonIfNonNull(m_previousButton);
+    deleteButtonIfNonNull(m_todayButton);
+    deleteButtonIfNonNull(m_nextButton);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the calendar table widget was created successfully
+    if(m_calendarTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_calendarTableWidget;
+        m_calendarTableWidget = nullptr;
+    }
+
+    // If the day bill table widget was created successfully
+    if(m_dayTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_dayTableWidget;
+        m_dayTableWidget = nullptr;
+    }
+}
+
+QDate BillCalendarWidget::getFirstShownDate() const
+{
+    // Weeks start on Sunday, which QDate numbers as the seventh day
+    return m_shownMonth.addDays(-(m_shownMonth.dayOfWeek() % m_DAYS_PER_WEEK));
+}
+
+QDate BillCalendarWidget::getLastShownDate() const
+{
+    return getFirstShownDate().addDays(m_WEEKS_SHOWN * m_DAYS_PER_WEEK - 1);
+}
+
+QDate BillCalendarWidget::getSelectedDate() const
+{
+    return m_selectedDate;
+}
+
+void BillCalendarWidget::initializeWidget()
+{
+    // Create the month and summary labels
+    m_monthLabel = new QLabel(this);
+    m_monthLabel->setAlignment(Qt::AlignmentFlag::AlignCenter);
+    m_summaryLabel = new QLabel(this);
+
+    // Create the read-only calendar table, with a cell for each day of six weeks
+    m_calendarTableWidget = new QTableWidget(m_WEEKS_SHOWN, m_DAYS_PER_WEEK, this);
+    m_calendarTableWidget->setHorizontalHeaderLabels(m_WEEKDAY_HEADER_STRING.split(";"));
+    m_calendarTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_calendarTableWidget->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_calendarTableWidget->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    m_calendarTableWidget->verticalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    m_calendarTableWidget->verticalHeader()->hide();
+
+    // Create the selected day label and the read-only table of its bills
+    m_dayLabel = new QLabel(this);
+    m_dayTableWidget = new QTableWidget(this);
+    m_dayTableWidget->setColumnCount(m_DAY_TABLE_HEADER_STRING.split(";").size());
+    m_dayTableWidget->setHorizontalHeaderLabels(m_DAY_TABLE_HEADER_STRING.split(";"));
+    m_dayTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_dayTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the paging and Close buttons
+    m_previousButton = new QPushButton(this);
+    m_previousButton->setText(m_PREVIOUS_BUTTON_TEXT);
+    m_todayButton = new QPushButton(this);
+    m_todayButton->setText(m_TODAY_BUTTON_TEXT);
+    m_nextButton = new QPushButton(this);
+    m_nextButton->setText(m_NEXT_BUTTON_TEXT);
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout, giving the calendar most of the height
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_previousButton, 0, 0);
+    m_gridLayout->addWidget(m_monthLabel, 0, 1);
+    m_gridLayout->addWidget(m_todayButton, 0, 2);
+    m_gridLayout->addWidget(m_nextButton, 0, 3);
+    m_gridLayout->addWidget(m_summaryLabel, 1, 0, 1, 4);
+    m_gridLayout->addWidget(m_calendarTableWidget, 2, 0, 1, 4);
+    m_gridLayout->addWidget(m_dayLabel, 3, 0, 1, 4);
+    m_gridLayout->addWidget(m_dayTableWidget, 4, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 5, 3);
+    m_gridLayout->setRowStretch(2, 3);
+    m_gridLayout->setRowStretch(4, 1);
+
+    m_monthLabel->setText(m_shownMonth.toString(m_MONTH_STRING_FORMAT));
+    m_dayLabel->setText(m_selectedDate.toString(m_DAY_LABEL_FORMAT));
+}
+
+void BillCalendarWidget::setDayTotals(const QVector<BillCalendar::DayTotals> &p_dayTotals, const QString &p_currencyCode)
+{
+    QDate firstShownDate = getFirstShownDate();
+    BillCalendar::DayTotals monthTotals;
+
+    // Fill each day's cell, showing only the day of the month for days without bills
+    for(int cell = 0; cell < m_WEEKS_SHOWN * m_DAYS_PER_WEEK && cell < p_dayTotals.size(); cell++)
+    {
+        QDate cellDate = firstShownDate.addDays(cell);
+        const BillCalendar::DayTotals &dayTotals = p_dayTotals.at(cell);
+        QTableWidgetItem *cellItem = new QTableWidgetItem();
+
+        if(dayTotals.billCount > 0)
+        {
+            cellItem->setText(m_DAY_CELL_TEXT.arg(cellDate.day()).arg(dayTotals.billCount).arg(QString::number(dayTotals.dueCents / 100.0, 'f', 2))
+                              .arg(QString::number(dayTotals.unfundedCents() / 100.0, 'f', 2)));
+            cellItem->setToolTip(m_DAY_CELL_TOOLTIP_TEXT.arg(QString::number(dayTotals.dueCents / 100.0, 'f', 2)).arg(QString::number(dayTotals.fundedCents / 100.0, 'f', 2))
+                                 .arg(QString::number(dayTotals.unfundedCents() / 100.0, 'f', 2)).arg(p_currencyCode));
+        }
+        else
+        {
+            cellItem->setText(QString::number(cellDate.day()));
+        }
+
+        cellItem->setTextAlignment(Qt::AlignmentFlag::AlignTop | Qt::AlignmentFlag::AlignLeft);
+
+        // Grey out days of the neighbouring months, only the month shown counts towards the summary
+        if(cellDate.month() != m_shownMonth.month())
+        {
+            cellItem->setForeground(Qt::GlobalColor::gray);
+        }
+        else
+        {
+            monthTotals.dueCents += dayTotals.dueCents;
+            monthTotals.fundedCents += dayTotals.fundedCents;
+            monthTotals.billCount += dayTotals.billCount;
+        }
+
+        m_calendarTableWidget->setItem(cell / m_DAYS_PER_WEEK, cell % m_DAYS_PER_WEEK, cellItem);
+    }
+
+    // Highlight the selected day if it is shown
+    qint64 selectedCell = firstShownDate.daysTo(m_selectedDate);
+
+    if(selectedCell >= 0 && selectedCell < m_WEEKS_SHOWN * m_DAYS_PER_WEEK)
+    {
+        m_calendarTableWidget->setCurrentCell(static_cast<int>(selectedCell / m_DAYS_PER_WEEK), static_cast<int>(selectedCell % m_DAYS_PER_WEEK));
+    }
+
+    // Name the month and summarize it
+    m_monthLabel->setText(m_shownMonth.toString(m_MONTH_STRING_FORMAT));
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(monthTotals.billCount).arg(QString::number(monthTotals.dueCents / 100.0, 'f', 2))
+                            .arg(QString::number(monthTotals.unfundedCents() / 100.0, 'f', 2)).arg(p_currencyCode));
+}
+
+void BillCalendarWidget::setDayBills(const QVector<Bill> &p_bills)
+{
+    m_dayLabel->setText(m_selectedDate.toString(m_DAY_LABEL_FORMAT));
+    m_dayTableWidget->setRowCount(p_bills.size());
+
+    // List each bill due on the selected day in its own currency
+    for(int row = 0; row < p_bills.size(); row++)
+    {
+        const Bill &bill = p_bills.at(row);
+
+        m_dayTableWidget->setItem(row, 0, new QTableWidgetItem(bill.getName()));
+        m_dayTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(bill.getAmountDue(), 'f', 2)));
+        m_dayTableWidget->setItem(row, 2, new QTableWidgetItem(bill.getCurrencyCode()));
+        m_dayTableWidget->setItem(row, 3, new QTableWidgetItem(bill.isFunded() ? m_FUNDED_STRING : m_NOT_FUNDED_STRING));
+    }
+}
+
+void BillCalendarWidget::showPreviousMonth()
+{
+    showMonthOf(m_shownMonth.addMonths(-1));
+}
+
+void BillCalendarWidget::showNextMonth()
+{
+    showMonthOf(m_shownMonth.addMonths(1));
+}
+
+void BillCalendarWidget::showToday()
+{
+    showMonthOf(QDate::currentDate());
+}
+
+void BillCalendarWidget::selectCell(int p_row, int p_column)
+{
+    QDate cellDate = getFirstShownDate().addDays(p_row * m_DAYS_PER_WEEK + p_column);
+
+    // Clicking a day of a neighbouring month pages to that month
+    if(cellDate.month() != m_shownMonth.month())
+    {
+        showMonthOf(cellDate);
+        return;
+    }
+
+    m_selectedDate = cellDate;
+    emit calendarRequested();
+}
+
+void BillCalendarWidget::showMonthOf(const QDate &p_date)
+{
+    m_shownMonth = QDate(p_date.year(), p_date.month(), 1);
+    m_selectedDate = p_date;
+    emit calendarRequested();
+}
@@ -0,0 +1,157 @@
+/*##################################################################################
+#   File name:          BillCalendarWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillCalendarWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLCALENDARWIDGET_H
+#define BILLCALENDARWIDGET_H
+
+// Local file includes
+#include "Bill.h"
+#include "BillCalendar.h"
+
+// Qt includes
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The BillCalendarWidget class represents a pop-up window showing a month as a calendar, with the number of bills, amount due, and amount unfunded on each day.
+ * Selecting a day lists the bills due on it. The day totals and bills are supplied by the MainWindow, which is asked for them whenever the month or selected day changes.
+ */
+class BillCalendarWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget for displaying the bill calendar, showing the current month.
+     */
+    BillCalendarWidget();
+
+    /**
+     * @brief Destructs the BillCalendarWidget by deleting objects which were dynamically allocated.
+     */
+    ~BillCalendarWidget();
+
+    /**
+     * @brief Returns the first day shown by the calendar, the Sunday on or before the first day of the month.
+     * @return The first date shown.
+     */
+    QDate getFirstShownDate() const;
+
+    /**
+     * @brief Returns the last day shown by the calendar, six weeks after the first.
+     * @return The last date shown.
+     */
+    QDate getLastShownDate() const;
+
+    /**
+     * @brief Returns the selected day, whose bills are listed below the calendar.
+     * @return The selected date.
+     */
+    QDate getSelectedDate() const;
+
+    /**
+     * @brief Fills the calendar with the totals of each day shown and summarizes the month.
+     * @param p_dayTotals - The totals of each day from getFirstShownDate() to getLastShownDate(), in order.
+     * @param p_currencyCode - The currency the totals are in.
+     */
+    void setDayTotals(const QVector<BillCalendar::DayTotals> &p_dayTotals, const QString &p_currencyCode);
+
+    /**
+     * @brief Lists the bills due on the selected day.
+     * @param p_bills - The bills.
+     */
+    void setDayBills(const QVector<Bill> &p_bills);
+
+signals:
+
+    /**
+     * @brief Emitted when the month or selected day changes, so the calendar can be filled again.
+     */
+    void calendarRequested();
+
+private slots:
+
+    /**
+     * @brief Shows the month before the one shown.
+     */
+    void showPreviousMonth();
+
+    /**
+     * @brief Shows the month after the one shown.
+     */
+    void showNextMonth();
+
+    /**
+     * @brief Shows the current month and selects today.
+     */
+    void showToday();
+
+    /**
+     * @brief Selects the day of a calendar cell.
+     * @param p_row - The week of the cell.
+     * @param p_column - The weekday of the cell.
+     */
+    void selectCell(int p_row, int p_column);
+
+private:
+
+    /**
+     * @brief Creates the labels, tables, and buttons of the BillCalendarWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Shows the month containing a date and selects the date.
+     * @param p_date - The date.
+     */
+    void showMonthOf(const QDate &p_date);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Bill Calendar"; //!< Title of the BillCalendarWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the BillCalendarWidget.
+    QDate m_shownMonth = QDate(QDate::currentDate().year(), QDate::currentDate().month(), 1); //!< The first day of the month shown.
+    QDate m_selectedDate = QDate::currentDate(); //!< The day whose bills are listed.
+
+    // Month fields
+    QLabel *m_monthLabel = nullptr; //!< Label naming the month shown.
+    const QString m_MONTH_STRING_FORMAT = "MMMM yyyy"; //!< The format used to name the month shown.
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the month shown.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 bills due this month totalling %2, %3 unfunded (%4)"; //!< Text of the summary label.
+
+    // Calendar table fields
+    QTableWidget *m_calendarTableWidget = nullptr; //!< Table of six weeks of days, one cell per day.
+    const QString m_WEEKDAY_HEADER_STRING = "Sun;Mon;Tue;Wed;Thu;Fri;Sat"; //!< The calendar table column titles, separated by semicolons.
+    const QString m_DAY_CELL_TEXT = "%1\n%2 bill(s)\nDue %3\nUnfunded %4"; //!< Text of a day with bills due, given the day of the month, number of bills, amount due, and amount unfunded.
+    const QString m_DAY_CELL_TOOLTIP_TEXT = "Due %1, funded %2, unfunded %3 (%4)"; //!< Tooltip of a day with bills due.
+    const int m_WEEKS_SHOWN = 6; //!< The number of weeks shown, enough for any month.
+    const int m_DAYS_PER_WEEK = 7; //!< The number of days in each week.
+
+    // Day bill table fields
+    QLabel *m_dayLabel = nullptr; //!< Label naming the selected day.
+    const QString m_DAY_LABEL_FORMAT = "'Bills due' dddd, MMMM d, yyyy"; //!< The format used to name the selected day.
+    QTableWidget *m_dayTableWidget = nullptr; //!< Table listing the bills due on the selected day.
+    const QString m_DAY_TABLE_HEADER_STRING = "Bill;Amount Due;Currency;Status"; //!< The day bill table column titles, separated by semicolons.
+    const QString m_FUNDED_STRING = "Funded"; //!< Funded status of funded represented as a string.
+    const QString m_NOT_FUNDED_STRING = "Not Funded"; //!< Funded status of not funded represented as a string.
+
+    // Button and button text variables
+    QPushButton *m_previousButton = nullptr; //!< Push button used for showing the previous month.
+    const QString m_PREVIOUS_BUTTON_TEXT = "< Previous"; //!< Text used for the Previous push button.
+    QPushButton *m_todayButton = nullptr; //!< Push button used for showing the current month.
+    const QString m_TODAY_BUTTON_TEXT = "Today"; //!< Text used for the Today push button.
+    QPushButton *m_nextButton = nullptr; //!< Push button used for showing the next month.
+    const QString m_NEXT_BUTTON_TEXT = "Next >"; //!< Text used for the Next push button.
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the BillCalendarWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // BILLCALENDARWIDGET_H
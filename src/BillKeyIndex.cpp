@@ -0,0 +1,267 @@
+/*##################################################################################
+#   File name:          BillKeyIndex.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillKeyIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillKeyIndex.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    const uint SECOND_HASH_SEED = 0x9e3779b9; //!< Seed of the second string hash, which supplies the other half of a 64-bit key hash.
+    const quint64 AMOUNT_DAY_TAG = Q_UINT64_C(0x632be59bd9b4e019); //!< Mixed into amount and day hashes so they differ from key hashes of the same bits.
+
+    /**
+     * @brief Mixes the bits of a 64-bit value so every input bit affects every output bit, as the final step of SplitMix64 does.
+     * @param p_value - The value to mix.
+     * @return The mixed value.
+     */
+    quint64 mixBits(quint64 p_value)
+    {
+        p_value = (p_value ^ (p_value >> 30)) * Q_UINT64_C(0xbf58476d1ce4e5b9);
+        p_value = (p_value ^ (p_value >> 27)) * Q_UINT64_C(0x94d049bb133111eb);
+        return p_value ^ (p_value >> 31);
+    }
+}
+
+QString BillKeyIndex::normalizeKey(const QString &p_billName)
+{
+    // Remove every space as bill map keys do, then fold case as Windows does for INI group names
+    QString normalizedKey = p_billName.simplified();
+    return normalizedKey.remove(QLatin1Char(' ')).toCaseFolded();
+}
+
+void BillKeyIndex::reset(int p_billCount)
+{
+    m_indexedBillByKey.clear();
+    m_billKeysByNormalizedKey.clear();
+    m_billKeysByAmountDay.clear();
+    m_indexedBillByKey.reserve(p_billCount);
+    m_billKeysByNormalizedKey.reserve(p_billCount);
+    m_billKeysByAmountDay.reserve(p_billCount);
+    m_keyFilter.reset(p_billCount);
+    m_amountDayFilter.reset(p_billCount);
+}
+
+void BillKeyIndex::insertBill(const QString &p_billKey, const Bill &p_bill)
+{
+    IndexedBill indexedBill;
+    indexedBill.normalizedKey = normalizeKey(p_billKey);
+    indexedBill.foldedName = foldName(p_bill.getName());
+    indexedBill.amountDueCents = p_bill.getAmountDueCents();
+    indexedBill.dueDay = p_bill.getDueDate().toJulianDay();
+
+    // Saving a bill which did not change leaves the index as it is
+    QHash<QString, IndexedBill>::const_iterator indexedIterator = m_indexedBillByKey.constFind(p_billKey);
+
+    if(indexedIterator != m_indexedBillByKey.cend())
+    {
+        if(indexedIterator->normalizedKey == indexedBill.normalizedKey && indexedIterator->foldedName == indexedBill.foldedName
+           && indexedIterator->amountDueCents == indexedBill.amountDueCents && indexedIterator->dueDay == indexedBill.dueDay)
+        {
+            return;
+        }
+
+        removeBill(p_billKey);
+    }
+
+    m_billKeysByNormalizedKey.insert(indexedBill.normalizedKey, p_billKey);
+    m_billKeysByAmountDay.insert(qMakePair(indexedBill.amountDueCents, indexedBill.dueDay), p_billKey);
+    m_keyFilter.insert(keyHash(indexedBill.normalizedKey));
+    m_amountDayFilter.insert(amountDayHash(indexedBill.amountDueCents, indexedBill.dueDay));
+    m_indexedBillByKey.insert(p_billKey, indexedBill);
+
+    if(m_keyFilter.isOverloaded() || m_amountDayFilter.isOverloaded())
+    {
+        growFilters();
+    }
+}
+
+void BillKeyIndex::removeBill(const QString &p_billKey)
+{
+    QHash<QString, IndexedBill>::iterator indexedIterator = m_indexedBillByKey.find(p_billKey);
+
+    if(indexedIterator == m_indexedBillByKey.end())
+    {
+        return;
+    }
+
+    // The filters keep the bill's bits, which only cost an occasional lookup until they are next refilled
+    m_billKeysByNormalizedKey.remove(indexedIterator->normalizedKey, p_billKey);
+    m_billKeysByAmountDay.remove(qMakePair(indexedIterator->amountDueCents, indexedIterator->dueDay), p_billKey);
+    m_indexedBillByKey.erase(indexedIterator);
+}
+
+BillKeyIndex::Collision BillKeyIndex::findCollision(const QString &p_billKey, const Bill &p_bill, bool p_isReplacingSameKey) const
+{
+    Collision collision;
+
+    // Keys which differ only in spacing or case collide, checked against the filter before the table
+    QString normalizedKey = normalizeKey(p_billKey);
+
+    if(m_keyFilter.mightContain(keyHash(normalizedKey)))
+    {
+        for(QMultiHash<QString, QString>::const_iterator keyIterator = m_billKeysByNormalizedKey.constFind(normalizedKey);
+            keyIterator != m_billKeysByNormalizedKey.cend() && keyIterator.key() == normalizedKey; ++keyIterator)
+        {
+            if(!p_isReplacingSameKey || keyIterator.value() != p_billKey)
+            {
+                collision.kind = KeyCollision;
+                collision.existingBillKey = keyIterator.value();
+                return collision;
+            }
+        }
+    }
+
+    // Look for bills of the same amount due on each nearby day, most days are ruled out by the filter alone
+    QString foldedName;
+    qint64 dueDay = p_bill.getDueDate().toJulianDay();
+    qint64 amountDueCents = p_bill.getAmountDueCents();
+
+    for(qint64 day = dueDay - m_NEAR_DUPLICATE_DAYS; day <= dueDay + m_NEAR_DUPLICATE_DAYS; day++)
+    {
+        if(!m_amountDayFilter.mightContain(amountDayHash(amountDueCents, day)))
+        {
+            continue;
+        }
+
+        QPair<qint64, qint64> amountDay = qMakePair(amountDueCents, day);
+
+        for(QMultiHash<QPair<qint64, qint64>, QString>::const_iterator amountDayIterator = m_billKeysByAmountDay.constFind(amountDay);
+            amountDayIterator != m_billKeysByAmountDay.cend() && amountDayIterator.key() == amountDay; ++amountDayIterator)
+        {
+            if(p_isReplacingSameKey && amountDayIterator.value() == p_billKey)
+            {
+                continue;
+            }
+
+            // The name is only folded once a bill of the same amount is found nearby
+            if(foldedName.isNull())
+            {
+                foldedName = foldName(p_bill.getName());
+            }
+
+            if(areNamesNear(foldedName, m_indexedBillByKey.value(amountDayIterator.value()).foldedName))
+            {
+                collision.kind = NearDuplicate;
+                collision.existingBillKey = amountDayIterator.value();
+                return collision;
+            }
+        }
+    }
+
+    return collision;
+}
+
+QString BillKeyIndex::uniqueName(const QString &p_billName) const
+{
+    QString candidateName = p_billName.trimmed();
+
+    for(int suffix = 2; m_billKeysByNormalizedKey.contains(normalizeKey(candidateName)); suffix++)
+    {
+        candidateName = p_billName.trimmed() + " " + QString::number(suffix);
+    }
+
+    return candidateName;
+}
+
+quint64 BillKeyIndex::keyHash(const QString &p_normalizedKey)
+{
+    // Combine two differently seeded string hashes, since qHash may only produce 32 bits
+    return mixBits((static_cast<quint64>(qHash(p_normalizedKey, 0)) << 32) ^ static_cast<quint64>(qHash(p_normalizedKey, SECOND_HASH_SEED)));
+}
+
+quint64 BillKeyIndex::amountDayHash(qint64 p_amountDueCents, qint64 p_dueDay)
+{
+    return mixBits(mixBits(static_cast<quint64>(p_amountDueCents) ^ AMOUNT_DAY_TAG) + static_cast<quint64>(p_dueDay));
+}
+
+QString BillKeyIndex::foldName(const QString &p_billName)
+{
+    QString foldedName;
+    foldedName.reserve(std::min(p_billName.size(), static_cast<int>(m_MAX_FOLDED_NAME_LENGTH)));
+
+    for(QChar character : p_billName.toCaseFolded())
+    {
+        if(foldedName.size() >= m_MAX_FOLDED_NAME_LENGTH)
+        {
+            break;
+        }
+
+        if(character.isLetterOrNumber())
+        {
+            foldedName.append(character);
+        }
+    }
+
+    return foldedName;
+}
+
+bool BillKeyIndex::areNamesNear(const QString &p_firstName, const QString &p_secondName)
+{
+    int firstLength = p_firstName.size();
+    int secondLength = p_secondName.size();
+
+    // Names whose lengths differ by more than the maximum distance cannot be near
+    if(std::abs(firstLength - secondLength) > m_MAX_NAME_DISTANCE)
+    {
+        return false;
+    }
+
+    // Compute the edit distance a row at a time, giving up once every entry of a row exceeds the maximum
+    QVector<int> previousRow(secondLength + 1);
+    QVector<int> currentRow(secondLength + 1);
+
+    for(int column = 0; column <= secondLength; column++)
+    {
+        previousRow[column] = column;
+    }
+
+    for(int row = 1; row <= firstLength; row++)
+    {
+        currentRow[0] = row;
+        int rowMinimum = row;
+
+        for(int column = 1; column <= secondLength; column++)
+        {
+            int substitutionCost = p_firstName.at(row - 1) == p_secondName.at(column - 1) ? 0 : 1;
+            currentRow[column] = std::min({previousRow.at(column) + 1, currentRow.at(column - 1) + 1, previousRow.at(column - 1) + substitutionCost});
+            rowMinimum = std::min(rowMinimum, currentRow.at(column));
+        }
+
+        if(rowMinimum > m_MAX_NAME_DISTANCE)
+        {
+            return false;
+        }
+
+        std::swap(previousRow, currentRow);
+    }
+
+    return previousRow.at(secondLength) <= m_MAX_NAME_DISTANCE;
+}
+
+void BillKeyIndex::growFilters()
+{
+    // Edits fill the filters with the bits of values no longer indexed, so they are refilled at the same capacity while the bills indexed take at most half of it, and only doubled once they take more
+    int capacity = std::max(m_keyFilter.capacity(), m_amountDayFilter.capacity());
+
+    if(m_indexedBillByKey.size() > capacity / 2)
+    {
+        capacity *= 2;
+    }
+
+    m_keyFilter.reset(capacity);
+    m_amountDayFilter.reset(capacity);
+
+    for(QHash<QString, IndexedBill>::const_iterator indexedIterator = m_indexedBillByKey.cbegin(); indexedIterator != m_indexedBillByKey.cend(); ++indexedIterator)
+    {
+        m_keyFilter.insert(keyHash(indexedIterator->normalizedKey));
+        m_amountDayFilter.insert(amountDayHash(indexedIterator->amountDueCents, indexedIterator->dueDay));
+    }
+}
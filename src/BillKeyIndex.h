@@ -0,0 +1,155 @@
+/*##################################################################################
+#   File name:          BillKeyIndex.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillKeyIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLKEYINDEX_H
+#define BILLKEYINDEX_H
+
+// Local file includes
+#include "Bill.h"
+#include "BloomFilter.h"
+
+// Qt includes
+#include <QHash>
+#include <QMultiHash>
+#include <QPair>
+#include <QString>
+
+/**
+ * @brief The BillKeyIndex class detects bills which would collide with, or nearly duplicate, the bills already stored.
+ * Bills are keyed by their name with spaces removed, so "Car Loan" and "CarLoan" share a key. Keys are further case folded here, since INI group names are case insensitive on Windows.
+ * Bills are also near duplicates when they are for the same amount, due within a few days of each other, and their names differ by at most a couple of characters.
+ * Both checks first consult a Bloom filter, so checking a bill which collides with nothing usually costs a few bit tests rather than hash table lookups,
+ * which keeps the check cheap for every row of a large import. The index is maintained incrementally as bills are stored and removed.
+ */
+class BillKeyIndex
+{
+
+public:
+
+    /**
+     * @brief The CollisionKind enum lists the ways a bill can clash with a stored bill.
+     */
+    enum CollisionKind
+    {
+        NoCollision,
+        KeyCollision,
+        NearDuplicate
+    };
+
+    /**
+     * @brief The Collision struct describes the stored bill a bill clashes with.
+     */
+    struct Collision
+    {
+        CollisionKind kind = NoCollision; //!< How the bills clash.
+        QString existingBillKey; //!< The bill map key of the stored bill, empty if there is no collision.
+    };
+
+    /**
+     * @brief Normalizes a bill key or name into the form collisions are detected in, without spaces and case folded.
+     * @param p_billName - The bill key or name.
+     * @return The normalized key.
+     */
+    static QString normalizeKey(const QString &p_billName);
+
+    /**
+     * @brief Empties the index and sizes its filters for a number of bills, avoiding resizing them while a large import is indexed.
+     * @param p_billCount - The number of bills expected.
+     */
+    void reset(int p_billCount);
+
+    /**
+     * @brief Adds a bill to the index, or updates it if a bill with the same key is already indexed.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     */
+    void insertBill(const QString &p_billKey, const Bill &p_bill);
+
+    /**
+     * @brief Removes a bill from the index, does nothing if the bill was never indexed.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBill(const QString &p_billKey);
+
+    /**
+     * @brief Finds a stored bill which a bill would collide with if it were stored under the given key. Key collisions are reported before near duplicates.
+     * @param p_billKey - The bill map key the bill would be stored under. A stored bill with exactly this key is ignored when p_isReplacingSameKey is true.
+     * @param p_bill - The bill.
+     * @param p_isReplacingSameKey - Whether the bill is an update of the bill stored under the same key, rather than a new bill.
+     * @return The collision, whose kind is NoCollision if there is none.
+     */
+    Collision findCollision(const QString &p_billKey, const Bill &p_bill, bool p_isReplacingSameKey = false) const;
+
+    /**
+     * @brief Returns a name based on the given one which does not collide with any stored bill's key, by appending a number.
+     * @param p_billName - The desired name.
+     * @return The name itself if it does not collide, otherwise the name followed by the lowest free number from two.
+     */
+    QString uniqueName(const QString &p_billName) const;
+
+private:
+
+    /**
+     * @brief The IndexedBill struct holds the values of an indexed bill which collisions are detected on.
+     */
+    struct IndexedBill
+    {
+        QString normalizedKey; //!< The bill's normalized key.
+        QString foldedName; //!< The bill's name case folded with only letters and digits kept, used to compare names.
+        qint64 amountDueCents = 0; //!< The bill's amount due in cents.
+        qint64 dueDay = 0; //!< The bill's due date as a day number.
+    };
+
+    /**
+     * @brief Returns a 64-bit hash of a normalized key for the key filter.
+     * @param p_normalizedKey - The normalized key.
+     * @return The hash.
+     */
+    static quint64 keyHash(const QString &p_normalizedKey);
+
+    /**
+     * @brief Returns a 64-bit hash of an amount and due day for the near duplicate filter.
+     * @param p_amountDueCents - The amount due in cents.
+     * @param p_dueDay - The due date as a day number.
+     * @return The hash.
+     */
+    static quint64 amountDayHash(qint64 p_amountDueCents, qint64 p_dueDay);
+
+    /**
+     * @brief Folds a name for comparison by case folding it and keeping only its letters and digits.
+     * @param p_billName - The name.
+     * @return The folded name, truncated so comparing it costs a bounded amount of work.
+     */
+    static QString foldName(const QString &p_billName);
+
+    /**
+     * @brief Returns whether two folded names are within the maximum edit distance of each other, stopping as soon as they are known not to be.
+     * @param p_firstName - The first folded name.
+     * @param p_secondName - The second folded name.
+     * @return True if the names differ by at most m_MAX_NAME_DISTANCE insertions, deletions, or substitutions.
+     */
+    static bool areNamesNear(const QString &p_firstName, const QString &p_secondName);
+
+    /**
+     * @brief Refills both filters from the indexed bills once they hold more values than they were sized for, doubling their capacity only if the indexed bills take more than half of it.
+     */
+    void growFilters();
+
+    static constexpr int m_NEAR_DUPLICATE_DAYS = 3; //!< Bills due at most this many days apart can be near duplicates.
+    static constexpr int m_MAX_NAME_DISTANCE = 2; //!< Names differing by at most this many characters can be near duplicates.
+    static constexpr int m_MAX_FOLDED_NAME_LENGTH = 64; //!< The most characters of a name compared.
+
+    QHash<QString, IndexedBill> m_indexedBillByKey; //!< Map of (bill map key, values the bill was indexed with).
+    QMultiHash<QString, QString> m_billKeysByNormalizedKey; //!< Map of (normalized key, bill map keys), several bills can share a normalized key when loaded from a file edited by hand.
+    QMultiHash<QPair<qint64, qint64>, QString> m_billKeysByAmountDay; //!< Map of ((amount due in cents, due day), bill map keys).
+    BloomFilter m_keyFilter; //!< Filter over the normalized keys.
+    BloomFilter m_amountDayFilter; //!< Filter over the amounts and due days.
+};
+
+#endif // BILLKEYINDEX_H
@@ -0,0 +1,298 @@
+/*##################################################################################
+#   File name:          BillPasteParser.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillPasteParser
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillPasteParser.h"
+#include "CategoryRollup.h"
+#include "StagedLedger.h"
+
+#include <QRegularExpression>
+
+#include <cmath>
+
+namespace
+{
+    const QString NAME_COLUMN_TITLE = "Bill Name"; //!< The title of the name column.
+    const QString SHORT_NAME_COLUMN_TITLE = "Name"; //!< Another title of the name column recognized in a header row.
+    const QString AMOUNT_DUE_COLUMN_TITLE = "Amount Due"; //!< The title of the amount due column.
+    const QString DUE_DATE_COLUMN_TITLE = "Due Date"; //!< The title of the due date column.
+    const QString CURRENCY_COLUMN_TITLE = "Currency"; //!< The title of the currency column.
+    const QString CATEGORY_COLUMN_TITLE = "Category"; //!< The title of the category column.
+    const QString TAGS_COLUMN_TITLE = "Tags"; //!< The title of the tags column.
+
+    const QString MISSING_NAME_ERROR = "The bill needs a name"; //!< Error shown for a row without a name.
+    const QString MISSING_AMOUNT_DUE_ERROR = "The bill needs an amount due"; //!< Error shown for a row without an amount due.
+    const QString INVALID_AMOUNT_DUE_ERROR = "\"%1\" is not an amount of money"; //!< Error shown for an amount due which is not a number, given the amount.
+    const QString AMOUNT_DUE_RANGE_ERROR = "The amount due must be between 0.00 and %1"; //!< Error shown for an amount due which is negative or too large, given the largest amount.
+    const QString MISSING_DUE_DATE_ERROR = "The bill needs a due date"; //!< Error shown for a row without a due date.
+    const QString INVALID_DUE_DATE_ERROR = "\"%1\" is not a date, use M/d/yyyy or yyyy-MM-dd"; //!< Error shown for a due date which cannot be read, given the date.
+    const QString DUE_DATE_RANGE_ERROR = "The due date must be between %1 and %2"; //!< Error shown for a due date which is too early or too late, given the earliest and latest dates.
+    const QString INVALID_CURRENCY_ERROR = "\"%1\" is not a three letter currency code"; //!< Error shown for a currency which is not a currency code, given the currency.
+    const QString EXTRA_FIELDS_WARNING = "Fields after the tags were ignored"; //!< Warning shown for a row with more fields than there are columns.
+
+    const QChar TAB_SEPARATOR = QLatin1Char('\t'); //!< The separator of fields copied from a spreadsheet.
+    const QChar COMMA_SEPARATOR = QLatin1Char(','); //!< The separator of fields in CSV text.
+    const QChar QUOTE = QLatin1Char('"'); //!< The character CSV fields containing commas are quoted with.
+}
+
+bool BillPasteParser::PastedRow::isValid() const
+{
+    for(const QString &fieldError : fieldErrors)
+    {
+        if(!fieldError.isEmpty())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QVector<BillPasteParser::PastedRow> BillPasteParser::parse(const QString &p_pastedText, const QString &p_defaultCurrencyCode)
+{
+    // Spreadsheets copy rows with tabs between the fields, anything else is read as CSV
+    QChar separator = p_pastedText.contains(TAB_SEPARATOR) ? TAB_SEPARATOR : COMMA_SEPARATOR;
+    QStringList lines = p_pastedText.split(QRegularExpression("\\r\\n|\\n|\\r"));
+    QVector<PastedRow> pastedRows;
+    bool isFirstRow = true;
+
+    for(int lineIndex = 0; lineIndex < lines.size(); lineIndex++)
+    {
+        const QString &lineText = lines.at(lineIndex);
+
+        if(lineText.trimmed().isEmpty())
+        {
+            continue;
+        }
+
+        PastedRow pastedRow;
+        pastedRow.lineNumber = lineIndex + 1;
+        pastedRow.lineText = lineText;
+        pastedRow.fields = splitFields(lineText, separator);
+
+        // Skip a header row, recognized by its name column holding the column's title
+        if(isFirstRow)
+        {
+            isFirstRow = false;
+            QString firstField = pastedRow.fields.value(NameColumn);
+
+            if(firstField.compare(NAME_COLUMN_TITLE, Qt::CaseInsensitive) == 0 || firstField.compare(SHORT_NAME_COLUMN_TITLE, Qt::CaseInsensitive) == 0)
+            {
+                continue;
+            }
+        }
+
+        readRow(pastedRow, p_defaultCurrencyCode);
+        pastedRows.append(pastedRow);
+    }
+
+    return pastedRows;
+}
+
+QString BillPasteParser::columnTitle(PastedColumn p_column)
+{
+    switch(p_column)
+    {
+        case NameColumn :
+        {
+            return NAME_COLUMN_TITLE;
+        }
+        case AmountDueColumn :
+        {
+            return AMOUNT_DUE_COLUMN_TITLE;
+        }
+        case DueDateColumn :
+        {
+            return DUE_DATE_COLUMN_TITLE;
+        }
+        case CurrencyColumn :
+        {
+            return CURRENCY_COLUMN_TITLE;
+        }
+        case CategoryColumn :
+        {
+            return CATEGORY_COLUMN_TITLE;
+        }
+        case TagsColumn :
+        {
+            return TAGS_COLUMN_TITLE;
+        }
+        default :
+        {
+            return QString();
+        }
+    }
+}
+
+QStringList BillPasteParser::splitFields(const QString &p_lineText, QChar p_separator)
+{
+    QStringList fields;
+    QString field;
+    bool isInQuotes = false;
+
+    for(int characterIndex = 0; characterIndex < p_lineText.size(); characterIndex++)
+    {
+        QChar character = p_lineText.at(characterIndex);
+
+        // Quotes only have meaning in CSV, where a doubled quote inside a quoted field stands for one quote
+        if(p_separator == COMMA_SEPARATOR && character == QUOTE)
+        {
+            if(isInQuotes && characterIndex + 1 < p_lineText.size() && p_lineText.at(characterIndex + 1) == QUOTE)
+            {
+                field.append(QUOTE);
+                characterIndex++;
+            }
+            else
+            {
+                isInQuotes = !isInQuotes;
+            }
+        }
+        else if(character == p_separator && !isInQuotes)
+        {
+            fields.append(field.trimmed());
+            field.clear();
+        }
+        else
+        {
+            field.append(character);
+        }
+    }
+
+    fields.append(field.trimmed());
+    return fields;
+}
+
+void BillPasteParser::readRow(PastedRow &p_pastedRow, const QString &p_defaultCurrencyCode)
+{
+    // Give every column a field, error, and warning, so rows with fields left out can be indexed like any other
+    bool hasExtraFields = p_pastedRow.fields.size() > PastedColumnCount;
+
+    while(p_pastedRow.fields.size() < PastedColumnCount)
+    {
+        p_pastedRow.fields.append(QString());
+    }
+
+    p_pastedRow.fields = p_pastedRow.fields.mid(0, PastedColumnCount);
+
+    for(int column = 0; column < PastedColumnCount; column++)
+    {
+        p_pastedRow.fieldErrors.append(QString());
+        p_pastedRow.fieldWarnings.append(QString());
+    }
+
+    if(hasExtraFields)
+    {
+        p_pastedRow.fieldWarnings[TagsColumn] = EXTRA_FIELDS_WARNING;
+    }
+
+    // The name is required
+    const QString &nameText = p_pastedRow.fields.at(NameColumn);
+
+    if(nameText.isEmpty())
+    {
+        p_pastedRow.fieldErrors[NameColumn] = MISSING_NAME_ERROR;
+    }
+
+    p_pastedRow.bill.setName(nameText);
+
+    // The amount due is required, and must fit in a Bill
+    const QString &amountDueText = p_pastedRow.fields.at(AmountDueColumn);
+    qint64 amountDueCents = 0;
+
+    if(amountDueText.isEmpty())
+    {
+        p_pastedRow.fieldErrors[AmountDueColumn] = MISSING_AMOUNT_DUE_ERROR;
+    }
+    else if(!readAmountDueCents(amountDueText, amountDueCents))
+    {
+        p_pastedRow.fieldErrors[AmountDueColumn] = INVALID_AMOUNT_DUE_ERROR.arg(amountDueText);
+    }
+    else if(amountDueCents < 0 || amountDueCents > Bill::getMaxAmountDueCents())
+    {
+        p_pastedRow.fieldErrors[AmountDueColumn] = AMOUNT_DUE_RANGE_ERROR.arg(QString::number(Bill::getMaxAmountDueCents() / 100.0, 'f', 2));
+    }
+
+    p_pastedRow.bill.setAmountDueCents(amountDueCents);
+
+    // The due date is required, since defaulting hundreds of bills to today would hide a missing column
+    const QString &dueDateText = p_pastedRow.fields.at(DueDateColumn);
+    QDate dueDate = readDueDate(dueDateText);
+
+    if(dueDateText.isEmpty())
+    {
+        p_pastedRow.fieldErrors[DueDateColumn] = MISSING_DUE_DATE_ERROR;
+    }
+    else if(!dueDate.isValid())
+    {
+        p_pastedRow.fieldErrors[DueDateColumn] = INVALID_DUE_DATE_ERROR.arg(dueDateText);
+    }
+    else if(dueDate < Bill::getMinDueDate() || dueDate > Bill::getMaxDueDate())
+    {
+        p_pastedRow.fieldErrors[DueDateColumn] = DUE_DATE_RANGE_ERROR.arg(Bill::getMinDueDate().toString(Qt::ISODate), Bill::getMaxDueDate().toString(Qt::ISODate));
+    }
+
+    p_pastedRow.bill.setDueDate(dueDate);
+
+    // Rows without a currency are in the default currency, as bills entered one at a time are
+    const QString &currencyText = p_pastedRow.fields.at(CurrencyColumn);
+    QString currencyCode = currencyText.isEmpty() ? p_defaultCurrencyCode : CurrencyRegistry::normalizeCode(currencyText);
+
+    if(currencyCode.isEmpty())
+    {
+        p_pastedRow.fieldErrors[CurrencyColumn] = INVALID_CURRENCY_ERROR.arg(currencyText);
+    }
+    else
+    {
+        p_pastedRow.fields[CurrencyColumn] = currencyCode;
+        p_pastedRow.bill.setCurrencyCode(currencyCode);
+    }
+
+    // The category and tags are optional, and pasted bills start out unfunded
+    p_pastedRow.bill.setCategory(p_pastedRow.fields.at(CategoryColumn));
+    p_pastedRow.bill.setTags(CategoryRollup::splitTags(p_pastedRow.fields.at(TagsColumn)));
+    p_pastedRow.bill.setFundedStatus(false);
+}
+
+bool BillPasteParser::readAmountDueCents(const QString &p_amountText, qint64 &p_amountDueCents)
+{
+    // Drop currency symbols, thousands separators, and spaces, which spreadsheets often format amounts with
+    QString amountText;
+
+    for(QChar character : p_amountText)
+    {
+        if(character.category() != QChar::Symbol_Currency && character != COMMA_SEPARATOR && !character.isSpace())
+        {
+            amountText.append(character);
+        }
+    }
+
+    bool isAmountValid = false;
+    double amountDue = amountText.toDouble(&isAmountValid);
+
+    if(!isAmountValid || !std::isfinite(amountDue))
+    {
+        return false;
+    }
+
+    // Amounts too large to convert to cents are kept just out of range, so they are reported as such
+    double amountDueCents = std::round(amountDue * 100.0);
+    p_amountDueCents = std::fabs(amountDueCents) > static_cast<double>(Bill::getMaxAmountDueCents()) ? (amountDueCents < 0 ? -1 : Bill::getMaxAmountDueCents() + 1) : static_cast<qint64>(amountDueCents);
+    return true;
+}
+
+QDate BillPasteParser::readDueDate(const QString &p_dateText)
+{
+    QDate dueDate = StagedLedger::parseDate(p_dateText);
+
+    if(dueDate.isValid())
+    {
+        return dueDate;
+    }
+
+    return QDate::fromString(p_dateText, Qt::ISODate);
+}
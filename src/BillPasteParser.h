@@ -0,0 +1,112 @@
+/*##################################################################################
+#   File name:          BillPasteParser.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillPasteParser
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLPASTEPARSER_H
+#define BILLPASTEPARSER_H
+
+// Local file includes
+#include "Bill.h"
+
+// Qt includes
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The BillPasteParser class turns rows of bills pasted from a spreadsheet or CSV file into Bills, checking every field of every row at once.
+ * Rows are separated by line breaks and fields by tabs, or by commas when the text holds no tabs, in which case fields containing commas are quoted as in CSV.
+ * Fields are given in the order of the BillWidget: name, amount due, due date, currency, category, and tags. The last three are optional, and a header row is skipped.
+ */
+class BillPasteParser
+{
+
+public:
+
+    /**
+     * @brief The PastedColumn enum lists the fields of a pasted row, in the order they are given.
+     */
+    enum PastedColumn
+    {
+        NameColumn,
+        AmountDueColumn,
+        DueDateColumn,
+        CurrencyColumn,
+        CategoryColumn,
+        TagsColumn,
+        PastedColumnCount
+    };
+
+    /**
+     * @brief The PastedRow struct is one pasted row, the Bill read from it, and what is wrong with each of its fields.
+     */
+    struct PastedRow
+    {
+        int lineNumber = 0; //!< The line of the pasted text the row was on, counting from one.
+        QString lineText; //!< The text of the line, so rows which were not added can be given back to the user.
+        QStringList fields; //!< The fields of the row as pasted, one per PastedColumn, empty for fields which were left out.
+        Bill bill; //!< The bill read from the row, only meaningful if the row has no errors.
+        QStringList fieldErrors; //!< What is wrong with each field, one per PastedColumn, empty for fields which are valid.
+        QStringList fieldWarnings; //!< What may be wrong with each field without stopping the row from being added, one per PastedColumn.
+
+        /**
+         * @brief Returns whether or not every field of the row is valid.
+         * @return True if the row can be added.
+         */
+        bool isValid() const;
+    };
+
+    /**
+     * @brief Splits pasted text into rows of fields, skipping blank lines and a header row.
+     * @param p_pastedText - The pasted text.
+     * @param p_defaultCurrencyCode - The currency of rows which leave it out.
+     * @return The rows, each read into a Bill and checked on its own.
+     */
+    static QVector<PastedRow> parse(const QString &p_pastedText, const QString &p_defaultCurrencyCode);
+
+    /**
+     * @brief Returns the title of a column, as shown above it and as recognized in a header row.
+     * @param p_column - The column.
+     * @return The title.
+     */
+    static QString columnTitle(PastedColumn p_column);
+
+private:
+
+    /**
+     * @brief Splits one line into fields, undoing CSV quoting when the fields are separated by commas.
+     * @param p_lineText - The line.
+     * @param p_separator - The character separating the fields.
+     * @return The fields with surrounding whitespace removed.
+     */
+    static QStringList splitFields(const QString &p_lineText, QChar p_separator);
+
+    /**
+     * @brief Reads the fields of a row into its Bill, noting what is wrong with any of them.
+     * @param p_pastedRow - The row, whose fields are set.
+     * @param p_defaultCurrencyCode - The currency of rows which leave it out.
+     */
+    static void readRow(PastedRow &p_pastedRow, const QString &p_defaultCurrencyCode);
+
+    /**
+     * @brief Reads an amount as it might be written in a spreadsheet, allowing a currency symbol and thousands separators.
+     * @param p_amountText - The amount as pasted.
+     * @param p_amountDueCents - Receives the amount in cents.
+     * @return False if the text is not an amount.
+     */
+    static bool readAmountDueCents(const QString &p_amountText, qint64 &p_amountDueCents);
+
+    /**
+     * @brief Reads a date written as the PFT writes them, "M/d/yyyy", or as an ISO 8601 date, "yyyy-MM-dd".
+     * @param p_dateText - The date as pasted.
+     * @return The date, or a null date if it is neither.
+     */
+    static QDate readDueDate(const QString &p_dateText);
+};
+
+#endif // BILLPASTEPARSER_H
@@ -0,0 +1,407 @@
+/*##################################################################################
+#   File name:          BillSearchIndex.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillSearchIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillSearchIndex.h"
+
+#include <algorithm>
+
+namespace
+{
+    // Tags stored in the upper bits of an encoded gram so trigrams and word prefixes never collide
+    const quint64 TRIGRAM_TAG = Q_UINT64_C(3) << 48;
+    const quint64 ONE_CHARACTER_PREFIX_TAG = Q_UINT64_C(1) << 48;
+    const quint64 TWO_CHARACTER_PREFIX_TAG = Q_UINT64_C(2) << 48;
+
+    /**
+     * @brief Packs up to three UTF-16 code units and a tag into a single integer.
+     * @param p_tag - The tag identifying the kind of gram.
+     * @param p_first - The first code unit.
+     * @param p_second - The second code unit, zero if unused.
+     * @param p_third - The third code unit, zero if unused.
+     * @return The encoded gram.
+     */
+    quint64 encodeGram(quint64 p_tag, QChar p_first, QChar p_second = QChar(), QChar p_third = QChar())
+    {
+        // Each code unit occupies sixteen bits beneath the tag
+        return p_tag | (quint64(p_first.unicode()) << 32) | (quint64(p_second.unicode()) << 16) | quint64(p_third.unicode());
+    }
+
+    /**
+     * @brief Sorts a list of grams and removes duplicates so each gram is only posted once per bill.
+     * @param p_grams - The grams to deduplicate.
+     */
+    void sortAndDeduplicate(QVector<quint64> &p_grams)
+    {
+        std::sort(p_grams.begin(), p_grams.end());
+        p_grams.erase(std::unique(p_grams.begin(), p_grams.end()), p_grams.end());
+    }
+}
+
+QString BillSearchIndex::foldText(const QString &p_text)
+{
+    // Fold case so "Car Loan" and "car loan" match, and collapse runs of whitespace
+    return p_text.toCaseFolded().simplified();
+}
+
+QVector<quint64> BillSearchIndex::gramsForName(const QString &p_foldedText)
+{
+    QVector<quint64> grams;
+    grams.reserve(p_foldedText.size() + 4);
+
+    // Every trigram of the name is posted so any substring of three or more characters can be looked up
+    for(int position = 0; position + 2 < p_foldedText.size(); position++)
+    {
+        grams.append(encodeGram(TRIGRAM_TAG, p_foldedText.at(position), p_foldedText.at(position + 1), p_foldedText.at(position + 2)));
+    }
+
+    // The one and two character prefixes of each word are posted so the first keystrokes already narrow the results
+    for(int position = 0; position < p_foldedText.size(); position++)
+    {
+        // Skip characters which do not begin a word
+        if(p_foldedText.at(position).isSpace() || (position > 0 && !p_foldedText.at(position - 1).isSpace()))
+        {
+            continue;
+        }
+
+        grams.append(encodeGram(ONE_CHARACTER_PREFIX_TAG, p_foldedText.at(position)));
+
+        // Only post the two character prefix if the word is at least two characters long
+        if(position + 1 < p_foldedText.size() && !p_foldedText.at(position + 1).isSpace())
+        {
+            grams.append(encodeGram(TWO_CHARACTER_PREFIX_TAG, p_foldedText.at(position), p_foldedText.at(position + 1)));
+        }
+    }
+
+    sortAndDeduplicate(grams);
+    return grams;
+}
+
+QVector<quint64> BillSearchIndex::gramsForQuery(const QString &p_foldedQuery)
+{
+    QVector<quint64> grams;
+
+    // Queries of three or more characters must contain every one of their trigrams
+    if(p_foldedQuery.size() >= 3)
+    {
+        for(int position = 0; position + 2 < p_foldedQuery.size(); position++)
+        {
+            grams.append(encodeGram(TRIGRAM_TAG, p_foldedQuery.at(position), p_foldedQuery.at(position + 1), p_foldedQuery.at(position + 2)));
+        }
+
+        sortAndDeduplicate(grams);
+    }
+
+    // Shorter queries are treated as the start of a word
+    else if(p_foldedQuery.size() == 2 && !p_foldedQuery.at(1).isSpace())
+    {
+        grams.append(encodeGram(TWO_CHARACTER_PREFIX_TAG, p_foldedQuery.at(0), p_foldedQuery.at(1)));
+    }
+    else if(!p_foldedQuery.isEmpty())
+    {
+        grams.append(encodeGram(ONE_CHARACTER_PREFIX_TAG, p_foldedQuery.at(0)));
+    }
+
+    return grams;
+}
+
+int BillSearchIndex::scoreSubstringMatch(const QString &p_foldedName, const QString &p_foldedQuery) const
+{
+    // Find the first occurrence of the query within the name
+    int matchPosition = p_foldedName.indexOf(p_foldedQuery);
+
+    // The candidate only shared grams with the query but does not actually contain it
+    if(matchPosition < 0)
+    {
+        return 0;
+    }
+
+    // Shorter names are closer to what was typed, so they rank higher within the same kind of match
+    int lengthPenalty = std::min(static_cast<int>(p_foldedName.size() - p_foldedQuery.size()), 999);
+
+    if(matchPosition == 0)
+    {
+        return (p_foldedName.size() == p_foldedQuery.size() ? m_EXACT_MATCH_SCORE : m_PREFIX_MATCH_SCORE) - lengthPenalty;
+    }
+
+    // Look for a later occurrence of the query which begins a word
+    while(matchPosition > 0)
+    {
+        if(p_foldedName.at(matchPosition - 1).isSpace())
+        {
+            return m_WORD_START_MATCH_SCORE - lengthPenalty;
+        }
+
+        matchPosition = p_foldedName.indexOf(p_foldedQuery, matchPosition + 1);
+    }
+
+    // The query only appears in the middle of a word
+    return m_SUBSTRING_MATCH_SCORE - lengthPenalty;
+}
+
+void BillSearchIndex::addPostings(quint32 p_billId, const QVector<quint64> &p_grams)
+{
+    for(quint64 gram : p_grams)
+    {
+        QVector<quint32> &postingList = m_postings[gram];
+
+        // New ids are handed out in increasing order, so appending keeps the list sorted in the common case
+        if(postingList.isEmpty() || postingList.last() < p_billId)
+        {
+            postingList.append(p_billId);
+        }
+
+        // A recycled id has to be inserted in order
+        else
+        {
+            postingList.insert(std::lower_bound(postingList.begin(), postingList.end(), p_billId), p_billId);
+        }
+    }
+}
+
+void BillSearchIndex::removePostings(quint32 p_billId, const QVector<quint64> &p_grams)
+{
+    for(quint64 gram : p_grams)
+    {
+        QHash<quint64, QVector<quint32>>::iterator postingIterator = m_postings.find(gram);
+
+        // The gram was never posted, nothing to remove
+        if(postingIterator == m_postings.end())
+        {
+            continue;
+        }
+
+        // Locate and remove the bill id from the sorted list
+        QVector<quint32> &postingList = postingIterator.value();
+        QVector<quint32>::iterator idIterator = std::lower_bound(postingList.begin(), postingList.end(), p_billId);
+
+        if(idIterator != postingList.end() && *idIterator == p_billId)
+        {
+            postingList.erase(idIterator);
+        }
+
+        // Drop empty lists so the index does not grow with every name ever typed
+        if(postingList.isEmpty())
+        {
+            m_postings.erase(postingIterator);
+        }
+    }
+}
+
+void BillSearchIndex::insertBill(const QString &p_billKey, const QString &p_billName)
+{
+    QString foldedName = foldText(p_billName);
+
+    // If the bill is already indexed
+    if(m_billIdByKey.contains(p_billKey))
+    {
+        // Nothing to do if its name has not changed
+        if(m_foldedNameById.at(m_billIdByKey.value(p_billKey)) == foldedName)
+        {
+            return;
+        }
+
+        // Otherwise remove the stale postings before re-indexing under the new name
+        removeBill(p_billKey);
+    }
+
+    quint32 billId;
+
+    // Reuse a released id if there is one so the id space stays dense
+    if(!m_freeBillIds.isEmpty())
+    {
+        billId = m_freeBillIds.takeLast();
+        m_billKeyById[billId] = p_billKey;
+        m_foldedNameById[billId] = foldedName;
+    }
+    else
+    {
+        billId = static_cast<quint32>(m_billKeyById.size());
+        m_billKeyById.append(p_billKey);
+        m_foldedNameById.append(foldedName);
+    }
+
+    // Record the id and post it under each of the name's grams
+    m_billIdByKey.insert(p_billKey, billId);
+    addPostings(billId, gramsForName(foldedName));
+}
+
+void BillSearchIndex::removeBill(const QString &p_billKey)
+{
+    QHash<QString, quint32>::iterator idIterator = m_billIdByKey.find(p_billKey);
+
+    // The bill was never indexed
+    if(idIterator == m_billIdByKey.end())
+    {
+        return;
+    }
+
+    quint32 billId = idIterator.value();
+
+    // Remove the bill's postings and release its id for reuse
+    removePostings(billId, gramsForName(m_foldedNameById.at(billId)));
+    m_billIdByKey.erase(idIterator);
+    m_billKeyById[billId].clear();
+    m_foldedNameById[billId].clear();
+    m_freeBillIds.append(billId);
+}
+
+void BillSearchIndex::clear()
+{
+    // Reset every structure back to its empty state
+    m_postings.clear();
+    m_billIdByKey.clear();
+    m_billKeyById.clear();
+    m_foldedNameById.clear();
+    m_freeBillIds.clear();
+}
+
+bool BillSearchIndex::containsBill(const QString &p_billKey) const
+{
+    // Return whether or not the bill has an id
+    return m_billIdByKey.contains(p_billKey);
+}
+
+QList<QString> BillSearchIndex::billKeys() const
+{
+    // Return the keys of every indexed bill
+    return m_billIdByKey.keys();
+}
+
+QList<BillSearchIndex::SearchResult> BillSearchIndex::search(const QString &p_query, int p_maxResults, int *p_matchCount) const
+{
+    QList<SearchResult> results;
+    QString foldedQuery = foldText(p_query);
+    QVector<quint64> queryGrams = gramsForQuery(foldedQuery);
+
+    if(p_matchCount != nullptr)
+    {
+        *p_matchCount = 0;
+    }
+
+    // An empty query, or a request for no results, matches nothing
+    if(queryGrams.isEmpty() || p_maxResults <= 0)
+    {
+        return results;
+    }
+
+    // Collect the posting list of each query gram, noting whether any gram has no postings at all
+    QVector<const QVector<quint32>*> postingLists;
+    bool isEveryGramPosted = true;
+
+    for(quint64 gram : queryGrams)
+    {
+        QHash<quint64, QVector<quint32>>::const_iterator postingIterator = m_postings.constFind(gram);
+
+        if(postingIterator == m_postings.constEnd())
+        {
+            isEveryGramPosted = false;
+        }
+        else
+        {
+            postingLists.append(&postingIterator.value());
+        }
+    }
+
+    // Intersect from the shortest list up so the candidate set shrinks as quickly as possible
+    std::sort(postingLists.begin(), postingLists.end(), [](const QVector<quint32> *p_first, const QVector<quint32> *p_second)
+    {
+        return p_first->size() < p_second->size();
+    });
+
+    QVector<quint32> strictCandidates;
+
+    // A name can only contain the query if it contains every one of the query's grams
+    if(isEveryGramPosted && !postingLists.isEmpty())
+    {
+        strictCandidates = *postingLists.first();
+
+        for(int listIndex = 1; listIndex < postingLists.size() && !strictCandidates.isEmpty(); listIndex++)
+        {
+            QVector<quint32> intersection;
+            intersection.reserve(strictCandidates.size());
+            std::set_intersection(strictCandidates.cbegin(), strictCandidates.cend(), postingLists.at(listIndex)->cbegin(), postingLists.at(listIndex)->cend(), std::back_inserter(intersection));
+            strictCandidates.swap(intersection);
+        }
+    }
+
+    // Verify each candidate actually contains the query, since sharing every trigram does not guarantee they appear in order
+    for(quint32 billId : strictCandidates)
+    {
+        int score = scoreSubstringMatch(m_foldedNameById.at(billId), foldedQuery);
+
+        if(score > 0)
+        {
+            results.append({m_billKeyById.at(billId), score});
+        }
+    }
+
+    // If too few names contain the query, fall back to names which share most of its trigrams to tolerate typos
+    int totalPostings = 0;
+
+    for(const QVector<quint32> *postingList : postingLists)
+    {
+        totalPostings += postingList->size();
+    }
+
+    if(results.size() < p_maxResults && foldedQuery.size() >= 3 && queryGrams.size() >= 2 && totalPostings <= m_MAX_FUZZY_POSTINGS)
+    {
+        // Count how many of the query's trigrams each bill shares
+        QHash<quint32, int> sharedGramCounts;
+
+        for(const QVector<quint32> *postingList : postingLists)
+        {
+            for(quint32 billId : *postingList)
+            {
+                sharedGramCounts[billId]++;
+            }
+        }
+
+        // Require at least half of the query's trigrams to be shared
+        int minimumSharedGrams = (queryGrams.size() + 1) / 2;
+
+        for(QHash<quint32, int>::const_iterator countIterator = sharedGramCounts.cbegin(); countIterator != sharedGramCounts.cend(); ++countIterator)
+        {
+            const QString &foldedName = m_foldedNameById.at(countIterator.key());
+
+            // Skip weak matches and names which were already returned as substring matches
+            if(countIterator.value() < minimumSharedGrams || foldedName.contains(foldedQuery))
+            {
+                continue;
+            }
+
+            int lengthPenalty = std::min(static_cast<int>(qAbs(foldedName.size() - foldedQuery.size())), 99);
+            results.append({m_billKeyById.at(countIterator.key()), m_FUZZY_MATCH_SCORE * countIterator.value() / queryGrams.size() - lengthPenalty});
+        }
+    }
+
+    // Order by descending score, breaking ties by key so results are stable between keystrokes
+    auto isBetterResult = [](const SearchResult &p_first, const SearchResult &p_second)
+    {
+        return p_first.score != p_second.score ? p_first.score > p_second.score : p_first.billKey < p_second.billKey;
+    };
+
+    // Let the caller know how many matches there were before the rest are dropped
+    if(p_matchCount != nullptr)
+    {
+        *p_matchCount = results.size();
+    }
+
+    // Only the best results are fully sorted
+    if(results.size() > p_maxResults)
+    {
+        std::partial_sort(results.begin(), results.begin() + p_maxResults, results.end(), isBetterResult);
+        results.erase(results.begin() + p_maxResults, results.end());
+    }
+    else
+    {
+        std::sort(results.begin(), results.end(), isBetterResult);
+    }
+
+    return results;
+}
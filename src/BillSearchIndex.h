@@ -0,0 +1,138 @@
+/*##################################################################################
+#   File name:          BillSearchIndex.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillSearchIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLSEARCHINDEX_H
+#define BILLSEARCHINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The BillSearchIndex class is an n-gram index over bill names which is maintained incrementally as bills are added, renamed, and removed.
+ * Names are case folded and split into trigrams, each of which maps to a sorted posting list of compact bill ids.
+ * Queries intersect the posting lists of the query's trigrams starting from the shortest, so the cost of a keystroke depends on how selective the query is rather than on the number of bills.
+ */
+class BillSearchIndex
+{
+
+public:
+
+    /**
+     * @brief The SearchResult struct holds a single bill matched by a query along with the quality of the match.
+     */
+    struct SearchResult
+    {
+        QString billKey; //!< The bill map key of the matched bill.
+        int score = 0; //!< The quality of the match, higher scores are better matches.
+    };
+
+    /**
+     * @brief Adds a bill to the index, or re-indexes it if a bill with the same key was already indexed under a different name.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_billName - The display name of the bill which is searched against.
+     */
+    void insertBill(const QString &p_billKey, const QString &p_billName);
+
+    /**
+     * @brief Removes a bill from the index, does nothing if the bill was never indexed.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBill(const QString &p_billKey);
+
+    /**
+     * @brief Removes every bill from the index.
+     */
+    void clear();
+
+    /**
+     * @brief Returns whether or not a bill is currently indexed.
+     * @param p_billKey - The bill map key of the bill.
+     * @return True if the bill is indexed, false otherwise.
+     */
+    bool containsBill(const QString &p_billKey) const;
+
+    /**
+     * @brief Returns the bill map keys of every indexed bill.
+     * @return The keys of every indexed bill, in no particular order.
+     */
+    QList<QString> billKeys() const;
+
+    /**
+     * @brief Finds the bills whose names match a query, ranked from best to worst match.
+     * Exact matches rank above prefix matches, which rank above word start matches, which rank above substring matches.
+     * When the query has too few exact substring matches, names sharing most of the query's trigrams are also returned as fuzzy matches.
+     * @param p_query - The text the user has typed so far.
+     * @param p_maxResults - The maximum number of results to return.
+     * @param p_matchCount - If not null, set to the number of bills which matched, including those beyond the maximum which were not returned.
+     * @return The best matching bills, ordered by descending score.
+     */
+    QList<SearchResult> search(const QString &p_query, int p_maxResults, int *p_matchCount = nullptr) const;
+
+private:
+
+    /**
+     * @brief Normalizes a name for matching by case folding it and collapsing whitespace.
+     * @param p_text - The text to normalize.
+     * @return The normalized text.
+     */
+    static QString foldText(const QString &p_text);
+
+    /**
+     * @brief Computes the distinct grams of a normalized name, which are its trigrams plus the one and two character prefixes of each word.
+     * @param p_foldedText - Normalized text produced by foldText().
+     * @return The distinct grams of the text, each encoded as an integer.
+     */
+    static QVector<quint64> gramsForName(const QString &p_foldedText);
+
+    /**
+     * @brief Computes the grams which every name matching a query must contain.
+     * @param p_foldedQuery - Normalized query produced by foldText().
+     * @return The distinct grams of the query, each encoded as an integer.
+     */
+    static QVector<quint64> gramsForQuery(const QString &p_foldedQuery);
+
+    /**
+     * @brief Scores how well a normalized name matches a normalized query.
+     * @param p_foldedName - The normalized bill name.
+     * @param p_foldedQuery - The normalized query.
+     * @return The score of the match, or zero if the query is not a substring of the name.
+     */
+    int scoreSubstringMatch(const QString &p_foldedName, const QString &p_foldedQuery) const;
+
+    /**
+     * @brief Adds a bill id to the posting list of each gram.
+     * @param p_billId - The bill id.
+     * @param p_grams - The grams the bill's name contains.
+     */
+    void addPostings(quint32 p_billId, const QVector<quint64> &p_grams);
+
+    /**
+     * @brief Removes a bill id from the posting list of each gram, dropping posting lists which become empty.
+     * @param p_billId - The bill id.
+     * @param p_grams - The grams the bill's name contains.
+     */
+    void removePostings(quint32 p_billId, const QVector<quint64> &p_grams);
+
+    const int m_EXACT_MATCH_SCORE = 4000; //!< Base score for a name equal to the query.
+    const int m_PREFIX_MATCH_SCORE = 3000; //!< Base score for a name starting with the query.
+    const int m_WORD_START_MATCH_SCORE = 2000; //!< Base score for a name containing a word which starts with the query.
+    const int m_SUBSTRING_MATCH_SCORE = 1000; //!< Base score for a name containing the query anywhere.
+    const int m_FUZZY_MATCH_SCORE = 900; //!< Maximum score for a name which only shares trigrams with the query.
+    const int m_MAX_FUZZY_POSTINGS = 250000; //!< The fuzzy pass is skipped when it would have to walk more postings than this, keeping keystrokes within a frame.
+
+    QHash<quint64, QVector<quint32>> m_postings; //!< Map of (encoded gram, sorted ids of the bills whose names contain the gram).
+    QHash<QString, quint32> m_billIdByKey; //!< Map of (bill map key, bill id).
+    QVector<QString> m_billKeyById; //!< The bill map key of each bill id, empty for unused ids.
+    QVector<QString> m_foldedNameById; //!< The normalized name of each bill id, used to verify and rank candidates.
+    QVector<quint32> m_freeBillIds; //!< Ids released by removed bills which can be handed out again.
+};
+
+#endif // BILLSEARCHINDEX_H
@@ -0,0 +1,307 @@
+/*##################################################################################
+#   File name:          BillSorter.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BillSorter
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BillSorter.h"
+
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <numeric>
+
+QCollator &BillSorter::collator()
+{
+    // Text sorts as the user's locale orders it, with case only telling apart text which is otherwise equal
+    static QCollator localeCollator = []()
+    {
+        QCollator newCollator;
+        newCollator.setCaseSensitivity(Qt::CaseInsensitive);
+        return newCollator;
+    }();
+
+    return localeCollator;
+}
+
+BillSorter::SortKey BillSorter::makeSortKey(const QString &p_name, double p_amountDue, const QDate &p_dueDate, bool p_isFunded, const QString &p_currencyCode, const QString &p_category, const QString &p_tagsText)
+{
+    // Pack the currency code's characters most significant first, so comparing the integers compares the codes alphabetically
+    quint32 currencyCodeValue = 0;
+
+    for(const QChar &character : p_currencyCode.left(3))
+    {
+        currencyCodeValue = (currencyCodeValue << 8) | static_cast<quint8>(character.toLatin1());
+    }
+
+    // Names, categories, and tags get the locale's collation keys, the amount is stored in whole cents so amounts compare exactly, and the due date as a day number
+    return SortKey{collator().sortKey(p_name), qRound64(p_amountDue * 100.0), p_dueDate.toJulianDay(), p_isFunded, currencyCodeValue, collator().sortKey(p_category),
+                   collator().sortKey(p_tagsText)};
+}
+
+bool BillSorter::isRowBefore(int p_firstRow, int p_secondRow) const
+{
+    const SortKey &firstKey = m_sortKeys.at(p_firstRow);
+    const SortKey &secondKey = m_sortKeys.at(p_secondRow);
+
+    // Check each criterion in order of significance until one of them tells the rows apart
+    for(const SortCriterion &criterion : m_criteria)
+    {
+        int comparison = 0;
+
+        switch(criterion.column)
+        {
+            case NameColumn :
+            {
+                comparison = firstKey.nameCollationKey.compare(secondKey.nameCollationKey);
+                break;
+            }
+
+            case AmountDueColumn :
+            {
+                comparison = firstKey.amountDueCents < secondKey.amountDueCents ? -1 : (firstKey.amountDueCents > secondKey.amountDueCents ? 1 : 0);
+                break;
+            }
+
+            case DueDateColumn :
+            {
+                comparison = firstKey.dueDateJulianDay < secondKey.dueDateJulianDay ? -1 : (firstKey.dueDateJulianDay > secondKey.dueDateJulianDay ? 1 : 0);
+                break;
+            }
+
+            case CategoryColumn :
+            {
+                comparison = firstKey.categoryCollationKey.compare(secondKey.categoryCollationKey);
+                break;
+            }
+
+            case TagsColumn :
+            {
+                comparison = firstKey.tagsCollationKey.compare(secondKey.tagsCollationKey);
+                break;
+            }
+
+            case CurrencyColumn :
+            {
+                comparison = firstKey.currencyCodeValue < secondKey.currencyCodeValue ? -1 : (firstKey.currencyCodeValue > secondKey.currencyCodeValue ? 1 : 0);
+                break;
+            }
+
+            default :
+            {
+                comparison = int(firstKey.isFunded) - int(secondKey.isFunded);
+                break;
+            }
+        }
+
+        if(comparison != 0)
+        {
+            return criterion.order == Qt::AscendingOrder ? comparison < 0 : comparison > 0;
+        }
+    }
+
+    // Rows equal under every criterion keep their original order
+    return p_firstRow < p_secondRow;
+}
+
+void BillSorter::refreshPositions(int p_firstPosition, int p_lastPosition)
+{
+    // Point each row in the range back at its sorted position
+    for(int position = p_firstPosition; position < p_lastPosition; position++)
+    {
+        m_positionOfRow[m_sortedRows.at(position)] = position;
+    }
+}
+
+void BillSorter::sortAllRows()
+{
+    // Start from the original row order
+    m_sortedRows.resize(m_sortKeys.size());
+    std::iota(m_sortedRows.begin(), m_sortedRows.end(), 0);
+    m_positionOfRow.resize(m_sortKeys.size());
+
+    auto rowComparator = [this](int p_firstRow, int p_secondRow)
+    {
+        return isRowBefore(p_firstRow, p_secondRow);
+    };
+
+    // Small tables are sorted on the calling thread since spinning up workers would cost more than it saves
+    if(m_sortedRows.size() < m_PARALLEL_SORT_THRESHOLD)
+    {
+        std::sort(m_sortedRows.begin(), m_sortedRows.end(), rowComparator);
+    }
+
+    // Large tables are split into one chunk per core, each sorted in parallel, and then merged pairwise in parallel rounds
+    else
+    {
+        int rowCount = m_sortedRows.size();
+        int chunkCount = std::max(1, QThread::idealThreadCount());
+        int chunkSize = (rowCount + chunkCount - 1) / chunkCount;
+
+        // Each chunk is a [first, last) range of sorted positions
+        QVector<QPair<int, int>> chunks;
+
+        for(int firstPosition = 0; firstPosition < rowCount; firstPosition += chunkSize)
+        {
+            chunks.append(qMakePair(firstPosition, std::min(firstPosition + chunkSize, rowCount)));
+        }
+
+        QtConcurrent::blockingMap(chunks, [this, &rowComparator](const QPair<int, int> &p_chunk)
+        {
+            std::sort(m_sortedRows.begin() + p_chunk.first, m_sortedRows.begin() + p_chunk.second, rowComparator);
+        });
+
+        // Merge neighbouring chunks until a single sorted run remains, every merge of a round running concurrently
+        while(chunks.size() > 1)
+        {
+            QVector<QPair<int, int>> mergedChunks;
+            QVector<QPair<QPair<int, int>, int>> merges;
+
+            for(int chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex += 2)
+            {
+                // An odd chunk out is carried into the next round untouched
+                if(chunkIndex + 1 == chunks.size())
+                {
+                    mergedChunks.append(chunks.at(chunkIndex));
+                    continue;
+                }
+
+                merges.append(qMakePair(qMakePair(chunks.at(chunkIndex).first, chunks.at(chunkIndex + 1).second), chunks.at(chunkIndex).second));
+                mergedChunks.append(qMakePair(chunks.at(chunkIndex).first, chunks.at(chunkIndex + 1).second));
+            }
+
+            QtConcurrent::blockingMap(merges, [this, &rowComparator](const QPair<QPair<int, int>, int> &p_merge)
+            {
+                std::inplace_merge(m_sortedRows.begin() + p_merge.first.first, m_sortedRows.begin() + p_merge.second, m_sortedRows.begin() + p_merge.first.second, rowComparator);
+            });
+
+            chunks.swap(mergedChunks);
+        }
+    }
+
+    refreshPositions(0, m_sortedRows.size());
+}
+
+void BillSorter::clear()
+{
+    // Drop every row, the criteria are kept so the next table is sorted the same way
+    m_sortKeys.clear();
+    m_sortedRows.clear();
+    m_positionOfRow.clear();
+}
+
+void BillSorter::resetRows(const QVector<SortKey> &p_sortKeys)
+{
+    // Replace the keys and sort them all at once rather than inserting row by row
+    m_sortKeys = p_sortKeys;
+    sortAllRows();
+}
+
+int BillSorter::appendRow(const SortKey &p_sortKey)
+{
+    // Store the new row's key
+    int row = m_sortKeys.size();
+    m_sortKeys.append(p_sortKey);
+    m_positionOfRow.append(0);
+
+    // Binary search for the row's sorted position and insert it there
+    int position = std::lower_bound(m_sortedRows.begin(), m_sortedRows.end(), row, [this](int p_firstRow, int p_secondRow)
+    {
+        return isRowBefore(p_firstRow, p_secondRow);
+    }) - m_sortedRows.begin();
+
+    m_sortedRows.insert(position, row);
+
+    // Every row after the insertion point moved down by one
+    refreshPositions(position, m_sortedRows.size());
+    return position;
+}
+
+int BillSorter::updateRow(int p_row, const SortKey &p_sortKey)
+{
+    // Take the row out of the sorted order before its key changes
+    int oldPosition = m_positionOfRow.at(p_row);
+    m_sortedRows.remove(oldPosition);
+    m_sortKeys[p_row] = p_sortKey;
+
+    // Binary search for where the edited row now belongs, the rest of the order is untouched
+    int newPosition = std::lower_bound(m_sortedRows.begin(), m_sortedRows.end(), p_row, [this](int p_firstRow, int p_secondRow)
+    {
+        return isRowBefore(p_firstRow, p_secondRow);
+    }) - m_sortedRows.begin();
+
+    m_sortedRows.insert(newPosition, p_row);
+
+    // Only the rows between the old and new positions shifted
+    refreshPositions(std::min(oldPosition, newPosition), std::max(oldPosition, newPosition) + 1);
+    return newPosition;
+}
+
+void BillSorter::removeRows(const QVector<int> &p_rows)
+{
+    if(p_rows.isEmpty())
+    {
+        return;
+    }
+
+    // Work out each remaining row's new number, which drops by one for every removed row above it, matching the bill table widget
+    QVector<int> newRowOf(m_sortKeys.size(), 0);
+
+    for(int removedRow : p_rows)
+    {
+        newRowOf[removedRow] = -1;
+    }
+
+    QVector<SortKey> remainingSortKeys;
+    remainingSortKeys.reserve(m_sortKeys.size() - p_rows.size());
+
+    for(int row = 0; row < m_sortKeys.size(); row++)
+    {
+        if(newRowOf.at(row) >= 0)
+        {
+            newRowOf[row] = remainingSortKeys.size();
+            remainingSortKeys.append(m_sortKeys.at(row));
+        }
+    }
+
+    // Drop the removed rows from the sorted order and renumber the rest in one pass, the renumbering keeping equal rows in their original order
+    int keptPosition = 0;
+
+    for(int position = 0; position < m_sortedRows.size(); position++)
+    {
+        int newRow = newRowOf.at(m_sortedRows.at(position));
+
+        if(newRow >= 0)
+        {
+            m_sortedRows[keptPosition++] = newRow;
+        }
+    }
+
+    m_sortedRows.resize(keptPosition);
+    m_sortKeys.swap(remainingSortKeys);
+    m_positionOfRow.resize(m_sortKeys.size());
+    refreshPositions(0, m_sortedRows.size());
+}
+
+void BillSorter::setCriteria(const QVector<SortCriterion> &p_criteria)
+{
+    // Store the new criteria and sort from scratch
+    m_criteria = p_criteria;
+    sortAllRows();
+}
+
+QVector<BillSorter::SortCriterion> BillSorter::criteria() const
+{
+    // Return the current sort criteria
+    return m_criteria;
+}
+
+const QVector<int> &BillSorter::sortedRows() const
+{
+    // Return the row displayed at each position
+    return m_sortedRows;
+}
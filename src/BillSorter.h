@@ -0,0 +1,165 @@
+/*##################################################################################
+#   File name:          BillSorter.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BillSorter
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BILLSORTER_H
+#define BILLSORTER_H
+
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <QDate>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The BillSorter class keeps the rows of the bill table widget in sorted order using typed sort keys computed once per row.
+ * Keys hold the amount due in integer cents, the due date as a Julian day, case insensitive locale collation keys for the name, category, and tags, the funding status, and the currency code packed into an integer, so comparisons never parse display strings.
+ * Rows equal under every sort criterion keep their original relative order, which makes each sort stable and allows a single edited row to be moved into place without re-sorting the rest.
+ */
+class BillSorter
+{
+
+public:
+
+    /**
+     * @brief The SortColumn enum lists the sortable columns, matching the columns of the bill table widget.
+     */
+    enum SortColumn
+    {
+        NameColumn = 0,
+        AmountDueColumn = 1,
+        DueDateColumn = 2,
+        FundingStatusColumn = 3,
+        CurrencyColumn = 4,
+        CategoryColumn = 5,
+        TagsColumn = 6
+    };
+
+    /**
+     * @brief The SortKey struct holds the precomputed values a row is compared by. It is only made by makeSortKey, since collation keys have no empty value.
+     */
+    struct SortKey
+    {
+        QCollatorSortKey nameCollationKey; //!< The name's collation key, which orders names as the user's locale does.
+        qint64 amountDueCents = 0; //!< The amount due in whole cents.
+        qint64 dueDateJulianDay = 0; //!< The due date as a Julian day number.
+        bool isFunded = false; //!< Whether or not the bill has been funded.
+        quint32 currencyCodeValue = 0; //!< The characters of the currency code packed into an integer which orders the same way as the code.
+        QCollatorSortKey categoryCollationKey; //!< The category's collation key.
+        QCollatorSortKey tagsCollationKey; //!< The collation key of the tags as displayed.
+    };
+
+    /**
+     * @brief The SortCriterion struct pairs a column with the direction it is sorted in.
+     */
+    struct SortCriterion
+    {
+        int column = NameColumn; //!< The column being sorted by.
+        Qt::SortOrder order = Qt::AscendingOrder; //!< The direction the column is sorted in.
+    };
+
+    /**
+     * @brief Computes the sort key for a bill's displayed values. Only called on the GUI thread, which owns the collator.
+     * @param p_name - The bill's name.
+     * @param p_amountDue - The bill's amount due in dollars.
+     * @param p_dueDate - The bill's due date.
+     * @param p_isFunded - Whether or not the bill is funded.
+     * @param p_currencyCode - The code of the currency the amount due is in.
+     * @param p_category - The bill's category.
+     * @param p_tagsText - The bill's tags as displayed.
+     * @return The sort key for the bill.
+     */
+    static SortKey makeSortKey(const QString &p_name, double p_amountDue, const QDate &p_dueDate, bool p_isFunded, const QString &p_currencyCode, const QString &p_category, const QString &p_tagsText);
+
+    /**
+     * @brief Removes every row.
+     */
+    void clear();
+
+    /**
+     * @brief Replaces every row at once and sorts them, used when the bill table widget is rebuilt.
+     * @param p_sortKeys - The sort key of each row.
+     */
+    void resetRows(const QVector<SortKey> &p_sortKeys);
+
+    /**
+     * @brief Adds a row after the existing rows and places it in sorted order.
+     * @param p_sortKey - The sort key of the new row.
+     * @return The sorted position the row was placed at.
+     */
+    int appendRow(const SortKey &p_sortKey);
+
+    /**
+     * @brief Replaces the sort key of a row and moves only that row to its new sorted position.
+     * @param p_row - The row whose values were edited.
+     * @param p_sortKey - The row's new sort key.
+     * @return The sorted position the row was moved to.
+     */
+    int updateRow(int p_row, const SortKey &p_sortKey);
+
+    /**
+     * @brief Removes rows in one pass over the sorted order, shifting the rows after each up just as the bill table widget does.
+     * @param p_rows - The rows being removed, in any order.
+     */
+    void removeRows(const QVector<int> &p_rows);
+
+    /**
+     * @brief Replaces the sort criteria and re-sorts every row, sorting large tables across all cores.
+     * @param p_criteria - The columns to sort by, most significant first. An empty list restores the original row order.
+     */
+    void setCriteria(const QVector<SortCriterion> &p_criteria);
+
+    /**
+     * @brief Returns the current sort criteria.
+     * @return The columns being sorted by, most significant first.
+     */
+    QVector<SortCriterion> criteria() const;
+
+    /**
+     * @brief Returns the rows in sorted order.
+     * @return The row displayed at each position.
+     */
+    const QVector<int> &sortedRows() const;
+
+private:
+
+    /**
+     * @brief Returns the case insensitive collator for the user's locale which collation keys are made with, created on first use.
+     * @return The collator.
+     */
+    static QCollator &collator();
+
+    /**
+     * @brief Compares two rows under the current sort criteria, falling back to their row numbers so equal rows keep their original order.
+     * @param p_firstRow - The first row to compare.
+     * @param p_secondRow - The second row to compare.
+     * @return True if the first row sorts before the second row.
+     */
+    bool isRowBefore(int p_firstRow, int p_secondRow) const;
+
+    /**
+     * @brief Sorts every row from scratch, splitting the work into per core chunks which are sorted and then merged in parallel for large tables.
+     */
+    void sortAllRows();
+
+    /**
+     * @brief Records the sorted position of each row within a range of positions.
+     * @param p_firstPosition - The first position to refresh.
+     * @param p_lastPosition - One past the last position to refresh.
+     */
+    void refreshPositions(int p_firstPosition, int p_lastPosition);
+
+    const int m_PARALLEL_SORT_THRESHOLD = 50000; //!< Tables with fewer rows than this are sorted on the calling thread.
+
+    QVector<SortKey> m_sortKeys; //!< The sort key of each row.
+    QVector<SortCriterion> m_criteria; //!< The columns being sorted by, most significant first.
+    QVector<int> m_sortedRows; //!< The row displayed at each sorted position.
+    QVector<int> m_positionOfRow; //!< The sorted position of each row.
+};
+
+#endif // BILLSORTER_H
@@ -63,15 +63,24 @@ BillWidget::~BillWidget()
     deleteLabelIfNonNull(m_nameLabel);
     deleteLabelIfNonNull(m_amountDueLabel);
     deleteLabelIfNonNull(m_dueDateLabel);
+    deleteLabelIfNonNull(m_currencyLabel);
+    deleteLabelIfNonNull(m_categoryLabel);
+    deleteLabelIfNonNull(m_tagsLabel);
+    deleteLabelIfNonNull(m_pasteInstructionsLabel);
+    deleteLabelIfNonNull(m_pasteSummaryLabel);
 
     // Properly delete dynamically allocated line edits
     deleteLineEditIfNonNull(m_nameInput);
     deleteLineEditIfNonNull(m_amountDueInput);
+    deleteLineEditIfNonNull(m_categoryInput);
+    deleteLineEditIfNonNull(m_tagsInput);
 
     // Properly delete dynamically allocated buttons
     deleteButtonIfNonNull(m_closeButton);
     deleteButtonIfNonNull(m_enterAnotherButton);
     deleteButtonIfNonNull(m_doneButton);
+    deleteButtonIfNonNull(m_pasteModeButton);
+    deleteButtonIfNonNull(m_addPastedButton);
 
     // If the due date date edit was created successfully
     if(m_dueDateInput != nullptr)
@@ -80,6 +89,30 @@ BillWidget::~BillWidget()
         delete m_dueDateInput;
         m_dueDateInput = nullptr;
     }
+
+    // If the currency combo box was created successfully
+    if(m_currencyInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_currencyInput;
+        m_currencyInput = nullptr;
+    }
+
+    // If the paste plain text edit was created successfully
+    if(m_pasteInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_pasteInput;
+        m_pasteInput = nullptr;
+    }
+
+    // If the paste preview table was created successfully
+    if(m_pastePreview != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_pastePreview;
+        m_pastePreview = nullptr;
+    }
 }
 
 void BillWidget::initializeWidget()
@@ -99,12 +132,28 @@ void BillWidget::initializeWidget()
     m_dueDateLabel->setText(m_DUE_DATE_LABEL_TEXT);
     m_dueDateInput = new QDateEdit(this);
 
-    // Allow the date edit to display a calendar
+    // Allow the date edit to display a calendar, offering only the dates a bill can hold
     m_dueDateInput->setCalendarPopup(true);
+    m_dueDateInput->setDateRange(Bill::getMinDueDate(), Bill::getMaxDueDate());
 
     // Ensure the date edit is initialized to the current date
     m_dueDateInput->setDate(QDate::currentDate());
 
+    // Create the bill currency label and associated combo box, which is editable so currencies without an exchange rate can still be entered
+    m_currencyLabel = new QLabel(this);
+    m_currencyLabel->setText(m_CURRENCY_LABEL_TEXT);
+    m_currencyInput = new QComboBox(this);
+    m_currencyInput->setEditable(true);
+
+    // Create the bill category and tags labels and associated line edits
+    m_categoryLabel = new QLabel(this);
+    m_categoryLabel->setText(m_CATEGORY_LABEL_TEXT);
+    m_categoryInput = new QLineEdit(this);
+    m_tagsLabel = new QLabel(this);
+    m_tagsLabel->setText(m_TAGS_LABEL_TEXT);
+    m_tagsInput = new QLineEdit(this);
+    m_tagsInput->setPlaceholderText(m_TAGS_PLACEHOLDER_TEXT);
+
     // Create the Close button
     m_closeButton = new QPushButton(this);
     m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
@@ -116,6 +165,39 @@ void BillWidget::initializeWidget()
     // Create the Done button
     m_doneButton = new QPushButton(this);
     m_doneButton->setText(m_DONE_BUTTON_TEXT);
+
+    // Create the paste mode fields, which replace the single bill fields while the paste mode button is checked
+    m_pasteInstructionsLabel = new QLabel(this);
+    m_pasteInstructionsLabel->setText(m_PASTE_INSTRUCTIONS_TEXT);
+    m_pasteInstructionsLabel->setWordWrap(true);
+    m_pasteInput = new QPlainTextEdit(this);
+    m_pasteInput->setPlaceholderText(m_PASTE_PLACEHOLDER_TEXT);
+    m_pasteInput->setLineWrapMode(QPlainTextEdit::NoWrap);
+    m_pasteSummaryLabel = new QLabel(this);
+
+    // Create the read only preview of the pasted rows, with a column per field
+    QStringList columnTitles;
+
+    for(int column = 0; column < BillPasteParser::PastedColumnCount; column++)
+    {
+        columnTitles.append(BillPasteParser::columnTitle(static_cast<BillPasteParser::PastedColumn>(column)));
+    }
+
+    m_pastePreview = new QTableWidget(this);
+    m_pastePreview->setColumnCount(BillPasteParser::PastedColumnCount);
+    m_pastePreview->setHorizontalHeaderLabels(columnTitles);
+    m_pastePreview->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    // Create the paste mode and Add Pasted Bills buttons
+    m_pasteModeButton = new QPushButton(this);
+    m_pasteModeButton->setText(m_PASTE_MODE_BUTTON_TEXT);
+    m_pasteModeButton->setCheckable(true);
+    connect(m_pasteModeButton, SIGNAL(toggled(bool)), this, SLOT(setPasteMode(bool)), Qt::AutoConnection);
+    m_addPastedButton = new QPushButton(this);
+    m_addPastedButton->setText(m_ADD_PASTED_BUTTON_TEXT);
+
+    // Start out entering one bill at a time
+    setPasteMode(false);
 }
 
 void BillWidget::createWidgetLayout()
@@ -123,14 +205,95 @@ void BillWidget::createWidgetLayout()
     // Add the labels, line edits, date edit, and buttons into a grid layout
     m_gridLayout = new QGridLayout(this);
     m_gridLayout->addWidget(m_nameLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
-    m_gridLayout->addWidget(m_nameInput, 0, 1);
+    m_gridLayout->addWidget(m_nameInput, 0, 1, 1, 3);
     m_gridLayout->addWidget(m_amountDueLabel, 1, 0);
-    m_gridLayout->addWidget(m_amountDueInput, 1, 1);
+    m_gridLayout->addWidget(m_amountDueInput, 1, 1, 1, 3);
     m_gridLayout->addWidget(m_dueDateLabel, 2, 0);
-    m_gridLayout->addWidget(m_dueDateInput, 2, 1);
-    m_gridLayout->addWidget(m_closeButton, 3, 0);
-    m_gridLayout->addWidget(m_enterAnotherButton, 3, 1);
-    m_gridLayout->addWidget(m_doneButton, 3, 2);
+    m_gridLayout->addWidget(m_dueDateInput, 2, 1, 1, 3);
+    m_gridLayout->addWidget(m_currencyLabel, 3, 0);
+    m_gridLayout->addWidget(m_currencyInput, 3, 1, 1, 3);
+    m_gridLayout->addWidget(m_categoryLabel, 4, 0);
+    m_gridLayout->addWidget(m_categoryInput, 4, 1, 1, 3);
+    m_gridLayout->addWidget(m_tagsLabel, 5, 0);
+    m_gridLayout->addWidget(m_tagsInput, 5, 1, 1, 3);
+
+    // Add the paste mode fields below, only one set of fields is shown at a time
+    m_gridLayout->addWidget(m_pasteInstructionsLabel, 6, 0, 1, 4);
+    m_gridLayout->addWidget(m_pasteInput, 7, 0, 1, 4);
+    m_gridLayout->addWidget(m_pasteSummaryLabel, 8, 0, 1, 4);
+    m_gridLayout->addWidget(m_pastePreview, 9, 0, 1, 4);
+
+    // The Enter Another Bill and Add Pasted Bills buttons share a cell, as only one of them is shown at a time
+    m_gridLayout->addWidget(m_closeButton, 10, 0);
+    m_gridLayout->addWidget(m_pasteModeButton, 10, 1);
+    m_gridLayout->addWidget(m_enterAnotherButton, 10, 2);
+    m_gridLayout->addWidget(m_addPastedButton, 10, 2);
+    m_gridLayout->addWidget(m_doneButton, 10, 3);
+}
+
+void BillWidget::showPastedRows(const QVector<BillPasteParser::PastedRow> &p_pastedRows)
+{
+    QStringList lineNumbers;
+    int validRowCount = 0;
+    m_pastePreview->clearContents();
+    m_pastePreview->setRowCount(p_pastedRows.size());
+
+    for(int row = 0; row < p_pastedRows.size(); row++)
+    {
+        const BillPasteParser::PastedRow &pastedRow = p_pastedRows.at(row);
+        lineNumbers.append(QString::number(pastedRow.lineNumber));
+        validRowCount += pastedRow.isValid() ? 1 : 0;
+
+        // Show each field as pasted, highlighting those with an error or warning and describing it in the tooltip
+        for(int column = 0; column < BillPasteParser::PastedColumnCount; column++)
+        {
+            QTableWidgetItem *fieldItem = new QTableWidgetItem(pastedRow.fields.value(column));
+            QString fieldError = pastedRow.fieldErrors.value(column);
+            QString fieldWarning = pastedRow.fieldWarnings.value(column);
+
+            if(!fieldError.isEmpty())
+            {
+                fieldItem->setBackground(m_ERROR_FIELD_COLOR);
+                fieldItem->setToolTip(fieldError);
+            }
+            else if(!fieldWarning.isEmpty())
+            {
+                fieldItem->setBackground(m_WARNING_FIELD_COLOR);
+                fieldItem->setToolTip(fieldWarning);
+            }
+
+            m_pastePreview->setItem(row, column, fieldItem);
+        }
+    }
+
+    // Label each row with the line it was pasted on, so the line can be found and corrected
+    m_pastePreview->setVerticalHeaderLabels(lineNumbers);
+    m_pasteSummaryLabel->setText(m_PASTE_SUMMARY_TEXT.arg(validRowCount).arg(p_pastedRows.size() - validRowCount));
+    m_addPastedButton->setEnabled(validRowCount > 0);
+}
+
+void BillWidget::setPasteMode(bool p_isPasteMode)
+{
+    m_isPasteMode = p_isPasteMode;
+
+    // Show either the single bill fields or the paste mode fields
+    QWidget *singleBillWidgets[] = {m_nameLabel, m_nameInput, m_amountDueLabel, m_amountDueInput, m_dueDateLabel, m_dueDateInput, m_currencyLabel, m_currencyInput,
+                                    m_categoryLabel, m_categoryInput, m_tagsLabel, m_tagsInput, m_enterAnotherButton};
+    QWidget *pasteModeWidgets[] = {m_pasteInstructionsLabel, m_pasteInput, m_pasteSummaryLabel, m_pastePreview, m_addPastedButton};
+
+    for(QWidget *singleBillWidget : singleBillWidgets)
+    {
+        singleBillWidget->setVisible(!p_isPasteMode);
+    }
+
+    for(QWidget *pasteModeWidget : pasteModeWidgets)
+    {
+        pasteModeWidget->setVisible(p_isPasteMode);
+    }
+
+    // Keep the button in step when the mode is changed other than by clicking it
+    m_pasteModeButton->setChecked(p_isPasteMode);
+    adjustSize();
 }
 
 QPushButton* BillWidget::getCloseButton()
@@ -168,3 +331,45 @@ QDateEdit* BillWidget::getDueDateInput()
     // Return the bill due date date edit pointer
     return m_dueDateInput;
 }
+
+QComboBox* BillWidget::getCurrencyInput()
+{
+    // Return the bill currency combo box pointer
+    return m_currencyInput;
+}
+
+QLineEdit* BillWidget::getCategoryInput()
+{
+    // Return the bill category line edit pointer
+    return m_categoryInput;
+}
+
+QLineEdit* BillWidget::getTagsInput()
+{
+    // Return the bill tags line edit pointer
+    return m_tagsInput;
+}
+
+QPushButton* BillWidget::getPasteModeButton()
+{
+    // Return the paste mode button pointer
+    return m_pasteModeButton;
+}
+
+QPushButton* BillWidget::getAddPastedButton()
+{
+    // Return the Add Pasted Bills button pointer
+    return m_addPastedButton;
+}
+
+QPlainTextEdit* BillWidget::getPasteInput()
+{
+    // Return the paste plain text edit pointer
+    return m_pasteInput;
+}
+
+bool BillWidget::isPasteMode() const
+{
+    // Return whether or not bills are being pasted
+    return m_isPasteMode;
+}
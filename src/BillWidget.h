@@ -10,12 +10,20 @@
 #ifndef BILLWIDGET_H
 #define BILLWIDGET_H
 
+// Local file includes
+#include "BillPasteParser.h"
+
+// Qt includes
+#include <QColor>
+#include <QComboBox>
 #include <QDialog>
 #include <QLabel>
 #include <QLineEdit>
 #include <QDateEdit>
 #include <QGridLayout>
+#include <QPlainTextEdit>
 #include <QPushButton>
+#include <QTableWidget>
 
 /**
  * @brief Properly deletes a dynamically allocated label pointer, as long as it was created properly.
@@ -37,6 +45,7 @@ void deleteButtonIfNonNull(QPushButton *p_button);
 
 /**
  * @brief The BillWidget class represents a pop-up widget which allows the user to enter a bill that they wish to track.
+ * In paste mode it instead accepts many bills pasted at once, previewing every row with the fields which need correcting highlighted.
  */
 class BillWidget : public QWidget
 {
@@ -101,6 +110,62 @@ public:
      */
     QDateEdit* getDueDateInput();
 
+    /**
+     * @brief Returns the currency combo box pointer.
+     * @return The currency combo box pointer.
+     */
+    QComboBox* getCurrencyInput();
+
+    /**
+     * @brief Returns the category line edit pointer.
+     * @return The category line edit pointer.
+     */
+    QLineEdit* getCategoryInput();
+
+    /**
+     * @brief Returns the tags line edit pointer.
+     * @return The tags line edit pointer.
+     */
+    QLineEdit* getTagsInput();
+
+    /**
+     * @brief Returns the checkable push button pointer which switches between entering one bill and pasting many.
+     * @return The paste mode push button pointer.
+     */
+    QPushButton* getPasteModeButton();
+
+    /**
+     * @brief Returns the add pasted bills push button pointer.
+     * @return The add pasted bills push button pointer.
+     */
+    QPushButton* getAddPastedButton();
+
+    /**
+     * @brief Returns the plain text edit pointer bills are pasted into.
+     * @return The paste plain text edit pointer.
+     */
+    QPlainTextEdit* getPasteInput();
+
+    /**
+     * @brief Returns whether or not the BillWidget is in paste mode.
+     * @return True if bills are being pasted rather than entered one at a time.
+     */
+    bool isPasteMode() const;
+
+    /**
+     * @brief Shows the rows read from the pasted text, highlighting each field with an error or warning and describing it in the field's tooltip.
+     * @param p_pastedRows - The rows read from the pasted text.
+     */
+    void showPastedRows(const QVector<BillPasteParser::PastedRow> &p_pastedRows);
+
+public slots:
+
+    /**
+     * @brief Switches between entering one bill at a time and pasting many.
+     * @param p_isPasteMode - Whether or not to show the paste mode fields.
+     */
+    void setPasteMode(bool p_isPasteMode);
+
 private:
 
     // General UI variables
@@ -122,6 +187,32 @@ private:
     const QString m_DUE_DATE_LABEL_TEXT = "Due Date:"; //!< Text for the label for the date edit used for entering the due date of the bill.
     QDateEdit *m_dueDateInput = nullptr; //!< The date edit used for entering the due date of the bill.
 
+    // Currency input fields
+    QLabel *m_currencyLabel = nullptr; //!< Label for the combo box used for choosing the currency of the bill.
+    const QString m_CURRENCY_LABEL_TEXT = "Currency:"; //!< Text for the label for the combo box used for choosing the currency of the bill.
+    QComboBox *m_currencyInput = nullptr; //!< The editable combo box used for choosing the currency of the bill, listing the currencies which have exchange rates.
+
+    // Category and tags input fields
+    QLabel *m_categoryLabel = nullptr; //!< Label for the line edit used for entering the budget category of the bill.
+    const QString m_CATEGORY_LABEL_TEXT = "Category:"; //!< Text for the label for the line edit used for entering the budget category of the bill.
+    QLineEdit *m_categoryInput = nullptr; //!< The line edit used for entering the budget category of the bill, which is optional.
+    QLabel *m_tagsLabel = nullptr; //!< Label for the line edit used for entering the tags of the bill.
+    const QString m_TAGS_LABEL_TEXT = "Tags:"; //!< Text for the label for the line edit used for entering the tags of the bill.
+    const QString m_TAGS_PLACEHOLDER_TEXT = "Separated by commas"; //!< Placeholder text shown in the empty tags line edit.
+    QLineEdit *m_tagsInput = nullptr; //!< The line edit used for entering the tags of the bill, which are optional.
+
+    // Paste mode fields
+    QLabel *m_pasteInstructionsLabel = nullptr; //!< Label explaining what can be pasted.
+    const QString m_PASTE_INSTRUCTIONS_TEXT = "Paste rows copied from a spreadsheet, or comma separated lines, with columns in this order. Currency, category, and tags are optional."; //!< Text for the label explaining what can be pasted.
+    QPlainTextEdit *m_pasteInput = nullptr; //!< The plain text edit bills are pasted into.
+    const QString m_PASTE_PLACEHOLDER_TEXT = "Bill Name, Amount Due, Due Date, Currency, Category, Tags"; //!< Placeholder text shown in the empty paste plain text edit.
+    QLabel *m_pasteSummaryLabel = nullptr; //!< Label counting the pasted rows which can be added and those which need correcting.
+    const QString m_PASTE_SUMMARY_TEXT = "%1 bill(s) ready to add, %2 row(s) to correct"; //!< Text for the paste summary label, given the number of valid and invalid rows.
+    QTableWidget *m_pastePreview = nullptr; //!< Read only table previewing each pasted row, with fields needing attention highlighted.
+    const QColor m_ERROR_FIELD_COLOR = QColor(255, 205, 205); //!< Background of fields which stop their row from being added.
+    const QColor m_WARNING_FIELD_COLOR = QColor(255, 240, 190); //!< Background of fields which may be wrong without stopping their row from being added.
+    bool m_isPasteMode = false; //!< Whether or not bills are being pasted rather than entered one at a time.
+
     // Button and button text variables
     QPushButton *m_closeButton = nullptr; //!< Push button used for closing the BillWidget and subsequently exiting the application.
     const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
@@ -129,6 +220,10 @@ private:
     const QString m_ENTER_ANOTHER_BUTTON_TEXT = "Enter Another Bill"; //!< Text used for the Enter Another button.
     QPushButton *m_doneButton = nullptr; //!< Push button used for closing the BillWidget when finished entering bills.
     const QString m_DONE_BUTTON_TEXT = "Done"; //!< //!< Text used for the Done push button.
+    QPushButton *m_pasteModeButton = nullptr; //!< Checkable push button used for switching between entering one bill and pasting many.
+    const QString m_PASTE_MODE_BUTTON_TEXT = "Paste Many Bills"; //!< Text used for the paste mode push button.
+    QPushButton *m_addPastedButton = nullptr; //!< Push button used for adding every valid pasted bill at once.
+    const QString m_ADD_PASTED_BUTTON_TEXT = "Add Pasted Bills"; //!< Text used for the add pasted bills push button.
 };
 
 #endif // BILLWIDGET_H
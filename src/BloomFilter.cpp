@@ -0,0 +1,76 @@
+/*##################################################################################
+#   File name:          BloomFilter.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a BloomFilter
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "BloomFilter.h"
+
+#include <algorithm>
+
+void BloomFilter::reset(int p_capacity)
+{
+    // Round the bit count up to whole words
+    m_capacity = std::max(p_capacity, m_MIN_CAPACITY);
+    quint64 wordCount = (static_cast<quint64>(m_capacity) * m_BITS_PER_VALUE + 63) / 64;
+    m_words = QVector<quint64>(static_cast<int>(wordCount), 0);
+    m_bitCount = wordCount * 64;
+    m_insertedCount = 0;
+}
+
+void BloomFilter::insert(quint64 p_hash)
+{
+    if(m_words.isEmpty())
+    {
+        reset(m_MIN_CAPACITY);
+    }
+
+    for(int probe = 0; probe < m_PROBE_COUNT; probe++)
+    {
+        quint64 bit = bitIndex(p_hash, probe);
+        m_words[static_cast<int>(bit / 64)] |= Q_UINT64_C(1) << (bit % 64);
+    }
+
+    m_insertedCount++;
+}
+
+bool BloomFilter::mightContain(quint64 p_hash) const
+{
+    if(m_words.isEmpty())
+    {
+        return false;
+    }
+
+    // Stop at the first clear bit, which is usually the first one probed for values never inserted
+    for(int probe = 0; probe < m_PROBE_COUNT; probe++)
+    {
+        quint64 bit = bitIndex(p_hash, probe);
+
+        if((m_words.at(static_cast<int>(bit / 64)) & (Q_UINT64_C(1) << (bit % 64))) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool BloomFilter::isOverloaded() const
+{
+    return m_insertedCount > m_capacity;
+}
+
+int BloomFilter::capacity() const
+{
+    return m_capacity;
+}
+
+quint64 BloomFilter::bitIndex(quint64 p_hash, int p_probe) const
+{
+    // The upper half of the hash strides through the bits, made odd so every probe lands on a different bit
+    quint64 stride = (p_hash >> 32) | 1;
+    return (p_hash + static_cast<quint64>(p_probe) * stride) % m_bitCount;
+}
@@ -0,0 +1,77 @@
+/*##################################################################################
+#   File name:          BloomFilter.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a BloomFilter
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+// Qt includes
+#include <QVector>
+
+/**
+ * @brief The BloomFilter class is a compact bit array answering whether a 64-bit hash might have been inserted.
+ * A negative answer is certain, so callers can skip looking the value up in a larger hash table. A positive answer is wrong about one time in a hundred
+ * while no more values than the capacity have been inserted. Values cannot be removed, their bits only cost occasional false positives until the filter is reset.
+ */
+class BloomFilter
+{
+
+public:
+
+    /**
+     * @brief Empties the filter and sizes it for a number of values.
+     * @param p_capacity - The number of values the filter is sized for.
+     */
+    void reset(int p_capacity);
+
+    /**
+     * @brief Sets the bits of a hash.
+     * @param p_hash - A well mixed 64-bit hash of the value.
+     */
+    void insert(quint64 p_hash);
+
+    /**
+     * @brief Returns whether a hash might have been inserted.
+     * @param p_hash - A well mixed 64-bit hash of the value.
+     * @return False if the hash was certainly never inserted.
+     */
+    bool mightContain(quint64 p_hash) const;
+
+    /**
+     * @brief Returns whether more values have been inserted than the filter was sized for, so its false positive rate has risen.
+     * @return True if the filter should be reset with a larger capacity.
+     */
+    bool isOverloaded() const;
+
+    /**
+     * @brief Returns the number of values the filter was sized for.
+     * @return The capacity.
+     */
+    int capacity() const;
+
+private:
+
+    /**
+     * @brief Returns the index of one of a hash's bits, using double hashing so only one hash of the value is needed.
+     * @param p_hash - The hash.
+     * @param p_probe - Which of the hash's bits, from zero.
+     * @return The bit index.
+     */
+    quint64 bitIndex(quint64 p_hash, int p_probe) const;
+
+    static constexpr int m_BITS_PER_VALUE = 10; //!< Bits of the array per value of capacity, which with seven probes gives about a one percent false positive rate.
+    static constexpr int m_PROBE_COUNT = 7; //!< The number of bits set for each value.
+    static constexpr int m_MIN_CAPACITY = 1024; //!< The smallest capacity a filter is sized for.
+
+    QVector<quint64> m_words; //!< The bit array, sixty-four bits per word.
+    quint64 m_bitCount = 0; //!< The number of bits in the array.
+    int m_capacity = 0; //!< The number of values the filter was sized for.
+    int m_insertedCount = 0; //!< The number of values inserted since the filter was reset.
+};
+
+#endif // BLOOMFILTER_H
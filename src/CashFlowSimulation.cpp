@@ -0,0 +1,367 @@
+/*##################################################################################
+#   File name:          CashFlowSimulation.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a CashFlowSimulation
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "CashFlowSimulation.h"
+
+#include <QString>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const double TWO_PI = 6.283185307179586; //!< The angle of a full turn, used to turn uniform draws into normal ones.
+    const double UNIT_FROM_53_BITS = 1.0 / 9007199254740992.0; //!< 2^-53, which scales the top 53 bits of a draw into [0, 1).
+    const quint64 GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL; //!< The odd constant the splitmix64 generator steps by.
+    const QString SIMULATING_STATUS_TEXT = "Simulating cash flow..."; //!< Progress text reported while the paths are simulated.
+
+    /**
+     * @brief Scrambles a 64-bit value with the splitmix64 finalizer, so nearby seeds give unrelated results.
+     * @param p_value - The value.
+     * @return The scrambled value.
+     */
+    quint64 mixBits(quint64 p_value)
+    {
+        p_value = (p_value ^ (p_value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        p_value = (p_value ^ (p_value >> 27)) * 0x94D049BB133111EBULL;
+        return p_value ^ (p_value >> 31);
+    }
+
+    /**
+     * @brief The FastRandom struct is a xoshiro256** random number generator, which draws in a few instructions and is only ever used by one chunk, so it needs no locking.
+     */
+    struct FastRandom
+    {
+        quint64 state[4] = {}; //!< The generator's state, never all zero.
+        bool hasSpareNormal = false; //!< Whether or not the second normal draw of the last Box-Muller transform is still unused.
+        double spareNormal = 0.0; //!< The second normal draw of the last Box-Muller transform.
+
+        /**
+         * @brief Seeds the generator of one chunk by stepping a splitmix64 generator, seeded from the simulation's seed and the chunk's index, four times.
+         * @param p_seed - The simulation's seed.
+         * @param p_chunkIndex - The index of the chunk.
+         */
+        FastRandom(quint64 p_seed, int p_chunkIndex)
+        {
+            quint64 seedState = mixBits(p_seed ^ mixBits(static_cast<quint64>(p_chunkIndex) + 1));
+
+            for(quint64 &stateWord : state)
+            {
+                seedState += GOLDEN_GAMMA;
+                stateWord = mixBits(seedState);
+            }
+        }
+
+        /**
+         * @brief Draws 64 random bits.
+         * @return The bits.
+         */
+        quint64 next()
+        {
+            quint64 result = rotateLeft(state[1] * 5, 7) * 9;
+            quint64 shifted = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= shifted;
+            state[3] = rotateLeft(state[3], 45);
+            return result;
+        }
+
+        /**
+         * @brief Draws from the standard normal distribution with the Box-Muller transform, which gives two draws for every pair of uniform draws.
+         * @return The draw.
+         */
+        double nextNormal()
+        {
+            if(hasSpareNormal)
+            {
+                hasSpareNormal = false;
+                return spareNormal;
+            }
+
+            // The first uniform draw is taken from (0, 1] so its logarithm is finite
+            double firstUniform = 1.0 - (next() >> 11) * UNIT_FROM_53_BITS;
+            double secondUniform = (next() >> 11) * UNIT_FROM_53_BITS;
+            double radius = std::sqrt(-2.0 * std::log(firstUniform));
+            spareNormal = radius * std::sin(TWO_PI * secondUniform);
+            hasSpareNormal = true;
+            return radius * std::cos(TWO_PI * secondUniform);
+        }
+
+        /**
+         * @brief Rotates the bits of a value to the left.
+         * @param p_value - The value.
+         * @param p_bitCount - The number of bits rotated, from 1 to 63.
+         * @return The rotated value.
+         */
+        static quint64 rotateLeft(quint64 p_value, int p_bitCount)
+        {
+            return (p_value << p_bitCount) | (p_value >> (64 - p_bitCount));
+        }
+    };
+
+    /**
+     * @brief The CashEvent struct is one paycheck or bill payment, as a day of the horizon and the distribution its amount is drawn from.
+     */
+    struct CashEvent
+    {
+        int dayOffset = 0; //!< The number of days after the start date the event falls on.
+        double meanCents = 0.0; //!< The usual amount in cents.
+        double spreadCents = 0.0; //!< The standard deviation of the amount in cents, zero for fixed amounts.
+        bool isIncome = false; //!< Whether the amount is added to the balance rather than taken from it.
+    };
+
+    /**
+     * @brief The PathChunk struct holds a range of paths simulated by one worker, and how many of them had run short by each point.
+     */
+    struct PathChunk
+    {
+        int chunkIndex = 0; //!< The index of the chunk, which its random number generator is seeded from.
+        int firstPathIndex = 0; //!< The index of the first path in the chunk.
+        int lastPathIndex = 0; //!< One past the index of the last path in the chunk.
+        QVector<int> shortfallCountByPoint; //!< The number of the chunk's paths which had run short by each point.
+    };
+
+    /**
+     * @brief The PointSummary struct holds the index of a point summarized by one worker, and its summary.
+     */
+    struct PointSummary
+    {
+        int pointIndex = 0; //!< The index of the point.
+        CashFlowSimulation::RiskPoint riskPoint; //!< The spread of the balances at the point.
+    };
+}
+
+CashFlowSimulation::Result CashFlowSimulation::run(const Model &p_model, JobContext *p_jobContext)
+{
+    Result result;
+    result.pathCount = qBound(0, p_model.pathCount, m_MAX_PATH_COUNT);
+
+    if(!p_model.startDate.isValid() || result.pathCount == 0)
+    {
+        return result;
+    }
+
+    // Points fall once a week from the start date, with a last point on the final day of the horizon
+    QDate horizonEndDate = p_model.startDate.addMonths(qBound(1, p_model.horizonMonths, m_MAX_HORIZON_MONTHS));
+    int horizonDays = static_cast<int>(p_model.startDate.daysTo(horizonEndDate));
+    QVector<int> pointDays;
+
+    for(int pointDay = 0; pointDay < horizonDays; pointDay += m_REPORT_INTERVAL_DAYS)
+    {
+        pointDays.append(pointDay);
+    }
+
+    pointDays.append(horizonDays);
+    int pointCount = pointDays.size();
+
+    // Lay out every paycheck and bill payment of the horizon once, so each path only draws their amounts
+    QVector<CashEvent> cashEvents;
+
+    if(p_model.incomeMeanCents > 0 && p_model.incomeIntervalDays > 0 && p_model.firstIncomeDate.isValid())
+    {
+        qint64 incomeDayOffset = p_model.startDate.daysTo(p_model.firstIncomeDate);
+
+        // Paychecks before the start date were already paid, so move on to the first one on or after it
+        if(incomeDayOffset < 0)
+        {
+            incomeDayOffset += ((-incomeDayOffset + p_model.incomeIntervalDays - 1) / p_model.incomeIntervalDays) * p_model.incomeIntervalDays;
+        }
+
+        for(; incomeDayOffset <= horizonDays; incomeDayOffset += p_model.incomeIntervalDays)
+        {
+            CashEvent incomeEvent;
+            incomeEvent.dayOffset = static_cast<int>(incomeDayOffset);
+            incomeEvent.meanCents = p_model.incomeMeanCents;
+            incomeEvent.spreadCents = std::max<qint64>(0, p_model.incomeSpreadCents);
+            incomeEvent.isIncome = true;
+            cashEvents.append(incomeEvent);
+        }
+    }
+
+    for(const SimulatedBill &bill : p_model.bills)
+    {
+        if(bill.amountCents <= 0 || !bill.dueDate.isValid())
+        {
+            continue;
+        }
+
+        // Funded bills already had their first payment set aside, so only their repeats are paid
+        for(int monthOffset = bill.isFunded ? 1 : 0; monthOffset == 0 || bill.isRepeatedMonthly; monthOffset++)
+        {
+            qint64 billDayOffset = p_model.startDate.daysTo(bill.dueDate.addMonths(monthOffset));
+
+            if(billDayOffset > horizonDays)
+            {
+                break;
+            }
+
+            // An overdue payment is paid on the start date, later repeats which are still in the past were never asked for
+            if(billDayOffset < 0 && monthOffset > 0)
+            {
+                continue;
+            }
+
+            CashEvent billEvent;
+            billEvent.dayOffset = static_cast<int>(std::max<qint64>(0, billDayOffset));
+            billEvent.meanCents = bill.amountCents;
+            billEvent.spreadCents = bill.amountCents * std::max(0.0, bill.spreadFraction);
+            cashEvents.append(billEvent);
+        }
+    }
+
+    // Paychecks are counted before bills due on the same day
+    std::stable_sort(cashEvents.begin(), cashEvents.end(), [](const CashEvent &p_firstEvent, const CashEvent &p_secondEvent)
+    {
+        return p_firstEvent.dayOffset < p_secondEvent.dayOffset || (p_firstEvent.dayOffset == p_secondEvent.dayOffset && p_firstEvent.isIncome && !p_secondEvent.isIncome);
+    });
+
+    // Every path's balance at every point is kept, point by point, so each point's paths sit together when they are summarized
+    QVector<float> balanceCentsByPoint(pointCount * result.pathCount);
+    float *balanceData = balanceCentsByPoint.data();
+    QVector<int> shortfallCountByPoint(pointCount, 0);
+    int eventCount = cashEvents.size();
+
+    auto simulateChunk = [&](PathChunk &p_chunk)
+    {
+        FastRandom fastRandom(p_model.seed, p_chunk.chunkIndex);
+        p_chunk.shortfallCountByPoint = QVector<int>(pointCount, 0);
+
+        for(int pathIndex = p_chunk.firstPathIndex; pathIndex < p_chunk.lastPathIndex; pathIndex++)
+        {
+            double balanceCents = p_model.startingBalanceCents;
+            bool isShort = balanceCents < 0;
+            int eventIndex = 0;
+
+            for(int pointIndex = 0; pointIndex < pointCount; pointIndex++)
+            {
+                // Apply the paycheck and bills up to the point, noting if the balance fell below zero in between
+                for(; eventIndex < eventCount && cashEvents.at(eventIndex).dayOffset <= pointDays.at(pointIndex); eventIndex++)
+                {
+                    const CashEvent &cashEvent = cashEvents.at(eventIndex);
+                    double amountCents = cashEvent.spreadCents > 0.0 ? std::max(0.0, cashEvent.meanCents + cashEvent.spreadCents * fastRandom.nextNormal()) : cashEvent.meanCents;
+                    balanceCents += cashEvent.isIncome ? amountCents : -amountCents;
+                    isShort = isShort || balanceCents < 0.0;
+                }
+
+                balanceData[pointIndex * result.pathCount + pathIndex] = static_cast<float>(balanceCents);
+                p_chunk.shortfallCountByPoint[pointIndex] += isShort ? 1 : 0;
+            }
+        }
+    };
+
+    // Takes the percentiles of each point's balances over the paths completed so far, each point on a worker of its own
+    auto summarizePaths = [&]()
+    {
+        QVector<PointSummary> pointSummaries(pointCount);
+
+        for(int pointIndex = 0; pointIndex < pointCount; pointIndex++)
+        {
+            pointSummaries[pointIndex].pointIndex = pointIndex;
+        }
+
+        int completedPathCount = result.completedPathCount;
+
+        QtConcurrent::blockingMap(pointSummaries, [&](PointSummary &p_pointSummary)
+        {
+            RiskPoint &riskPoint = p_pointSummary.riskPoint;
+            riskPoint.date = p_model.startDate.addDays(pointDays.at(p_pointSummary.pointIndex));
+            riskPoint.shortfallProbability = static_cast<double>(shortfallCountByPoint.at(p_pointSummary.pointIndex)) / completedPathCount;
+
+            // Copy the point's balances, since selecting percentiles reorders them
+            const float *firstBalance = balanceData + p_pointSummary.pointIndex * result.pathCount;
+            QVector<float> balances(firstBalance, firstBalance + completedPathCount);
+            float *selectedFrom = balances.data();
+            float *balancesEnd = selectedFrom + completedPathCount;
+
+            // Each percentile is selected from the balances above the last one, since selection leaves them on its right
+            auto selectPercentile = [&](double p_fraction)
+            {
+                float *percentileBalance = balances.data() + std::lround(p_fraction * (completedPathCount - 1));
+                std::nth_element(selectedFrom, percentileBalance, balancesEnd);
+                selectedFrom = percentileBalance;
+                return static_cast<qint64>(std::llround(*percentileBalance));
+            };
+
+            riskPoint.fifthPercentileCents = selectPercentile(0.05);
+            riskPoint.twentyFifthPercentileCents = selectPercentile(0.25);
+            riskPoint.medianCents = selectPercentile(0.50);
+            riskPoint.seventyFifthPercentileCents = selectPercentile(0.75);
+            riskPoint.ninetyFifthPercentileCents = selectPercentile(0.95);
+        });
+
+        result.points.clear();
+        result.points.reserve(pointCount);
+
+        for(const PointSummary &pointSummary : qAsConst(pointSummaries))
+        {
+            result.points.append(pointSummary.riskPoint);
+        }
+    };
+
+    // Run the chunks a batch at a time, with at least one chunk per core in each batch
+    int chunkCount = (result.pathCount + m_PATHS_PER_CHUNK - 1) / m_PATHS_PER_CHUNK;
+    int chunksPerBatch = std::max(QThread::idealThreadCount(), (chunkCount + m_BATCH_COUNT - 1) / m_BATCH_COUNT);
+    int completedChunkCount = 0;
+
+    while(completedChunkCount < chunkCount)
+    {
+        QVector<PathChunk> chunks;
+
+        for(int chunkIndex = completedChunkCount; chunkIndex < std::min(completedChunkCount + chunksPerBatch, chunkCount); chunkIndex++)
+        {
+            PathChunk chunk;
+            chunk.chunkIndex = chunkIndex;
+            chunk.firstPathIndex = chunkIndex * m_PATHS_PER_CHUNK;
+            chunk.lastPathIndex = std::min(chunk.firstPathIndex + m_PATHS_PER_CHUNK, result.pathCount);
+            chunks.append(chunk);
+        }
+
+        // A single chunk is simulated on the calling thread, several are simulated concurrently
+        if(chunks.size() == 1)
+        {
+            simulateChunk(chunks.first());
+        }
+        else
+        {
+            QtConcurrent::blockingMap(chunks, simulateChunk);
+        }
+
+        for(const PathChunk &chunk : qAsConst(chunks))
+        {
+            for(int pointIndex = 0; pointIndex < pointCount; pointIndex++)
+            {
+                shortfallCountByPoint[pointIndex] += chunk.shortfallCountByPoint.at(pointIndex);
+            }
+        }
+
+        completedChunkCount += chunks.size();
+        result.completedPathCount = chunks.last().lastPathIndex;
+
+        // Stop between batches if the simulation was cancelled, keeping the paths completed so far
+        if(p_jobContext != nullptr && p_jobContext->isCancelled())
+        {
+            break;
+        }
+
+        // Send the results so far, the final results being returned instead
+        if(p_jobContext != nullptr && completedChunkCount < chunkCount)
+        {
+            summarizePaths();
+            p_jobContext->reportPartialResult(100 * completedChunkCount / chunkCount, QVariant::fromValue(result), SIMULATING_STATUS_TEXT);
+        }
+    }
+
+    summarizePaths();
+    return result;
+}
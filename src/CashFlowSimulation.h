@@ -0,0 +1,106 @@
+/*##################################################################################
+#   File name:          CashFlowSimulation.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a CashFlowSimulation
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CASHFLOWSIMULATION_H
+#define CASHFLOWSIMULATION_H
+
+// Local file includes
+#include "JobManager.h"
+
+// Qt includes
+#include <QDate>
+#include <QMetaType>
+#include <QVector>
+
+/**
+ * @brief The CashFlowSimulation class estimates the risk of running short of money over the coming months, when paychecks and some bills, such as utilities, vary from month to month.
+ * Tens of thousands of possible futures, or paths, are simulated by drawing each paycheck and variable bill from a normal distribution around its usual amount. The paths are split into fixed size chunks,
+ * each drawing from its own fast random number generator seeded from the chunk's index, so the chunks run on every core without sharing any state and a given seed always gives the same results.
+ * For each week of the horizon, the share of paths which ran short by then and bands of the balance across the paths are reported.
+ */
+class CashFlowSimulation
+{
+
+public:
+
+    /**
+     * @brief The SimulatedBill struct is one bill paid during the horizon.
+     */
+    struct SimulatedBill
+    {
+        qint64 amountCents = 0; //!< The usual amount of the bill in cents, in the currency of the starting balance.
+        QDate dueDate; //!< The date the bill is first paid on, bills due before the start date being paid on the start date.
+        double spreadFraction = 0.0; //!< How much the bill varies, as the standard deviation over its usual amount, zero for fixed bills.
+        bool isRepeatedMonthly = false; //!< Whether or not the bill is paid again on the same day of every following month.
+        bool isFunded = false; //!< Whether or not the bill's first payment was already set aside out of the starting balance, in which case only its repeats are paid.
+    };
+
+    /**
+     * @brief The Model struct describes the money coming in and going out over the horizon.
+     */
+    struct Model
+    {
+        qint64 startingBalanceCents = 0; //!< The balance on the start date, in cents.
+        QDate startDate; //!< The first day simulated.
+        int horizonMonths = 6; //!< The number of months simulated from the start date.
+        int pathCount = 20000; //!< The number of paths simulated.
+        quint64 seed = 0; //!< The seed every chunk's random number generator is derived from.
+        qint64 incomeMeanCents = 0; //!< The usual amount of a paycheck in cents, zero for no income.
+        qint64 incomeSpreadCents = 0; //!< How much a paycheck varies, as the standard deviation in cents.
+        int incomeIntervalDays = 14; //!< The number of days between paychecks.
+        QDate firstIncomeDate; //!< The date of the next paycheck.
+        QVector<SimulatedBill> bills; //!< The bills paid during the horizon.
+    };
+
+    /**
+     * @brief The RiskPoint struct is the spread of the paths' balances on one date.
+     */
+    struct RiskPoint
+    {
+        QDate date; //!< The date.
+        double shortfallProbability = 0.0; //!< The share of paths whose balance fell below zero on or before the date, from 0 to 1.
+        qint64 fifthPercentileCents = 0; //!< The balance which 5% of the paths fell below.
+        qint64 twentyFifthPercentileCents = 0; //!< The balance which 25% of the paths fell below.
+        qint64 medianCents = 0; //!< The balance which half of the paths fell below.
+        qint64 seventyFifthPercentileCents = 0; //!< The balance which 75% of the paths fell below.
+        qint64 ninetyFifthPercentileCents = 0; //!< The balance which 95% of the paths fell below.
+    };
+
+    /**
+     * @brief The Result struct is the outcome of a simulation, or of the paths simulated so far.
+     */
+    struct Result
+    {
+        QVector<RiskPoint> points; //!< One point per week of the horizon, starting from the start date and ending on the last day of the horizon.
+        int completedPathCount = 0; //!< The number of paths the points were taken from.
+        int pathCount = 0; //!< The number of paths asked for.
+    };
+
+    /**
+     * @brief Simulates the paths of a model, a batch of chunks at a time on every core, reporting the results of the paths completed so far after each batch.
+     * @param p_model - The model. The horizon and path count are clamped to their limits.
+     * @param p_jobContext - The job running the simulation, which is sent the results so far and checked for cancellation between batches, or null when simulating outside a job.
+     * @return The results of every path, or of the paths completed before the job was cancelled.
+     */
+    static Result run(const Model &p_model, JobContext *p_jobContext = nullptr);
+
+    static constexpr int m_MAX_HORIZON_MONTHS = 24; //!< The longest horizon simulated, in months.
+    static constexpr int m_MAX_PATH_COUNT = 100000; //!< The most paths simulated, bounding the memory the balances take.
+
+private:
+
+    static constexpr int m_PATHS_PER_CHUNK = 1024; //!< The number of paths simulated by one chunk, each chunk drawing from its own random number generator.
+    static constexpr int m_REPORT_INTERVAL_DAYS = 7; //!< The number of days between points.
+    static constexpr int m_BATCH_COUNT = 20; //!< The number of batches the chunks are run in, so the results so far are reported every 5% of the paths.
+
+};
+
+Q_DECLARE_METATYPE(CashFlowSimulation::Result)
+
+#endif // CASHFLOWSIMULATION_H
@@ -0,0 +1,317 @@
+/*##################################################################################
+#   File name:          CashFlowSimulationWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a CashFlowSimulationWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "CashFlowSimulationWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+#include <cmath>
+#include <iterator>
+
+CashFlowSimulationWidget::CashFlowSimulationWidget()
+{
+    // Set the title and size of the CashFlowSimulationWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(850, 650);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When the Run or Cancel button is clicked, ask for a simulation to be started or stopped
+    connect(m_runButton, SIGNAL(clicked()), this, SIGNAL(runRequested()), Qt::AutoConnection);
+    connect(m_cancelButton, SIGNAL(clicked()), this, SIGNAL(cancelRequested()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the CashFlowSimulationWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+CashFlowSimulationWidget::~CashFlowSimulationWidget()
+{
+    // Properly delete dynamically allocated labels, line edits, and buttons
+    deleteLabelIfNonNull(m_incomeLabel);
+    deleteLabelIfNonNull(m_incomeSpreadLabel);
+    deleteLabelIfNonNull(m_incomeIntervalLabel);
+    deleteLabelIfNonNull(m_firstIncomeLabel);
+    deleteLabelIfNonNull(m_variableCategoriesLabel);
+    deleteLabelIfNonNull(m_billSpreadLabel);
+    deleteLabelIfNonNull(m_horizonLabel);
+    deleteLabelIfNonNull(m_pathCountLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteLineEditIfNonNull(m_variableCategoriesInput);
+    deleteButtonIfNonNull(m_runButton);
+    deleteButtonIfNonNull(m_cancelButton);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the income spin box was created successfully
+    if(m_incomeInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_incomeInput;
+        m_incomeInput = nullptr;
+    }
+
+    // If the income variation spin box was created successfully
+    if(m_incomeSpreadInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_incomeSpreadInput;
+        m_incomeSpreadInput = nullptr;
+    }
+
+    // If the income interval spin box was created successfully
+    if(m_incomeIntervalInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_incomeIntervalInput;
+        m_incomeIntervalInput = nullptr;
+    }
+
+    // If the next paycheck date edit was created successfully
+    if(m_firstIncomeInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_firstIncomeInput;
+        m_firstIncomeInput = nullptr;
+    }
+
+    // If the bill variation spin box was created successfully
+    if(m_billSpreadInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_billSpreadInput;
+        m_billSpreadInput = nullptr;
+    }
+
+    // If the repeat monthly check box was created successfully
+    if(m_repeatMonthlyInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_repeatMonthlyInput;
+        m_repeatMonthlyInput = nullptr;
+    }
+
+    // If the horizon spin box was created successfully
+    if(m_horizonInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_horizonInput;
+        m_horizonInput = nullptr;
+    }
+
+    // If the path count spin box was created successfully
+    if(m_pathCountInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_pathCountInput;
+        m_pathCountInput = nullptr;
+    }
+
+    // If the risk table widget was created successfully
+    if(m_riskTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_riskTableWidget;
+        m_riskTableWidget = nullptr;
+    }
+}
+
+CashFlowSimulation::Model CashFlowSimulationWidget::getModel() const
+{
+    CashFlowSimulation::Model model;
+    model.horizonMonths = m_horizonInput->value();
+    model.pathCount = m_pathCountInput->value();
+    model.incomeMeanCents = std::llround(m_incomeInput->value() * 100.0);
+    model.incomeSpreadCents = std::llround(m_incomeSpreadInput->value() * 100.0);
+    model.incomeIntervalDays = m_incomeIntervalInput->value();
+    model.firstIncomeDate = m_firstIncomeInput->date();
+    return model;
+}
+
+QStringList CashFlowSimulationWidget::getVariableCategories() const
+{
+    QStringList variableCategories;
+
+    // Ignore the spaces around each category and any empty ones left by stray commas
+    for(const QString &category : m_variableCategoriesInput->text().split(m_CATEGORY_SEPARATOR))
+    {
+        if(!category.trimmed().isEmpty())
+        {
+            variableCategories.append(category.trimmed());
+        }
+    }
+
+    return variableCategories;
+}
+
+double CashFlowSimulationWidget::getBillSpreadFraction() const
+{
+    return m_billSpreadInput->value() / 100.0;
+}
+
+bool CashFlowSimulationWidget::isRepeatMonthlyChecked() const
+{
+    return m_repeatMonthlyInput->isChecked();
+}
+
+void CashFlowSimulationWidget::setRunning(bool p_isRunning)
+{
+    m_runButton->setEnabled(!p_isRunning);
+    m_cancelButton->setEnabled(p_isRunning);
+}
+
+void CashFlowSimulationWidget::setResult(const CashFlowSimulation::Result &p_result, const QString &p_currencyCode)
+{
+    m_riskTableWidget->setRowCount(p_result.points.size());
+
+    // List each week's chance of a shortfall and balance bands, shading the balances below zero
+    for(int row = 0; row < p_result.points.size(); row++)
+    {
+        const CashFlowSimulation::RiskPoint &riskPoint = p_result.points.at(row);
+        const qint64 bandCents[] = {riskPoint.fifthPercentileCents, riskPoint.twentyFifthPercentileCents, riskPoint.medianCents, riskPoint.seventyFifthPercentileCents,
+                                    riskPoint.ninetyFifthPercentileCents};
+
+        m_riskTableWidget->setItem(row, 0, new QTableWidgetItem(riskPoint.date.toString(m_DATE_FORMAT)));
+        m_riskTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(riskPoint.shortfallProbability * 100.0, 'f', 1) + "%"));
+
+        for(int bandIndex = 0; bandIndex < static_cast<int>(std::size(bandCents)); bandIndex++)
+        {
+            QTableWidgetItem *bandItem = new QTableWidgetItem(formatCents(bandCents[bandIndex]));
+
+            if(bandCents[bandIndex] < 0)
+            {
+                bandItem->setBackground(m_SHORTFALL_COLOR);
+            }
+
+            m_riskTableWidget->setItem(row, bandIndex + 2, bandItem);
+        }
+    }
+
+    // Summarize the chance of running short by the end of the horizon
+    if(!p_result.points.isEmpty())
+    {
+        const CashFlowSimulation::RiskPoint &lastPoint = p_result.points.last();
+        m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(QString::number(lastPoint.shortfallProbability * 100.0, 'f', 1)).arg(lastPoint.date.toString(m_DATE_FORMAT))
+                                .arg(p_result.completedPathCount).arg(p_result.pathCount).arg(p_currencyCode));
+    }
+}
+
+void CashFlowSimulationWidget::setMessage(const QString &p_message)
+{
+    m_summaryLabel->setText(p_message);
+}
+
+void CashFlowSimulationWidget::initializeWidget()
+{
+    // Create the income labels and inputs, the next paycheck defaulting to two weeks from today
+    m_incomeLabel = new QLabel(this);
+    m_incomeLabel->setText(m_INCOME_LABEL_TEXT);
+    m_incomeInput = new QDoubleSpinBox(this);
+    m_incomeInput->setRange(0.00, m_MAX_AMOUNT);
+
+    m_incomeSpreadLabel = new QLabel(this);
+    m_incomeSpreadLabel->setText(m_INCOME_SPREAD_LABEL_TEXT);
+    m_incomeSpreadInput = new QDoubleSpinBox(this);
+    m_incomeSpreadInput->setRange(0.00, m_MAX_AMOUNT);
+
+    m_incomeIntervalLabel = new QLabel(this);
+    m_incomeIntervalLabel->setText(m_INCOME_INTERVAL_LABEL_TEXT);
+    m_incomeIntervalInput = new QSpinBox(this);
+    m_incomeIntervalInput->setRange(1, m_MAX_INCOME_INTERVAL_DAYS);
+    m_incomeIntervalInput->setValue(m_DEFAULT_INCOME_INTERVAL_DAYS);
+
+    m_firstIncomeLabel = new QLabel(this);
+    m_firstIncomeLabel->setText(m_FIRST_INCOME_LABEL_TEXT);
+    m_firstIncomeInput = new QDateEdit(this);
+    m_firstIncomeInput->setCalendarPopup(true);
+    m_firstIncomeInput->setDisplayFormat(m_DATE_FORMAT);
+    m_firstIncomeInput->setDate(QDate::currentDate().addDays(m_DEFAULT_INCOME_INTERVAL_DAYS));
+
+    // Create the bill labels and inputs
+    m_variableCategoriesLabel = new QLabel(this);
+    m_variableCategoriesLabel->setText(m_VARIABLE_CATEGORIES_LABEL_TEXT);
+    m_variableCategoriesInput = new QLineEdit(this);
+    m_variableCategoriesInput->setText(m_DEFAULT_VARIABLE_CATEGORIES);
+
+    m_billSpreadLabel = new QLabel(this);
+    m_billSpreadLabel->setText(m_BILL_SPREAD_LABEL_TEXT);
+    m_billSpreadInput = new QDoubleSpinBox(this);
+    m_billSpreadInput->setRange(0.0, 100.0);
+    m_billSpreadInput->setValue(m_DEFAULT_BILL_SPREAD_PERCENT);
+
+    m_repeatMonthlyInput = new QCheckBox(this);
+    m_repeatMonthlyInput->setText(m_REPEAT_MONTHLY_TEXT);
+    m_repeatMonthlyInput->setChecked(true);
+
+    // Create the simulation labels and inputs
+    m_horizonLabel = new QLabel(this);
+    m_horizonLabel->setText(m_HORIZON_LABEL_TEXT);
+    m_horizonInput = new QSpinBox(this);
+    m_horizonInput->setRange(1, CashFlowSimulation::m_MAX_HORIZON_MONTHS);
+    m_horizonInput->setValue(m_DEFAULT_HORIZON_MONTHS);
+
+    m_pathCountLabel = new QLabel(this);
+    m_pathCountLabel->setText(m_PATH_COUNT_LABEL_TEXT);
+    m_pathCountInput = new QSpinBox(this);
+    m_pathCountInput->setRange(m_MIN_PATH_COUNT, CashFlowSimulation::m_MAX_PATH_COUNT);
+    m_pathCountInput->setSingleStep(m_PATH_COUNT_STEP_SIZE);
+    m_pathCountInput->setValue(m_DEFAULT_PATH_COUNT);
+
+    // Create the summary label and the read-only risk table
+    m_summaryLabel = new QLabel(this);
+    m_summaryLabel->setText(m_NOT_RUN_TEXT);
+    m_summaryLabel->setWordWrap(true);
+
+    m_riskTableWidget = new QTableWidget(this);
+    m_riskTableWidget->setColumnCount(m_RISK_TABLE_HEADER_STRING.split(";").size());
+    m_riskTableWidget->setHorizontalHeaderLabels(m_RISK_TABLE_HEADER_STRING.split(";"));
+    m_riskTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_riskTableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_riskTableWidget->verticalHeader()->hide();
+
+    // Create the Run, Cancel, and Close buttons, only one of Run and Cancel being enabled at a time
+    m_runButton = new QPushButton(this);
+    m_runButton->setText(m_RUN_BUTTON_TEXT);
+    m_cancelButton = new QPushButton(this);
+    m_cancelButton->setText(m_CANCEL_BUTTON_TEXT);
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+    setRunning(false);
+
+    // Add the widgets into a grid layout, the inputs above the results
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_incomeLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_incomeInput, 0, 1);
+    m_gridLayout->addWidget(m_incomeSpreadLabel, 0, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_incomeSpreadInput, 0, 3);
+    m_gridLayout->addWidget(m_incomeIntervalLabel, 1, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_incomeIntervalInput, 1, 1);
+    m_gridLayout->addWidget(m_firstIncomeLabel, 1, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_firstIncomeInput, 1, 3);
+    m_gridLayout->addWidget(m_variableCategoriesLabel, 2, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_variableCategoriesInput, 2, 1);
+    m_gridLayout->addWidget(m_billSpreadLabel, 2, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_billSpreadInput, 2, 3);
+    m_gridLayout->addWidget(m_horizonLabel, 3, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_horizonInput, 3, 1);
+    m_gridLayout->addWidget(m_pathCountLabel, 3, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_pathCountInput, 3, 3);
+    m_gridLayout->addWidget(m_repeatMonthlyInput, 4, 0, 1, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_runButton, 4, 2);
+    m_gridLayout->addWidget(m_cancelButton, 4, 3);
+    m_gridLayout->addWidget(m_summaryLabel, 5, 0, 1, 4);
+    m_gridLayout->addWidget(m_riskTableWidget, 6, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 7, 3);
+    m_gridLayout->setRowStretch(6, 1);
+}
+
+QString CashFlowSimulationWidget::formatCents(qint64 p_cents)
+{
+    return QString::number(p_cents / 100.0, 'f', 2);
+}
@@ -0,0 +1,182 @@
+/*##################################################################################
+#   File name:          CashFlowSimulationWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a CashFlowSimulationWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CASHFLOWSIMULATIONWIDGET_H
+#define CASHFLOWSIMULATIONWIDGET_H
+
+// Local file includes
+#include "CashFlowSimulation.h"
+
+// Qt includes
+#include <QCheckBox>
+#include <QColor>
+#include <QDateEdit>
+#include <QDoubleSpinBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QStringList>
+#include <QTableWidget>
+
+/**
+ * @brief The CashFlowSimulationWidget class represents a pop-up window for simulating how likely the amount available is to run short over the coming months, when paychecks and some bills vary.
+ * The user describes their paychecks and which bill categories vary, and the MainWindow runs the simulation in the background, listing the chance of a shortfall and bands of the balance week by week as the paths complete.
+ */
+class CashFlowSimulationWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget for simulating cash flow.
+     */
+    CashFlowSimulationWidget();
+
+    /**
+     * @brief Destructs the CashFlowSimulationWidget by deleting objects which were dynamically allocated.
+     */
+    ~CashFlowSimulationWidget();
+
+    /**
+     * @brief Returns the paychecks, horizon, and number of paths entered, leaving the starting balance and bills to be filled in.
+     * @return The model.
+     */
+    CashFlowSimulation::Model getModel() const;
+
+    /**
+     * @brief Returns the categories whose bills vary from month to month.
+     * @return The categories entered, separated by commas.
+     */
+    QStringList getVariableCategories() const;
+
+    /**
+     * @brief Returns how much the bills of the variable categories vary.
+     * @return The standard deviation over the usual amount, as a fraction.
+     */
+    double getBillSpreadFraction() const;
+
+    /**
+     * @brief Returns whether or not the bills should be paid again every month of the horizon.
+     * @return True if the bills repeat monthly.
+     */
+    bool isRepeatMonthlyChecked() const;
+
+    /**
+     * @brief Enables the Cancel button while a simulation runs, and the Run button otherwise.
+     * @param p_isRunning - Whether or not a simulation is running.
+     */
+    void setRunning(bool p_isRunning);
+
+    /**
+     * @brief Lists the chance of a shortfall and the balance bands by date, from the paths simulated so far.
+     * @param p_result - The results.
+     * @param p_currencyCode - The currency of the balances.
+     */
+    void setResult(const CashFlowSimulation::Result &p_result, const QString &p_currencyCode);
+
+    /**
+     * @brief Shows a message in place of the summary, such as the simulation being cancelled, leaving the results so far listed.
+     * @param p_message - The message.
+     */
+    void setMessage(const QString &p_message);
+
+signals:
+
+    /**
+     * @brief Emitted when the Run button is clicked, so a simulation of the bills can be started.
+     */
+    void runRequested();
+
+    /**
+     * @brief Emitted when the Cancel button is clicked, so the running simulation can be stopped.
+     */
+    void cancelRequested();
+
+private:
+
+    /**
+     * @brief Creates the labels, inputs, table, and buttons of the CashFlowSimulationWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Formats an amount in cents with two decimal places.
+     * @param p_cents - The amount in cents.
+     * @return The amount in dollars.
+     */
+    static QString formatCents(qint64 p_cents);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Cash Flow Simulation"; //!< Title of the CashFlowSimulationWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the CashFlowSimulationWidget.
+    const QString m_DATE_FORMAT = "M/d/yyyy"; //!< The format dates are shown in, the same as the bill table's.
+    const double m_MAX_AMOUNT = 99999999.99; //!< The largest paycheck or variation which can be entered.
+
+    // Income fields
+    QLabel *m_incomeLabel = nullptr; //!< Label for the spin box used for entering the usual paycheck.
+    const QString m_INCOME_LABEL_TEXT = "Income Per Paycheck:"; //!< Text for the label for the usual paycheck.
+    QDoubleSpinBox *m_incomeInput = nullptr; //!< The spin box used for entering the usual paycheck.
+    QLabel *m_incomeSpreadLabel = nullptr; //!< Label for the spin box used for entering how much a paycheck varies.
+    const QString m_INCOME_SPREAD_LABEL_TEXT = "Income Varies By:"; //!< Text for the label for how much a paycheck varies.
+    QDoubleSpinBox *m_incomeSpreadInput = nullptr; //!< The spin box used for entering how much a paycheck varies, as a standard deviation.
+    QLabel *m_incomeIntervalLabel = nullptr; //!< Label for the spin box used for entering the days between paychecks.
+    const QString m_INCOME_INTERVAL_LABEL_TEXT = "Paid Every (days):"; //!< Text for the label for the days between paychecks.
+    QSpinBox *m_incomeIntervalInput = nullptr; //!< The spin box used for entering the days between paychecks.
+    const int m_DEFAULT_INCOME_INTERVAL_DAYS = 14; //!< The days between paychecks filled in, every other week.
+    const int m_MAX_INCOME_INTERVAL_DAYS = 92; //!< The most days between paychecks which can be entered, about a quarter.
+    QLabel *m_firstIncomeLabel = nullptr; //!< Label for the date edit used for choosing the date of the next paycheck.
+    const QString m_FIRST_INCOME_LABEL_TEXT = "Next Paycheck:"; //!< Text for the label for the date of the next paycheck.
+    QDateEdit *m_firstIncomeInput = nullptr; //!< The date edit used for choosing the date of the next paycheck.
+
+    // Bill fields
+    QLabel *m_variableCategoriesLabel = nullptr; //!< Label for the line edit used for entering the categories whose bills vary.
+    const QString m_VARIABLE_CATEGORIES_LABEL_TEXT = "Variable Categories:"; //!< Text for the label for the categories whose bills vary.
+    QLineEdit *m_variableCategoriesInput = nullptr; //!< The line edit used for entering the categories whose bills vary, separated by commas.
+    const QString m_DEFAULT_VARIABLE_CATEGORIES = "Utilities"; //!< The categories filled in whose bills vary.
+    const QString m_CATEGORY_SEPARATOR = ","; //!< Separates the categories entered.
+    QLabel *m_billSpreadLabel = nullptr; //!< Label for the spin box used for entering how much the variable bills vary.
+    const QString m_BILL_SPREAD_LABEL_TEXT = "Bills Vary By (%):"; //!< Text for the label for how much the variable bills vary.
+    QDoubleSpinBox *m_billSpreadInput = nullptr; //!< The spin box used for entering how much the variable bills vary, as a percentage of their amount due.
+    const double m_DEFAULT_BILL_SPREAD_PERCENT = 15.0; //!< How much the variable bills vary by default.
+    QCheckBox *m_repeatMonthlyInput = nullptr; //!< Check box used for choosing whether the bills are paid again every month of the horizon.
+    const QString m_REPEAT_MONTHLY_TEXT = "Bills repeat monthly"; //!< Text of the repeat monthly check box.
+
+    // Simulation fields
+    QLabel *m_horizonLabel = nullptr; //!< Label for the spin box used for entering the number of months simulated.
+    const QString m_HORIZON_LABEL_TEXT = "Months Ahead:"; //!< Text for the label for the number of months simulated.
+    QSpinBox *m_horizonInput = nullptr; //!< The spin box used for entering the number of months simulated.
+    const int m_DEFAULT_HORIZON_MONTHS = 6; //!< The number of months simulated by default.
+    QLabel *m_pathCountLabel = nullptr; //!< Label for the spin box used for entering the number of paths simulated.
+    const QString m_PATH_COUNT_LABEL_TEXT = "Paths:"; //!< Text for the label for the number of paths simulated.
+    QSpinBox *m_pathCountInput = nullptr; //!< The spin box used for entering the number of paths simulated.
+    const int m_MIN_PATH_COUNT = 1000; //!< The fewest paths which can be simulated, below which the bands are too rough to be useful.
+    const int m_DEFAULT_PATH_COUNT = 20000; //!< The number of paths simulated by default.
+    const int m_PATH_COUNT_STEP_SIZE = 1000; //!< The amount the number of paths changes by per step.
+
+    // Result fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the results so far.
+    const QString m_NOT_RUN_TEXT = "Describe your paychecks and run a simulation to see how likely you are to run short."; //!< Text of the summary label before a simulation is run.
+    const QString m_SUMMARY_LABEL_TEXT = "%1% chance of running short by %2, from %3 of %4 paths (%5)"; //!< Text of the summary label, given the chance, the last date, the paths completed and asked for, and the currency code.
+    QTableWidget *m_riskTableWidget = nullptr; //!< Table listing the chance of a shortfall and the balance bands by date.
+    const QString m_RISK_TABLE_HEADER_STRING = "Date;Shortfall Chance;5th Percentile;25th Percentile;Median;75th Percentile;95th Percentile"; //!< The risk table column titles, separated by semicolons.
+    const QColor m_SHORTFALL_COLOR = QColor(255, 205, 205); //!< Background of balances below zero, the same as the BillWidget's error fields.
+
+    // Button and button text variables
+    QPushButton *m_runButton = nullptr; //!< Push button used for starting a simulation.
+    const QString m_RUN_BUTTON_TEXT = "Run"; //!< Text used for the Run push button.
+    QPushButton *m_cancelButton = nullptr; //!< Push button used for stopping the running simulation.
+    const QString m_CANCEL_BUTTON_TEXT = "Cancel"; //!< Text used for the Cancel push button.
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the CashFlowSimulationWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // CASHFLOWSIMULATIONWIDGET_H
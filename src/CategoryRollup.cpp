@@ -0,0 +1,121 @@
+/*##################################################################################
+#   File name:          CategoryRollup.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a CategoryRollup
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "CategoryRollup.h"
+
+QStringList CategoryRollup::splitTags(const QString &p_tagsText)
+{
+    QStringList tags;
+
+    // Keep each non-empty tag once, in the order given
+    foreach(QString tag, p_tagsText.split(QLatin1Char(',')))
+    {
+        tag = tag.trimmed();
+
+        if(!tag.isEmpty() && !tags.contains(tag))
+        {
+            tags.append(tag);
+        }
+    }
+
+    return tags;
+}
+
+QString CategoryRollup::joinTags(const QStringList &p_tags)
+{
+    return p_tags.join(", ");
+}
+
+void CategoryRollup::setBill(const QString &p_billKey, const QString &p_category, const QStringList &p_tags, qint64 p_amountDueCents, bool p_isFunded)
+{
+    QHash<QString, BillContribution>::iterator contributionIterator = m_contributionByBillKey.find(p_billKey);
+
+    // Take the bill's previous contribution back out, if it made one
+    if(contributionIterator != m_contributionByBillKey.end())
+    {
+        applyContribution(contributionIterator.value(), -1);
+    }
+    else
+    {
+        contributionIterator = m_contributionByBillKey.insert(p_billKey, BillContribution());
+    }
+
+    // Remember and add the new contribution
+    BillContribution &contribution = contributionIterator.value();
+    contribution.category = p_category;
+    contribution.tags = p_tags;
+    contribution.amountDueCents = p_amountDueCents;
+    contribution.isFunded = p_isFunded;
+    applyContribution(contribution, 1);
+}
+
+void CategoryRollup::removeBill(const QString &p_billKey)
+{
+    QHash<QString, BillContribution>::iterator contributionIterator = m_contributionByBillKey.find(p_billKey);
+
+    if(contributionIterator == m_contributionByBillKey.end())
+    {
+        return;
+    }
+
+    applyContribution(contributionIterator.value(), -1);
+    m_contributionByBillKey.erase(contributionIterator);
+}
+
+bool CategoryRollup::containsBill(const QString &p_billKey) const
+{
+    return m_contributionByBillKey.contains(p_billKey);
+}
+
+QList<QString> CategoryRollup::billKeys() const
+{
+    return m_contributionByBillKey.keys();
+}
+
+const QHash<QString, CategoryRollup::RollupTotals>& CategoryRollup::categoryTotals() const
+{
+    return m_categoryTotals;
+}
+
+const QHash<QString, CategoryRollup::RollupTotals>& CategoryRollup::tagTotals() const
+{
+    return m_tagTotals;
+}
+
+void CategoryRollup::clear()
+{
+    m_contributionByBillKey.clear();
+    m_categoryTotals.clear();
+    m_tagTotals.clear();
+}
+
+void CategoryRollup::applyContribution(const BillContribution &p_contribution, int p_sign)
+{
+    // A bill always counts towards exactly one category, and towards each of its tags
+    applyToTotals(m_categoryTotals, p_contribution.category, p_contribution, p_sign);
+
+    for(const QString &tag : p_contribution.tags)
+    {
+        applyToTotals(m_tagTotals, tag, p_contribution, p_sign);
+    }
+}
+
+void CategoryRollup::applyToTotals(QHash<QString, RollupTotals> &p_totalsByName, const QString &p_name, const BillContribution &p_contribution, int p_sign)
+{
+    RollupTotals &totals = p_totalsByName[p_name];
+    totals.dueCents += p_sign * p_contribution.amountDueCents;
+    totals.fundedCents += p_contribution.isFunded ? p_sign * p_contribution.amountDueCents : 0;
+    totals.billCount += p_sign;
+
+    // Drop categories and tags which no longer have any bills, so they disappear from the summary
+    if(totals.billCount <= 0)
+    {
+        p_totalsByName.remove(p_name);
+    }
+}
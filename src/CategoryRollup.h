@@ -0,0 +1,137 @@
+/*##################################################################################
+#   File name:          CategoryRollup.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a CategoryRollup
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CATEGORYROLLUP_H
+#define CATEGORYROLLUP_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The CategoryRollup class keeps running totals of the amount due, funded, and outstanding for each budget category and tag.
+ * It remembers what each bill last contributed, so adding, editing, funding, or deleting a bill only subtracts its old contribution and adds its new one, rather than re-totalling every bill.
+ */
+class CategoryRollup
+{
+
+public:
+
+    /**
+     * @brief The RollupTotals struct holds the totals of one category or tag, in cents.
+     */
+    struct RollupTotals
+    {
+        qint64 dueCents = 0; //!< The total amount due of the bills.
+        qint64 fundedCents = 0; //!< The total amount due of the bills which have been funded.
+        int billCount = 0; //!< The number of bills.
+
+        /**
+         * @brief Returns the amount due which has not been funded yet.
+         * @return The outstanding amount in cents.
+         */
+        qint64 outstandingCents() const { return dueCents - fundedCents; }
+    };
+
+    /**
+     * @brief Splits the tags of a bill as entered or stored, separated by commas, into a list with surrounding spaces, empty tags, and repeated tags removed.
+     * @param p_tagsText - The tags separated by commas.
+     * @return The tags in the order they were given.
+     */
+    static QStringList splitTags(const QString &p_tagsText);
+
+    /**
+     * @brief Joins tags into the form they are displayed and stored in.
+     * @param p_tags - The tags.
+     * @return The tags separated by a comma and a space.
+     */
+    static QString joinTags(const QStringList &p_tags);
+
+    /**
+     * @brief Adds a bill to the totals, or updates it if it was already added, by replacing only its own contribution.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_category - The bill's category, empty if it has none.
+     * @param p_tags - The bill's tags.
+     * @param p_amountDueCents - The bill's amount due in cents, already in the currency the totals are kept in.
+     * @param p_isFunded - Whether or not the bill has been funded.
+     */
+    void setBill(const QString &p_billKey, const QString &p_category, const QStringList &p_tags, qint64 p_amountDueCents, bool p_isFunded);
+
+    /**
+     * @brief Removes a bill's contribution from the totals. Bills which were never added are ignored.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBill(const QString &p_billKey);
+
+    /**
+     * @brief Checks whether a bill has been added.
+     * @param p_billKey - The bill map key of the bill.
+     * @return True if the bill contributes to the totals.
+     */
+    bool containsBill(const QString &p_billKey) const;
+
+    /**
+     * @brief Returns the keys of every bill contributing to the totals.
+     * @return The bill map keys.
+     */
+    QList<QString> billKeys() const;
+
+    /**
+     * @brief Returns the totals of each category. Bills without a category are totalled under an empty category.
+     * @return The totals keyed by category.
+     */
+    const QHash<QString, RollupTotals>& categoryTotals() const;
+
+    /**
+     * @brief Returns the totals of each tag. A bill with several tags counts towards each of them.
+     * @return The totals keyed by tag.
+     */
+    const QHash<QString, RollupTotals>& tagTotals() const;
+
+    /**
+     * @brief Removes every bill and total.
+     */
+    void clear();
+
+private:
+
+    /**
+     * @brief The BillContribution struct holds what a bill last added to the totals, so it can be taken back out without knowing its previous values.
+     */
+    struct BillContribution
+    {
+        QString category; //!< The category the bill was totalled under.
+        QStringList tags; //!< The tags the bill was totalled under.
+        qint64 amountDueCents = 0; //!< The amount due which was added.
+        bool isFunded = false; //!< Whether the amount due was added as funded.
+    };
+
+    /**
+     * @brief Adds or subtracts a bill's contribution to the totals of its category and tags.
+     * @param p_contribution - The bill's contribution.
+     * @param p_sign - 1 to add the contribution, -1 to subtract it.
+     */
+    void applyContribution(const BillContribution &p_contribution, int p_sign);
+
+    /**
+     * @brief Adds or subtracts an amount from one set of totals, removing the totals once no bill contributes to them.
+     * @param p_totalsByName - The totals keyed by category or tag.
+     * @param p_name - The category or tag.
+     * @param p_contribution - The bill's contribution.
+     * @param p_sign - 1 to add the contribution, -1 to subtract it.
+     */
+    static void applyToTotals(QHash<QString, RollupTotals> &p_totalsByName, const QString &p_name, const BillContribution &p_contribution, int p_sign);
+
+    QHash<QString, BillContribution> m_contributionByBillKey; //!< What each bill last contributed, keyed by bill map key.
+    QHash<QString, RollupTotals> m_categoryTotals; //!< The running totals of each category.
+    QHash<QString, RollupTotals> m_tagTotals; //!< The running totals of each tag.
+
+};
+
+#endif // CATEGORYROLLUP_H
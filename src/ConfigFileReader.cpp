@@ -0,0 +1,655 @@
+/*##################################################################################
+#   File name:          ConfigFileReader.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a ConfigFileReader
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ConfigFileReader.h"
+
+#include <QLatin1String>
+#include <QString>
+
+#include <cstring>
+
+namespace
+{
+    const QLatin1String GENERAL_GROUP_LABEL("General"); //!< The section QSettings writes keys outside any group into.
+
+    /**
+     * @brief Returns whether a byte is a space or tab, the whitespace QSettings trims around keys and values.
+     * @param p_byte - The byte.
+     * @return True if the byte is a space or tab.
+     */
+    bool isBlank(char p_byte)
+    {
+        return p_byte == ' ' || p_byte == '\t';
+    }
+
+    /**
+     * @brief Returns the value of a digit in base 8 or 16.
+     * @param p_byte - The byte holding the digit.
+     * @param p_base - The base, 8 or 16.
+     * @return The value of the digit, or -1 if the byte is not a digit of the base.
+     */
+    int digitValue(char p_byte, int p_base)
+    {
+        int value = -1;
+
+        if(p_byte >= '0' && p_byte <= '9')
+        {
+            value = p_byte - '0';
+        }
+        else if(p_byte >= 'a' && p_byte <= 'f')
+        {
+            value = p_byte - 'a' + 10;
+        }
+        else if(p_byte >= 'A' && p_byte <= 'F')
+        {
+            value = p_byte - 'A' + 10;
+        }
+
+        return value < p_base ? value : -1;
+    }
+
+    /**
+     * @brief Returns the character a single character backslash escape stands for.
+     * @param p_escapedByte - The byte after the backslash.
+     * @return The character, or zero if the escape is not a single character one.
+     */
+    char unescapeCharacter(char p_escapedByte)
+    {
+        switch(p_escapedByte)
+        {
+            case 'a' :
+            {
+                return '\a';
+            }
+            case 'b' :
+            {
+                return '\b';
+            }
+            case 'f' :
+            {
+                return '\f';
+            }
+            case 'n' :
+            {
+                return '\n';
+            }
+            case 'r' :
+            {
+                return '\r';
+            }
+            case 't' :
+            {
+                return '\t';
+            }
+            case 'v' :
+            {
+                return '\v';
+            }
+            case '"' :
+            case '?' :
+            case '\'' :
+            case '\\' :
+            {
+                return p_escapedByte;
+            }
+            default :
+            {
+                return 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the spaces and tabs at the end of a decoded string, stopping at a limit so escaped whitespace is kept.
+     * @param p_characters - The decoded string.
+     * @param p_length - The length of the decoded string, shortened past the removed whitespace.
+     * @param p_chopLimit - The length the string is never shortened below.
+     */
+    void chopTrailingBlanks(const QChar *p_characters, int &p_length, int p_chopLimit)
+    {
+        while(p_length > p_chopLimit && (p_characters[p_length - 1] == QLatin1Char(' ') || p_characters[p_length - 1] == QLatin1Char('\t')))
+        {
+            p_length--;
+        }
+    }
+}
+
+ConfigFileReader::ConfigFileReader(const QByteArray &p_fileContents, LoadArena &p_arena)
+    : ConfigFileReader(p_fileContents, 0, static_cast<int>(p_fileContents.size()), p_arena)
+{
+}
+
+ConfigFileReader::ConfigFileReader(const QByteArray &p_fileContents, int p_firstByteIndex, int p_endByteIndex, LoadArena &p_arena)
+    : m_fileContents(p_fileContents), m_fileData(m_fileContents.constData()), m_firstByteIndex(p_firstByteIndex), m_endByteIndex(p_endByteIndex), m_position(p_firstByteIndex), m_arena(p_arena)
+{
+}
+
+QVector<int> ConfigFileReader::findChunkBoundaries(const QByteArray &p_fileContents, int p_chunkCount)
+{
+    const char *fileData = p_fileContents.constData();
+    int fileSize = static_cast<int>(p_fileContents.size());
+    QVector<int> chunkBoundaries = {0};
+
+    for(int chunkIndex = 1; chunkIndex < p_chunkCount; chunkIndex++)
+    {
+        // Start looking for a section header at the next even split of the file, or past the previous chunk's header if that is further along
+        int searchIndex = qMax(static_cast<int>(static_cast<qint64>(fileSize) * chunkIndex / p_chunkCount), chunkBoundaries.last() + 1);
+        int headerIndex = -1;
+
+        while(headerIndex < 0 && searchIndex < fileSize)
+        {
+            const char *lineBreak = static_cast<const char*>(memchr(fileData + searchIndex, '\n', fileSize - searchIndex));
+
+            if(lineBreak == nullptr)
+            {
+                break;
+            }
+
+            int lineBreakIndex = static_cast<int>(lineBreak - fileData);
+            searchIndex = lineBreakIndex + 1;
+
+            // A line break escaped by an odd number of backslashes continues a value, so the next line is not the start of one. A backslash in a comment is treated the same, which only passes up a place to split
+            int backslashIndex = lineBreakIndex > 0 && fileData[lineBreakIndex - 1] == '\r' ? lineBreakIndex - 2 : lineBreakIndex - 1;
+            int backslashCount = 0;
+
+            while(backslashIndex >= 0 && fileData[backslashIndex] == '\\')
+            {
+                backslashCount++;
+                backslashIndex--;
+            }
+
+            if(backslashCount % 2 == 1)
+            {
+                continue;
+            }
+
+            // Split before the line if it is a section header
+            int lineStart = searchIndex;
+
+            while(lineStart < fileSize && isBlank(fileData[lineStart]))
+            {
+                lineStart++;
+            }
+
+            if(lineStart < fileSize && fileData[lineStart] == '[')
+            {
+                headerIndex = lineStart;
+            }
+        }
+
+        // Without another section header, the rest of the file is one chunk
+        if(headerIndex < 0)
+        {
+            break;
+        }
+
+        chunkBoundaries.append(headerIndex);
+    }
+
+    chunkBoundaries.append(fileSize);
+    return chunkBoundaries;
+}
+
+bool ConfigFileReader::readEntry(Entry &p_entry)
+{
+    int lineBegin = 0;
+    int lineStart = 0;
+    int lineEnd = 0;
+    int equalsIndex = -1;
+    LineType lineType = nextLine(lineBegin, lineStart, lineEnd, equalsIndex);
+
+    // Section headers only change the group label of the entries after them
+    while(lineType == HeaderLine)
+    {
+        lineType = nextLine(lineBegin, lineStart, lineEnd, equalsIndex);
+    }
+
+    if(lineType == EndOfContents)
+    {
+        return false;
+    }
+
+    int keyEnd = equalsIndex;
+
+    while(keyEnd > lineStart && isBlank(m_fileData[keyEnd - 1]))
+    {
+        keyEnd--;
+    }
+
+    p_entry.groupLabel = m_groupLabel;
+    p_entry.key = decodeKey(lineStart, keyEnd);
+    p_entry.value = decodeValue(equalsIndex + 1, lineEnd);
+    return true;
+}
+
+bool ConfigFileReader::readSectionHeader(SectionHeader &p_sectionHeader)
+{
+    int lineBegin = 0;
+    int lineStart = 0;
+    int lineEnd = 0;
+    int equalsIndex = -1;
+    LineType lineType = nextLine(lineBegin, lineStart, lineEnd, equalsIndex);
+
+    // Entries are skipped without decoding them
+    while(lineType == EntryLine)
+    {
+        lineType = nextLine(lineBegin, lineStart, lineEnd, equalsIndex);
+    }
+
+    if(lineType == EndOfContents)
+    {
+        return false;
+    }
+
+    // The section starts after the line break ending its header, a "\r\n" counting as one
+    int bodyStart = m_position;
+
+    if(bodyStart < m_endByteIndex && m_fileData[bodyStart] == '\r')
+    {
+        bodyStart++;
+    }
+
+    if(bodyStart < m_endByteIndex && m_fileData[bodyStart] == '\n')
+    {
+        bodyStart++;
+    }
+
+    p_sectionHeader.groupLabel = m_groupLabel;
+    p_sectionHeader.headerStart = lineBegin;
+    p_sectionHeader.bodyStart = bodyStart;
+    return true;
+}
+
+bool ConfigFileReader::hasFormatError() const
+{
+    return m_hasFormatError;
+}
+
+int ConfigFileReader::getPercentRead() const
+{
+    int chunkSize = m_endByteIndex - m_firstByteIndex;
+    return chunkSize <= 0 ? 100 : static_cast<int>(100LL * (m_position - m_firstByteIndex) / chunkSize);
+}
+
+ConfigFileReader::LineType ConfigFileReader::nextLine(int &p_lineBegin, int &p_lineStart, int &p_lineEnd, int &p_equalsIndex)
+{
+    p_lineBegin = m_position;
+
+    while(m_position < m_endByteIndex)
+    {
+        char firstByte = m_fileData[m_position];
+
+        // Skip blank lines, the next line beginning after each line break
+        if(firstByte == '\r' || firstByte == '\n')
+        {
+            m_position++;
+            p_lineBegin = m_position;
+            continue;
+        }
+
+        // Skip whitespace to reach the first character of the line
+        if(isBlank(firstByte))
+        {
+            m_position++;
+            continue;
+        }
+
+        // Skip "#" comments to the end of the line, quotes in them included
+        if(firstByte == '#')
+        {
+            while(m_position < m_endByteIndex && m_fileData[m_position] != '\n' && m_fileData[m_position] != '\r')
+            {
+                m_position++;
+            }
+
+            continue;
+        }
+
+        p_lineStart = m_position;
+        scanLine(p_lineStart, p_lineEnd, p_equalsIndex);
+
+        // Skip ";" comments, which scanLine() ends at their first character
+        if(firstByte == ';')
+        {
+            continue;
+        }
+
+        // A line starting with "[" begins a new section
+        if(firstByte == '[')
+        {
+            decodeGroupLabel(p_lineStart, p_lineEnd);
+            return HeaderLine;
+        }
+
+        // Any other line must be a "key=value" pair
+        if(p_equalsIndex < 0)
+        {
+            m_hasFormatError = true;
+            continue;
+        }
+
+        return EntryLine;
+    }
+
+    return EndOfContents;
+}
+
+void ConfigFileReader::decodeGroupLabel(int p_lineStart, int p_lineEnd)
+{
+    // A header without a closing bracket is malformed, and QSettings reads the rest of the line as the label
+    const char *closingBracket = static_cast<const char*>(memchr(m_fileData + p_lineStart, ']', p_lineEnd - p_lineStart));
+    int labelStart = p_lineStart + 1;
+    int labelEnd = closingBracket != nullptr ? static_cast<int>(closingBracket - m_fileData) : p_lineEnd;
+
+    if(closingBracket == nullptr)
+    {
+        m_hasFormatError = true;
+    }
+
+    while(labelStart < labelEnd && isBlank(m_fileData[labelStart]))
+    {
+        labelStart++;
+    }
+
+    while(labelEnd > labelStart && isBlank(m_fileData[labelEnd - 1]))
+    {
+        labelEnd--;
+    }
+
+    QLatin1String encodedLabel(m_fileData + labelStart, labelEnd - labelStart);
+
+    // Keys in the General section, in any case, belong to no group. QSettings writes a group really named General as "[%General]", which is read back without the "%" rather than decoded
+    if(encodedLabel.compare(GENERAL_GROUP_LABEL, Qt::CaseInsensitive) == 0)
+    {
+        m_groupLabel = QStringView();
+    }
+    else if(encodedLabel.size() == GENERAL_GROUP_LABEL.size() + 1 && encodedLabel.startsWith(QLatin1Char('%')) && encodedLabel.sliced(1).compare(GENERAL_GROUP_LABEL, Qt::CaseInsensitive) == 0)
+    {
+        m_groupLabel = decodeKey(labelStart + 1, labelEnd);
+    }
+    else
+    {
+        m_groupLabel = decodeKey(labelStart, labelEnd);
+    }
+}
+
+void ConfigFileReader::scanLine(int p_lineStart, int &p_lineEnd, int &p_equalsIndex)
+{
+    int index = p_lineStart;
+    bool isInQuotes = false;
+    p_lineEnd = -1;
+    p_equalsIndex = -1;
+
+    while(index < m_endByteIndex)
+    {
+        char character = m_fileData[index];
+
+        // A line break ends the line unless it is inside quotes, which QSettings lets run over several lines
+        if((character == '\n' || character == '\r') && !isInQuotes)
+        {
+            break;
+        }
+
+        // A backslash escapes the next character, including a line break which continues the value on the next line, "\r\n" and "\n\r" counting as one
+        if(character == '\\')
+        {
+            index++;
+
+            if(index + 1 < m_endByteIndex && ((m_fileData[index] == '\r' && m_fileData[index + 1] == '\n') || (m_fileData[index] == '\n' && m_fileData[index + 1] == '\r')))
+            {
+                index++;
+            }
+
+            index++;
+            continue;
+        }
+
+        if(character == '"')
+        {
+            isInQuotes = !isInQuotes;
+        }
+        else if(!isInQuotes && character == '=' && p_equalsIndex < 0)
+        {
+            p_equalsIndex = index;
+        }
+
+        // An unquoted semicolon starts a comment which runs to the end of the line
+        else if(!isInQuotes && character == ';')
+        {
+            p_lineEnd = index;
+
+            while(index < m_endByteIndex && m_fileData[index] != '\n' && m_fileData[index] != '\r')
+            {
+                index++;
+            }
+
+            break;
+        }
+
+        index++;
+    }
+
+    if(p_lineEnd < 0)
+    {
+        p_lineEnd = qMin(index, m_endByteIndex);
+    }
+
+    m_position = qMin(index, m_endByteIndex);
+}
+
+QStringView ConfigFileReader::decodeKey(int p_start, int p_end)
+{
+    // A decoded key is never longer than its encoding
+    QChar *characters = m_arena.allocateCharacters(p_end - p_start);
+    int length = 0;
+    int index = p_start;
+
+    while(index < p_end)
+    {
+        char character = m_fileData[index];
+
+        // QSettings writes slashes in keys as backslashes
+        if(character == '\\')
+        {
+            characters[length++] = QLatin1Char('/');
+            index++;
+            continue;
+        }
+
+        // QSettings writes characters outside Latin-1 as "%UXXXX" and other special characters as "%XX"
+        if(character == '%' && index + 1 < p_end)
+        {
+            int firstDigitIndex = m_fileData[index + 1] == 'U' ? index + 2 : index + 1;
+            int digitCount = m_fileData[index + 1] == 'U' ? 4 : 2;
+            ushort codeUnit = 0;
+            bool isHexValid = firstDigitIndex + digitCount <= p_end;
+
+            for(int digitIndex = firstDigitIndex; isHexValid && digitIndex < firstDigitIndex + digitCount; digitIndex++)
+            {
+                int digit = digitValue(m_fileData[digitIndex], 16);
+                isHexValid = digit >= 0;
+                codeUnit = static_cast<ushort>(codeUnit * 16 + digit);
+            }
+
+            if(isHexValid)
+            {
+                characters[length++] = QChar(codeUnit);
+                index = firstDigitIndex + digitCount;
+                continue;
+            }
+        }
+
+        // Copy the run of bytes up to the next escape as it is
+        int runEnd = index + 1;
+
+        while(runEnd < p_end && m_fileData[runEnd] != '\\' && m_fileData[runEnd] != '%')
+        {
+            runEnd++;
+        }
+
+        appendText(index, runEnd, characters, length);
+        index = runEnd;
+    }
+
+    m_arena.shrinkLastAllocation(characters, static_cast<size_t>(length) * sizeof(QChar));
+    return QStringView(characters, length);
+}
+
+QStringView ConfigFileReader::decodeValue(int p_start, int p_end)
+{
+    // A decoded value is never longer than twice its encoding, which allows for each unquoted comma becoming ", "
+    QChar *characters = m_arena.allocateCharacters(2 * (p_end - p_start));
+    int length = 0;
+    int chopLimit = 0;
+    bool isInQuotes = false;
+    bool isItemQuoted = false;
+    int index = p_start;
+
+    while(index < p_end && isBlank(m_fileData[index]))
+    {
+        index++;
+    }
+
+    while(index < p_end)
+    {
+        char character = m_fileData[index];
+
+        if(character == '\\')
+        {
+            index++;
+
+            if(index >= p_end)
+            {
+                break;
+            }
+
+            char escapedByte = m_fileData[index++];
+            char unescapedCharacter = unescapeCharacter(escapedByte);
+
+            if(unescapedCharacter != 0)
+            {
+                characters[length++] = QLatin1Char(unescapedCharacter);
+            }
+
+            // Hexadecimal escapes run until the first byte which is not a hex digit, and octal escapes until the first which is not an octal digit
+            else if(escapedByte == 'x' || digitValue(escapedByte, 8) >= 0)
+            {
+                int base = escapedByte == 'x' ? 16 : 8;
+                ushort codeUnit = escapedByte == 'x' ? 0 : static_cast<ushort>(escapedByte - '0');
+                bool hasDigits = escapedByte != 'x';
+
+                while(index < p_end && digitValue(m_fileData[index], base) >= 0)
+                {
+                    codeUnit = static_cast<ushort>(codeUnit * base + digitValue(m_fileData[index], base));
+                    hasDigits = true;
+                    index++;
+                }
+
+                if(hasDigits)
+                {
+                    characters[length++] = QChar(codeUnit);
+                }
+            }
+
+            // An escaped line break continues the value on the next line, any other escaped byte is dropped as QSettings does
+            else if((escapedByte == '\r' || escapedByte == '\n') && index < p_end && (m_fileData[index] == '\r' || m_fileData[index] == '\n') && m_fileData[index] != escapedByte)
+            {
+                index++;
+            }
+
+            // Escaped whitespace is never trimmed
+            chopLimit = length;
+        }
+        else if(character == '"')
+        {
+            index++;
+            isItemQuoted = true;
+            isInQuotes = !isInQuotes;
+
+            // Whitespace after a closing quote is skipped
+            if(!isInQuotes)
+            {
+                while(index < p_end && isBlank(m_fileData[index]))
+                {
+                    index++;
+                }
+
+                chopLimit = length;
+            }
+        }
+
+        // QSettings reads unquoted commas as separating the items of a list, which are joined back together
+        else if(character == ',' && !isInQuotes)
+        {
+            if(!isItemQuoted)
+            {
+                chopTrailingBlanks(characters, length, chopLimit);
+            }
+
+            characters[length++] = QLatin1Char(',');
+            characters[length++] = QLatin1Char(' ');
+            chopLimit = length;
+            isItemQuoted = false;
+            index++;
+
+            while(index < p_end && isBlank(m_fileData[index]))
+            {
+                index++;
+            }
+        }
+        else
+        {
+            // Copy the run of bytes up to the next escape, quote, or comma as it is
+            int runEnd = index + 1;
+
+            while(runEnd < p_end && m_fileData[runEnd] != '\\' && m_fileData[runEnd] != '"' && m_fileData[runEnd] != ',')
+            {
+                runEnd++;
+            }
+
+            appendText(index, runEnd, characters, length);
+            index = runEnd;
+        }
+    }
+
+    if(!isItemQuoted)
+    {
+        chopTrailingBlanks(characters, length, chopLimit);
+    }
+
+    m_arena.shrinkLastAllocation(characters, static_cast<size_t>(length) * sizeof(QChar));
+
+    // QSettings doubles a leading "@" so values are not mistaken for its type prefixes
+    if(length >= 2 && characters[0] == QLatin1Char('@') && characters[1] == QLatin1Char('@'))
+    {
+        return QStringView(characters + 1, length - 1);
+    }
+
+    return QStringView(characters, length);
+}
+
+void ConfigFileReader::appendText(int p_start, int p_end, QChar *p_characters, int &p_length) const
+{
+    for(int index = p_start; index < p_end; index++)
+    {
+        uchar byte = static_cast<uchar>(m_fileData[index]);
+
+        if(byte < 0x80)
+        {
+            p_characters[p_length++] = QLatin1Char(static_cast<char>(byte));
+            continue;
+        }
+
+        // Decode the rest of the run as UTF-8, which never takes more characters than bytes. Non-ASCII text is rare enough that a temporary string is acceptable
+        QString decodedText = QString::fromUtf8(m_fileData + index, p_end - index);
+        std::memcpy(p_characters + p_length, decodedText.constData(), static_cast<size_t>(decodedText.size()) * sizeof(QChar));
+        p_length += static_cast<int>(decodedText.size());
+        return;
+    }
+}
@@ -0,0 +1,177 @@
+/*##################################################################################
+#   File name:          ConfigFileReader.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a ConfigFileReader
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CONFIGFILEREADER_H
+#define CONFIGFILEREADER_H
+
+// Local file includes
+#include "LoadArena.h"
+
+// Qt includes
+#include <QByteArray>
+#include <QStringView>
+#include <QVector>
+
+/**
+ * @brief The ConfigFileReader class reads the "key=value" entries of an INI file written by QSettings, one at a time, without creating a QString per key or value.
+ * Group labels, keys, and values are decoded into a LoadArena and handed out as views, so reading a whole file makes no per-entry heap allocations unless a value holds non-ASCII text.
+ * Values are unquoted and unescaped as QSettings does, and values QSettings would read as a list, such as hand-edited tags with unquoted commas, are joined back together with ", ".
+ * It is the only INI parser the PFT has, so loading the file, re-reading the sections an external edit changed, and merging on save all read a file alike.
+ * The one deliberate difference from QSettings is that lines starting with "#" are read as comments.
+ */
+class ConfigFileReader
+{
+
+public:
+
+    /**
+     * @brief The Entry struct is one "key=value" line of the file, every view of which stays valid until the arena is released.
+     */
+    struct Entry
+    {
+        QStringView groupLabel; //!< The decoded label of the section the entry is in, empty for entries outside any section or in the General section.
+        QStringView key; //!< The decoded key.
+        QStringView value; //!< The decoded value.
+    };
+
+    /**
+     * @brief The SectionHeader struct is one "[Group]" header line of the file and where the section it begins starts.
+     */
+    struct SectionHeader
+    {
+        QStringView groupLabel; //!< The decoded label of the section, empty for the General section.
+        int headerStart = 0; //!< The offset of the first byte of the header line, including any whitespace before the "[".
+        int bodyStart = 0; //!< The offset of the first byte after the header line.
+    };
+
+    /**
+     * @brief Prepares to read a file's contents from the start.
+     * @param p_fileContents - The contents of the file, which must outlive the reader.
+     * @param p_arena - The arena the decoded text is stored in.
+     */
+    ConfigFileReader(const QByteArray &p_fileContents, LoadArena &p_arena);
+
+    /**
+     * @brief Prepares to read one chunk of a file's contents, such as one returned by findChunkBoundaries().
+     * @param p_fileContents - The contents of the file, which must outlive the reader.
+     * @param p_firstByteIndex - The offset of the first byte of the chunk, which should be the start of a line.
+     * @param p_endByteIndex - The offset one past the last byte of the chunk.
+     * @param p_arena - The arena the decoded text is stored in.
+     */
+    ConfigFileReader(const QByteArray &p_fileContents, int p_firstByteIndex, int p_endByteIndex, LoadArena &p_arena);
+
+    /**
+     * @brief Splits a file's contents into chunks of roughly equal size which can be read independently, each starting at a section header.
+     * Chunks never split a section, so entries keep the group label they would have had had the whole file been read at once. Fewer chunks are returned when there are not enough sections to split at.
+     * Only a hand-edited quoted value running over several lines, one of which starts with "[", can be split wrongly, since whether a line is inside quotes is not known without reading from the start.
+     * @param p_fileContents - The contents of the file.
+     * @param p_chunkCount - The number of chunks wanted.
+     * @return The offset of the first byte of each chunk followed by the size of the file, so chunk i runs from element i up to element i + 1.
+     */
+    static QVector<int> findChunkBoundaries(const QByteArray &p_fileContents, int p_chunkCount);
+
+    /**
+     * @brief Reads the next entry, skipping section headers, blank lines, and comments.
+     * @param p_entry - Receives the entry.
+     * @return False once the end of the file is reached.
+     */
+    bool readEntry(Entry &p_entry);
+
+    /**
+     * @brief Reads the next section header, skipping entries without decoding them, along with blank lines and comments.
+     * @param p_sectionHeader - Receives the section header.
+     * @return False once the end of the file is reached.
+     */
+    bool readSectionHeader(SectionHeader &p_sectionHeader);
+
+    /**
+     * @brief Returns whether any line read so far was neither a section header, an entry, nor a comment, which QSettings reports as a format error.
+     * @return True if the file is malformed.
+     */
+    bool hasFormatError() const;
+
+    /**
+     * @brief Returns how far through the file, or its chunk, the reader is.
+     * @return The percentage of the bytes read.
+     */
+    int getPercentRead() const;
+
+private:
+
+    /**
+     * @brief The LineType enum lists the kinds of line nextLine() stops at.
+     */
+    enum LineType
+    {
+        EntryLine,
+        HeaderLine,
+        EndOfContents
+    };
+
+    /**
+     * @brief Moves to the next section header or "key=value" line, skipping blank lines and comments and flagging malformed lines. A header's group label is decoded as it is reached.
+     * @param p_lineBegin - Receives the offset of the first byte of the line, including any whitespace before its first character.
+     * @param p_lineStart - Receives the offset of the first character of the line.
+     * @param p_lineEnd - Receives the offset one past the last character of the line, before any comment.
+     * @param p_equalsIndex - Receives the offset of the first "=" in the line, or -1 if there is none.
+     * @return The kind of line reached.
+     */
+    LineType nextLine(int &p_lineBegin, int &p_lineStart, int &p_lineEnd, int &p_equalsIndex);
+
+    /**
+     * @brief Decodes the group label of a section header line, which the entries after it belong to.
+     * @param p_lineStart - The offset of the "[" starting the line.
+     * @param p_lineEnd - The offset one past the last character of the line, before any comment.
+     */
+    void decodeGroupLabel(int p_lineStart, int p_lineEnd);
+
+    /**
+     * @brief Finds the end of the line starting at the current position, skipping quoted text, which may run over line breaks, and escaped line breaks, and moves past it.
+     * @param p_lineStart - The offset of the first character of the line.
+     * @param p_lineEnd - Receives the offset one past the last character of the line, before any comment.
+     * @param p_equalsIndex - Receives the offset of the first "=" in the line, or -1 if there is none.
+     */
+    void scanLine(int p_lineStart, int &p_lineEnd, int &p_equalsIndex);
+
+    /**
+     * @brief Decodes a group label or key, replacing QSettings' "%XX" and "%UXXXX" escapes and turning backslashes back into slashes.
+     * @param p_start - The offset of the first byte of the encoded key.
+     * @param p_end - The offset one past the last byte of the encoded key.
+     * @return A view of the decoded key in the arena.
+     */
+    QStringView decodeKey(int p_start, int p_end);
+
+    /**
+     * @brief Decodes a value, removing quotes, replacing backslash escapes, trimming unquoted whitespace, and joining list items with ", ".
+     * @param p_start - The offset of the first byte after the "=".
+     * @param p_end - The offset one past the last byte of the value.
+     * @return A view of the decoded value in the arena.
+     */
+    QStringView decodeValue(int p_start, int p_end);
+
+    /**
+     * @brief Appends a run of bytes without escapes to a decoded string, widening ASCII directly and decoding anything else as UTF-8.
+     * @param p_start - The offset of the first byte.
+     * @param p_end - The offset one past the last byte.
+     * @param p_characters - The decoded string being built.
+     * @param p_length - The length of the decoded string, advanced past the appended characters.
+     */
+    void appendText(int p_start, int p_end, QChar *p_characters, int &p_length) const;
+
+    const QByteArray m_fileContents; //!< The contents of the file, sharing the caller's data.
+    const char *m_fileData = nullptr; //!< The first byte of the file.
+    int m_firstByteIndex = 0; //!< The offset of the first byte to read.
+    int m_endByteIndex = 0; //!< The offset one past the last byte to read.
+    int m_position = 0; //!< The offset of the next line to read.
+    LoadArena &m_arena; //!< The arena decoded text is stored in.
+    QStringView m_groupLabel; //!< The decoded label of the section being read.
+    bool m_hasFormatError = false; //!< Whether or not a malformed line has been read.
+};
+
+#endif // CONFIGFILEREADER_H
@@ -0,0 +1,129 @@
+/*##################################################################################
+#   File name:          ConfigSectionIndex.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a ConfigSectionIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ConfigSectionIndex.h"
+#include "ConfigFileReader.h"
+#include "LoadArena.h"
+
+void ConfigSectionIndex::reset(const QByteArray &p_fileContents)
+{
+    // Forget the previous baseline
+    m_sectionFingerprints.clear();
+
+    // Fingerprint every section of the new baseline
+    for(const SectionSpan &sectionSpan : splitSections(p_fileContents))
+    {
+        m_sectionFingerprints.insert(sectionSpan.groupLabel, fingerprintSection(p_fileContents, sectionSpan));
+    }
+}
+
+QVector<ConfigSectionIndex::SectionChange> ConfigSectionIndex::update(const QByteArray &p_fileContents)
+{
+    QVector<SectionChange> sectionChanges;
+    QVector<SectionSpan> sectionSpans = splitSections(p_fileContents);
+    QHash<QString, SectionFingerprint> updatedFingerprints;
+    updatedFingerprints.reserve(sectionSpans.size());
+
+    // Compare each section against the baseline, parsing only those which are new or whose bytes differ
+    for(const SectionSpan &sectionSpan : sectionSpans)
+    {
+        SectionFingerprint sectionFingerprint = fingerprintSection(p_fileContents, sectionSpan);
+        updatedFingerprints.insert(sectionSpan.groupLabel, sectionFingerprint);
+
+        QHash<QString, SectionFingerprint>::const_iterator baselineIterator = m_sectionFingerprints.constFind(sectionSpan.groupLabel);
+
+        if(baselineIterator == m_sectionFingerprints.constEnd() || !(baselineIterator.value() == sectionFingerprint))
+        {
+            SectionChange sectionChange;
+            sectionChange.groupLabel = sectionSpan.groupLabel;
+            sectionChange.type = baselineIterator == m_sectionFingerprints.constEnd() ? SectionAdded : SectionModified;
+            sectionChange.values = parseSection(p_fileContents, sectionSpan);
+            sectionChanges.append(sectionChange);
+        }
+    }
+
+    // Sections in the baseline which no longer appear were removed
+    for(QHash<QString, SectionFingerprint>::const_iterator baselineIterator = m_sectionFingerprints.constBegin(); baselineIterator != m_sectionFingerprints.constEnd(); ++baselineIterator)
+    {
+        if(!updatedFingerprints.contains(baselineIterator.key()))
+        {
+            SectionChange sectionChange;
+            sectionChange.groupLabel = baselineIterator.key();
+            sectionChange.type = SectionRemoved;
+            sectionChanges.append(sectionChange);
+        }
+    }
+
+    // The new version becomes the baseline for the next comparison
+    m_sectionFingerprints.swap(updatedFingerprints);
+    return sectionChanges;
+}
+
+void ConfigSectionIndex::clear()
+{
+    // Forget every section
+    m_sectionFingerprints.clear();
+}
+
+QVector<ConfigSectionIndex::SectionSpan> ConfigSectionIndex::splitSections(const QByteArray &p_fileContents)
+{
+    QVector<SectionSpan> sectionSpans;
+    LoadArena labelArena;
+    ConfigFileReader configFileReader(p_fileContents, labelArena);
+    ConfigFileReader::SectionHeader sectionHeader;
+
+    // Read the header lines the way the whole file is read on load, skipping the entries between them
+    while(configFileReader.readSectionHeader(sectionHeader))
+    {
+        // The previous section ends where this header's line begins
+        if(!sectionSpans.isEmpty())
+        {
+            sectionSpans.last().bodyEnd = sectionHeader.headerStart;
+        }
+
+        SectionSpan sectionSpan;
+        sectionSpan.groupLabel = sectionHeader.groupLabel.toString();
+        sectionSpan.headerStart = sectionHeader.headerStart;
+        sectionSpan.bodyStart = sectionHeader.bodyStart;
+        sectionSpans.append(sectionSpan);
+    }
+
+    // The last section runs to the end of the file
+    if(!sectionSpans.isEmpty())
+    {
+        sectionSpans.last().bodyEnd = static_cast<int>(p_fileContents.size());
+    }
+
+    return sectionSpans;
+}
+
+ConfigSectionIndex::SectionFingerprint ConfigSectionIndex::fingerprintSection(const QByteArray &p_fileContents, const SectionSpan &p_sectionSpan)
+{
+    // Hash the section's bytes in place rather than copying them out
+    SectionFingerprint sectionFingerprint;
+    sectionFingerprint.length = p_sectionSpan.bodyEnd - p_sectionSpan.bodyStart;
+    sectionFingerprint.hash = qHashBits(p_fileContents.constData() + p_sectionSpan.bodyStart, static_cast<size_t>(sectionFingerprint.length));
+    return sectionFingerprint;
+}
+
+QHash<QString, QString> ConfigSectionIndex::parseSection(const QByteArray &p_fileContents, const SectionSpan &p_sectionSpan)
+{
+    QHash<QString, QString> sectionValues;
+    LoadArena entryArena;
+    ConfigFileReader configFileReader(p_fileContents, p_sectionSpan.bodyStart, p_sectionSpan.bodyEnd, entryArena);
+    ConfigFileReader::Entry configEntry;
+
+    // Decode each "key=value" line exactly as it is decoded on load, later duplicates of a key winning as they do there
+    while(configFileReader.readEntry(configEntry))
+    {
+        sectionValues.insert(configEntry.key.toString(), configEntry.value.toString());
+    }
+
+    return sectionValues;
+}
@@ -0,0 +1,123 @@
+/*##################################################################################
+#   File name:          ConfigSectionIndex.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a ConfigSectionIndex
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CONFIGSECTIONINDEX_H
+#define CONFIGSECTIONINDEX_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The ConfigSectionIndex class remembers a fingerprint of every section of the config file so that, when the file is edited outside the application, only the sections which actually changed are parsed.
+ * Splitting the file into sections and fingerprinting them is a single pass over the raw bytes, so detecting a handful of edited bills in a ledger of 100k bills stays in the milliseconds.
+ */
+class ConfigSectionIndex
+{
+
+public:
+
+    /**
+     * @brief The ChangeType enum lists the ways a section can differ from the previous version of the file.
+     */
+    enum ChangeType
+    {
+        SectionAdded,
+        SectionModified,
+        SectionRemoved
+    };
+
+    /**
+     * @brief The SectionChange struct describes a single section which differs from the previous version of the file.
+     */
+    struct SectionChange
+    {
+        QString groupLabel; //!< The group label of the section, either the FundsInformation group or a bill map key.
+        ChangeType type = SectionModified; //!< How the section changed.
+        QHash<QString, QString> values; //!< Map of (key, value) pairs within the section, empty for removed sections.
+    };
+
+    /**
+     * @brief The SectionSpan struct locates a section within the raw file contents.
+     */
+    struct SectionSpan
+    {
+        QString groupLabel; //!< The decoded group label of the section.
+        int headerStart = 0; //!< The offset of the first byte of the section's header line, including any whitespace before the "[".
+        int bodyStart = 0; //!< The offset of the first byte after the section's header line.
+        int bodyEnd = 0; //!< The offset one past the last byte of the section.
+    };
+
+    /**
+     * @brief Fingerprints every section of the file as the baseline future versions are compared against, without reporting any changes.
+     * @param p_fileContents - The raw contents of the config file.
+     */
+    void reset(const QByteArray &p_fileContents);
+
+    /**
+     * @brief Compares a new version of the file against the previous one, parsing only the sections which were added or modified, then makes it the new baseline.
+     * @param p_fileContents - The raw contents of the config file.
+     * @return The sections which were added, modified, or removed.
+     */
+    QVector<SectionChange> update(const QByteArray &p_fileContents);
+
+    /**
+     * @brief Forgets every section, so the next update reports every section as added.
+     */
+    void clear();
+
+    /**
+     * @brief Splits the raw file contents into sections at their "[Group]" header lines, found with the ConfigFileReader so they match the sections a load reads. Lines before the first header are ignored.
+     * @param p_fileContents - The raw contents of the config file.
+     * @return The location of each section, in file order.
+     */
+    static QVector<SectionSpan> splitSections(const QByteArray &p_fileContents);
+
+    /**
+     * @brief Parses the "key=value" lines of a section with the ConfigFileReader, so they decode exactly as they would on load.
+     * @param p_fileContents - The raw contents of the config file.
+     * @param p_sectionSpan - The location of the section.
+     * @return Map of (key, value) pairs within the section.
+     */
+    static QHash<QString, QString> parseSection(const QByteArray &p_fileContents, const SectionSpan &p_sectionSpan);
+
+private:
+
+    /**
+     * @brief The SectionFingerprint struct identifies the contents of a section without keeping them.
+     */
+    struct SectionFingerprint
+    {
+        size_t hash = 0; //!< Hash of the section's raw bytes.
+        int length = 0; //!< The number of bytes in the section, compared alongside the hash to make false matches even less likely.
+
+        /**
+         * @brief Compares two fingerprints for equality.
+         * @param p_otherFingerprint - The fingerprint to compare against.
+         * @return True if both the hash and length match.
+         */
+        bool operator == (const SectionFingerprint &p_otherFingerprint) const
+        {
+            return hash == p_otherFingerprint.hash && length == p_otherFingerprint.length;
+        }
+    };
+
+    /**
+     * @brief Computes the fingerprint of a section's raw bytes.
+     * @param p_fileContents - The raw contents of the config file.
+     * @param p_sectionSpan - The location of the section.
+     * @return The fingerprint of the section.
+     */
+    static SectionFingerprint fingerprintSection(const QByteArray &p_fileContents, const SectionSpan &p_sectionSpan);
+
+    QHash<QString, SectionFingerprint> m_sectionFingerprints; //!< Map of (group label, fingerprint) for every section of the baseline version of the file.
+};
+
+#endif // CONFIGSECTIONINDEX_H
@@ -0,0 +1,160 @@
+/*##################################################################################
+#   File name:          CurrencyRegistry.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a CurrencyRegistry
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "CurrencyRegistry.h"
+
+#include <QHash>
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QVector>
+#include <QWriteLocker>
+
+namespace
+{
+    const QString DEFAULT_CURRENCY_CODE = "USD"; //!< The currency bills were tracked in before currencies could be chosen.
+    const int CURRENCY_CODE_LENGTH = 3; //!< The length of an ISO 4217 currency code.
+
+    /**
+     * @brief Packs a currency code into a number, upper casing it and checking it is three ASCII letters, so it can be looked up without creating a string.
+     * @param p_currencyCode - The currency code as entered.
+     * @return The packed code, or zero if it is not a valid currency code.
+     */
+    quint32 packCode(QStringView p_currencyCode)
+    {
+        QStringView trimmedCode = p_currencyCode.trimmed();
+
+        if(trimmedCode.size() != CURRENCY_CODE_LENGTH)
+        {
+            return 0;
+        }
+
+        quint32 packedCode = 0;
+
+        for(QChar character : trimmedCode)
+        {
+            ushort codeUnit = character.unicode();
+
+            if(codeUnit >= 'a' && codeUnit <= 'z')
+            {
+                codeUnit = static_cast<ushort>(codeUnit - ('a' - 'A'));
+            }
+
+            if(codeUnit < 'A' || codeUnit > 'Z')
+            {
+                return 0;
+            }
+
+            packedCode = (packedCode << 8) | codeUnit;
+        }
+
+        return packedCode;
+    }
+
+    /**
+     * @brief The registered currencies, shared by every thread.
+     */
+    struct RegistryState
+    {
+        QReadWriteLock lock; //!< Guards the codes, which background load jobs register while the GUI thread reads them.
+        QVector<QString> codeByIndex{DEFAULT_CURRENCY_CODE}; //!< The code of each registered currency, by index.
+        QHash<quint32, quint8> indexByPackedCode{{packCode(DEFAULT_CURRENCY_CODE), CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX}}; //!< The index of each registered currency, by packed code.
+    };
+
+    RegistryState& registryState()
+    {
+        // Constructed on first use so it is ready before any other static needs it
+        static RegistryState state;
+        return state;
+    }
+}
+
+QString CurrencyRegistry::defaultCurrencyCode()
+{
+    return DEFAULT_CURRENCY_CODE;
+}
+
+QString CurrencyRegistry::normalizeCode(const QString &p_currencyCode)
+{
+    QString normalizedCode = p_currencyCode.trimmed().toUpper();
+
+    // Only accept three ASCII letters, so typos such as "US" or "US$" are not registered as new currencies
+    if(normalizedCode.size() != CURRENCY_CODE_LENGTH)
+    {
+        return QString();
+    }
+
+    for(const QChar &character : normalizedCode)
+    {
+        if(character < QLatin1Char('A') || character > QLatin1Char('Z'))
+        {
+            return QString();
+        }
+    }
+
+    return normalizedCode;
+}
+
+quint8 CurrencyRegistry::indexForCode(QStringView p_currencyCode)
+{
+    quint32 packedCode = packCode(p_currencyCode);
+
+    if(packedCode == 0)
+    {
+        return m_DEFAULT_CURRENCY_INDEX;
+    }
+
+    RegistryState &state = registryState();
+
+    // Almost every lookup is for a currency which is already registered, so only take the shared lock for it
+    {
+        QReadLocker readLocker(&state.lock);
+        QHash<quint32, quint8>::const_iterator indexIterator = state.indexByPackedCode.constFind(packedCode);
+
+        if(indexIterator != state.indexByPackedCode.cend())
+        {
+            return indexIterator.value();
+        }
+    }
+
+    QWriteLocker writeLocker(&state.lock);
+
+    // Another thread may have registered the code between the two locks
+    QHash<quint32, quint8>::const_iterator indexIterator = state.indexByPackedCode.constFind(packedCode);
+
+    if(indexIterator != state.indexByPackedCode.cend())
+    {
+        return indexIterator.value();
+    }
+
+    // Fall back to the default currency once every index is taken
+    if(state.codeByIndex.size() >= m_MAX_CURRENCY_COUNT)
+    {
+        return m_DEFAULT_CURRENCY_INDEX;
+    }
+
+    // Only a newly registered currency needs its code kept as a string
+    quint8 currencyIndex = static_cast<quint8>(state.codeByIndex.size());
+    state.codeByIndex.append(p_currencyCode.trimmed().toString().toUpper());
+    state.indexByPackedCode.insert(packedCode, currencyIndex);
+    return currencyIndex;
+}
+
+QString CurrencyRegistry::codeForIndex(quint8 p_currencyIndex)
+{
+    RegistryState &state = registryState();
+    QReadLocker readLocker(&state.lock);
+    return p_currencyIndex < state.codeByIndex.size() ? state.codeByIndex.at(p_currencyIndex) : DEFAULT_CURRENCY_CODE;
+}
+
+int CurrencyRegistry::currencyCount()
+{
+    RegistryState &state = registryState();
+    QReadLocker readLocker(&state.lock);
+    return state.codeByIndex.size();
+}
@@ -0,0 +1,65 @@
+/*##################################################################################
+#   File name:          CurrencyRegistry.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a CurrencyRegistry
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef CURRENCYREGISTRY_H
+#define CURRENCYREGISTRY_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+/**
+ * @brief The CurrencyRegistry class assigns each currency code seen by the application a small index, so a Bill stores its currency in 8 bits and totals can be grouped into an array indexed by currency.
+ * Indexes are only meaningful within one run of the application, anything written to disk stores the currency code instead. The registry is shared by every thread and is safe to use from background jobs.
+ */
+class CurrencyRegistry
+{
+
+public:
+
+    static constexpr int m_MAX_CURRENCY_COUNT = 256; //!< The number of currencies which can be registered, the most an 8-bit index can refer to.
+    static constexpr quint8 m_DEFAULT_CURRENCY_INDEX = 0; //!< The index of the default currency, which is always registered first.
+
+    /**
+     * @brief Returns the code of the currency used when none is given, such as for bills saved before currencies were tracked.
+     * @return The default currency code.
+     */
+    static QString defaultCurrencyCode();
+
+    /**
+     * @brief Trims and upper cases a currency code, checking it is three letters as in ISO 4217.
+     * @param p_currencyCode - The currency code as entered.
+     * @return The normalized code, or an empty string if it is not a valid currency code.
+     */
+    static QString normalizeCode(const QString &p_currencyCode);
+
+    /**
+     * @brief Returns the index of a currency, registering it if it has not been seen before.
+     * Looking up a currency which is already registered creates no strings, so it is cheap enough to call for every bill of a large config file.
+     * @param p_currencyCode - The currency code, which is normalized first.
+     * @return The index of the currency. Invalid codes, and new codes once the registry is full, return the default currency's index.
+     */
+    static quint8 indexForCode(QStringView p_currencyCode);
+
+    /**
+     * @brief Returns the code of a registered currency.
+     * @param p_currencyIndex - The index of the currency.
+     * @return The currency code, or the default currency code if the index is not registered.
+     */
+    static QString codeForIndex(quint8 p_currencyIndex);
+
+    /**
+     * @brief Returns the number of registered currencies, whose indexes run from zero up to one less than the count.
+     * @return The number of registered currencies.
+     */
+    static int currencyCount();
+
+};
+
+#endif // CURRENCYREGISTRY_H
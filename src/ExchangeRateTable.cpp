@@ -0,0 +1,171 @@
+/*##################################################################################
+#   File name:          ExchangeRateTable.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for an ExchangeRateTable
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ExchangeRateTable.h"
+
+#include <QFile>
+#include <QSettings>
+
+#include <cmath>
+
+bool ExchangeRateTable::load(const QString &p_filePath)
+{
+    // Start from a table holding only the default currency, which converts to itself
+    m_rateByCurrency.fill(0.0);
+    m_baseCurrencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX;
+    m_rateByCurrency[m_baseCurrencyIndex] = 1.0;
+
+    bool isExistingFile = QFile::exists(p_filePath);
+    QSettings rateSettings(p_filePath, QSettings::IniFormat);
+
+    if(rateSettings.status() != QSettings::NoError)
+    {
+        return false;
+    }
+
+    // Write a template holding just the base currency for the user to add rates to
+    if(!isExistingFile)
+    {
+        rateSettings.beginGroup(m_RATE_INFORMATION_GROUP_LABEL);
+        rateSettings.setValue(m_BASE_CURRENCY_KEY, CurrencyRegistry::defaultCurrencyCode());
+        rateSettings.endGroup();
+        rateSettings.beginGroup(m_RATES_GROUP_LABEL);
+        rateSettings.setValue(CurrencyRegistry::defaultCurrencyCode(), 1.0);
+        rateSettings.endGroup();
+        rateSettings.sync();
+        return rateSettings.status() == QSettings::NoError;
+    }
+
+    // The base currency always converts to itself, whether or not the file lists it
+    m_baseCurrencyIndex = CurrencyRegistry::indexForCode(rateSettings.value(m_RATE_INFORMATION_GROUP_LABEL + "/" + m_BASE_CURRENCY_KEY, CurrencyRegistry::defaultCurrencyCode()).toString());
+    m_rateByCurrency.fill(0.0);
+    m_rateByCurrency[m_baseCurrencyIndex] = 1.0;
+
+    // Parse each rate once and cache it against its currency's index
+    rateSettings.beginGroup(m_RATES_GROUP_LABEL);
+
+    foreach(QString currencyCode, rateSettings.childKeys())
+    {
+        bool isNumber = false;
+        double rate = rateSettings.value(currencyCode).toString().toDouble(&isNumber);
+
+        if(!isNumber || !std::isfinite(rate) || rate <= 0.0 || CurrencyRegistry::normalizeCode(currencyCode).isEmpty())
+        {
+            continue;
+        }
+
+        quint8 currencyIndex = CurrencyRegistry::indexForCode(currencyCode);
+
+        if(currencyIndex != m_baseCurrencyIndex)
+        {
+            m_rateByCurrency[currencyIndex] = rate;
+        }
+    }
+
+    rateSettings.endGroup();
+    return true;
+}
+
+QString ExchangeRateTable::baseCurrencyCode() const
+{
+    return CurrencyRegistry::codeForIndex(m_baseCurrencyIndex);
+}
+
+QStringList ExchangeRateTable::currencyCodes() const
+{
+    QStringList otherCurrencyCodes;
+
+    for(int currencyIndex = 0; currencyIndex < CurrencyRegistry::currencyCount(); currencyIndex++)
+    {
+        if(currencyIndex != m_baseCurrencyIndex && m_rateByCurrency.at(currencyIndex) > 0.0)
+        {
+            otherCurrencyCodes.append(CurrencyRegistry::codeForIndex(static_cast<quint8>(currencyIndex)));
+        }
+    }
+
+    // List the base currency first, since it is the most likely choice
+    otherCurrencyCodes.sort();
+    otherCurrencyCodes.prepend(baseCurrencyCode());
+    return otherCurrencyCodes;
+}
+
+bool ExchangeRateTable::hasRate(quint8 p_currencyIndex) const
+{
+    return m_rateByCurrency.at(p_currencyIndex) > 0.0;
+}
+
+qint64 ExchangeRateTable::convertCents(qint64 p_amountCents, quint8 p_sourceCurrencyIndex, quint8 p_targetCurrencyIndex, bool *p_isConverted) const
+{
+    bool isConvertible = p_sourceCurrencyIndex == p_targetCurrencyIndex || (hasRate(p_sourceCurrencyIndex) && hasRate(p_targetCurrencyIndex));
+
+    if(p_isConverted != nullptr)
+    {
+        *p_isConverted = isConvertible;
+    }
+
+    // Amounts which cannot be converted have no value in the target currency, so callers must check before using them
+    if(!isConvertible)
+    {
+        return 0;
+    }
+
+    // Amounts already in the target currency are returned as they are
+    if(p_sourceCurrencyIndex == p_targetCurrencyIndex)
+    {
+        return p_amountCents;
+    }
+
+    // Convert through the base currency, using long double so large amounts keep every cent before rounding
+    long double convertedCents = static_cast<long double>(p_amountCents) * m_rateByCurrency.at(p_sourceCurrencyIndex) / m_rateByCurrency.at(p_targetCurrencyIndex);
+    return static_cast<qint64>(std::llround(convertedCents));
+}
+
+qint64 ExchangeRateTable::convertTotals(const QVector<qint64> &p_centsByCurrency, quint8 p_targetCurrencyIndex, QStringList *p_missingCurrencyCodes) const
+{
+    // Without a rate for the target currency only its own amount can be totalled
+    if(!hasRate(p_targetCurrencyIndex))
+    {
+        for(int currencyIndex = 0; currencyIndex < p_centsByCurrency.size(); currencyIndex++)
+        {
+            if(currencyIndex != p_targetCurrencyIndex && p_centsByCurrency.at(currencyIndex) != 0 && p_missingCurrencyCodes != nullptr)
+            {
+                p_missingCurrencyCodes->append(CurrencyRegistry::codeForIndex(static_cast<quint8>(currencyIndex)));
+            }
+        }
+
+        return p_targetCurrencyIndex < p_centsByCurrency.size() ? p_centsByCurrency.at(p_targetCurrencyIndex) : 0;
+    }
+
+    // Sum every currency in the base currency, then convert that sum to the target once
+    long double totalBaseCents = 0.0L;
+
+    for(int currencyIndex = 0; currencyIndex < p_centsByCurrency.size(); currencyIndex++)
+    {
+        qint64 currencyCents = p_centsByCurrency.at(currencyIndex);
+
+        if(currencyCents == 0)
+        {
+            continue;
+        }
+
+        if(!hasRate(static_cast<quint8>(currencyIndex)))
+        {
+            if(p_missingCurrencyCodes != nullptr)
+            {
+                p_missingCurrencyCodes->append(CurrencyRegistry::codeForIndex(static_cast<quint8>(currencyIndex)));
+            }
+
+            continue;
+        }
+
+        totalBaseCents += static_cast<long double>(currencyCents) * m_rateByCurrency.at(currencyIndex);
+    }
+
+    return static_cast<qint64>(std::llround(totalBaseCents / m_rateByCurrency.at(p_targetCurrencyIndex)));
+}
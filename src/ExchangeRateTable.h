@@ -0,0 +1,88 @@
+/*##################################################################################
+#   File name:          ExchangeRateTable.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for an ExchangeRateTable
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef EXCHANGERATETABLE_H
+#define EXCHANGERATETABLE_H
+
+// Local file includes
+#include "CurrencyRegistry.h"
+
+// Qt includes
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The ExchangeRateTable class holds the exchange rates the user maintains in a local file, so amounts in different currencies can be converted without a network connection.
+ * The file is parsed once when it is loaded and each rate is cached against its currency's CurrencyRegistry index, so converting never looks up a currency code.
+ * Totals are converted from per-currency sums, so converting the total of any number of bills costs one multiplication per currency.
+ */
+class ExchangeRateTable
+{
+
+public:
+
+    /**
+     * @brief Loads the exchange rates from a file. If the file does not exist, one is written holding only the base currency so the user has a template to add rates to.
+     * Rates which are not positive numbers and codes which are not valid currency codes are skipped.
+     * @param p_filePath - The path of the exchange rate file.
+     * @return True if the file was read or created.
+     */
+    bool load(const QString &p_filePath);
+
+    /**
+     * @brief Returns the currency every rate is relative to.
+     * @return The base currency code.
+     */
+    QString baseCurrencyCode() const;
+
+    /**
+     * @brief Returns the codes of the currencies which have a rate, base currency first and the rest in alphabetical order.
+     * @return The currency codes.
+     */
+    QStringList currencyCodes() const;
+
+    /**
+     * @brief Checks whether a currency can be converted.
+     * @param p_currencyIndex - The CurrencyRegistry index of the currency.
+     * @return True if the table has a rate for the currency.
+     */
+    bool hasRate(quint8 p_currencyIndex) const;
+
+    /**
+     * @brief Converts an amount from one currency to another, rounding to the nearest cent.
+     * @param p_amountCents - The amount in cents of the source currency.
+     * @param p_sourceCurrencyIndex - The CurrencyRegistry index of the currency the amount is in.
+     * @param p_targetCurrencyIndex - The CurrencyRegistry index of the currency to convert to.
+     * @param p_isConverted - If not null, set to false when either currency has no rate.
+     * @return The amount in cents of the target currency, or zero if either currency has no rate, as an amount left unconverted would be in the wrong currency.
+     */
+    qint64 convertCents(qint64 p_amountCents, quint8 p_sourceCurrencyIndex, quint8 p_targetCurrencyIndex, bool *p_isConverted = nullptr) const;
+
+    /**
+     * @brief Converts amounts which were summed per currency into a single total, in one pass over the currencies.
+     * @param p_centsByCurrency - The amount in cents of each currency, indexed by CurrencyRegistry index.
+     * @param p_targetCurrencyIndex - The CurrencyRegistry index of the currency to total in.
+     * @param p_missingCurrencyCodes - If not null, filled with the codes of currencies which had an amount but no rate. Those amounts are left out of the total.
+     * @return The total in cents of the target currency, or the target currency's own amount if it has no rate.
+     */
+    qint64 convertTotals(const QVector<qint64> &p_centsByCurrency, quint8 p_targetCurrencyIndex, QStringList *p_missingCurrencyCodes = nullptr) const;
+
+private:
+
+    const QString m_RATES_GROUP_LABEL = "ExchangeRates"; //!< The group of the exchange rate file holding a rate per currency code.
+    const QString m_RATE_INFORMATION_GROUP_LABEL = "RateInformation"; //!< The group of the exchange rate file describing the rates.
+    const QString m_BASE_CURRENCY_KEY = "BaseCurrency"; //!< The key of the currency every rate is relative to.
+
+    quint8 m_baseCurrencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the base currency.
+    QVector<double> m_rateByCurrency = QVector<double>(CurrencyRegistry::m_MAX_CURRENCY_COUNT, 0.0); //!< The value of one unit of each currency in the base currency, indexed by CurrencyRegistry index, zero if there is no rate.
+
+};
+
+#endif // EXCHANGERATETABLE_H
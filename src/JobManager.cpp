@@ -0,0 +1,223 @@
+/*##################################################################################
+#   File name:          JobManager.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a JobManager
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "JobManager.h"
+
+#include <QMetaObject>
+
+#include <thread>
+
+JobContext::JobContext(std::shared_ptr<JobState> p_jobState, std::function<void()> p_wakeCallback)
+    : m_jobState(std::move(p_jobState)), m_wakeCallback(std::move(p_wakeCallback))
+{
+}
+
+bool JobContext::isCancelled() const
+{
+    // Return whether or not the GUI thread asked the job to stop
+    return m_jobState->isCancelRequested.load(std::memory_order_relaxed);
+}
+
+void JobContext::reportProgress(int p_percentComplete, const QString &p_statusText)
+{
+    // Drop repeated reports so tight loops can report freely without flooding the GUI thread
+    if(p_percentComplete == m_lastReportedPercent)
+    {
+        return;
+    }
+
+    JobMessage progressMessage;
+    progressMessage.type = JobMessage::Progress;
+    progressMessage.percentComplete = p_percentComplete;
+    progressMessage.statusText = p_statusText;
+
+    // Progress is lossy, if the GUI thread is behind this report is skipped and a later one will catch it up
+    if(m_jobState->channel.tryPush(std::move(progressMessage)))
+    {
+        m_lastReportedPercent = p_percentComplete;
+        m_wakeCallback();
+    }
+}
+
+void JobContext::reportPartialResult(int p_percentComplete, const QVariant &p_partialResult, const QString &p_statusText)
+{
+    JobMessage partialResultMessage;
+    partialResultMessage.type = JobMessage::PartialResult;
+    partialResultMessage.percentComplete = p_percentComplete;
+    partialResultMessage.statusText = p_statusText;
+    partialResultMessage.result = p_partialResult;
+
+    // Partial results are lossy like progress, the next report or the final result supersedes a skipped one
+    if(m_jobState->channel.tryPush(std::move(partialResultMessage)))
+    {
+        m_lastReportedPercent = p_percentComplete;
+        m_wakeCallback();
+    }
+}
+
+JobManager::JobManager(QObject *p_parent, int p_workerCount) : QObject(p_parent), m_jobPool(p_workerCount)
+{
+}
+
+JobManager::~JobManager()
+{
+    // Let queued jobs finish, such as a save in progress, before the channels they post to are destroyed
+    // The GUI thread stops draining while it waits, so tell the workers not to wait for room in a full channel
+    m_isShuttingDown.store(true);
+    m_jobPool.shutdown();
+}
+
+quint64 JobManager::submit(const QString &p_jobName, JobFunction p_jobFunction)
+{
+    // Create the state shared between the worker and the GUI thread
+    std::shared_ptr<JobState> jobState = std::make_shared<JobState>();
+    jobState->jobId = m_nextJobId++;
+    jobState->jobName = p_jobName;
+    jobState->jobFunction = std::move(p_jobFunction);
+
+    // Track the job until it delivers its outcome, then hand it to the pool
+    m_activeJobs.insert(jobState->jobId, jobState);
+    m_jobPool.submit([this, jobState]()
+    {
+        runJob(jobState);
+    });
+
+    return jobState->jobId;
+}
+
+void JobManager::cancel(quint64 p_jobId)
+{
+    std::shared_ptr<JobState> jobState = m_activeJobs.value(p_jobId);
+
+    // Ask the job to stop at its next check, jobs which already finished are ignored
+    if(jobState)
+    {
+        jobState->isCancelRequested.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool JobManager::isRunning(quint64 p_jobId) const
+{
+    // A job is running until its outcome has been drained
+    return m_activeJobs.contains(p_jobId);
+}
+
+void JobManager::runJob(std::shared_ptr<JobState> p_jobState)
+{
+    JobMessage outcomeMessage;
+
+    // A job cancelled while it was still queued is never started
+    if(p_jobState->isCancelRequested.load(std::memory_order_relaxed))
+    {
+        outcomeMessage.type = JobMessage::Cancelled;
+    }
+    else
+    {
+        // Run the job with a context it can report progress through
+        JobContext jobContext(p_jobState, [this]()
+        {
+            scheduleDrain();
+        });
+
+        QVariant jobResult = p_jobState->jobFunction(jobContext);
+
+        // A job which noticed cancellation is reported as cancelled rather than finished, still carrying whatever it returned
+        if(jobContext.isCancelled())
+        {
+            outcomeMessage.type = JobMessage::Cancelled;
+        }
+        else
+        {
+            outcomeMessage.type = JobMessage::Finished;
+            outcomeMessage.percentComplete = 100;
+        }
+
+        outcomeMessage.result = std::move(jobResult);
+    }
+
+    // Release the job's captures on the worker rather than whenever the GUI thread drops its reference
+    p_jobState->jobFunction = nullptr;
+    postRequiredMessage(p_jobState, std::move(outcomeMessage));
+}
+
+void JobManager::postRequiredMessage(const std::shared_ptr<JobState> &p_jobState, JobMessage p_jobMessage)
+{
+    // The outcome must not be dropped, so wait for the GUI thread to free a slot if the channel is full
+    while(!p_jobState->channel.tryPush(p_jobMessage))
+    {
+        // The GUI thread is joining the workers and will never drain again, so nobody is left to receive the outcome
+        if(m_isShuttingDown.load())
+        {
+            return;
+        }
+
+        scheduleDrain();
+        std::this_thread::yield();
+    }
+
+    scheduleDrain();
+}
+
+void JobManager::scheduleDrain()
+{
+    // Only queue a drain if one is not already pending, the pending one will pick up this message too
+    if(!m_isDrainScheduled.exchange(true))
+    {
+        QMetaObject::invokeMethod(this, "drainJobChannels", Qt::QueuedConnection);
+    }
+}
+
+void JobManager::drainJobChannels()
+{
+    // Clear the flag first so messages posted while draining schedule another drain
+    m_isDrainScheduled.store(false);
+
+    // Take a copy of the active jobs since slots connected to the signals below may submit or cancel jobs
+    QList<std::shared_ptr<JobState>> activeJobs = m_activeJobs.values();
+
+    for(const std::shared_ptr<JobState> &jobState : activeJobs)
+    {
+        JobMessage jobMessage;
+
+        // Turn every queued message of the job into a signal
+        while(jobState->channel.tryPop(jobMessage))
+        {
+            switch(jobMessage.type)
+            {
+                case JobMessage::Progress :
+                {
+                    emit jobProgress(jobState->jobId, jobMessage.percentComplete, jobMessage.statusText);
+                    break;
+                }
+
+                case JobMessage::PartialResult :
+                {
+                    emit jobProgress(jobState->jobId, jobMessage.percentComplete, jobMessage.statusText);
+                    emit jobPartialResult(jobState->jobId, jobMessage.percentComplete, jobMessage.result);
+                    break;
+                }
+
+                case JobMessage::Finished :
+                {
+                    // Stop tracking the job before announcing it so slots see it as no longer running
+                    m_activeJobs.remove(jobState->jobId);
+                    emit jobFinished(jobState->jobId, jobMessage.result);
+                    break;
+                }
+
+                default :
+                {
+                    m_activeJobs.remove(jobState->jobId);
+                    emit jobCancelled(jobState->jobId, jobMessage.result);
+                    break;
+                }
+            }
+        }
+    }
+}
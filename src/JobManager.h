@@ -0,0 +1,219 @@
+/*##################################################################################
+#   File name:          JobManager.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a JobManager
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef JOBMANAGER_H
+#define JOBMANAGER_H
+
+// Local file includes
+#include "JobPool.h"
+#include "SpscQueue.h"
+
+// Qt includes
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QVariant>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+class JobContext;
+
+/**
+ * @brief The JobMessage struct is a single update posted by a running job to the GUI thread.
+ */
+struct JobMessage
+{
+    /**
+     * @brief The MessageType enum lists the kinds of updates a job can post.
+     */
+    enum MessageType
+    {
+        Progress,
+        PartialResult,
+        Finished,
+        Cancelled
+    };
+
+    MessageType type = Progress; //!< The kind of update.
+    int percentComplete = 0; //!< How far along the job is, from 0 to 100.
+    QString statusText; //!< Short description of what the job is doing.
+    QVariant result; //!< The value the job returned on Finished and Cancelled messages, or the results so far on PartialResult messages. Invalid for a job cancelled before it started.
+};
+
+/**
+ * @brief The JobState struct holds everything shared between a job's worker and the GUI thread.
+ */
+struct JobState
+{
+    quint64 jobId = 0; //!< The id the job was submitted under.
+    QString jobName; //!< Human readable name of the job.
+    std::function<QVariant(JobContext&)> jobFunction; //!< The work the job performs.
+    std::atomic<bool> isCancelRequested{false}; //!< Set by the GUI thread to ask the job to stop at its next check.
+    SpscQueue<JobMessage> channel{64}; //!< Messages from the job's worker to the GUI thread.
+};
+
+/**
+ * @brief The JobContext class is handed to a running job so it can report progress and check for cancellation.
+ */
+class JobContext
+{
+
+public:
+
+    /**
+     * @brief Constructs a JobContext.
+     * @param p_jobState - The state of the job being run.
+     * @param p_wakeCallback - Called after a message is posted so the GUI thread drains it.
+     */
+    JobContext(std::shared_ptr<JobState> p_jobState, std::function<void()> p_wakeCallback);
+
+    /**
+     * @brief Returns whether or not the job has been asked to stop. Long running jobs should check this regularly and return early when it is set.
+     * @return True if cancellation was requested.
+     */
+    bool isCancelled() const;
+
+    /**
+     * @brief Posts the job's progress to the GUI thread. Repeated reports of the same percentage are dropped, as are reports made while the channel is full.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_statusText - Short description of what the job is doing.
+     */
+    void reportProgress(int p_percentComplete, const QString &p_statusText = QString());
+
+    /**
+     * @brief Posts the job's results so far to the GUI thread, so long running jobs can be shown while they run. Reports made while the channel is full are dropped, since a later report supersedes them.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_partialResult - The results so far.
+     * @param p_statusText - Short description of what the job is doing.
+     */
+    void reportPartialResult(int p_percentComplete, const QVariant &p_partialResult, const QString &p_statusText = QString());
+
+private:
+
+    std::shared_ptr<JobState> m_jobState; //!< The state of the job being run.
+    std::function<void()> m_wakeCallback; //!< Wakes the GUI thread after a message is posted.
+    int m_lastReportedPercent = -1; //!< The last percentage posted, used to drop duplicate reports.
+};
+
+/**
+ * @brief The JobManager class runs jobs such as loading and saving the ledger on a work-stealing JobPool so the GUI thread is never blocked.
+ * Each job posts progress and its result through its own lock-free single producer, single consumer channel, which the GUI thread drains and turns into signals.
+ * Jobs are cancelled cooperatively, a cancelled job stops at its next check of JobContext::isCancelled().
+ */
+class JobManager : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    using JobFunction = std::function<QVariant(JobContext&)>; //!< The signature of the work a job performs.
+
+    /**
+     * @brief Constructs the JobManager and starts its workers.
+     * @param p_parent - Parent object used for object tree tracking.
+     * @param p_workerCount - The number of worker threads, one per core if zero or less.
+     */
+    explicit JobManager(QObject *p_parent = nullptr, int p_workerCount = 0);
+
+    /**
+     * @brief Destructs the JobManager by letting queued jobs finish and joining the workers.
+     */
+    ~JobManager();
+
+    /**
+     * @brief Queues a job to be run in the background.
+     * @param p_jobName - Human readable name of the job.
+     * @param p_jobFunction - The work the job performs, its return value is delivered through jobFinished().
+     * @return The id of the job, never zero.
+     */
+    quint64 submit(const QString &p_jobName, JobFunction p_jobFunction);
+
+    /**
+     * @brief Asks a job to stop. Does nothing if the job has already finished.
+     * @param p_jobId - The id of the job.
+     */
+    void cancel(quint64 p_jobId);
+
+    /**
+     * @brief Returns whether or not a job is still queued or running.
+     * @param p_jobId - The id of the job.
+     * @return True if the job has not yet delivered its result.
+     */
+    bool isRunning(quint64 p_jobId) const;
+
+signals:
+
+    /**
+     * @brief Emitted on the GUI thread when a job reports progress.
+     * @param p_jobId - The id of the job.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_statusText - Short description of what the job is doing.
+     */
+    void jobProgress(quint64 p_jobId, int p_percentComplete, QString p_statusText);
+
+    /**
+     * @brief Emitted on the GUI thread when a job reports its results so far.
+     * @param p_jobId - The id of the job.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_partialResult - The results so far.
+     */
+    void jobPartialResult(quint64 p_jobId, int p_percentComplete, QVariant p_partialResult);
+
+    /**
+     * @brief Emitted on the GUI thread when a job finishes.
+     * @param p_jobId - The id of the job.
+     * @param p_result - The value the job returned.
+     */
+    void jobFinished(quint64 p_jobId, QVariant p_result);
+
+    /**
+     * @brief Emitted on the GUI thread when a job stops because it was cancelled.
+     * @param p_jobId - The id of the job.
+     * @param p_result - The value the job returned after it stopped, such as the results of the work it completed, or an invalid QVariant if it was cancelled before it started.
+     */
+    void jobCancelled(quint64 p_jobId, QVariant p_result);
+
+private slots:
+
+    /**
+     * @brief Drains the channel of every active job on the GUI thread, emitting a signal for each message.
+     */
+    void drainJobChannels();
+
+private:
+
+    /**
+     * @brief Runs a job on a worker thread and posts its outcome.
+     * @param p_jobState - The state of the job.
+     */
+    void runJob(std::shared_ptr<JobState> p_jobState);
+
+    /**
+     * @brief Posts a message the GUI thread must receive, waiting for space in the channel if it is full.
+     * Once the JobManager is being destructed nothing drains the channels any more, so the message is dropped rather than waited on.
+     * @param p_jobState - The state of the job.
+     * @param p_jobMessage - The message to post.
+     */
+    void postRequiredMessage(const std::shared_ptr<JobState> &p_jobState, JobMessage p_jobMessage);
+
+    /**
+     * @brief Schedules a single drain of the job channels on the GUI thread. Safe to call from any thread, repeated calls before the drain runs are coalesced.
+     */
+    void scheduleDrain();
+
+    JobPool m_jobPool; //!< The worker threads jobs run on.
+    QHash<quint64, std::shared_ptr<JobState>> m_activeJobs; //!< Map of (job id, job state) for jobs which have not yet delivered their outcome, only touched on the GUI thread.
+    quint64 m_nextJobId = 1; //!< The id handed to the next submitted job.
+    std::atomic<bool> m_isDrainScheduled{false}; //!< Whether or not a drain is already queued on the GUI thread.
+    std::atomic<bool> m_isShuttingDown{false}; //!< Set once the GUI thread is waiting for the workers in the destructor, after which no channel is drained.
+};
+
+#endif // JOBMANAGER_H
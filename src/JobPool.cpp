@@ -0,0 +1,162 @@
+/*##################################################################################
+#   File name:          JobPool.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a JobPool
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "JobPool.h"
+
+#include <algorithm>
+
+namespace
+{
+    thread_local const JobPool *currentWorkerPool = nullptr; //!< The pool the calling thread works for, null on threads outside any pool.
+    thread_local int currentWorkerIndex = -1; //!< The queue index of the calling worker thread.
+}
+
+JobPool::JobPool(int p_workerCount)
+{
+    // Default to one worker per core
+    int workerCount = p_workerCount > 0 ? p_workerCount : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Create every queue before any worker starts so thieves never see a partially built pool
+    for(int workerIndex = 0; workerIndex < workerCount; workerIndex++)
+    {
+        m_workerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    // Start the workers
+    for(int workerIndex = 0; workerIndex < workerCount; workerIndex++)
+    {
+        m_workers.emplace_back(&JobPool::runWorker, this, workerIndex);
+    }
+}
+
+JobPool::~JobPool()
+{
+    // Finish the queued tasks and join the workers
+    shutdown();
+}
+
+int JobPool::workerCount() const
+{
+    // Return the number of workers
+    return static_cast<int>(m_workerQueues.size());
+}
+
+void JobPool::submit(std::function<void()> p_task)
+{
+    // Tasks submitted by one of this pool's workers stay on that worker's queue, others are spread round robin
+    std::size_t queueIndex = (currentWorkerPool == this) ? static_cast<std::size_t>(currentWorkerIndex) : m_nextQueueIndex.fetch_add(1) % m_workerQueues.size();
+
+    {
+        std::lock_guard<std::mutex> queueLock(m_workerQueues[queueIndex]->mutex);
+        m_workerQueues[queueIndex]->tasks.push_back(std::move(p_task));
+    }
+
+    m_queuedTaskCount.fetch_add(1);
+
+    // Taking the sleep mutex before notifying guarantees a worker about to sleep sees the new count
+    {
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+    }
+
+    m_wakeCondition.notify_one();
+}
+
+void JobPool::shutdown()
+{
+    // Only the first call stops the workers
+    if(m_isShuttingDown.exchange(true))
+    {
+        return;
+    }
+
+    // Wake every worker so they drain the queues and exit
+    {
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+    }
+
+    m_wakeCondition.notify_all();
+
+    for(std::thread &worker : m_workers)
+    {
+        if(worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+bool JobPool::takeOrStealTask(int p_workerIndex, std::function<void()> &p_task)
+{
+    // Run the worker's own newest task first, since its data is most likely still in cache
+    {
+        WorkerQueue &ownQueue = *m_workerQueues[p_workerIndex];
+        std::lock_guard<std::mutex> queueLock(ownQueue.mutex);
+
+        if(!ownQueue.tasks.empty())
+        {
+            p_task = std::move(ownQueue.tasks.back());
+            ownQueue.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Otherwise steal the oldest task from the next worker which has one
+    for(std::size_t offset = 1; offset < m_workerQueues.size(); offset++)
+    {
+        WorkerQueue &victimQueue = *m_workerQueues[(p_workerIndex + offset) % m_workerQueues.size()];
+        std::unique_lock<std::mutex> queueLock(victimQueue.mutex, std::try_to_lock);
+
+        // Skip queues which are busy rather than waiting on them, another pass will find the task
+        if(!queueLock.owns_lock() || victimQueue.tasks.empty())
+        {
+            continue;
+        }
+
+        p_task = std::move(victimQueue.tasks.front());
+        victimQueue.tasks.pop_front();
+        return true;
+    }
+
+    return false;
+}
+
+void JobPool::runWorker(int p_workerIndex)
+{
+    // Let tasks submitted from this thread find their way back to this worker's queue
+    currentWorkerPool = this;
+    currentWorkerIndex = p_workerIndex;
+
+    std::function<void()> task;
+
+    while(true)
+    {
+        // Run any task which can be found
+        if(takeOrStealTask(p_workerIndex, task))
+        {
+            m_queuedTaskCount.fetch_sub(1);
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+
+        // Exit once the pool is shutting down and every task has been taken
+        if(m_isShuttingDown.load() && m_queuedTaskCount.load() == 0)
+        {
+            return;
+        }
+
+        // Sleep until a task is queued or the pool shuts down, re-checking the queues if a task slipped past a busy queue lock
+        m_wakeCondition.wait(sleepLock, [this]()
+        {
+            return m_queuedTaskCount.load() > 0 || m_isShuttingDown.load();
+        });
+    }
+}
@@ -0,0 +1,94 @@
+/*##################################################################################
+#   File name:          JobPool.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a JobPool
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef JOBPOOL_H
+#define JOBPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The JobPool class is a fixed set of worker threads which run tasks using work stealing.
+ * Each worker owns a queue and runs its own most recently queued task first, and when its queue is empty it steals the oldest task from another worker.
+ * Tasks submitted from a worker go to that worker's queue, so a job which fans out work keeps it local until another worker runs dry.
+ */
+class JobPool
+{
+
+public:
+
+    /**
+     * @brief Constructs a JobPool and starts its workers.
+     * @param p_workerCount - The number of worker threads, one per core if zero or less.
+     */
+    explicit JobPool(int p_workerCount);
+
+    /**
+     * @brief Destructs the JobPool by finishing every queued task and joining the workers.
+     */
+    ~JobPool();
+
+    /**
+     * @brief Queues a task to be run on one of the workers.
+     * @param p_task - The task to run.
+     */
+    void submit(std::function<void()> p_task);
+
+    /**
+     * @brief Finishes every queued task and then stops the workers. Called automatically on destruction.
+     */
+    void shutdown();
+
+    /**
+     * @brief Returns the number of worker threads.
+     * @return The number of workers.
+     */
+    int workerCount() const;
+
+private:
+
+    /**
+     * @brief The WorkerQueue struct holds the tasks queued to a single worker.
+     */
+    struct WorkerQueue
+    {
+        std::mutex mutex; //!< Guards the tasks, only contended when another worker steals.
+        std::deque<std::function<void()>> tasks; //!< The queued tasks, the owner takes from the back and thieves from the front.
+    };
+
+    /**
+     * @brief The main loop of a worker, which runs tasks until the pool shuts down.
+     * @param p_workerIndex - The index of the worker's own queue.
+     */
+    void runWorker(int p_workerIndex);
+
+    /**
+     * @brief Takes a task from the worker's own queue, or steals one from another worker if its own queue is empty.
+     * @param p_workerIndex - The index of the worker's own queue.
+     * @param p_task - Receives the task.
+     * @return True if a task was found, false if every queue was empty.
+     */
+    bool takeOrStealTask(int p_workerIndex, std::function<void()> &p_task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues; //!< One queue per worker.
+    std::vector<std::thread> m_workers; //!< The worker threads.
+    std::mutex m_sleepMutex; //!< Mutex idle workers sleep on.
+    std::condition_variable m_wakeCondition; //!< Signalled when a task is queued or the pool shuts down.
+    std::atomic<int> m_queuedTaskCount{0}; //!< The number of tasks queued but not yet taken by a worker.
+    std::atomic<unsigned int> m_nextQueueIndex{0}; //!< Round robin position for tasks submitted from outside the pool.
+    std::atomic<bool> m_isShuttingDown{false}; //!< Whether or not the workers should exit once the queues are empty.
+};
+
+#endif // JOBPOOL_H
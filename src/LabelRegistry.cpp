@@ -0,0 +1,112 @@
+/*##################################################################################
+#   File name:          LabelRegistry.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LabelRegistry
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LabelRegistry.h"
+
+#include <QHash>
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QWriteLocker>
+
+#include <deque>
+
+namespace
+{
+    /**
+     * @brief The registered labels of one kind, shared by every thread.
+     * Labels are kept in a deque, which never moves its elements as it grows, so a label handed out stays valid while later ones are registered.
+     */
+    template <typename Label>
+    struct InternedLabels
+    {
+        QReadWriteLock lock; //!< Guards the labels, which background load jobs register while the GUI thread reads them.
+        std::deque<Label> labelByIndex{Label()}; //!< Each registered label, by index, starting with the empty label.
+        QHash<Label, quint32> indexByLabel{{Label(), LabelRegistry::m_EMPTY_LABEL_INDEX}}; //!< The index of each registered label.
+
+        /**
+         * @brief Returns the index of a label, registering it if it has not been seen before.
+         * @param p_label - The label.
+         * @return The index of the label.
+         */
+        quint32 indexFor(const Label &p_label)
+        {
+            // Almost every lookup is for a label which is already registered, so only take the shared lock for it
+            {
+                QReadLocker readLocker(&lock);
+                typename QHash<Label, quint32>::const_iterator indexIterator = indexByLabel.constFind(p_label);
+
+                if(indexIterator != indexByLabel.cend())
+                {
+                    return indexIterator.value();
+                }
+            }
+
+            QWriteLocker writeLocker(&lock);
+
+            // Another thread may have registered the label between the two locks
+            typename QHash<Label, quint32>::const_iterator indexIterator = indexByLabel.constFind(p_label);
+
+            if(indexIterator != indexByLabel.cend())
+            {
+                return indexIterator.value();
+            }
+
+            quint32 labelIndex = static_cast<quint32>(labelByIndex.size());
+            labelByIndex.push_back(p_label);
+            indexByLabel.insert(p_label, labelIndex);
+            return labelIndex;
+        }
+
+        /**
+         * @brief Returns a registered label.
+         * @param p_labelIndex - The index of the label.
+         * @return The label, or the empty label if the index is not registered.
+         */
+        const Label& labelFor(quint32 p_labelIndex)
+        {
+            QReadLocker readLocker(&lock);
+            return p_labelIndex < labelByIndex.size() ? labelByIndex[p_labelIndex] : labelByIndex.front();
+        }
+    };
+
+    InternedLabels<QString>& categories()
+    {
+        // Constructed on first use so it is ready before any other static needs it
+        static InternedLabels<QString> categoryLabels;
+        return categoryLabels;
+    }
+
+    InternedLabels<QStringList>& tagLists()
+    {
+        static InternedLabels<QStringList> tagListLabels;
+        return tagListLabels;
+    }
+}
+
+quint32 LabelRegistry::indexForCategory(const QString &p_category)
+{
+    // Skip the lock for bills without a category, which most are
+    return p_category.isEmpty() ? m_EMPTY_LABEL_INDEX : categories().indexFor(p_category);
+}
+
+const QString& LabelRegistry::categoryForIndex(quint32 p_categoryIndex)
+{
+    return categories().labelFor(p_categoryIndex);
+}
+
+quint32 LabelRegistry::indexForTags(const QStringList &p_tags)
+{
+    // Skip the lock for bills without tags, which most are
+    return p_tags.isEmpty() ? m_EMPTY_LABEL_INDEX : tagLists().indexFor(p_tags);
+}
+
+const QStringList& LabelRegistry::tagsForIndex(quint32 p_tagsIndex)
+{
+    return tagLists().labelFor(p_tagsIndex);
+}
@@ -0,0 +1,58 @@
+/*##################################################################################
+#   File name:          LabelRegistry.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LabelRegistry
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LABELREGISTRY_H
+#define LABELREGISTRY_H
+
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The LabelRegistry class interns the categories and tag lists of bills, giving each distinct one an index, so a Bill stores them as two small numbers rather than a string and a list of its own.
+ * Most bills share a handful of categories and tag lists, so each is kept once however many bills use it, and bills with the same labels compare equal by index alone.
+ * Indexes are only meaningful within one run of the application, anything written to disk stores the labels instead. The registry is shared by every thread and is safe to use from background jobs.
+ */
+class LabelRegistry
+{
+
+public:
+
+    static constexpr quint32 m_EMPTY_LABEL_INDEX = 0; //!< The index of the empty category and of the empty tag list, which are always registered first.
+
+    /**
+     * @brief Returns the index of a category, registering it if it has not been seen before.
+     * @param p_category - The category.
+     * @return The index of the category.
+     */
+    static quint32 indexForCategory(const QString &p_category);
+
+    /**
+     * @brief Returns a registered category, which stays valid for the rest of the run.
+     * @param p_categoryIndex - The index of the category.
+     * @return The category, or an empty string if the index is not registered.
+     */
+    static const QString& categoryForIndex(quint32 p_categoryIndex);
+
+    /**
+     * @brief Returns the index of a tag list, registering it if it has not been seen before.
+     * @param p_tags - The tags, in order.
+     * @return The index of the tag list.
+     */
+    static quint32 indexForTags(const QStringList &p_tags);
+
+    /**
+     * @brief Returns a registered tag list, which stays valid for the rest of the run.
+     * @param p_tagsIndex - The index of the tag list.
+     * @return The tags, or an empty list if the index is not registered.
+     */
+    static const QStringList& tagsForIndex(quint32 p_tagsIndex);
+
+};
+
+#endif // LABELREGISTRY_H
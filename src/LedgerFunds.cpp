@@ -0,0 +1,101 @@
+/*##################################################################################
+#   File name:          LedgerFunds.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LedgerFunds
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LedgerFunds.h"
+
+#include <QDateTime>
+
+void LedgerFunds::BillTotals::addBill(const Bill &p_bill)
+{
+    QVector<qint64> &centsByCurrency = p_bill.isFunded() ? fundedCentsByCurrency : unfundedCentsByCurrency;
+    centsByCurrency[p_bill.getCurrencyIndex()] += p_bill.getAmountDueCents();
+    billCount++;
+    fundedBillCount += p_bill.isFunded() ? 1 : 0;
+}
+
+LedgerFunds::LedgerFunds(const ExchangeRateTable &p_exchangeRateTable, quint8 p_availableCurrencyIndex) : m_exchangeRateTable(p_exchangeRateTable), m_availableCurrencyIndex(p_availableCurrencyIndex)
+{
+}
+
+qint64 LedgerFunds::convertToAvailableCurrency(qint64 p_amountCents, quint8 p_currencyIndex, bool *p_isConverted) const
+{
+    return m_exchangeRateTable.convertCents(p_amountCents, p_currencyIndex, m_availableCurrencyIndex, p_isConverted);
+}
+
+LedgerFunds::FundsChange LedgerFunds::fundingChange(const Bill &p_bill, bool p_isFunded) const
+{
+    FundsChange fundsChange;
+    fundsChange.transactionType = p_isFunded ? TransactionLedger::Fund : TransactionLedger::Defund;
+
+    // Bills already in the requested state are left alone
+    if(p_bill.isFunded() == p_isFunded)
+    {
+        return fundsChange;
+    }
+
+    // Funding sets the amount due aside, defunding releases it back into the amount available
+    qint64 movedCents = convertToAvailableCurrency(p_bill.getAmountDueCents(), p_bill.getCurrencyIndex(), &fundsChange.isConverted);
+    fundsChange.isChanged = true;
+    fundsChange.amountAvailableChangeCents = p_isFunded ? -movedCents : movedCents;
+    return fundsChange;
+}
+
+LedgerFunds::FundsChange LedgerFunds::deletionChange(const Bill &p_bill) const
+{
+    FundsChange fundsChange;
+    fundsChange.isChanged = true;
+    fundsChange.transactionType = TransactionLedger::Delete;
+
+    // Only a funded bill has funds set aside to return
+    if(p_bill.isFunded())
+    {
+        fundsChange.amountAvailableChangeCents = convertToAvailableCurrency(p_bill.getAmountDueCents(), p_bill.getCurrencyIndex(), &fundsChange.isConverted);
+    }
+
+    return fundsChange;
+}
+
+LedgerFunds::BillTotals LedgerFunds::totalBills(const QMap<QString, Bill> &p_billMap)
+{
+    // Sum in one pass, indexing by currency so no bill needs a rate looked up
+    BillTotals billTotals;
+
+    for(const Bill &bill : p_billMap)
+    {
+        billTotals.addBill(bill);
+    }
+
+    return billTotals;
+}
+
+qint64 LedgerFunds::convertTotals(const QVector<qint64> &p_centsByCurrency, QStringList *p_missingCurrencyCodes) const
+{
+    return m_exchangeRateTable.convertTotals(p_centsByCurrency, m_availableCurrencyIndex, p_missingCurrencyCodes);
+}
+
+BalanceHistory::Snapshot LedgerFunds::balanceSnapshot(const QMap<QString, Bill> &p_billMap, qint64 p_availableCents, QStringList *p_missingCurrencyCodes) const
+{
+    BillTotals billTotals = totalBills(p_billMap);
+
+    // Record the totals in the currency of the amount available, as they are shown
+    BalanceHistory::Snapshot snapshot;
+    snapshot.timestampMsecs = QDateTime::currentMSecsSinceEpoch();
+    snapshot.availableCents = p_availableCents;
+    snapshot.fundedCents = convertTotals(billTotals.fundedCentsByCurrency, p_missingCurrencyCodes);
+    snapshot.outstandingCents = convertTotals(billTotals.unfundedCentsByCurrency, p_missingCurrencyCodes);
+    snapshot.currencyIndex = m_availableCurrencyIndex;
+
+    // A currency missing from both totals is only listed once
+    if(p_missingCurrencyCodes != nullptr)
+    {
+        p_missingCurrencyCodes->removeDuplicates();
+    }
+
+    return snapshot;
+}
@@ -0,0 +1,124 @@
+/*##################################################################################
+#   File name:          LedgerFunds.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LedgerFunds
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LEDGERFUNDS_H
+#define LEDGERFUNDS_H
+
+// Local file includes
+#include "BalanceHistory.h"
+#include "Bill.h"
+#include "CurrencyRegistry.h"
+#include "ExchangeRateTable.h"
+#include "TransactionLedger.h"
+
+// Qt includes
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The LedgerFunds class works out how funding, defunding, and deleting bills move money out of and back into the total amount available, and totals bills per currency,
+ * all in the currency of the amount available. The PFT and pft both move funds and total bills through it, so the two always agree.
+ */
+class LedgerFunds
+{
+
+public:
+
+    /**
+     * @brief The FundsChange struct is what funding, defunding, or deleting a bill does to the total amount available, and how it is recorded in the transaction history.
+     */
+    struct FundsChange
+    {
+        bool isChanged = false; //!< Whether or not the bill changes, funding a funded bill or defunding an unfunded one changing nothing.
+        bool isConverted = true; //!< Whether or not the amount moved could be converted into the currency of the amount available, the change being refused when it could not.
+        qint64 amountAvailableChangeCents = 0; //!< The signed change to the amount available in cents, negative when funds are set aside.
+        TransactionLedger::TransactionType transactionType = TransactionLedger::Delete; //!< The transaction the change is recorded as.
+    };
+
+    /**
+     * @brief The BillTotals struct is the amounts due of a set of bills summed per currency, so they are converted once per currency rather than once per bill.
+     */
+    struct BillTotals
+    {
+        QVector<qint64> fundedCentsByCurrency = QVector<qint64>(CurrencyRegistry::m_MAX_CURRENCY_COUNT, 0); //!< The amount due of the funded bills, indexed by currency.
+        QVector<qint64> unfundedCentsByCurrency = QVector<qint64>(CurrencyRegistry::m_MAX_CURRENCY_COUNT, 0); //!< The amount due of the unfunded bills, indexed by currency.
+        int billCount = 0; //!< The number of bills totalled.
+        int fundedBillCount = 0; //!< The number of funded bills totalled.
+
+        /**
+         * @brief Adds a bill's amount due to the funded or unfunded sum of its currency.
+         * @param p_bill - The bill.
+         */
+        void addBill(const Bill &p_bill);
+    };
+
+    /**
+     * @brief Constructs a LedgerFunds moving funds in a currency.
+     * @param p_exchangeRateTable - The exchange rates used for bills in other currencies, which must outlive the LedgerFunds.
+     * @param p_availableCurrencyIndex - The CurrencyRegistry index of the currency the amount available is in.
+     */
+    LedgerFunds(const ExchangeRateTable &p_exchangeRateTable, quint8 p_availableCurrencyIndex);
+
+    /**
+     * @brief Converts an amount into the currency of the amount available.
+     * @param p_amountCents - The amount in cents.
+     * @param p_currencyIndex - The CurrencyRegistry index of the currency the amount is in.
+     * @param p_isConverted - If not null, set to false when there is no exchange rate for the conversion.
+     * @return The converted amount in cents, or zero if there is no exchange rate for the conversion.
+     */
+    qint64 convertToAvailableCurrency(qint64 p_amountCents, quint8 p_currencyIndex, bool *p_isConverted = nullptr) const;
+
+    /**
+     * @brief Returns what setting a bill's funding status does to the amount available, funding setting its amount due aside and defunding releasing it.
+     * @param p_bill - The bill, with the funding status it has before the change.
+     * @param p_isFunded - The funding status the bill is changed to.
+     * @return The change, which is unchanged if the bill already has the funding status, and not converted if its amount due has no exchange rate, in which case it must not be made.
+     */
+    FundsChange fundingChange(const Bill &p_bill, bool p_isFunded) const;
+
+    /**
+     * @brief Returns what deleting a bill does to the amount available, a funded bill's amount due being returned to it.
+     * @param p_bill - The bill.
+     * @return The change, which is always recorded even if nothing is returned, and not converted if a funded bill's amount due has no exchange rate, in which case it must not be made.
+     */
+    FundsChange deletionChange(const Bill &p_bill) const;
+
+    /**
+     * @brief Sums the amounts due of every bill in a bill map per currency.
+     * @param p_billMap - The bill map.
+     * @return The totals.
+     */
+    static BillTotals totalBills(const QMap<QString, Bill> &p_billMap);
+
+    /**
+     * @brief Converts amounts summed per currency into a total in the currency of the amount available.
+     * @param p_centsByCurrency - The amount in cents of each currency, indexed by CurrencyRegistry index.
+     * @param p_missingCurrencyCodes - If not null, filled with the codes of currencies which had an amount but no rate, which are left out of the total.
+     * @return The total in cents.
+     */
+    qint64 convertTotals(const QVector<qint64> &p_centsByCurrency, QStringList *p_missingCurrencyCodes = nullptr) const;
+
+    /**
+     * @brief Totals the funded and unfunded bills of a bill map as a balance history snapshot taken now.
+     * @param p_billMap - The bill map.
+     * @param p_availableCents - The amount available in cents.
+     * @param p_missingCurrencyCodes - If not null, filled with the codes of currencies which had bills but no rate, which are left out of the totals.
+     * @return The snapshot.
+     */
+    BalanceHistory::Snapshot balanceSnapshot(const QMap<QString, Bill> &p_billMap, qint64 p_availableCents, QStringList *p_missingCurrencyCodes = nullptr) const;
+
+private:
+
+    const ExchangeRateTable &m_exchangeRateTable; //!< The exchange rates used for bills in other currencies.
+    quint8 m_availableCurrencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the currency the amount available is in.
+};
+
+#endif // LEDGERFUNDS_H
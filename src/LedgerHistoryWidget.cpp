@@ -0,0 +1,113 @@
+/*##################################################################################
+#   File name:          LedgerHistoryWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LedgerHistoryWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LedgerHistoryWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+LedgerHistoryWidget::LedgerHistoryWidget(const TransactionLedger *p_transactionLedger) : m_transactionLedger(p_transactionLedger)
+{
+    // Set the title and size of the LedgerHistoryWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(500, 400);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When a different day is chosen, display that day's history
+    connect(m_dateInput, SIGNAL(dateChanged(QDate)), this, SLOT(refreshHistory()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the LedgerHistoryWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+LedgerHistoryWidget::~LedgerHistoryWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_dateLabel);
+    deleteLabelIfNonNull(m_availableLabel);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the date edit was created successfully
+    if(m_dateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_dateInput;
+        m_dateInput = nullptr;
+    }
+
+    // If the transaction table widget was created successfully
+    if(m_transactionTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_transactionTableWidget;
+        m_transactionTableWidget = nullptr;
+    }
+}
+
+void LedgerHistoryWidget::initializeWidget()
+{
+    // Create the date label and associated date edit, initialized to today with a calendar for picking other days
+    m_dateLabel = new QLabel(this);
+    m_dateLabel->setText(m_DATE_LABEL_TEXT);
+    m_dateInput = new QDateEdit(this);
+    m_dateInput->setCalendarPopup(true);
+    m_dateInput->setDate(QDate::currentDate());
+
+    // Create the label displaying the reconstructed amount available
+    m_availableLabel = new QLabel(this);
+
+    // Create the read-only transaction table
+    m_transactionTableWidget = new QTableWidget(this);
+    m_transactionTableWidget->setColumnCount(m_TRANSACTION_TABLE_HEADER_STRING.split(";").size());
+    m_transactionTableWidget->setHorizontalHeaderLabels(m_TRANSACTION_TABLE_HEADER_STRING.split(";"));
+    m_transactionTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_transactionTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the Close button
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_dateLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_dateInput, 0, 1);
+    m_gridLayout->addWidget(m_availableLabel, 1, 0, 1, 2);
+    m_gridLayout->addWidget(m_transactionTableWidget, 2, 0, 1, 2);
+    m_gridLayout->addWidget(m_closeButton, 3, 1);
+}
+
+void LedgerHistoryWidget::refreshHistory()
+{
+    // Cover the whole of the selected day
+    QDate selectedDate = m_dateInput->date();
+    QDateTime startOfDay(selectedDate, QTime(0, 0));
+    QDateTime endOfDay(selectedDate, QTime(23, 59, 59, 999));
+
+    // Reconstruct the amount available at the end of the day from the closest earlier checkpoint
+    qint64 availableCents = m_transactionLedger->availableCentsAt(endOfDay);
+    m_availableLabel->setText(m_AVAILABLE_LABEL_TEXT + QString::number(availableCents / 100.0, 'f', 2));
+
+    // Retrieve the day's transactions
+    QVector<TransactionLedger::Transaction> dayTransactions = m_transactionLedger->transactionsBetween(startOfDay, endOfDay);
+    m_transactionTableWidget->setRowCount(dayTransactions.size());
+
+    // List each transaction in chronological order
+    for(int row = 0; row < dayTransactions.size(); row++)
+    {
+        const TransactionLedger::Transaction &transaction = dayTransactions.at(row);
+
+        m_transactionTableWidget->setItem(row, 0, new QTableWidgetItem(QDateTime::fromMSecsSinceEpoch(transaction.timestampMsecs).time().toString(m_TIME_STRING_FORMAT)));
+        m_transactionTableWidget->setItem(row, 1, new QTableWidgetItem(TransactionLedger::typeToString(transaction.type)));
+        m_transactionTableWidget->setItem(row, 2, new QTableWidgetItem(transaction.billKey));
+        m_transactionTableWidget->setItem(row, 3, new QTableWidgetItem(QString::number(transaction.amountCents / 100.0, 'f', 2)));
+        m_transactionTableWidget->setItem(row, 4, new QTableWidgetItem(QString::number(transaction.eventCount)));
+    }
+}
@@ -0,0 +1,81 @@
+/*##################################################################################
+#   File name:          LedgerHistoryWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LedgerHistoryWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LEDGERHISTORYWIDGET_H
+#define LEDGERHISTORYWIDGET_H
+
+// Local file includes
+#include "TransactionLedger.h"
+
+// Qt includes
+#include <QDateEdit>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The LedgerHistoryWidget class represents a pop-up window which shows the transactions recorded by the TransactionLedger on a chosen day, along with the amount that was available at the end of that day.
+ */
+class LedgerHistoryWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget displaying the history of a transaction ledger.
+     * @param p_transactionLedger - The ledger whose history is displayed, owned by the caller.
+     */
+    LedgerHistoryWidget(const TransactionLedger *p_transactionLedger);
+
+    /**
+     * @brief Destructs the LedgerHistoryWidget by deleting objects which were dynamically allocated.
+     */
+    ~LedgerHistoryWidget();
+
+public slots:
+
+    /**
+     * @brief Reconstructs the amount available at the end of the selected day and lists the day's transactions.
+     */
+    void refreshHistory();
+
+private:
+
+    /**
+     * @brief Creates the labels, date edit, table, and button of the LedgerHistoryWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Ledger History"; //!< Title of the LedgerHistoryWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the LedgerHistoryWidget.
+    const TransactionLedger *m_transactionLedger = nullptr; //!< The ledger whose history is displayed.
+
+    // Date selection fields
+    QLabel *m_dateLabel = nullptr; //!< Label for the date edit used for choosing the day to display.
+    const QString m_DATE_LABEL_TEXT = "Date:"; //!< Text for the label for the date edit.
+    QDateEdit *m_dateInput = nullptr; //!< The date edit used for choosing the day to display.
+
+    // Amount available fields
+    QLabel *m_availableLabel = nullptr; //!< Label displaying the amount available at the end of the selected day.
+    const QString m_AVAILABLE_LABEL_TEXT = "Available at end of day: $"; //!< Text preceding the reconstructed amount available.
+
+    // Transaction table fields
+    QTableWidget *m_transactionTableWidget = nullptr; //!< Table listing the transactions of the selected day.
+    const QString m_TRANSACTION_TABLE_HEADER_STRING = "Time;Type;Bill;Amount;Events"; //!< The transaction table column titles, separated by semicolons.
+    const QString m_TIME_STRING_FORMAT = "h:mm:ss AP"; //!< The format used to display the time of each transaction.
+
+    // Button and button text variables
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the LedgerHistoryWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // LEDGERHISTORYWIDGET_H
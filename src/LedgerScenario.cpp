@@ -0,0 +1,246 @@
+/*##################################################################################
+#   File name:          LedgerScenario.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LedgerScenario
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LedgerScenario.h"
+#include "CurrencyRegistry.h"
+
+#include <algorithm>
+
+LedgerScenario::LedgerScenario()
+    : m_baseLedger(QSharedPointer<BaseLedger>::create())
+{
+}
+
+LedgerScenario::LedgerScenario(const QString &p_name, const LedgerSnapshot &p_baseLedger)
+    : m_name(p_name)
+{
+    QSharedPointer<BaseLedger> baseLedger = QSharedPointer<BaseLedger>::create();
+    baseLedger->ledger = p_baseLedger;
+
+    // Total the base once, per currency so forks can convert with whatever rates are current when they are totalled
+    for(const Bill &bill : p_baseLedger.billMap)
+    {
+        if(bill.isFunded())
+        {
+            baseLedger->fundedBillCount++;
+        }
+        else
+        {
+            baseLedger->unfundedCentsByCurrency[bill.getCurrencyIndex()] += bill.getAmountDueCents();
+        }
+    }
+
+    m_baseLedger = baseLedger;
+}
+
+LedgerScenario LedgerScenario::fork(const QString &p_name) const
+{
+    // Every member is shared with this scenario until one of them changes
+    LedgerScenario scenario(*this);
+    scenario.m_name = p_name;
+    return scenario;
+}
+
+bool LedgerScenario::isBasedOn(const QMap<QString, Bill> &p_billMap, double p_totalAmountAvailable, const QString &p_availableCurrencyCode) const
+{
+    // A bill map which was changed since the base was taken no longer shares its data
+    return m_baseLedger->ledger.billMap.isSharedWith(p_billMap) && m_baseLedger->ledger.totalAmountAvailable == p_totalAmountAvailable
+           && m_baseLedger->ledger.availableCurrencyCode == p_availableCurrencyCode;
+}
+
+const QString& LedgerScenario::getName() const
+{
+    return m_name;
+}
+
+const LedgerSnapshot& LedgerScenario::getBaseLedger() const
+{
+    return m_baseLedger->ledger;
+}
+
+bool LedgerScenario::findBill(const QString &p_billKey, Bill &p_bill) const
+{
+    if(m_removedBillKeys.contains(p_billKey))
+    {
+        return false;
+    }
+
+    // Bills the scenario changed hide the base ledger's
+    QHash<QString, Bill>::const_iterator changedIterator = m_changedBills.constFind(p_billKey);
+
+    if(changedIterator != m_changedBills.cend())
+    {
+        p_bill = changedIterator.value();
+        return true;
+    }
+
+    QMap<QString, Bill>::const_iterator baseIterator = m_baseLedger->ledger.billMap.constFind(p_billKey);
+
+    if(baseIterator == m_baseLedger->ledger.billMap.cend())
+    {
+        return false;
+    }
+
+    p_bill = baseIterator.value();
+    return true;
+}
+
+void LedgerScenario::setBill(const QString &p_billKey, const Bill &p_bill)
+{
+    m_removedBillKeys.remove(p_billKey);
+    QMap<QString, Bill>::const_iterator baseIterator = m_baseLedger->ledger.billMap.constFind(p_billKey);
+
+    // Only keep bills which differ from the base, so changes which are undone leave nothing behind
+    if(baseIterator != m_baseLedger->ledger.billMap.cend() && baseIterator.value() == p_bill)
+    {
+        m_changedBills.remove(p_billKey);
+    }
+    else
+    {
+        m_changedBills.insert(p_billKey, p_bill);
+    }
+}
+
+bool LedgerScenario::removeBill(const QString &p_billKey, qint64 p_returnedCents)
+{
+    Bill removedBill;
+
+    if(!findBill(p_billKey, removedBill))
+    {
+        return false;
+    }
+
+    // Bills the scenario added are simply dropped, the base ledger's are hidden
+    m_changedBills.remove(p_billKey);
+
+    if(m_baseLedger->ledger.billMap.contains(p_billKey))
+    {
+        m_removedBillKeys.insert(p_billKey);
+    }
+
+    m_amountAvailableChangeCents += p_returnedCents;
+    return true;
+}
+
+bool LedgerScenario::setFundedStatus(const QString &p_billKey, bool p_isFunded, qint64 p_convertedCents)
+{
+    Bill bill;
+
+    if(!findBill(p_billKey, bill) || bill.isFunded() == p_isFunded)
+    {
+        return false;
+    }
+
+    bill.setFundedStatus(p_isFunded);
+    setBill(p_billKey, bill);
+    m_amountAvailableChangeCents += p_isFunded ? -p_convertedCents : p_convertedCents;
+    return true;
+}
+
+void LedgerScenario::adjustAmountAvailable(qint64 p_changeCents)
+{
+    m_amountAvailableChangeCents += p_changeCents;
+    m_adjustmentCents += p_changeCents;
+}
+
+qint64 LedgerScenario::getAmountAvailableChangeCents() const
+{
+    return m_amountAvailableChangeCents;
+}
+
+qint64 LedgerScenario::getAdjustmentCents() const
+{
+    return m_adjustmentCents;
+}
+
+int LedgerScenario::getChangeCount() const
+{
+    return m_changedBills.size() + m_removedBillKeys.size();
+}
+
+QVector<LedgerScenario::BillChange> LedgerScenario::diff() const
+{
+    QVector<BillChange> billChanges;
+    billChanges.reserve(getChangeCount());
+
+    for(QHash<QString, Bill>::const_iterator changedIterator = m_changedBills.cbegin(); changedIterator != m_changedBills.cend(); ++changedIterator)
+    {
+        BillChange billChange;
+        billChange.billKey = changedIterator.key();
+        billChange.kind = m_baseLedger->ledger.billMap.contains(changedIterator.key()) ? ChangedBill : AddedBill;
+        billChange.baseBill = m_baseLedger->ledger.billMap.value(changedIterator.key());
+        billChange.scenarioBill = changedIterator.value();
+        billChanges.append(billChange);
+    }
+
+    for(const QString &removedBillKey : m_removedBillKeys)
+    {
+        BillChange billChange;
+        billChange.billKey = removedBillKey;
+        billChange.kind = RemovedBill;
+        billChange.baseBill = m_baseLedger->ledger.billMap.value(removedBillKey);
+        billChanges.append(billChange);
+    }
+
+    // List the changes in the same order as the bill table
+    std::sort(billChanges.begin(), billChanges.end(), [](const BillChange &p_firstChange, const BillChange &p_secondChange)
+    {
+        return p_firstChange.billKey < p_secondChange.billKey;
+    });
+
+    return billChanges;
+}
+
+LedgerScenario::Totals LedgerScenario::totals(const ExchangeRateTable &p_exchangeRateTable) const
+{
+    Totals scenarioTotals;
+    QVector<qint64> unfundedCentsByCurrency = m_baseLedger->unfundedCentsByCurrency;
+    scenarioTotals.billCount = m_baseLedger->ledger.billMap.size();
+    scenarioTotals.fundedBillCount = m_baseLedger->fundedBillCount;
+    scenarioTotals.changeCount = getChangeCount();
+
+    // Counts a bill into the totals, or out of them with a sign of -1
+    auto countBill = [&scenarioTotals, &unfundedCentsByCurrency](const Bill &p_bill, int p_sign)
+    {
+        scenarioTotals.billCount += p_sign;
+
+        if(p_bill.isFunded())
+        {
+            scenarioTotals.fundedBillCount += p_sign;
+        }
+        else
+        {
+            unfundedCentsByCurrency[p_bill.getCurrencyIndex()] += p_sign * p_bill.getAmountDueCents();
+        }
+    };
+
+    // Swap the base ledger's version of each changed bill for the scenario's, and take removed bills out
+    for(QHash<QString, Bill>::const_iterator changedIterator = m_changedBills.cbegin(); changedIterator != m_changedBills.cend(); ++changedIterator)
+    {
+        QMap<QString, Bill>::const_iterator baseIterator = m_baseLedger->ledger.billMap.constFind(changedIterator.key());
+
+        if(baseIterator != m_baseLedger->ledger.billMap.cend())
+        {
+            countBill(baseIterator.value(), -1);
+        }
+
+        countBill(changedIterator.value(), 1);
+    }
+
+    for(const QString &removedBillKey : m_removedBillKeys)
+    {
+        countBill(m_baseLedger->ledger.billMap.value(removedBillKey), -1);
+    }
+
+    // Convert once per currency, as the left to fund label does
+    quint8 availableCurrencyIndex = CurrencyRegistry::indexForCode(m_baseLedger->ledger.availableCurrencyCode);
+    scenarioTotals.leftToFundCents = p_exchangeRateTable.convertTotals(unfundedCentsByCurrency, availableCurrencyIndex, &scenarioTotals.missingCurrencyCodes);
+    scenarioTotals.amountAvailable = m_baseLedger->ledger.totalAmountAvailable + m_amountAvailableChangeCents / 100.0;
+    return scenarioTotals;
+}
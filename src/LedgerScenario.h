@@ -0,0 +1,199 @@
+/*##################################################################################
+#   File name:          LedgerScenario.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LedgerScenario
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LEDGERSCENARIO_H
+#define LEDGERSCENARIO_H
+
+// Local file includes
+#include "ExchangeRateTable.h"
+#include "LedgerSnapshot.h"
+
+// Qt includes
+#include <QHash>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The LedgerScenario class is a what-if fork of the user's bills and funds, such as funding a few bills while a paycheck is late, which never touches the real ledger.
+ * Forks share the ledger they were taken from and only hold the bills they changed or removed, so forking a ledger of any size takes constant time and memory, and each fork is totalled from the base's totals plus its own changes.
+ */
+class LedgerScenario
+{
+
+public:
+
+    /**
+     * @brief The ChangeKind enum lists how a scenario's bill differs from the base ledger.
+     */
+    enum ChangeKind
+    {
+        AddedBill,
+        ChangedBill,
+        RemovedBill
+    };
+
+    /**
+     * @brief The BillChange struct is one bill which differs between a scenario and its base ledger.
+     */
+    struct BillChange
+    {
+        QString billKey; //!< The bill map key of the bill.
+        ChangeKind kind = ChangedBill; //!< How the bill differs.
+        Bill baseBill; //!< The bill as it is in the base ledger, default for added bills.
+        Bill scenarioBill; //!< The bill as it is in the scenario, default for removed bills.
+    };
+
+    /**
+     * @brief The Totals struct is what a scenario leaves the user with, in the currency of the amount available.
+     */
+    struct Totals
+    {
+        double amountAvailable = 0.00; //!< The amount available once the scenario's funding and adjustments are made.
+        qint64 leftToFundCents = 0; //!< The amount due of the unfunded bills.
+        int billCount = 0; //!< The number of bills.
+        int fundedBillCount = 0; //!< The number of funded bills.
+        int changeCount = 0; //!< The number of bills which differ from the base ledger.
+        QStringList missingCurrencyCodes; //!< The currencies left out of the left to fund total for lack of a rate.
+    };
+
+    /**
+     * @brief Constructs a scenario of an empty ledger.
+     */
+    LedgerScenario();
+
+    /**
+     * @brief Constructs a scenario without changes from a ledger, which is totalled once here so that every fork of the scenario is totalled from its changes alone.
+     * The ledger's bill map is shared rather than copied.
+     * @param p_name - The name of the scenario.
+     * @param p_baseLedger - The ledger the scenario starts from.
+     */
+    LedgerScenario(const QString &p_name, const LedgerSnapshot &p_baseLedger);
+
+    /**
+     * @brief Forks the scenario, sharing its base ledger and its changes until either side changes again.
+     * @param p_name - The name of the fork.
+     * @return The fork.
+     */
+    LedgerScenario fork(const QString &p_name) const;
+
+    /**
+     * @brief Checks whether the scenario was taken from the bills and funds given, and they have not changed since.
+     * @param p_billMap - The bills.
+     * @param p_totalAmountAvailable - The amount available.
+     * @param p_availableCurrencyCode - The currency of the amount available.
+     * @return True if the scenario's base ledger still shares the bill map and holds the same funds.
+     */
+    bool isBasedOn(const QMap<QString, Bill> &p_billMap, double p_totalAmountAvailable, const QString &p_availableCurrencyCode) const;
+
+    /**
+     * @brief Returns the name of the scenario.
+     * @return The name.
+     */
+    const QString& getName() const;
+
+    /**
+     * @brief Returns the ledger the scenario was forked from.
+     * @return The base ledger.
+     */
+    const LedgerSnapshot& getBaseLedger() const;
+
+    /**
+     * @brief Looks a bill up as it is in the scenario.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - Set to the bill if it is found.
+     * @return False if the bill is not in the scenario.
+     */
+    bool findBill(const QString &p_billKey, Bill &p_bill) const;
+
+    /**
+     * @brief Adds or changes a bill in the scenario. A bill changed back to how it is in the base ledger no longer counts as a change.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     */
+    void setBill(const QString &p_billKey, const Bill &p_bill);
+
+    /**
+     * @brief Removes a bill from the scenario, returning its funds.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_returnedCents - The amount added back to the amount available, zero for unfunded bills.
+     * @return False if the bill is not in the scenario.
+     */
+    bool removeBill(const QString &p_billKey, qint64 p_returnedCents);
+
+    /**
+     * @brief Funds or defunds a bill in the scenario, moving its amount due out of or back into the amount available.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_isFunded - Whether the bill should be funded.
+     * @param p_convertedCents - The bill's amount due in the currency of the amount available.
+     * @return False if the bill is not in the scenario or already has the funding status.
+     */
+    bool setFundedStatus(const QString &p_billKey, bool p_isFunded, qint64 p_convertedCents);
+
+    /**
+     * @brief Adds to or takes from the amount available, such as holding back a paycheck which has not arrived.
+     * @param p_changeCents - The amount added, negative to take it away.
+     */
+    void adjustAmountAvailable(qint64 p_changeCents);
+
+    /**
+     * @brief Returns how much the scenario changed the amount available by, through funding, removed bills, and adjustments.
+     * @return The change in cents, in the currency of the amount available.
+     */
+    qint64 getAmountAvailableChangeCents() const;
+
+    /**
+     * @brief Returns how much was added to or taken from the amount available by adjustAmountAvailable(), leaving out funding and removed bills.
+     * @return The adjustments in cents, in the currency of the amount available.
+     */
+    qint64 getAdjustmentCents() const;
+
+    /**
+     * @brief Returns the number of bills which differ from the base ledger.
+     * @return The number of added, changed, and removed bills.
+     */
+    int getChangeCount() const;
+
+    /**
+     * @brief Lists how the scenario's bills differ from the base ledger.
+     * @return The differing bills, in bill map key order.
+     */
+    QVector<BillChange> diff() const;
+
+    /**
+     * @brief Totals the scenario from the base ledger's totals and the scenario's changes, so the time taken grows with the changes rather than the bills.
+     * @param p_exchangeRateTable - The exchange rates used to convert the unfunded bills into the currency of the amount available.
+     * @return The totals.
+     */
+    Totals totals(const ExchangeRateTable &p_exchangeRateTable) const;
+
+private:
+
+    /**
+     * @brief The BaseLedger struct is a ledger scenarios are forked from, together with its totals per currency.
+     */
+    struct BaseLedger
+    {
+        LedgerSnapshot ledger; //!< The bills and funds.
+        QVector<qint64> unfundedCentsByCurrency = QVector<qint64>(CurrencyRegistry::m_MAX_CURRENCY_COUNT, 0); //!< The amount due of the unfunded bills, indexed by currency.
+        int fundedBillCount = 0; //!< The number of funded bills.
+    };
+
+    QSharedPointer<const BaseLedger> m_baseLedger; //!< The ledger the scenario was forked from, shared by every fork of it.
+    QString m_name; //!< The name of the scenario.
+    QHash<QString, Bill> m_changedBills; //!< The bills the scenario added or changed, keyed by bill map key.
+    QSet<QString> m_removedBillKeys; //!< The bill map keys of the base ledger's bills the scenario removed.
+    qint64 m_amountAvailableChangeCents = 0; //!< How much the scenario changed the amount available by, in cents.
+    qint64 m_adjustmentCents = 0; //!< How much of the change to the amount available was adjustments, in cents.
+
+};
+
+#endif // LEDGERSCENARIO_H
@@ -0,0 +1,41 @@
+/*##################################################################################
+#   File name:          LedgerSnapshot.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LedgerSnapshot
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LEDGERSNAPSHOT_H
+#define LEDGERSNAPSHOT_H
+
+// Local file includes
+#include "Bill.h"
+
+// Qt includes
+#include <QList>
+#include <QMap>
+#include <QMetaType>
+#include <QString>
+
+/**
+ * @brief The LedgerSnapshot struct is a self-contained copy of the user's bills and funds, handed between the GUI thread and background jobs which load or save the config file.
+ * The bill map is implicitly shared, so taking a snapshot is cheap until one side modifies its copy.
+ */
+struct LedgerSnapshot
+{
+    QMap<QString, Bill> billMap; //!< Map which stores (key, value) pairs of (the names of bills, corresponding bill objects).
+    QList<QString> fundedBillsList; //!< List which holds the currently funded bills.
+    double totalAmountAvailable = 0.00; //!< The total amount of money the user has available.
+    QString availableCurrencyCode = CurrencyRegistry::defaultCurrencyCode(); //!< The code of the currency the total amount available is held in.
+    quint64 version = 0; //!< The version stamp of the config file the snapshot was loaded from or saved as, which every save increments.
+    bool isConfigReadable = true; //!< Whether or not the config file could be opened.
+    int invalidKeyCount = 0; //!< The number of keys in the config file which were not in "Group label/key" format.
+    QList<QString> repeatedBillKeys; //!< The keys of bills which appeared in more than one section of the config file, whose sections were merged.
+    QList<QString> outOfRangeBillKeys; //!< The keys of bills whose amount due is too large for a Bill to hold, which were left out of the bill map.
+};
+
+Q_DECLARE_METATYPE(LedgerSnapshot)
+
+#endif // LEDGERSNAPSHOT_H
@@ -0,0 +1,1008 @@
+/*##################################################################################
+#   File name:          LedgerStore.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LedgerStore
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LedgerStore.h"
+#include "CategoryRollup.h"
+#include "ConfigFileReader.h"
+#include "CurrencyRegistry.h"
+#include "LedgerFunds.h"
+#include "Profiler.h"
+
+#include <QFile>
+#include <QFuture>
+#include <QLockFile>
+#include <QSaveFile>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Merges one field changed on two sides since a baseline, keeping whichever side changed it and this side's value if both did.
+     * @param p_baseValue - The field as of the baseline.
+     * @param p_ourValue - The field as this side has it.
+     * @param p_theirValue - The field as the other side has it.
+     * @param p_isConflicting - Set to true if both sides changed the field to different values.
+     * @return The merged field.
+     */
+    template <typename Value>
+    Value mergeField(const Value &p_baseValue, const Value &p_ourValue, const Value &p_theirValue, bool &p_isConflicting)
+    {
+        if(p_ourValue == p_baseValue)
+        {
+            return p_theirValue;
+        }
+
+        p_isConflicting = p_isConflicting || (p_theirValue != p_baseValue && p_theirValue != p_ourValue);
+        return p_ourValue;
+    }
+}
+
+LedgerStore::LedgerStore(const QString &p_configFilePath)
+    : m_configFilePath(p_configFilePath)
+{
+}
+
+QString LedgerStore::getConfigFilePath() const
+{
+    return m_configFilePath;
+}
+
+LedgerSnapshot LedgerStore::load(JobContext *p_jobContext) const
+{
+    LedgerSnapshot loadedLedger;
+
+    // Attempt to read the pre-existing config file in one go, a missing config file reads as an empty one
+    Profiler::Scope configOpenScope(m_PROFILE_CONFIG_OPEN_PHASE);
+    QByteArray configFileContents;
+
+    // If attempting to open the config file resulted in an error, let the caller alert the user
+    if(!readConfigFileContents(configFileContents))
+    {
+        loadedLedger.isConfigReadable = false;
+        return loadedLedger;
+    }
+
+    configOpenScope.stop();
+
+    // Profile the parsing separately from opening the file
+    Profiler::Scope parseScope(m_PROFILE_PARSE_PHASE);
+
+    // Split the config file at section headers into one chunk per core, but only as many chunks as the file is large enough for
+    int chunkCount = std::max(1, std::min(QThread::idealThreadCount(), static_cast<int>(configFileContents.size() / m_MIN_BYTES_PER_LOAD_CHUNK)));
+    QVector<int> chunkBoundaries = ConfigFileReader::findChunkBoundaries(configFileContents, chunkCount);
+    std::vector<std::unique_ptr<LoadChunk>> loadChunks;
+
+    // Each chunk decodes its entries and stages its bills in its own arena sized from the chunk, so a chunk is usually served by one block and makes almost no allocations per bill
+    for(int chunkIndex = 0; chunkIndex + 1 < chunkBoundaries.size(); chunkIndex++)
+    {
+        size_t arenaBlockSize = static_cast<size_t>(chunkBoundaries.at(chunkIndex + 1) - chunkBoundaries.at(chunkIndex)) * m_LOAD_ARENA_BYTES_PER_FILE_BYTE;
+        loadChunks.push_back(std::make_unique<LoadChunk>(chunkBoundaries.at(chunkIndex), chunkBoundaries.at(chunkIndex + 1), arenaBlockSize));
+    }
+
+    auto parseChunk = [this, &configFileContents, p_jobContext](std::unique_ptr<LoadChunk> &p_loadChunk)
+    {
+        parseConfigChunk(configFileContents, *p_loadChunk, p_jobContext);
+    };
+
+    // A small config file is read on the calling thread, larger ones are read by workers, concurrently when split, while the calling thread reports their progress
+    if(loadChunks.size() == 1 && configFileContents.size() < m_MIN_BYTES_PER_LOAD_CHUNK)
+    {
+        parseChunk(loadChunks.front());
+    }
+    else
+    {
+        QFuture<void> parseFuture = QtConcurrent::map(loadChunks, parseChunk);
+
+        while(!parseFuture.isFinished())
+        {
+            qint64 bytesRead = 0;
+
+            for(const std::unique_ptr<LoadChunk> &loadChunk : loadChunks)
+            {
+                bytesRead += static_cast<qint64>(loadChunk->endByteIndex - loadChunk->firstByteIndex) * loadChunk->percentRead.load(std::memory_order_relaxed) / 100;
+            }
+
+            if(p_jobContext != nullptr)
+            {
+                p_jobContext->reportProgress(static_cast<int>(100 * bytesRead / std::max<qint64>(configFileContents.size(), 1)), m_LOAD_STATUS_TEXT);
+            }
+
+            QThread::msleep(m_LOAD_PROGRESS_INTERVAL_MSECS);
+        }
+
+        parseFuture.waitForFinished();
+    }
+
+    // Stop early if a newer read was requested
+    if(p_jobContext != nullptr && p_jobContext->isCancelled())
+    {
+        return LedgerSnapshot();
+    }
+
+    // Combine the chunks in file order, so later sections win exactly as if the file had been read from start to end
+    QVector<StagedLedger*> stagedLedgers;
+
+    for(const std::unique_ptr<LoadChunk> &loadChunk : loadChunks)
+    {
+        // If a line of the config file was malformed, let the caller alert the user as it would for a file which cannot be opened
+        if(loadChunk->hasFormatError)
+        {
+            loadedLedger.isConfigReadable = false;
+            return loadedLedger;
+        }
+
+        if(loadChunk->hasAvailableCurrency)
+        {
+            loadedLedger.availableCurrencyCode = loadChunk->partialLedger.availableCurrencyCode;
+        }
+
+        if(loadChunk->hasTotalAmountAvailable)
+        {
+            loadedLedger.totalAmountAvailable = loadChunk->partialLedger.totalAmountAvailable;
+        }
+
+        if(loadChunk->hasVersion)
+        {
+            loadedLedger.version = loadChunk->partialLedger.version;
+        }
+
+        loadedLedger.invalidKeyCount += loadChunk->partialLedger.invalidKeyCount;
+        stagedLedgers.append(&loadChunk->stagedLedger);
+    }
+
+    // Merge each chunk's bills into the bill map and funded bills list, noting bills which appeared in more than one section
+    StagedLedger::mergeInto(stagedLedgers, loadedLedger);
+    return loadedLedger;
+}
+
+LedgerStore::SaveResult LedgerStore::save(const LedgerSnapshot &p_ledgerToSave, const LedgerSnapshot &p_baseLedger, const ExchangeRateTable &p_exchangeRateTable, JobContext *p_jobContext) const
+{
+    Profiler::Scope profileScope(m_PROFILE_SAVE_WRITE_PHASE);
+    SaveResult saveResult;
+    saveResult.savedLedger = p_ledgerToSave;
+
+    // Hold the config file's lock while it is read, merged, and written, so another instance cannot save in between
+    QLockFile configLock(m_configFilePath + m_LOCK_FILE_SUFFIX);
+
+    if(!configLock.tryLock(m_LOCK_TIMEOUT_MSECS))
+    {
+        saveResult.isLockTimedOut = true;
+        return saveResult;
+    }
+
+    // If the config file cannot be read, let the caller alert the user
+    QByteArray configFileContents;
+
+    if(!readConfigFileContents(configFileContents))
+    {
+        return saveResult;
+    }
+
+    // Leave the config file untouched if the save was cancelled before it started writing, so it still holds the baseline
+    if(p_jobContext != nullptr && p_jobContext->isCancelled())
+    {
+        saveResult.isCancelled = true;
+        saveResult.savedLedger = p_baseLedger;
+        return saveResult;
+    }
+
+    // Read the version stamp and funds information the config file holds now, parsing only that section
+    QVector<ConfigSectionIndex::SectionSpan> sectionSpans = ConfigSectionIndex::splitSections(configFileContents);
+    double storedAmountAvailable = p_baseLedger.totalAmountAvailable;
+    QString storedCurrencyCode = p_baseLedger.availableCurrencyCode;
+    quint64 storedVersion = 0;
+    bool hasFundsInformationSection = false;
+
+    for(const ConfigSectionIndex::SectionSpan &sectionSpan : sectionSpans)
+    {
+        if(isFundsInformationGroup(sectionSpan.groupLabel))
+        {
+            QHash<QString, QString> fundsValues = ConfigSectionIndex::parseSection(configFileContents, sectionSpan);
+            readFundsInformation(fundsValues, storedAmountAvailable, storedCurrencyCode);
+            storedVersion = readVersion(fundsValues);
+            hasFundsInformationSection = true;
+        }
+    }
+
+    // The bills which differ from the baseline are this save's changes, found in one pass over both bill maps since they are in key order
+    QMap<QString, Bill> ourChangedBills;
+    QSet<QString> ourRemovedBillKeys;
+    QMap<QString, Bill>::const_iterator ourBillIterator = p_ledgerToSave.billMap.cbegin();
+    QMap<QString, Bill>::const_iterator baseBillIterator = p_baseLedger.billMap.cbegin();
+
+    while(ourBillIterator != p_ledgerToSave.billMap.cend() || baseBillIterator != p_baseLedger.billMap.cend())
+    {
+        if(baseBillIterator == p_baseLedger.billMap.cend() || (ourBillIterator != p_ledgerToSave.billMap.cend() && ourBillIterator.key() < baseBillIterator.key()))
+        {
+            ourChangedBills.insert(ourBillIterator.key(), ourBillIterator.value());
+            ++ourBillIterator;
+        }
+        else if(ourBillIterator == p_ledgerToSave.billMap.cend() || baseBillIterator.key() < ourBillIterator.key())
+        {
+            ourRemovedBillKeys.insert(baseBillIterator.key());
+            ++baseBillIterator;
+        }
+        else
+        {
+            if(!haveSameSavedValues(ourBillIterator.value(), baseBillIterator.value()))
+            {
+                ourChangedBills.insert(ourBillIterator.key(), ourBillIterator.value());
+            }
+
+            ++ourBillIterator;
+            ++baseBillIterator;
+        }
+    }
+
+    QMap<QString, Bill> rewrittenBills = ourChangedBills;
+    QSet<QString> removedBillKeys = ourRemovedBillKeys;
+    double savedAmountAvailable = p_ledgerToSave.totalAmountAvailable;
+    QString savedCurrencyCode = p_ledgerToSave.availableCurrencyCode;
+
+    // If another instance saved since the baseline, merge its changes rather than overwriting them
+    if(storedVersion != p_baseLedger.version)
+    {
+        // Find the bills it changed, only parsing the sections whose text is not what the baseline would write
+        QMap<QString, Bill> theirChangedBills;
+        QSet<QString> storedBillKeys;
+
+        for(const ConfigSectionIndex::SectionSpan &sectionSpan : sectionSpans)
+        {
+            if(isFundsInformationGroup(sectionSpan.groupLabel))
+            {
+                continue;
+            }
+
+            storedBillKeys.insert(sectionSpan.groupLabel);
+            QMap<QString, Bill>::const_iterator baseSectionBillIterator = p_baseLedger.billMap.constFind(sectionSpan.groupLabel);
+
+            if(baseSectionBillIterator != p_baseLedger.billMap.cend() && isSectionUnchanged(configFileContents, sectionSpan, encodeBillSection(sectionSpan.groupLabel, baseSectionBillIterator.value())))
+            {
+                continue;
+            }
+
+            // Bills whose amount due is too large to hold were left out when loaded, so they are left in the file as they are rather than merged clamped
+            QHash<QString, QString> sectionValues = ConfigSectionIndex::parseSection(configFileContents, sectionSpan);
+
+            if(!isAmountDueInRange(sectionValues))
+            {
+                continue;
+            }
+
+            // Keep the name the bill is displayed with, which the config file does not hold
+            Bill storedBill = readBill(sectionSpan.groupLabel, sectionValues);
+            QMap<QString, Bill>::const_iterator ourSectionBillIterator = p_ledgerToSave.billMap.constFind(sectionSpan.groupLabel);
+
+            if(ourSectionBillIterator != p_ledgerToSave.billMap.cend() || baseSectionBillIterator != p_baseLedger.billMap.cend())
+            {
+                storedBill.setName(ourSectionBillIterator != p_ledgerToSave.billMap.cend() ? ourSectionBillIterator->getName() : baseSectionBillIterator->getName());
+            }
+
+            if(baseSectionBillIterator == p_baseLedger.billMap.cend() || !haveSameSavedValues(storedBill, baseSectionBillIterator.value()))
+            {
+                theirChangedBills.insert(sectionSpan.groupLabel, storedBill);
+            }
+        }
+
+        // Resolve each bill changed here against the other instance's changes
+        for(QMap<QString, Bill>::const_iterator changedBillIterator = ourChangedBills.cbegin(); changedBillIterator != ourChangedBills.cend(); ++changedBillIterator)
+        {
+            const QString &billKey = changedBillIterator.key();
+            QMap<QString, Bill>::const_iterator theirBillIterator = theirChangedBills.constFind(billKey);
+
+            // A bill edited here and deleted there is kept as edited
+            if(p_baseLedger.billMap.contains(billKey) && !storedBillKeys.contains(billKey))
+            {
+                saveResult.conflictingBillKeys.append(billKey);
+            }
+
+            // A bill changed differently on both sides is merged field by field, bills added under the same key on both sides keep this side's fields
+            else if(theirBillIterator != theirChangedBills.cend() && !haveSameSavedValues(changedBillIterator.value(), theirBillIterator.value()))
+            {
+                bool isConflicting = !p_baseLedger.billMap.contains(billKey);
+                Bill mergedBill = isConflicting ? changedBillIterator.value() : mergeBill(p_baseLedger.billMap.value(billKey), changedBillIterator.value(), theirBillIterator.value(), isConflicting);
+
+                if(isConflicting)
+                {
+                    saveResult.conflictingBillKeys.append(billKey);
+                }
+
+                if(!haveSameSavedValues(mergedBill, changedBillIterator.value()))
+                {
+                    saveResult.savedLedger.billMap.insert(billKey, mergedBill);
+                    saveResult.mergedBillKeys.append(billKey);
+                }
+
+                rewrittenBills.insert(billKey, mergedBill);
+            }
+        }
+
+        // A bill deleted here and edited there is kept as edited
+        for(const QString &billKey : ourRemovedBillKeys)
+        {
+            QMap<QString, Bill>::const_iterator theirBillIterator = theirChangedBills.constFind(billKey);
+
+            if(theirBillIterator != theirChangedBills.cend())
+            {
+                removedBillKeys.remove(billKey);
+                saveResult.savedLedger.billMap.insert(billKey, theirBillIterator.value());
+                saveResult.mergedBillKeys.append(billKey);
+                saveResult.conflictingBillKeys.append(billKey);
+            }
+        }
+
+        // Bills only the other instance changed are left as it wrote them
+        for(QMap<QString, Bill>::const_iterator theirBillIterator = theirChangedBills.cbegin(); theirBillIterator != theirChangedBills.cend(); ++theirBillIterator)
+        {
+            if(!ourChangedBills.contains(theirBillIterator.key()) && !ourRemovedBillKeys.contains(theirBillIterator.key()))
+            {
+                saveResult.savedLedger.billMap.insert(theirBillIterator.key(), theirBillIterator.value());
+                saveResult.mergedBillKeys.append(theirBillIterator.key());
+            }
+        }
+
+        // Bills only the other instance deleted stay deleted
+        for(QMap<QString, Bill>::const_iterator remainingBaseBillIterator = p_baseLedger.billMap.cbegin(); remainingBaseBillIterator != p_baseLedger.billMap.cend(); ++remainingBaseBillIterator)
+        {
+            if(!storedBillKeys.contains(remainingBaseBillIterator.key()) && !ourChangedBills.contains(remainingBaseBillIterator.key()) && !ourRemovedBillKeys.contains(remainingBaseBillIterator.key()))
+            {
+                saveResult.savedLedger.billMap.remove(remainingBaseBillIterator.key());
+                saveResult.mergedRemovedBillKeys.append(remainingBaseBillIterator.key());
+            }
+        }
+
+        // Funding, defunding, and deleting bills move their amounts out of and back into the amount available, so only the other instance's deposits are added as they are
+        // and the bills' share is worked out again from the merged bills, since funding the same bill on both sides sets its amount aside once
+        quint8 availableCurrencyIndex = CurrencyRegistry::indexForCode(p_ledgerToSave.availableCurrencyCode);
+        qint64 theirDepositCents = std::llround(storedAmountAvailable * 100.0) - std::llround(p_baseLedger.totalAmountAvailable * 100.0);
+        qint64 mergedFundingChangeCents = 0;
+        QSet<QString> fundingBillKeys = ourRemovedBillKeys;
+
+        for(QMap<QString, Bill>::const_iterator changedBillIterator = ourChangedBills.cbegin(); changedBillIterator != ourChangedBills.cend(); ++changedBillIterator)
+        {
+            fundingBillKeys.insert(changedBillIterator.key());
+        }
+
+        for(QMap<QString, Bill>::const_iterator theirBillIterator = theirChangedBills.cbegin(); theirBillIterator != theirChangedBills.cend(); ++theirBillIterator)
+        {
+            fundingBillKeys.insert(theirBillIterator.key());
+        }
+
+        for(QMap<QString, Bill>::const_iterator baseBillIterator = p_baseLedger.billMap.cbegin(); baseBillIterator != p_baseLedger.billMap.cend(); ++baseBillIterator)
+        {
+            if(!storedBillKeys.contains(baseBillIterator.key()))
+            {
+                fundingBillKeys.insert(baseBillIterator.key());
+            }
+        }
+
+        for(const QString &billKey : fundingBillKeys)
+        {
+            qint64 baseFundedCents = fundedCents(p_baseLedger.billMap, billKey, availableCurrencyIndex, p_exchangeRateTable);
+            qint64 theirFundedCents = theirChangedBills.contains(billKey) ? fundedCents(theirChangedBills, billKey, availableCurrencyIndex, p_exchangeRateTable)
+                                                                           : storedBillKeys.contains(billKey) ? baseFundedCents : 0;
+
+            theirDepositCents += theirFundedCents - baseFundedCents;
+            mergedFundingChangeCents += fundedCents(saveResult.savedLedger.billMap, billKey, availableCurrencyIndex, p_exchangeRateTable)
+                                        - fundedCents(p_ledgerToSave.billMap, billKey, availableCurrencyIndex, p_exchangeRateTable);
+        }
+
+        // The amount available is this save's, plus the other instance's deposits, less whatever the merge funded beyond this save's bills, and a changed currency is adopted unless it was changed here too
+        qint64 mergedAmountAvailableChangeCents = theirDepositCents - mergedFundingChangeCents;
+        saveResult.mergedAmountAvailableChange = mergedAmountAvailableChangeCents / 100.0;
+        savedAmountAvailable = (std::llround(p_ledgerToSave.totalAmountAvailable * 100.0) + mergedAmountAvailableChangeCents) / 100.0;
+
+        if(p_ledgerToSave.availableCurrencyCode == p_baseLedger.availableCurrencyCode)
+        {
+            savedCurrencyCode = storedCurrencyCode;
+        }
+    }
+
+    // Splice the rewritten sections into the config file's text, copying every other section as it is
+    quint64 savedVersion = std::max(storedVersion, p_baseLedger.version) + 1;
+    QByteArray fundsInformationSection = encodeFundsInformationSection(savedAmountAvailable, savedCurrencyCode, savedVersion);
+    QByteArrayView configFileView(configFileContents);
+    QByteArray updatedContents;
+    QSet<QString> writtenBillKeys;
+    int sectionsWritten = 0;
+    updatedContents.reserve(configFileContents.size() + fundsInformationSection.size());
+    updatedContents.append(configFileView.first(sectionSpans.isEmpty() ? configFileContents.size() : sectionSpans.first().headerStart));
+
+    if(!hasFundsInformationSection)
+    {
+        appendSection(updatedContents, fundsInformationSection);
+    }
+
+    for(const ConfigSectionIndex::SectionSpan &sectionSpan : sectionSpans)
+    {
+        QMap<QString, Bill>::const_iterator rewrittenBillIterator = rewrittenBills.constFind(sectionSpan.groupLabel);
+
+        // The funds information is written once with the new version stamp
+        if(isFundsInformationGroup(sectionSpan.groupLabel))
+        {
+            if(hasFundsInformationSection)
+            {
+                appendSection(updatedContents, fundsInformationSection);
+                hasFundsInformationSection = false;
+            }
+        }
+
+        // Changed bills are written once in place of their first section, deleted bills are left out
+        else if(rewrittenBillIterator != rewrittenBills.cend() && !writtenBillKeys.contains(sectionSpan.groupLabel))
+        {
+            appendSection(updatedContents, encodeBillSection(sectionSpan.groupLabel, rewrittenBillIterator.value()));
+            writtenBillKeys.insert(sectionSpan.groupLabel);
+        }
+        else if(rewrittenBillIterator == rewrittenBills.cend() && !removedBillKeys.contains(sectionSpan.groupLabel))
+        {
+            appendSection(updatedContents, configFileView.sliced(sectionSpan.headerStart, sectionSpan.bodyEnd - sectionSpan.headerStart));
+        }
+
+        // Report how far through the sections the save is
+        sectionsWritten++;
+
+        if(p_jobContext != nullptr)
+        {
+            p_jobContext->reportProgress(static_cast<int>(100 * sectionsWritten / (sectionSpans.size() + 1)), m_SAVE_STATUS_TEXT);
+        }
+    }
+
+    // Bills added since the baseline follow the sections already in the file
+    for(QMap<QString, Bill>::const_iterator rewrittenBillIterator = rewrittenBills.cbegin(); rewrittenBillIterator != rewrittenBills.cend(); ++rewrittenBillIterator)
+    {
+        if(!writtenBillKeys.contains(rewrittenBillIterator.key()))
+        {
+            appendSection(updatedContents, encodeBillSection(rewrittenBillIterator.key(), rewrittenBillIterator.value()));
+        }
+    }
+
+    saveResult.isWritten = writeConfigFileContents(updatedContents);
+    saveResult.savedLedger.totalAmountAvailable = savedAmountAvailable;
+    saveResult.savedLedger.availableCurrencyCode = savedCurrencyCode;
+    saveResult.savedLedger.version = savedVersion;
+
+    // Total what was written while still off the GUI thread, for the balance history
+    if(saveResult.isWritten)
+    {
+        LedgerFunds savedLedgerFunds(p_exchangeRateTable, CurrencyRegistry::indexForCode(savedCurrencyCode));
+        saveResult.balanceSnapshot = savedLedgerFunds.balanceSnapshot(saveResult.savedLedger.billMap, std::llround(savedAmountAvailable * 100.0), &saveResult.missingRateCurrencyCodes);
+    }
+
+    return saveResult;
+}
+
+bool LedgerStore::replace(const LedgerSnapshot &p_ledgerToSave) const
+{
+    Profiler::Scope profileScope(m_PROFILE_SAVE_WRITE_PHASE);
+
+    // Hold the config file's lock while it is written, as a save does
+    QLockFile configLock(m_configFilePath + m_LOCK_FILE_SUFFIX);
+    QByteArray configFileContents;
+
+    if(!configLock.tryLock(m_LOCK_TIMEOUT_MSECS) || !readConfigFileContents(configFileContents))
+    {
+        return false;
+    }
+
+    // Only the stored version stamp is read, so the new contents still get a newer one and every other instance merges against them
+    quint64 storedVersion = 0;
+
+    for(const ConfigSectionIndex::SectionSpan &sectionSpan : ConfigSectionIndex::splitSections(configFileContents))
+    {
+        if(isFundsInformationGroup(sectionSpan.groupLabel))
+        {
+            storedVersion = readVersion(ConfigSectionIndex::parseSection(configFileContents, sectionSpan));
+        }
+    }
+
+    QByteArray replacedContents = encodeFundsInformationSection(p_ledgerToSave.totalAmountAvailable, p_ledgerToSave.availableCurrencyCode, std::max(storedVersion, p_ledgerToSave.version) + 1);
+
+    for(QMap<QString, Bill>::const_iterator billMapIterator = p_ledgerToSave.billMap.cbegin(); billMapIterator != p_ledgerToSave.billMap.cend(); ++billMapIterator)
+    {
+        appendSection(replacedContents, encodeBillSection(billMapIterator.key(), billMapIterator.value()));
+    }
+
+    return writeConfigFileContents(replacedContents);
+}
+
+bool LedgerStore::remove() const
+{
+    // Wait for any save holding the lock, a save which takes it afterwards sees it was cancelled before writing
+    QLockFile configLock(m_configFilePath + m_LOCK_FILE_SUFFIX);
+
+    if(!configLock.tryLock(m_LOCK_TIMEOUT_MSECS))
+    {
+        return false;
+    }
+
+    return QFile::remove(m_configFilePath);
+}
+
+Bill LedgerStore::readBill(const QString &p_billKey, const QHash<QString, QString> &p_sectionValues) const
+{
+    Bill sectionBill;
+
+    // Bills loaded from the config file are named after their group label, as when the file is first read
+    sectionBill.setName(p_billKey);
+    sectionBill.setAmountDue(p_sectionValues.value(m_BILL_AMOUNT_DUE_KEY).toDouble());
+    sectionBill.setDueDate(parseDate(p_sectionValues.value(m_BILL_DUE_DATE_KEY)));
+    sectionBill.setCurrencyCode(p_sectionValues.value(m_CURRENCY_KEY));
+    sectionBill.setCategory(p_sectionValues.value(m_BILL_CATEGORY_KEY).trimmed());
+    sectionBill.setTags(CategoryRollup::splitTags(p_sectionValues.value(m_BILL_TAGS_KEY)));
+    sectionBill.setFundedStatus(fundingStatusFromString(p_sectionValues.value(m_BILL_FUNDING_STATUS_KEY)));
+    return sectionBill;
+}
+
+bool LedgerStore::isAmountDueInRange(const QHash<QString, QString> &p_sectionValues) const
+{
+    // Sections without an amount due read as zero, as in readBill
+    return Bill::isAmountDueInRange(p_sectionValues.value(m_BILL_AMOUNT_DUE_KEY).toDouble());
+}
+
+void LedgerStore::readFundsInformation(const QHash<QString, QString> &p_sectionValues, double &p_totalAmountAvailable, QString &p_availableCurrencyCode) const
+{
+    // Config files without a currency are in the default currency
+    QString currencyCode = CurrencyRegistry::normalizeCode(p_sectionValues.value(m_CURRENCY_KEY));
+    p_availableCurrencyCode = currencyCode.isEmpty() ? CurrencyRegistry::defaultCurrencyCode() : currencyCode;
+    p_totalAmountAvailable = p_sectionValues.value(m_TOTAL_FUNDS_AVAILABLE_KEY).toDouble();
+}
+
+quint64 LedgerStore::readVersion(const QHash<QString, QString> &p_sectionValues) const
+{
+    // Config files saved before version stamps were added read as version zero
+    return p_sectionValues.value(m_VERSION_KEY).toULongLong();
+}
+
+bool LedgerStore::isFundsInformationGroup(QStringView p_groupLabel) const
+{
+    return p_groupLabel == m_FUNDS_INFORMATION_GROUP_LABEL;
+}
+
+QString LedgerStore::billKeyForName(const QString &p_billName) const
+{
+    // Convert the input string to a format in which characters can be replaced
+    QString noSpaces = p_billName.simplified();
+
+    // Return the string with spaces removed
+    return noSpaces.replace(" ", "");
+}
+
+QString LedgerStore::fundingStatusToString(bool p_isBillFunded) const
+{
+    // If the bill has been funded, return the funded string, otherwise return the not funded string
+    return p_isBillFunded ? m_FUNDED_STRING : m_NOT_FUNDED_STRING;
+}
+
+bool LedgerStore::fundingStatusFromString(QStringView p_fundingStatus) const
+{
+    // If the bill has a funding status of "Funded", return true, otherwise return false
+    return p_fundingStatus == m_FUNDED_STRING;
+}
+
+QDate LedgerStore::parseDate(QStringView p_dateText) const
+{
+    // Dates the PFT wrote are read directly, without creating any strings
+    QDate convertedDate = StagedLedger::parseDate(p_dateText);
+
+    if(!convertedDate.isNull())
+    {
+        return convertedDate;
+    }
+
+    // Otherwise convert the due date string into a date object and return it
+    return QDate::fromString(billKeyForName(p_dateText.toString()), m_DATE_STRING_FORMAT);
+}
+
+QString LedgerStore::formatDate(const QDate &p_date) const
+{
+    return p_date.toString(m_DATE_STRING_FORMAT);
+}
+
+void LedgerStore::parseConfigChunk(const QByteArray &p_configFileContents, LoadChunk &p_loadChunk, const JobContext *p_jobContext) const
+{
+    ConfigFileReader configFileReader(p_configFileContents, p_loadChunk.firstByteIndex, p_loadChunk.endByteIndex, p_loadChunk.loadArena);
+    ConfigFileReader::Entry configEntry;
+
+    // Iterate over each "key=value" entry of the chunk
+    while(configFileReader.readEntry(configEntry))
+    {
+        // Stop early if a newer read was requested
+        if(p_jobContext != nullptr && p_jobContext->isCancelled())
+        {
+            return;
+        }
+
+        // If the entry is not within a group, count it so the user is alerted once
+        if(configEntry.groupLabel.isEmpty())
+        {
+            p_loadChunk.partialLedger.invalidKeyCount++;
+        }
+
+        else
+        {
+            // Note which funds information the chunk set, so only that overrides what earlier chunks read
+            if(configEntry.groupLabel == m_FUNDS_INFORMATION_GROUP_LABEL)
+            {
+                p_loadChunk.hasAvailableCurrency = p_loadChunk.hasAvailableCurrency || configEntry.key == m_CURRENCY_KEY;
+                p_loadChunk.hasTotalAmountAvailable = p_loadChunk.hasTotalAmountAvailable || configEntry.key == m_TOTAL_FUNDS_AVAILABLE_KEY;
+                p_loadChunk.hasVersion = p_loadChunk.hasVersion || configEntry.key == m_VERSION_KEY;
+            }
+
+            // Use group labels, keys, and values from the chunk to build up the funds information and the staged bills
+            parseConfigContents(configEntry.groupLabel, configEntry.key, configEntry.value, p_loadChunk.stagedLedger, p_loadChunk.partialLedger);
+        }
+
+        // Publish how far through the chunk the worker is
+        p_loadChunk.percentRead.store(configFileReader.getPercentRead(), std::memory_order_relaxed);
+    }
+
+    p_loadChunk.hasFormatError = configFileReader.hasFormatError();
+
+    // Build the chunk's bills on this thread, then give back the arena since nothing built refers to it
+    p_loadChunk.stagedLedger.buildBills();
+    p_loadChunk.loadArena.release();
+}
+
+void LedgerStore::parseConfigContents(QStringView p_groupLabel, QStringView p_key, QStringView p_value, StagedLedger &p_stagedLedger, LedgerSnapshot &p_loadedLedger) const
+{
+    // If the group label is the funds information section
+    if(p_groupLabel == m_FUNDS_INFORMATION_GROUP_LABEL)
+    {
+        // If the key is the currency of the total amount available, config files without one are in the default currency
+        if(p_key == m_CURRENCY_KEY)
+        {
+            QString currencyCode = CurrencyRegistry::normalizeCode(p_value.toString());
+            p_loadedLedger.availableCurrencyCode = currencyCode.isEmpty() ? CurrencyRegistry::defaultCurrencyCode() : currencyCode;
+        }
+
+        // If the key is the version stamp, note which version of the config file was read so a later save can tell whether another instance saved since
+        else if(p_key == m_VERSION_KEY)
+        {
+            p_loadedLedger.version = p_value.toULongLong();
+        }
+
+        // If there is no total amount of money available currently stored in the config file
+        else if(p_key == m_TOTAL_FUNDS_AVAILABLE_KEY && p_value.isEmpty())
+        {
+            // Default the amount available to zero
+            p_loadedLedger.totalAmountAvailable = 0.00;
+        }
+
+        // If an amount available was found
+        else if(p_key == m_TOTAL_FUNDS_AVAILABLE_KEY)
+        {
+            // Update the amount available to the config file's contents
+            p_loadedLedger.totalAmountAvailable = p_value.toDouble();
+        }
+    }
+
+    // If the group label is a bill
+    else
+    {
+        // Stage the bill in the load's arena, entries of the same section fill in the same staged bill, whose name is its group label
+        p_stagedLedger.stageBill(p_groupLabel);
+
+        // If the key label is the amount due key
+        if(p_key == m_BILL_AMOUNT_DUE_KEY)
+        {
+            // Set the staged bill's amount due
+            p_stagedLedger.setAmountDue(p_value.toDouble());
+        }
+
+        // If the key label is the due date key
+        else if(p_key == m_BILL_DUE_DATE_KEY)
+        {
+            // Set the staged bill's due date by converting the date string to a date object
+            p_stagedLedger.setDueDate(parseDate(p_value));
+        }
+
+        // If the key label is the currency key
+        else if(p_key == m_CURRENCY_KEY)
+        {
+            // Set the staged bill's currency, bills without one stay in the default currency
+            p_stagedLedger.setCurrencyCode(p_value);
+        }
+
+        // If the key label is the category key
+        else if(p_key == m_BILL_CATEGORY_KEY)
+        {
+            // Set the staged bill's category
+            p_stagedLedger.setCategory(p_value.trimmed());
+        }
+
+        // If the key label is the tags key
+        else if(p_key == m_BILL_TAGS_KEY)
+        {
+            // Set the staged bill's tags, which are split at the commas once the bill is built
+            p_stagedLedger.setTags(p_value);
+        }
+
+        // Otherwise, the key label is the funding status
+        else
+        {
+            // Set the staged bill's funding status by converting the funding status string to a boolean, funded bills are added to the funded list once the bill is built
+            p_stagedLedger.setFundedStatus(fundingStatusFromString(p_value));
+        }
+    }
+}
+
+bool LedgerStore::readConfigFileContents(QByteArray &p_configFileContents) const
+{
+    QFile configFile(m_configFilePath);
+
+    // A missing config file reads as an empty one
+    if(!configFile.exists())
+    {
+        p_configFileContents.clear();
+        return true;
+    }
+
+    if(!configFile.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    p_configFileContents = configFile.readAll();
+    return true;
+}
+
+bool LedgerStore::writeConfigFileContents(const QByteArray &p_configFileContents) const
+{
+    // The new contents only replace the config file once they are completely written
+    QSaveFile configFile(m_configFilePath);
+
+    if(!configFile.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    configFile.write(p_configFileContents);
+    return configFile.commit();
+}
+
+QByteArray LedgerStore::encodeBillSection(const QString &p_billKey, const Bill &p_bill) const
+{
+    QByteArray section;
+    section.append('[').append(encodeGroupLabel(p_billKey)).append(']').append(m_LINE_ENDING);
+
+    // Write the keys in the alphabetical order QSettings writes them in, so unchanged sections written by either read back identically
+    appendEncodedEntry(section, m_BILL_AMOUNT_DUE_KEY, QString::number(p_bill.getAmountDue(), 'f', 2));
+
+    if(!p_bill.getCategory().isEmpty())
+    {
+        appendEncodedEntry(section, m_BILL_CATEGORY_KEY, p_bill.getCategory());
+    }
+
+    appendEncodedEntry(section, m_CURRENCY_KEY, p_bill.getCurrencyCode());
+    appendEncodedEntry(section, m_BILL_DUE_DATE_KEY, formatDate(p_bill.getDueDate()));
+    appendEncodedEntry(section, m_BILL_FUNDING_STATUS_KEY, fundingStatusToString(p_bill.isFunded()));
+
+    if(!p_bill.getTags().isEmpty())
+    {
+        appendEncodedEntry(section, m_BILL_TAGS_KEY, CategoryRollup::joinTags(p_bill.getTags()));
+    }
+
+    return section;
+}
+
+QByteArray LedgerStore::encodeFundsInformationSection(double p_totalAmountAvailable, const QString &p_availableCurrencyCode, quint64 p_version) const
+{
+    QByteArray section;
+    section.append('[').append(encodeGroupLabel(m_FUNDS_INFORMATION_GROUP_LABEL)).append(']').append(m_LINE_ENDING);
+    appendEncodedEntry(section, m_CURRENCY_KEY, p_availableCurrencyCode);
+    appendEncodedEntry(section, m_TOTAL_FUNDS_AVAILABLE_KEY, QString::number(p_totalAmountAvailable, 'f', 2));
+    appendEncodedEntry(section, m_VERSION_KEY, QString::number(p_version));
+    return section;
+}
+
+void LedgerStore::appendEncodedEntry(QByteArray &p_section, const QString &p_key, const QString &p_value) const
+{
+    p_section.append(p_key.toLatin1()).append('=').append(encodeValue(p_value)).append(m_LINE_ENDING);
+}
+
+QByteArray LedgerStore::encodeGroupLabel(QStringView p_groupLabel)
+{
+    QByteArray encodedLabel;
+    encodedLabel.reserve(p_groupLabel.size());
+
+    for(QChar character : p_groupLabel)
+    {
+        char16_t codeUnit = character.unicode();
+
+        // QSettings writes slashes as backslashes, keeps letters, digits, and a few symbols, and writes anything else as "%XX" or "%UXXXX"
+        if(codeUnit == u'/')
+        {
+            encodedLabel.append('\\');
+        }
+        else if((codeUnit >= u'a' && codeUnit <= u'z') || (codeUnit >= u'A' && codeUnit <= u'Z') || (codeUnit >= u'0' && codeUnit <= u'9') || codeUnit == u'_' || codeUnit == u'-' || codeUnit == u'.')
+        {
+            encodedLabel.append(static_cast<char>(codeUnit));
+        }
+        else if(codeUnit <= 0xFF)
+        {
+            encodedLabel.append('%').append(QByteArray::number(codeUnit, 16).toUpper().rightJustified(2, '0'));
+        }
+        else
+        {
+            encodedLabel.append("%U").append(QByteArray::number(codeUnit, 16).toUpper().rightJustified(4, '0'));
+        }
+    }
+
+    return encodedLabel;
+}
+
+QByteArray LedgerStore::encodeValue(const QString &p_value)
+{
+    // QSettings marks strings starting with "@" by doubling it, since "@" otherwise starts a type name
+    QString value = p_value.startsWith(QLatin1Char('@')) ? QLatin1Char('@') + p_value : p_value;
+    QByteArray encodedValue;
+    QString plainRun;
+    bool needsQuotes = false;
+    bool isEscapingHexDigits = false;
+    encodedValue.reserve(value.size());
+
+    for(QChar character : value)
+    {
+        char16_t codeUnit = character.unicode();
+        bool isHexDigit = (codeUnit >= u'0' && codeUnit <= u'9') || (codeUnit >= u'a' && codeUnit <= u'f') || (codeUnit >= u'A' && codeUnit <= u'F');
+        needsQuotes = needsQuotes || codeUnit == u';' || codeUnit == u',' || codeUnit == u'=';
+
+        // Characters written as they are are collected and encoded together, so surrogate pairs stay whole
+        if(codeUnit > 0x1F && codeUnit != u'"' && codeUnit != u'\\' && !(isEscapingHexDigits && isHexDigit))
+        {
+            plainRun.append(character);
+            isEscapingHexDigits = false;
+            continue;
+        }
+
+        encodedValue.append(plainRun.toUtf8());
+        plainRun.clear();
+
+        // Escape quotes, backslashes, and control characters, and hex digits straight after a "\x" escape so they are not read as part of it
+        switch(codeUnit)
+        {
+            case u'\0' :
+            {
+                encodedValue.append("\\0");
+                isEscapingHexDigits = true;
+                continue;
+            }
+            case u'\a' :
+            {
+                encodedValue.append("\\a");
+                break;
+            }
+            case u'\b' :
+            {
+                encodedValue.append("\\b");
+                break;
+            }
+            case u'\f' :
+            {
+                encodedValue.append("\\f");
+                break;
+            }
+            case u'\n' :
+            {
+                encodedValue.append("\\n");
+                break;
+            }
+            case u'\r' :
+            {
+                encodedValue.append("\\r");
+                break;
+            }
+            case u'\t' :
+            {
+                encodedValue.append("\\t");
+                break;
+            }
+            case u'\v' :
+            {
+                encodedValue.append("\\v");
+                break;
+            }
+            case u'"' :
+            case u'\\' :
+            {
+                encodedValue.append('\\').append(static_cast<char>(codeUnit));
+                break;
+            }
+            default :
+            {
+                encodedValue.append("\\x").append(QByteArray::number(codeUnit, 16));
+                isEscapingHexDigits = true;
+                continue;
+            }
+        }
+
+        isEscapingHexDigits = false;
+    }
+
+    encodedValue.append(plainRun.toUtf8());
+
+    // Values containing separators or starting or ending with a space are quoted
+    if(needsQuotes || encodedValue.startsWith(' ') || encodedValue.endsWith(' '))
+    {
+        encodedValue.prepend('"').append('"');
+    }
+
+    return encodedValue;
+}
+
+void LedgerStore::appendSection(QByteArray &p_configFileContents, QByteArrayView p_section) const
+{
+    // QSettings separates sections with a blank line
+    if(!p_configFileContents.isEmpty() && !p_configFileContents.endsWith(m_LINE_ENDING))
+    {
+        p_configFileContents.append(m_LINE_ENDING);
+    }
+
+    if(!p_configFileContents.isEmpty() && !p_configFileContents.endsWith(m_LINE_ENDING + m_LINE_ENDING))
+    {
+        p_configFileContents.append(m_LINE_ENDING);
+    }
+
+    p_configFileContents.append(p_section);
+}
+
+bool LedgerStore::isSectionUnchanged(const QByteArray &p_configFileContents, const ConfigSectionIndex::SectionSpan &p_sectionSpan, const QByteArray &p_encodedSection)
+{
+    QByteArrayView sectionText = QByteArrayView(p_configFileContents).sliced(p_sectionSpan.headerStart, p_sectionSpan.bodyEnd - p_sectionSpan.headerStart);
+    QByteArrayView encodedText(p_encodedSection);
+
+    // Ignore the blank lines separating the section from the next
+    while(!sectionText.isEmpty() && (sectionText.back() == '\n' || sectionText.back() == '\r'))
+    {
+        sectionText.chop(1);
+    }
+
+    while(!encodedText.isEmpty() && (encodedText.back() == '\n' || encodedText.back() == '\r'))
+    {
+        encodedText.chop(1);
+    }
+
+    return sectionText == encodedText;
+}
+
+bool LedgerStore::haveSameSavedValues(const Bill &p_firstBill, const Bill &p_secondBill)
+{
+    return p_firstBill.getAmountDueCents() == p_secondBill.getAmountDueCents() && p_firstBill.getDueDate() == p_secondBill.getDueDate() && p_firstBill.getCurrencyIndex() == p_secondBill.getCurrencyIndex()
+           && p_firstBill.isFunded() == p_secondBill.isFunded() && p_firstBill.getCategory() == p_secondBill.getCategory() && p_firstBill.getTags() == p_secondBill.getTags();
+}
+
+Bill LedgerStore::mergeBill(const Bill &p_baseBill, const Bill &p_ourBill, const Bill &p_theirBill, bool &p_isConflicting)
+{
+    Bill mergedBill = p_ourBill;
+    mergedBill.setAmountDueCents(mergeField(p_baseBill.getAmountDueCents(), p_ourBill.getAmountDueCents(), p_theirBill.getAmountDueCents(), p_isConflicting));
+    mergedBill.setDueDate(mergeField(p_baseBill.getDueDate(), p_ourBill.getDueDate(), p_theirBill.getDueDate(), p_isConflicting));
+    mergedBill.setCurrencyIndex(mergeField(p_baseBill.getCurrencyIndex(), p_ourBill.getCurrencyIndex(), p_theirBill.getCurrencyIndex(), p_isConflicting));
+    mergedBill.setCategory(mergeField(p_baseBill.getCategory(), p_ourBill.getCategory(), p_theirBill.getCategory(), p_isConflicting));
+    mergedBill.setTags(mergeField(p_baseBill.getTags(), p_ourBill.getTags(), p_theirBill.getTags(), p_isConflicting));
+    mergedBill.setFundedStatus(mergeField(p_baseBill.isFunded(), p_ourBill.isFunded(), p_theirBill.isFunded(), p_isConflicting));
+    return mergedBill;
+}
+
+qint64 LedgerStore::fundedCents(const QMap<QString, Bill> &p_billMap, const QString &p_billKey, quint8 p_availableCurrencyIndex, const ExchangeRateTable &p_exchangeRateTable)
+{
+    QMap<QString, Bill>::const_iterator billIterator = p_billMap.constFind(p_billKey);
+
+    if(billIterator == p_billMap.cend() || !billIterator->isFunded())
+    {
+        return 0;
+    }
+
+    return p_exchangeRateTable.convertCents(billIterator->getAmountDueCents(), billIterator->getCurrencyIndex(), p_availableCurrencyIndex);
+}
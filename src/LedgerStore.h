@@ -0,0 +1,361 @@
+/*##################################################################################
+#   File name:          LedgerStore.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LedgerStore
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LEDGERSTORE_H
+#define LEDGERSTORE_H
+
+// Local file includes
+#include "BalanceHistory.h"
+#include "Bill.h"
+#include "ConfigSectionIndex.h"
+#include "ExchangeRateTable.h"
+#include "JobManager.h"
+#include "LedgerSnapshot.h"
+#include "LoadArena.h"
+#include "StagedLedger.h"
+
+// Qt includes
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QDate>
+#include <QHash>
+#include <QMetaType>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+#include <atomic>
+
+/**
+ * @brief The LedgerStore class reads and writes the bills and funds information of a config file, without depending on the GUI.
+ * It is shared by the PersonalFinanceTool and the pft command-line tool, so both read and write the config file in exactly the same format.
+ * Saves hold the config file's lock and stamp it with a new version. A save made after another instance saved merges the bills each side changed, rather than overwriting the other's changes.
+ */
+class LedgerStore
+{
+
+public:
+
+    /**
+     * @brief The SaveResult struct describes what a save wrote, and which changes saved by other instances were merged into it.
+     */
+    struct SaveResult
+    {
+        bool isWritten = false; //!< Whether or not the config file was written.
+        bool isLockTimedOut = false; //!< Whether or not the config file stayed locked by another instance for too long to save.
+        bool isCancelled = false; //!< Whether or not the save was cancelled before it started writing, leaving the config file untouched.
+        LedgerSnapshot savedLedger; //!< The bills and funds information the config file now holds, which the next save is merged against.
+        double mergedAmountAvailableChange = 0.00; //!< How much other instances changed the total amount available by since the baseline.
+        QStringList mergedBillKeys; //!< The bills other instances added or changed, whose saved values differ from those handed to the save.
+        QStringList mergedRemovedBillKeys; //!< The bills other instances deleted, which were removed from the saved bills.
+        QStringList conflictingBillKeys; //!< The bills both this save and another instance changed differently, fields changed on both sides keep this save's value.
+        BalanceHistory::Snapshot balanceSnapshot; //!< The totals of the saved bills in the currency of the amount available, taken by the save so they are not summed again afterwards.
+        QStringList missingRateCurrencyCodes; //!< The codes of currencies which had bills but no exchange rate, left out of the balance snapshot's totals.
+    };
+
+    /**
+     * @brief Constructs a LedgerStore for a config file, which need not exist yet.
+     * @param p_configFilePath - The path of the config file.
+     */
+    explicit LedgerStore(const QString &p_configFilePath);
+
+    /**
+     * @brief Returns the path of the config file.
+     * @return The config file path.
+     */
+    QString getConfigFilePath() const;
+
+    /**
+     * @brief Reads the config file into a LedgerSnapshot, a missing config file reading as an empty one. Large config files are split at section headers and read on several threads.
+     * @param p_jobContext - The job doing the load, which is told of its progress and checked for cancellation, or null when loading outside a job.
+     * @return The bills and funds information read, whose isConfigReadable and invalidKeyCount say whether the file could be read. Empty if the job was cancelled.
+     */
+    LedgerSnapshot load(JobContext *p_jobContext = nullptr) const;
+
+    /**
+     * @brief Writes the bills and funds information which changed since a baseline to the config file, leaving the text of every other section as it is.
+     * If another instance saved since the baseline, only the sections whose text differs from the baseline are read, and the changes of both are merged bill by bill.
+     * Fields changed on both sides keep this save's value, and a bill edited on one side and deleted on the other is kept. The other instance's deposits are added to the total amount available,
+     * while the amounts set aside by funding, defunding, and deleting bills are worked out from the merged bills, so a bill funded on both sides is only paid for once.
+     * The whole file is still read and written out in full by every save, as the untouched sections are copied from its text and the file is replaced in a single step.
+     * @param p_ledgerToSave - The bills and funds information to write.
+     * @param p_baseLedger - The bills and funds information as last loaded from or saved to the config file.
+     * @param p_exchangeRateTable - The exchange rates used to convert funded bills in other currencies into the currency of the amount available when merging.
+     * @param p_jobContext - The job doing the save, which is told of its progress and checked for cancellation, or null when saving outside a job.
+     * @return What was written and merged, with the totals of what was written for the balance history.
+     */
+    SaveResult save(const LedgerSnapshot &p_ledgerToSave, const LedgerSnapshot &p_baseLedger, const ExchangeRateTable &p_exchangeRateTable, JobContext *p_jobContext = nullptr) const;
+
+    /**
+     * @brief Replaces the contents of the config file with the bills and funds information of a LedgerSnapshot, discarding anything saved since it was loaded.
+     * @param p_ledgerToSave - The bills and funds information to write.
+     * @return False if the config file could not be locked or written.
+     */
+    bool replace(const LedgerSnapshot &p_ledgerToSave) const;
+
+    /**
+     * @brief Removes the config file while holding its lock, so a save already writing it finishes first rather than recreating it afterwards.
+     * @return False if the config file could not be locked or removed.
+     */
+    bool remove() const;
+
+    /**
+     * @brief Builds a Bill from the values of one config file section.
+     * @param p_billKey - The group label of the section, which the bill is named after.
+     * @param p_sectionValues - Map of (key, value) pairs within the section.
+     * @return The Bill the section describes.
+     */
+    Bill readBill(const QString &p_billKey, const QHash<QString, QString> &p_sectionValues) const;
+
+    /**
+     * @brief Returns whether or not the amount due of one config file section fits in a Bill, sections which do not fit being left out rather than read clamped.
+     * @param p_sectionValues - Map of (key, value) pairs within the section.
+     * @return True if the section's amount due fits.
+     */
+    bool isAmountDueInRange(const QHash<QString, QString> &p_sectionValues) const;
+
+    /**
+     * @brief Reads the total amount available and its currency from the values of the funds information section.
+     * @param p_sectionValues - Map of (key, value) pairs within the section.
+     * @param p_totalAmountAvailable - Receives the total amount available.
+     * @param p_availableCurrencyCode - Receives the code of the currency it is held in, the default currency if the section has none.
+     */
+    void readFundsInformation(const QHash<QString, QString> &p_sectionValues, double &p_totalAmountAvailable, QString &p_availableCurrencyCode) const;
+
+    /**
+     * @brief Reads the version stamp from the values of the funds information section.
+     * @param p_sectionValues - Map of (key, value) pairs within the section.
+     * @return The version, zero for config files which were never saved with one.
+     */
+    quint64 readVersion(const QHash<QString, QString> &p_sectionValues) const;
+
+    /**
+     * @brief Returns whether or not a group label is that of the funds information section, which no bill may be saved under.
+     * @param p_groupLabel - The group label.
+     * @return True if the group label is the funds information section's.
+     */
+    bool isFundsInformationGroup(QStringView p_groupLabel) const;
+
+    /**
+     * @brief Returns the bill map key a bill is saved under, its name with spaces removed.
+     * @param p_billName - The name of the bill.
+     * @return The bill map key.
+     */
+    QString billKeyForName(const QString &p_billName) const;
+
+    /**
+     * @brief Checks a funding status and returns "Funded" or "Not Funded" if the status is true or false respectively.
+     * @param p_isBillFunded - Funding status as a boolean, true or false.
+     * @return The funding status as a string.
+     */
+    QString fundingStatusToString(bool p_isBillFunded) const;
+
+    /**
+     * @brief Checks a funding status and returns true or false if the status is "Funded" or "Not Funded" respectively.
+     * @param p_fundingStatus - Funding status as a string, "Funded" or "Not Funded".
+     * @return The funding status as a boolean.
+     */
+    bool fundingStatusFromString(QStringView p_fundingStatus) const;
+
+    /**
+     * @brief Converts a date represented as a string into a date object, reading the "M/d/yyyy" format the config file uses.
+     * Dates in exactly that format are read without creating any strings, since one is converted for every bill loaded.
+     * @param p_dateText - A date represented as a string.
+     * @return The date, or a null date if it is not in "M/d/yyyy" format.
+     */
+    QDate parseDate(QStringView p_dateText) const;
+
+    /**
+     * @brief Converts a date into the "M/d/yyyy" format the config file uses.
+     * @param p_date - The date.
+     * @return The date as a string.
+     */
+    QString formatDate(const QDate &p_date) const;
+
+    /**
+     * @brief Returns whether or not two bills would be written to the config file identically, bills being named after their group label when read back.
+     * @param p_firstBill - The first bill.
+     * @param p_secondBill - The second bill.
+     * @return True if every saved field matches.
+     */
+    static bool haveSameSavedValues(const Bill &p_firstBill, const Bill &p_secondBill);
+
+    /**
+     * @brief Merges the changes two sides made to a bill since the baseline field by field, each field changed on both sides keeping this side's value.
+     * @param p_baseBill - The bill as of the baseline.
+     * @param p_ourBill - The bill as this side has it, such as a save would write it or the bill table shows it.
+     * @param p_theirBill - The bill as another instance saved it.
+     * @param p_isConflicting - Set to true if a field was changed differently on both sides.
+     * @return The merged bill, named as this side names it.
+     */
+    static Bill mergeBill(const Bill &p_baseBill, const Bill &p_ourBill, const Bill &p_theirBill, bool &p_isConflicting);
+
+private:
+
+    /**
+     * @brief The LoadChunk struct holds one chunk of the config file being loaded, and everything one worker reads from it into its own arena.
+     */
+    struct LoadChunk
+    {
+        /**
+         * @brief Prepares a chunk to be read, allocating nothing until it is.
+         * @param p_firstByteIndex - The offset of the first byte of the chunk.
+         * @param p_endByteIndex - The offset one past the last byte of the chunk.
+         * @param p_arenaBlockSize - The size of the first block of the chunk's arena.
+         */
+        LoadChunk(int p_firstByteIndex, int p_endByteIndex, size_t p_arenaBlockSize) : firstByteIndex(p_firstByteIndex), endByteIndex(p_endByteIndex), loadArena(p_arenaBlockSize), stagedLedger(loadArena) {}
+
+        int firstByteIndex = 0; //!< The offset of the first byte of the chunk.
+        int endByteIndex = 0; //!< The offset one past the last byte of the chunk.
+        LoadArena loadArena; //!< The arena the chunk's decoded text and staged bills are allocated from.
+        StagedLedger stagedLedger; //!< The bills read from the chunk.
+        LedgerSnapshot partialLedger; //!< The funds information and invalid key count read from the chunk.
+        bool hasAvailableCurrency = false; //!< Whether or not the chunk set the currency of the total amount available.
+        bool hasTotalAmountAvailable = false; //!< Whether or not the chunk set the total amount available.
+        bool hasVersion = false; //!< Whether or not the chunk set the version stamp.
+        bool hasFormatError = false; //!< Whether or not a line of the chunk was malformed.
+        std::atomic<int> percentRead{0}; //!< How far through the chunk its worker is, read by the loading thread to report progress.
+    };
+
+    /**
+     * @brief Reads one chunk of the config file and builds its bills, on whichever thread it is handed to.
+     * Only touches the chunk and constant members, so several chunks can be read at once.
+     * @param p_configFileContents - The contents of the config file.
+     * @param p_loadChunk - The chunk to read.
+     * @param p_jobContext - The job doing the load, checked for cancellation, or null.
+     */
+    void parseConfigChunk(const QByteArray &p_configFileContents, LoadChunk &p_loadChunk, const JobContext *p_jobContext) const;
+
+    /**
+     * @brief Uses the group label, key, and value of one config file entry to build up the funds information, or to stage a bill.
+     * @param p_groupLabel - The group label, either the funds information section or a bill map key.
+     * @param p_key - The key within the group.
+     * @param p_value - The value of the key.
+     * @param p_stagedLedger - The bills staged so far.
+     * @param p_loadedLedger - The funds information read so far.
+     */
+    void parseConfigContents(QStringView p_groupLabel, QStringView p_key, QStringView p_value, StagedLedger &p_stagedLedger, LedgerSnapshot &p_loadedLedger) const;
+
+    /**
+     * @brief Reads the whole config file, a missing config file reading as an empty one.
+     * @param p_configFileContents - Receives the contents of the config file.
+     * @return False if the config file exists but could not be opened.
+     */
+    bool readConfigFileContents(QByteArray &p_configFileContents) const;
+
+    /**
+     * @brief Writes new contents to the config file through a temporary file, so a failed write never leaves it half written.
+     * @param p_configFileContents - The new contents of the config file.
+     * @return False if the config file could not be written.
+     */
+    bool writeConfigFileContents(const QByteArray &p_configFileContents) const;
+
+    /**
+     * @brief Encodes a bill's section the way QSettings writes it, with its keys in alphabetical order.
+     * @param p_billKey - The bill map key of the bill, used as the section's group label.
+     * @param p_bill - The bill.
+     * @return The section's header and "key=value" lines.
+     */
+    QByteArray encodeBillSection(const QString &p_billKey, const Bill &p_bill) const;
+
+    /**
+     * @brief Encodes the funds information section the way QSettings writes it, with its keys in alphabetical order.
+     * @param p_totalAmountAvailable - The total amount available.
+     * @param p_availableCurrencyCode - The code of the currency the total amount available is held in.
+     * @param p_version - The version stamp of the config file.
+     * @return The section's header and "key=value" lines.
+     */
+    QByteArray encodeFundsInformationSection(double p_totalAmountAvailable, const QString &p_availableCurrencyCode, quint64 p_version) const;
+
+    /**
+     * @brief Appends one "key=value" line to an encoded section, escaping the value as QSettings does.
+     * @param p_section - The encoded section.
+     * @param p_key - The key, which needs no escaping.
+     * @param p_value - The value.
+     */
+    void appendEncodedEntry(QByteArray &p_section, const QString &p_key, const QString &p_value) const;
+
+    /**
+     * @brief Encodes a group label as QSettings does, percent encoding characters other than letters, digits, and a few symbols.
+     * @param p_groupLabel - The group label.
+     * @return The encoded group label.
+     */
+    static QByteArray encodeGroupLabel(QStringView p_groupLabel);
+
+    /**
+     * @brief Encodes a value as QSettings does, escaping special characters and quoting values containing separators or surrounding spaces.
+     * @param p_value - The value.
+     * @return The encoded value.
+     */
+    static QByteArray encodeValue(const QString &p_value);
+
+    /**
+     * @brief Appends a section to new config file contents, separating it from the previous section with a blank line.
+     * @param p_configFileContents - The new config file contents.
+     * @param p_section - The section's bytes.
+     */
+    void appendSection(QByteArray &p_configFileContents, QByteArrayView p_section) const;
+
+    /**
+     * @brief Returns whether or not the text of a section of the config file is exactly what would be written for it, ignoring trailing blank lines.
+     * @param p_configFileContents - The contents of the config file.
+     * @param p_sectionSpan - The location of the section.
+     * @param p_encodedSection - The section as it would be written.
+     * @return True if the section's text matches.
+     */
+    static bool isSectionUnchanged(const QByteArray &p_configFileContents, const ConfigSectionIndex::SectionSpan &p_sectionSpan, const QByteArray &p_encodedSection);
+
+    /**
+     * @brief Returns how much of the amount available a bill in a bill map has set aside, its amount due converted if it is funded and nothing otherwise.
+     * @param p_billMap - The bill map.
+     * @param p_billKey - The bill map key of the bill, which need not be in the bill map.
+     * @param p_availableCurrencyIndex - The CurrencyRegistry index of the currency the amount available is in.
+     * @param p_exchangeRateTable - The exchange rates used for bills in other currencies.
+     * @return The amount set aside in cents, zero if the bill is missing, not funded, or has no exchange rate, as it could never have been funded.
+     */
+    static qint64 fundedCents(const QMap<QString, Bill> &p_billMap, const QString &p_billKey, quint8 p_availableCurrencyIndex, const ExchangeRateTable &p_exchangeRateTable);
+
+    QString m_configFilePath; //!< The path of the config file.
+
+    // Config file format variables
+    const QString m_FUNDS_INFORMATION_GROUP_LABEL = "FundsInformation"; //!< The group label for the funds information section of the configuration file.
+    const QString m_TOTAL_FUNDS_AVAILABLE_KEY = "TotalFundsAvailable"; //!< The total funds available key which maps to the total funds available value.
+    const QString m_BILL_AMOUNT_DUE_KEY = "AmountDue"; //!< The amount due key which maps to various amounts due of bills.
+    const QString m_BILL_DUE_DATE_KEY = "DueDate"; //!< The due date key which maps to various due dates of bills.
+    const QString m_BILL_FUNDING_STATUS_KEY = "FundingStatus"; //!< The funding status key which maps to whether or not a bill has been funded.
+    const QString m_CURRENCY_KEY = "Currency"; //!< The currency key which maps to the currency of a bill, or of the total funds available.
+    const QString m_BILL_CATEGORY_KEY = "Category"; //!< The category key which maps to the budget category of a bill, omitted if the bill has none.
+    const QString m_BILL_TAGS_KEY = "Tags"; //!< The tags key which maps to the tags of a bill separated by commas, omitted if the bill has none.
+    const QString m_VERSION_KEY = "Version"; //!< The version key which maps to the version stamp of the config file, incremented by every save.
+    const QString m_FUNDED_STRING = "Funded"; //!< Funded status of funded represented as a string.
+    const QString m_NOT_FUNDED_STRING = "Not Funded"; //!< Funded status of not funded represented as a string.
+    const QString m_DATE_STRING_FORMAT = "M/d/yyyy"; //!< The format dates are written to the config file in.
+#ifdef Q_OS_WIN
+    const QByteArray m_LINE_ENDING = "\r\n"; //!< The line ending QSettings writes on Windows.
+#else
+    const QByteArray m_LINE_ENDING = "\n"; //!< The line ending QSettings writes on other platforms.
+#endif
+
+    // Loading and saving variables
+    const QString m_LOAD_STATUS_TEXT = "Loading bills..."; //!< Progress text reported while the config file loads.
+    const QString m_SAVE_STATUS_TEXT = "Saving bills..."; //!< Progress text reported while the config file saves.
+    const size_t m_LOAD_ARENA_BYTES_PER_FILE_BYTE = 3; //!< The size of the load arena's first block per byte of the config file, enough for its decoded text and staged bills.
+    const int m_MIN_BYTES_PER_LOAD_CHUNK = 1024 * 1024; //!< Config files smaller than this are read on the loading thread alone, since starting workers would cost more than it saves.
+    const unsigned long m_LOAD_PROGRESS_INTERVAL_MSECS = 20; //!< How often the loading thread reports the progress of the workers reading the config file.
+    const QString m_LOCK_FILE_SUFFIX = ".lock"; //!< The suffix of the config file's lock file, the same one QSettings locks the config file with.
+    const int m_LOCK_TIMEOUT_MSECS = 5000; //!< How long a save waits for another instance to release the config file's lock.
+    const char *m_PROFILE_CONFIG_OPEN_PHASE = "Config Open"; //!< Opening the config file and reading its keys.
+    const char *m_PROFILE_PARSE_PHASE = "Parse"; //!< Parsing the config file's keys into bills.
+    const char *m_PROFILE_SAVE_WRITE_PHASE = "Save Write"; //!< Writing the bill map to the config file.
+};
+
+Q_DECLARE_METATYPE(LedgerStore::SaveResult)
+
+#endif // LEDGERSTORE_H
@@ -0,0 +1,129 @@
+/*##################################################################################
+#   File name:          LoadArena.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LoadArena
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LoadArena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+LoadArena::LoadArena(size_t p_firstBlockSize)
+    : m_nextBlockSize(std::max<size_t>(p_firstBlockSize, sizeof(BlockHeader)))
+{
+}
+
+LoadArena::~LoadArena()
+{
+    release();
+}
+
+void* LoadArena::allocate(size_t p_byteCount, size_t p_alignment)
+{
+    // Round the cursor up to the alignment, moving to a new block if the allocation does not fit in what is left
+    uintptr_t alignedAddress = (reinterpret_cast<uintptr_t>(m_cursor) + p_alignment - 1) & ~(static_cast<uintptr_t>(p_alignment) - 1);
+
+    if(m_currentBlock == nullptr || alignedAddress + p_byteCount > reinterpret_cast<uintptr_t>(m_blockEnd))
+    {
+        addBlock(p_byteCount);
+        alignedAddress = reinterpret_cast<uintptr_t>(m_cursor);
+    }
+
+    char *allocation = reinterpret_cast<char*>(alignedAddress);
+    m_usedBytes += static_cast<size_t>(allocation + p_byteCount - m_cursor);
+    m_cursor = allocation + p_byteCount;
+    m_lastAllocation = allocation;
+    return allocation;
+}
+
+QChar* LoadArena::allocateCharacters(int p_maxLength)
+{
+    return static_cast<QChar*>(allocate(static_cast<size_t>(std::max(p_maxLength, 0)) * sizeof(QChar), alignof(QChar)));
+}
+
+void LoadArena::shrinkLastAllocation(const void *p_allocation, size_t p_usedByteCount)
+{
+    if(p_allocation == nullptr || p_allocation != m_lastAllocation)
+    {
+        return;
+    }
+
+    // Move the cursor back to just past the bytes which were used
+    char *newCursor = const_cast<char*>(m_lastAllocation) + p_usedByteCount;
+
+    if(newCursor < m_cursor)
+    {
+        m_usedBytes -= static_cast<size_t>(m_cursor - newCursor);
+        m_cursor = newCursor;
+    }
+}
+
+QStringView LoadArena::storeString(QStringView p_string)
+{
+    if(p_string.isEmpty())
+    {
+        return QStringView();
+    }
+
+    QChar *storedCharacters = allocateCharacters(static_cast<int>(p_string.size()));
+    std::memcpy(storedCharacters, p_string.data(), static_cast<size_t>(p_string.size()) * sizeof(QChar));
+    return QStringView(storedCharacters, p_string.size());
+}
+
+void LoadArena::release()
+{
+    // Free the blocks newest first by following their links
+    while(m_currentBlock != nullptr)
+    {
+        BlockHeader *previousBlock = m_currentBlock->previousBlock;
+        m_currentBlock->~BlockHeader();
+        ::operator delete(static_cast<void*>(m_currentBlock));
+        m_currentBlock = previousBlock;
+    }
+
+    m_cursor = nullptr;
+    m_blockEnd = nullptr;
+    m_lastAllocation = nullptr;
+    m_usedBytes = 0;
+    m_reservedBytes = 0;
+    m_blockCount = 0;
+}
+
+size_t LoadArena::getUsedBytes() const
+{
+    return m_usedBytes;
+}
+
+size_t LoadArena::getReservedBytes() const
+{
+    return m_reservedBytes;
+}
+
+int LoadArena::getBlockCount() const
+{
+    return m_blockCount;
+}
+
+void LoadArena::addBlock(size_t p_byteCount)
+{
+    // Allocations larger than the next block get a block of their own size, the header keeps the space after it aligned
+    size_t blockSize = std::max(m_nextBlockSize, p_byteCount);
+    void *blockMemory = ::operator new(sizeof(BlockHeader) + blockSize);
+    BlockHeader *newBlock = new (blockMemory) BlockHeader();
+    newBlock->previousBlock = m_currentBlock;
+    newBlock->blockSize = blockSize;
+
+    m_currentBlock = newBlock;
+    m_cursor = reinterpret_cast<char*>(newBlock + 1);
+    m_blockEnd = m_cursor + blockSize;
+    m_reservedBytes += blockSize;
+    m_blockCount++;
+
+    // Double each block so a load which outgrows its first block makes few allocations
+    m_nextBlockSize = std::max(m_nextBlockSize, std::min(blockSize * 2, m_MAX_BLOCK_SIZE));
+}
@@ -0,0 +1,139 @@
+/*##################################################################################
+#   File name:          LoadArena.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LoadArena
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LOADARENA_H
+#define LOADARENA_H
+
+// Qt includes
+#include <QString>
+#include <QStringView>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief The LoadArena class is a monotonic allocator for the short-lived records and strings built while a file is loaded.
+ * Memory is carved out of large blocks by bumping a pointer, nothing is freed individually, and every block is released at once when the load finishes.
+ * Sizing the first block from the file being loaded lets a whole load be served by a single heap allocation. The arena is not thread safe, each load uses its own.
+ */
+class LoadArena
+{
+
+public:
+
+    /**
+     * @brief Creates an empty arena, which allocates nothing until it is first used.
+     * @param p_firstBlockSize - The size in bytes of the first block, later blocks grow from it.
+     */
+    explicit LoadArena(size_t p_firstBlockSize = m_DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Releases every block.
+     */
+    ~LoadArena();
+
+    LoadArena(const LoadArena&) = delete;
+    LoadArena& operator=(const LoadArena&) = delete;
+
+    /**
+     * @brief Allocates uninitialized memory which stays valid until the arena is released.
+     * @param p_byteCount - The number of bytes needed.
+     * @param p_alignment - The alignment needed, a power of two no larger than that of std::max_align_t.
+     * @return The memory.
+     */
+    void* allocate(size_t p_byteCount, size_t p_alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Default constructs an object in the arena. Only trivially destructible types are allowed, since the arena never runs destructors.
+     * @return The object.
+     */
+    template<typename T>
+    T* create()
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Objects in a LoadArena are never destroyed");
+        return new (allocate(sizeof(T), alignof(T))) T();
+    }
+
+    /**
+     * @brief Allocates room for characters, to be filled in by the caller and then trimmed with shrinkLastAllocation().
+     * @param p_maxLength - The most characters which will be written.
+     * @return The first character.
+     */
+    QChar* allocateCharacters(int p_maxLength);
+
+    /**
+     * @brief Gives back the unused end of the most recent allocation, so strings decoded into a worst case sized buffer only keep what they used.
+     * Does nothing if another allocation has been made since.
+     * @param p_allocation - The most recent allocation.
+     * @param p_usedByteCount - The number of bytes at its start which are kept.
+     */
+    void shrinkLastAllocation(const void *p_allocation, size_t p_usedByteCount);
+
+    /**
+     * @brief Copies a string into the arena.
+     * @param p_string - The string.
+     * @return A view of the copy, valid until the arena is released.
+     */
+    QStringView storeString(QStringView p_string);
+
+    /**
+     * @brief Frees every block at once, invalidating everything allocated from the arena.
+     */
+    void release();
+
+    /**
+     * @brief Returns the number of bytes handed out since the arena was created or released, including alignment padding.
+     * @return The number of bytes.
+     */
+    size_t getUsedBytes() const;
+
+    /**
+     * @brief Returns the number of bytes held in blocks.
+     * @return The number of bytes.
+     */
+    size_t getReservedBytes() const;
+
+    /**
+     * @brief Returns the number of blocks the arena holds, which is the number of heap allocations it has made since it was created or released.
+     * @return The number of blocks.
+     */
+    int getBlockCount() const;
+
+private:
+
+    /**
+     * @brief The BlockHeader struct begins each block, linking it to the block allocated before it.
+     */
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        BlockHeader *previousBlock = nullptr; //!< The block allocated before this one, null for the first block.
+        size_t blockSize = 0; //!< The size of the block in bytes, not counting its header.
+    };
+
+    /**
+     * @brief Allocates a new block large enough for an allocation and makes it the current block.
+     * @param p_byteCount - The size of the allocation which did not fit.
+     */
+    void addBlock(size_t p_byteCount);
+
+    static constexpr size_t m_DEFAULT_BLOCK_SIZE = 64 * 1024; //!< The size of the first block when none is given.
+    static constexpr size_t m_MAX_BLOCK_SIZE = 16 * 1024 * 1024; //!< Blocks stop doubling in size past this, unless a single allocation needs more.
+
+    size_t m_nextBlockSize = m_DEFAULT_BLOCK_SIZE; //!< The size of the next block to be allocated.
+    BlockHeader *m_currentBlock = nullptr; //!< The block allocations are carved from, null until the first allocation.
+    char *m_cursor = nullptr; //!< The first free byte of the current block.
+    char *m_blockEnd = nullptr; //!< One past the last byte of the current block.
+    const char *m_lastAllocation = nullptr; //!< The most recent allocation, which shrinkLastAllocation() may trim.
+    size_t m_usedBytes = 0; //!< The number of bytes handed out.
+    size_t m_reservedBytes = 0; //!< The number of bytes held in blocks.
+    int m_blockCount = 0; //!< The number of blocks held.
+};
+
+#endif // LOADARENA_H
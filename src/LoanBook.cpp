@@ -0,0 +1,123 @@
+/*##################################################################################
+#   File name:          LoanBook.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LoanBook
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LoanBook.h"
+#include "StagedLedger.h"
+
+#include <QFile>
+#include <QSettings>
+
+#include <cmath>
+
+bool LoanBook::load(const QString &p_filePath)
+{
+    m_filePath = p_filePath;
+    m_loanTermsByBillKey.clear();
+
+    // No loans have been added yet
+    if(!QFile::exists(p_filePath))
+    {
+        return true;
+    }
+
+    QSettings loanSettings(p_filePath, QSettings::IniFormat);
+
+    if(loanSettings.status() != QSettings::NoError)
+    {
+        return false;
+    }
+
+    // Read each loan's group, skipping terms which were edited into something that cannot be amortized
+    foreach(QString billKey, loanSettings.childGroups())
+    {
+        loanSettings.beginGroup(billKey);
+        LoanSchedule::LoanTerms loanTerms;
+        loanTerms.principalCents = std::llround(loanSettings.value(m_PRINCIPAL_KEY).toString().toDouble() * 100.0);
+        loanTerms.annualRatePercent = loanSettings.value(m_ANNUAL_RATE_KEY).toString().toDouble();
+        loanTerms.termMonths = loanSettings.value(m_TERM_MONTHS_KEY).toString().toInt();
+        loanTerms.firstPaymentDate = StagedLedger::parseDate(loanSettings.value(m_FIRST_PAYMENT_DATE_KEY).toString());
+        loanTerms.extraPaymentCents = std::llround(loanSettings.value(m_EXTRA_PAYMENT_KEY).toString().toDouble() * 100.0);
+        loanSettings.endGroup();
+
+        if(loanTerms.isValid())
+        {
+            m_loanTermsByBillKey.insert(billKey, loanTerms);
+        }
+    }
+
+    return true;
+}
+
+bool LoanBook::contains(const QString &p_billKey) const
+{
+    return m_loanTermsByBillKey.contains(p_billKey);
+}
+
+LoanSchedule::LoanTerms LoanBook::loanTerms(const QString &p_billKey) const
+{
+    return m_loanTermsByBillKey.value(p_billKey);
+}
+
+QStringList LoanBook::billKeys() const
+{
+    return m_loanTermsByBillKey.keys();
+}
+
+bool LoanBook::setLoanTerms(const QString &p_billKey, const LoanSchedule::LoanTerms &p_loanTerms)
+{
+    if(!p_loanTerms.isValid() || p_billKey.isEmpty())
+    {
+        return false;
+    }
+
+    QSettings loanSettings(m_filePath, QSettings::IniFormat);
+
+    if(loanSettings.status() != QSettings::NoError)
+    {
+        return false;
+    }
+
+    // Write amounts in dollars as the config file does, so the file can be edited by hand
+    loanSettings.beginGroup(p_billKey);
+    loanSettings.setValue(m_PRINCIPAL_KEY, QString::number(p_loanTerms.principalCents / 100.0, 'f', 2));
+    loanSettings.setValue(m_ANNUAL_RATE_KEY, QString::number(p_loanTerms.annualRatePercent));
+    loanSettings.setValue(m_TERM_MONTHS_KEY, QString::number(p_loanTerms.termMonths));
+    loanSettings.setValue(m_FIRST_PAYMENT_DATE_KEY, p_loanTerms.firstPaymentDate.toString(m_DATE_FORMAT));
+    loanSettings.setValue(m_EXTRA_PAYMENT_KEY, QString::number(p_loanTerms.extraPaymentCents / 100.0, 'f', 2));
+    loanSettings.endGroup();
+    loanSettings.sync();
+
+    if(loanSettings.status() != QSettings::NoError)
+    {
+        return false;
+    }
+
+    m_loanTermsByBillKey.insert(p_billKey, p_loanTerms);
+    return true;
+}
+
+bool LoanBook::removeLoan(const QString &p_billKey)
+{
+    if(!m_loanTermsByBillKey.contains(p_billKey))
+    {
+        return true;
+    }
+
+    QSettings loanSettings(m_filePath, QSettings::IniFormat);
+    loanSettings.remove(p_billKey);
+    loanSettings.sync();
+
+    if(loanSettings.status() != QSettings::NoError)
+    {
+        return false;
+    }
+
+    m_loanTermsByBillKey.remove(p_billKey);
+    return true;
+}
@@ -0,0 +1,87 @@
+/*##################################################################################
+#   File name:          LoanBook.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LoanBook
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LOANBOOK_H
+#define LOANBOOK_H
+
+// Local file includes
+#include "LoanSchedule.h"
+
+// Qt includes
+#include <QMap>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief The LoanBook class holds the terms of the bills which are loans, kept in a file beside the config file under the bill map key of each loan's bill.
+ * A loan's bill stays an ordinary Bill whose amount due and due date are its next payment, so the terms are kept apart from the config file and every bill is still packed into a single word.
+ */
+class LoanBook
+{
+
+public:
+
+    /**
+     * @brief Loads the terms of every loan from a file. A missing file holds no loans, and is only written once a loan is added.
+     * Loans whose terms cannot be amortized are skipped.
+     * @param p_filePath - The path of the loan file.
+     * @return False if the file exists but could not be read.
+     */
+    bool load(const QString &p_filePath);
+
+    /**
+     * @brief Checks whether a bill is a loan.
+     * @param p_billKey - The bill map key of the bill.
+     * @return True if the bill has loan terms.
+     */
+    bool contains(const QString &p_billKey) const;
+
+    /**
+     * @brief Returns the terms of a loan.
+     * @param p_billKey - The bill map key of the loan's bill.
+     * @return The terms, or default terms which are not valid if the bill is not a loan.
+     */
+    LoanSchedule::LoanTerms loanTerms(const QString &p_billKey) const;
+
+    /**
+     * @brief Returns the bill map keys of every loan, in order.
+     * @return The bill map keys.
+     */
+    QStringList billKeys() const;
+
+    /**
+     * @brief Makes a bill a loan, or changes its terms, and writes them to the loan file.
+     * @param p_billKey - The bill map key of the loan's bill.
+     * @param p_loanTerms - The terms, which must be valid.
+     * @return False if the terms are not valid or the loan file could not be written.
+     */
+    bool setLoanTerms(const QString &p_billKey, const LoanSchedule::LoanTerms &p_loanTerms);
+
+    /**
+     * @brief Makes a loan an ordinary bill again, removing its terms from the loan file.
+     * @param p_billKey - The bill map key of the loan's bill.
+     * @return False if the loan file could not be written.
+     */
+    bool removeLoan(const QString &p_billKey);
+
+private:
+
+    const QString m_PRINCIPAL_KEY = "Principal"; //!< The key of a loan's amount borrowed.
+    const QString m_ANNUAL_RATE_KEY = "AnnualRatePercent"; //!< The key of a loan's yearly interest rate in percent.
+    const QString m_TERM_MONTHS_KEY = "TermMonths"; //!< The key of a loan's number of monthly payments.
+    const QString m_FIRST_PAYMENT_DATE_KEY = "FirstPaymentDate"; //!< The key of the date of a loan's first payment.
+    const QString m_EXTRA_PAYMENT_KEY = "ExtraPayment"; //!< The key of the amount paid on top of each of a loan's payments.
+    const QString m_DATE_FORMAT = "M/d/yyyy"; //!< The format dates are written in, the same as the config file's.
+
+    QString m_filePath; //!< The path of the loan file.
+    QMap<QString, LoanSchedule::LoanTerms> m_loanTermsByBillKey; //!< The terms of each loan, keyed by the bill map key of its bill.
+
+};
+
+#endif // LOANBOOK_H
@@ -0,0 +1,178 @@
+/*##################################################################################
+#   File name:          LoanSchedule.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LoanSchedule
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LoanSchedule.h"
+
+#include <algorithm>
+#include <cmath>
+
+double LoanSchedule::roundToCent(double p_cents)
+{
+    return (p_cents + m_ROUNDING_CONSTANT) - m_ROUNDING_CONSTANT;
+}
+
+bool LoanSchedule::LoanTerms::isValid() const
+{
+    return principalCents > 0 && std::isfinite(annualRatePercent) && annualRatePercent >= 0.0 && termMonths > 0 && termMonths <= m_MAX_TERM_MONTHS
+           && firstPaymentDate.isValid() && extraPaymentCents >= 0;
+}
+
+qint64 LoanSchedule::scheduledPaymentCents(const LoanTerms &p_loanTerms)
+{
+    if(!p_loanTerms.isValid())
+    {
+        return 0;
+    }
+
+    double principalCents = static_cast<double>(p_loanTerms.principalCents);
+    double monthlyRate = p_loanTerms.annualRatePercent / 1200.0;
+
+    // Interest free loans are repaid in equal parts of the principal
+    if(monthlyRate == 0.0)
+    {
+        return static_cast<qint64>(std::ceil(principalCents / p_loanTerms.termMonths));
+    }
+
+    // Round the annuity payment up, ignoring rounding noise a millionth of a cent above a whole cent, so the last payment is never larger than the others
+    double paymentCents = principalCents * monthlyRate / (1.0 - std::pow(1.0 + monthlyRate, -p_loanTerms.termMonths));
+    return static_cast<qint64>(std::ceil(paymentCents - 1e-6));
+}
+
+int LoanSchedule::paymentsBefore(const LoanTerms &p_loanTerms, const QDate &p_date)
+{
+    if(!p_date.isValid() || !p_loanTerms.firstPaymentDate.isValid() || p_date <= p_loanTerms.firstPaymentDate)
+    {
+        return 0;
+    }
+
+    // Count the whole months between the dates, then whether the payment in the date's month falls before it
+    int monthCount = (p_date.year() - p_loanTerms.firstPaymentDate.year()) * 12 + p_date.month() - p_loanTerms.firstPaymentDate.month();
+    return p_loanTerms.firstPaymentDate.addMonths(monthCount) < p_date ? monthCount + 1 : monthCount;
+}
+
+QVector<LoanSchedule::Installment> LoanSchedule::schedule(const LoanTerms &p_loanTerms, qint64 p_whatIfExtraCents, const QDate &p_whatIfStartDate)
+{
+    QVector<Installment> installments;
+
+    if(!p_loanTerms.isValid())
+    {
+        return installments;
+    }
+
+    // Step through the months with the same arithmetic as summarize(), so a loan's schedule always agrees with its summary
+    double balanceCents = static_cast<double>(p_loanTerms.principalCents);
+    double monthlyRate = p_loanTerms.annualRatePercent / 1200.0;
+    double paymentCents = static_cast<double>(scheduledPaymentCents(p_loanTerms) + p_loanTerms.extraPaymentCents);
+    int whatIfStartMonth = paymentsBefore(p_loanTerms, p_whatIfStartDate);
+    installments.reserve(p_loanTerms.termMonths);
+
+    for(int month = 0; balanceCents > 0.0 && month < m_MAX_TERM_MONTHS; month++)
+    {
+        double interestCents = roundToCent(balanceCents * monthlyRate);
+        double owedCents = balanceCents + interestCents;
+        double paidCents = std::min(paymentCents + (month >= whatIfStartMonth ? static_cast<double>(p_whatIfExtraCents) : 0.0), owedCents);
+        balanceCents = owedCents - paidCents;
+
+        Installment installment;
+        installment.paymentNumber = month + 1;
+        installment.paymentDate = p_loanTerms.firstPaymentDate.addMonths(month);
+        installment.paymentCents = static_cast<qint64>(paidCents);
+        installment.interestCents = static_cast<qint64>(interestCents);
+        installment.principalCents = static_cast<qint64>(paidCents - interestCents);
+        installment.balanceCents = static_cast<qint64>(balanceCents);
+        installments.append(installment);
+    }
+
+    return installments;
+}
+
+QVector<LoanSchedule::PayoffSummary> LoanSchedule::summarize(const QVector<LoanTerms> &p_loans, qint64 p_whatIfExtraCents, const QDate &p_whatIfStartDate)
+{
+    QVector<PayoffSummary> payoffSummaries(p_loans.size());
+    QVector<LoanLanes> loanLanes((p_loans.size() + m_LANE_COUNT - 1) / m_LANE_COUNT);
+
+    // Lay the loans out side by side, loans which are not valid and the lanes past the last loan keeping a zero balance so they never change
+    for(int loanIndex = 0; loanIndex < p_loans.size(); loanIndex++)
+    {
+        const LoanTerms &loanTerms = p_loans.at(loanIndex);
+
+        if(!loanTerms.isValid())
+        {
+            continue;
+        }
+
+        LoanLanes &lanes = loanLanes[loanIndex / m_LANE_COUNT];
+        int lane = loanIndex % m_LANE_COUNT;
+        payoffSummaries[loanIndex].scheduledPaymentCents = scheduledPaymentCents(loanTerms);
+        lanes.balanceCents[lane] = static_cast<double>(loanTerms.principalCents);
+        lanes.monthlyRate[lane] = loanTerms.annualRatePercent / 1200.0;
+        lanes.paymentCents[lane] = static_cast<double>(payoffSummaries.at(loanIndex).scheduledPaymentCents + loanTerms.extraPaymentCents);
+        lanes.whatIfStartMonth[lane] = paymentsBefore(loanTerms, p_whatIfStartDate);
+    }
+
+    double whatIfExtraCents = static_cast<double>(p_whatIfExtraCents);
+
+    // Step every loan through each month together, without branches, so each block of lanes is stepped with vector instructions
+    for(int month = 0; month < m_MAX_TERM_MONTHS; month++)
+    {
+        double monthIndex = month;
+
+        for(LoanLanes &lanes : loanLanes)
+        {
+            for(int lane = 0; lane < m_LANE_COUNT; lane++)
+            {
+                double balanceCents = lanes.balanceCents[lane];
+                double interestCents = roundToCent(balanceCents * lanes.monthlyRate[lane]);
+                double owedCents = balanceCents + interestCents;
+                double paymentCents = lanes.paymentCents[lane] + (monthIndex >= lanes.whatIfStartMonth[lane] ? whatIfExtraCents : 0.0);
+                lanes.currentBalanceCents[lane] += monthIndex == lanes.whatIfStartMonth[lane] ? balanceCents : 0.0;
+                lanes.totalInterestCents[lane] += interestCents;
+                lanes.paymentCount[lane] += balanceCents > 0.0 ? 1.0 : 0.0;
+                lanes.balanceCents[lane] = owedCents - std::min(paymentCents, owedCents);
+            }
+        }
+
+        // Stop once every loan has been paid off, checking only now and then since most loans run for years
+        if((month + 1) % m_PAYOFF_CHECK_MONTHS == 0)
+        {
+            bool isAnyLoanOutstanding = false;
+
+            for(const LoanLanes &lanes : qAsConst(loanLanes))
+            {
+                for(int lane = 0; lane < m_LANE_COUNT; lane++)
+                {
+                    isAnyLoanOutstanding = isAnyLoanOutstanding || lanes.balanceCents[lane] > 0.0;
+                }
+            }
+
+            if(!isAnyLoanOutstanding)
+            {
+                break;
+            }
+        }
+    }
+
+    // Read each loan's results back out of its lane
+    for(int loanIndex = 0; loanIndex < p_loans.size(); loanIndex++)
+    {
+        const LoanLanes &lanes = loanLanes.at(loanIndex / m_LANE_COUNT);
+        int lane = loanIndex % m_LANE_COUNT;
+        PayoffSummary &payoffSummary = payoffSummaries[loanIndex];
+        payoffSummary.paymentCount = static_cast<int>(lanes.paymentCount[lane]);
+        payoffSummary.totalInterestCents = static_cast<qint64>(lanes.totalInterestCents[lane]);
+        payoffSummary.currentBalanceCents = static_cast<qint64>(lanes.currentBalanceCents[lane]);
+
+        if(payoffSummary.paymentCount > 0)
+        {
+            payoffSummary.payoffDate = p_loans.at(loanIndex).firstPaymentDate.addMonths(payoffSummary.paymentCount - 1);
+        }
+    }
+
+    return payoffSummaries;
+}
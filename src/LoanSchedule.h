@@ -0,0 +1,136 @@
+/*##################################################################################
+#   File name:          LoanSchedule.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LoanSchedule
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LOANSCHEDULE_H
+#define LOANSCHEDULE_H
+
+// Qt includes
+#include <QDate>
+#include <QVector>
+
+/**
+ * @brief The LoanSchedule class amortizes fixed rate loans repaid in equal monthly payments, with interest compounded monthly and rounded to the cent each month.
+ * A loan's full schedule is only built when it is asked for. Payoff summaries of many loans are computed together, month by month, with the loans laid out side by side in arrays
+ * processed a fixed number of lanes at a time, so the compiler turns each month's step into a few vector instructions and hundreds of multi-decade loans are summarized in well under a millisecond.
+ */
+class LoanSchedule
+{
+
+public:
+
+    /**
+     * @brief The LoanTerms struct describes a loan as it was taken out.
+     */
+    struct LoanTerms
+    {
+        qint64 principalCents = 0; //!< The amount borrowed in cents.
+        double annualRatePercent = 0.0; //!< The nominal yearly interest rate in percent, such as 6.5, compounded monthly.
+        int termMonths = 0; //!< The number of monthly payments the loan is repaid over.
+        QDate firstPaymentDate; //!< The date of the first payment, later payments falling on the same day of each following month.
+        qint64 extraPaymentCents = 0; //!< An amount paid towards the principal on top of every payment.
+
+        /**
+         * @brief Returns whether or not the terms describe a loan which can be amortized.
+         * @return True if the principal and term are positive, the rate is not negative, and the first payment date is valid.
+         */
+        bool isValid() const;
+    };
+
+    /**
+     * @brief The Installment struct is one payment of a loan's schedule.
+     */
+    struct Installment
+    {
+        int paymentNumber = 0; //!< The number of the payment, counting from one.
+        QDate paymentDate; //!< The date the payment is due.
+        qint64 paymentCents = 0; //!< The amount paid, including any extra payment.
+        qint64 interestCents = 0; //!< The part of the payment which pays the month's interest.
+        qint64 principalCents = 0; //!< The part of the payment which pays down the balance.
+        qint64 balanceCents = 0; //!< The balance left after the payment.
+    };
+
+    /**
+     * @brief The PayoffSummary struct is how a loan is paid off, without its individual payments.
+     */
+    struct PayoffSummary
+    {
+        qint64 scheduledPaymentCents = 0; //!< The monthly payment which repays the loan over its term, before any extra payment.
+        int paymentCount = 0; //!< The number of payments made until the loan is paid off.
+        QDate payoffDate; //!< The date of the last payment.
+        qint64 totalInterestCents = 0; //!< The interest paid over the life of the loan.
+        qint64 currentBalanceCents = 0; //!< The balance left before the first payment due on or after the what-if start date.
+    };
+
+    /**
+     * @brief Returns the monthly payment which repays a loan over its term, rounded up to the cent so the term is never exceeded.
+     * @param p_loanTerms - The loan.
+     * @return The payment in cents, or zero if the terms are not valid.
+     */
+    static qint64 scheduledPaymentCents(const LoanTerms &p_loanTerms);
+
+    /**
+     * @brief Returns the number of a loan's payments which are due before a date.
+     * @param p_loanTerms - The loan.
+     * @param p_date - The date, a null date counting no payments.
+     * @return The number of payments due before the date.
+     */
+    static int paymentsBefore(const LoanTerms &p_loanTerms, const QDate &p_date);
+
+    /**
+     * @brief Builds the full schedule of a loan, from its first payment until it is paid off.
+     * @param p_loanTerms - The loan.
+     * @param p_whatIfExtraCents - An amount paid towards the principal on top of every payment due on or after the what-if start date, to see how much sooner the loan is paid off.
+     * @param p_whatIfStartDate - The date the what-if extra payments start from, a null date starting them from the first payment.
+     * @return The payments in date order, empty if the terms are not valid.
+     */
+    static QVector<Installment> schedule(const LoanTerms &p_loanTerms, qint64 p_whatIfExtraCents = 0, const QDate &p_whatIfStartDate = QDate());
+
+    /**
+     * @brief Summarizes how each of many loans is paid off, stepping every loan through each month together. Gives the same results as building each schedule on its own.
+     * @param p_loans - The loans.
+     * @param p_whatIfExtraCents - An amount paid towards the principal of every loan on top of every payment due on or after the what-if start date.
+     * @param p_whatIfStartDate - The date the what-if extra payments start from, and which the current balances are taken at, a null date meaning the first payment of each loan.
+     * @return One summary per loan, in the same order, default summaries standing for loans whose terms are not valid.
+     */
+    static QVector<PayoffSummary> summarize(const QVector<LoanTerms> &p_loans, qint64 p_whatIfExtraCents = 0, const QDate &p_whatIfStartDate = QDate());
+
+private:
+
+    static constexpr int m_LANE_COUNT = 8; //!< The number of loans stepped through a month together, filling a 512-bit vector or two 256-bit ones.
+
+    /**
+     * @brief The LoanLanes struct holds the state of a block of loans being summarized, one array element per loan, so a month's step over the block is a handful of vector instructions.
+     * The arrays are members of one struct rather than separate buffers so the compiler knows they never overlap.
+     */
+    struct LoanLanes
+    {
+        double balanceCents[m_LANE_COUNT] = {}; //!< The balance of each loan, zero once paid off.
+        double monthlyRate[m_LANE_COUNT] = {}; //!< The interest rate of each loan per month, as a fraction.
+        double paymentCents[m_LANE_COUNT] = {}; //!< The scheduled payment of each loan, with its standing extra payment.
+        double whatIfStartMonth[m_LANE_COUNT] = {}; //!< The index of each loan's first payment which the what-if extra payment is added to.
+        double totalInterestCents[m_LANE_COUNT] = {}; //!< The interest each loan has paid so far.
+        double paymentCount[m_LANE_COUNT] = {}; //!< The number of payments each loan has made so far.
+        double currentBalanceCents[m_LANE_COUNT] = {}; //!< The balance of each loan before its first what-if payment.
+    };
+
+    /**
+     * @brief Rounds a non-negative amount of cents to the nearest whole cent, ties going to the even cent, using arithmetic alone so loops calling it can be vectorized.
+     * Adding and subtracting 1.5 * 2^52 leaves no bits for a fraction, so the hardware rounds it away. Exact for amounts below 2^51 cents.
+     * @param p_cents - The amount in cents.
+     * @return The amount rounded to a whole number of cents.
+     */
+    static double roundToCent(double p_cents);
+
+    static constexpr int m_MAX_TERM_MONTHS = 1200; //!< The longest term amortized, a hundred years, guarding against terms typed with too many digits.
+    static constexpr int m_PAYOFF_CHECK_MONTHS = 12; //!< How often, in months, the summaries check whether every loan has been paid off and stop early.
+    static constexpr double m_ROUNDING_CONSTANT = 6755399441055744.0; //!< 1.5 * 2^52, which rounds a double to a whole number when added and subtracted.
+
+};
+
+#endif // LOANSCHEDULE_H
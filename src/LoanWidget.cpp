@@ -0,0 +1,338 @@
+/*##################################################################################
+#   File name:          LoanWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a LoanWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "LoanWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+#include <cmath>
+
+LoanWidget::LoanWidget()
+{
+    // Set the title and size of the LoanWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(800, 650);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When another bill is chosen, fill in its terms and schedule
+    connect(m_billInput, SIGNAL(currentIndexChanged(int)), this, SIGNAL(billChosen()), Qt::AutoConnection);
+
+    // When a loan is clicked in the loan table, choose its bill
+    connect(m_loanTableWidget, SIGNAL(cellClicked(int,int)), this, SLOT(chooseLoanRow(int,int)), Qt::AutoConnection);
+
+    // When the what-if extra payment changes, summarize the loans again
+    connect(m_whatIfInput, SIGNAL(valueChanged(double)), this, SIGNAL(whatIfRequested()), Qt::AutoConnection);
+
+    // When the Save Loan or Remove Loan button is clicked, ask for the chosen bill to be changed
+    connect(m_saveLoanButton, SIGNAL(clicked()), this, SIGNAL(saveLoanRequested()), Qt::AutoConnection);
+    connect(m_removeLoanButton, SIGNAL(clicked()), this, SIGNAL(removeLoanRequested()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the LoanWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+LoanWidget::~LoanWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_billLabel);
+    deleteLabelIfNonNull(m_principalLabel);
+    deleteLabelIfNonNull(m_rateLabel);
+    deleteLabelIfNonNull(m_termLabel);
+    deleteLabelIfNonNull(m_firstPaymentLabel);
+    deleteLabelIfNonNull(m_extraPaymentLabel);
+    deleteLabelIfNonNull(m_whatIfLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteButtonIfNonNull(m_saveLoanButton);
+    deleteButtonIfNonNull(m_removeLoanButton);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the bill combo box was created successfully
+    if(m_billInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_billInput;
+        m_billInput = nullptr;
+    }
+
+    // If the principal spin box was created successfully
+    if(m_principalInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_principalInput;
+        m_principalInput = nullptr;
+    }
+
+    // If the rate spin box was created successfully
+    if(m_rateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_rateInput;
+        m_rateInput = nullptr;
+    }
+
+    // If the term spin box was created successfully
+    if(m_termInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_termInput;
+        m_termInput = nullptr;
+    }
+
+    // If the extra payment spin box was created successfully
+    if(m_extraPaymentInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_extraPaymentInput;
+        m_extraPaymentInput = nullptr;
+    }
+
+    // If the what-if spin box was created successfully
+    if(m_whatIfInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_whatIfInput;
+        m_whatIfInput = nullptr;
+    }
+
+    // If the first payment date edit was created successfully
+    if(m_firstPaymentInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_firstPaymentInput;
+        m_firstPaymentInput = nullptr;
+    }
+
+    // If the loan table widget was created successfully
+    if(m_loanTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_loanTableWidget;
+        m_loanTableWidget = nullptr;
+    }
+
+    // If the schedule table widget was created successfully
+    if(m_scheduleTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_scheduleTableWidget;
+        m_scheduleTableWidget = nullptr;
+    }
+}
+
+void LoanWidget::setBills(const QStringList &p_billKeys, const QStringList &p_billNames)
+{
+    // Refill the combo box without announcing each change, then announce the choice once
+    QString chosenBillKey = getChosenBillKey();
+    m_billInput->blockSignals(true);
+    m_billInput->clear();
+
+    for(int billIndex = 0; billIndex < p_billKeys.size(); billIndex++)
+    {
+        m_billInput->addItem(p_billNames.value(billIndex, p_billKeys.at(billIndex)), p_billKeys.at(billIndex));
+    }
+
+    m_billInput->setCurrentIndex(qMax(0, m_billInput->findData(chosenBillKey)));
+    m_billInput->blockSignals(false);
+    emit billChosen();
+}
+
+QString LoanWidget::getChosenBillKey() const
+{
+    return m_billInput->currentData().toString();
+}
+
+LoanSchedule::LoanTerms LoanWidget::getLoanTerms() const
+{
+    LoanSchedule::LoanTerms loanTerms;
+    loanTerms.principalCents = std::llround(m_principalInput->value() * 100.0);
+    loanTerms.annualRatePercent = m_rateInput->value();
+    loanTerms.termMonths = m_termInput->value();
+    loanTerms.firstPaymentDate = m_firstPaymentInput->date();
+    loanTerms.extraPaymentCents = std::llround(m_extraPaymentInput->value() * 100.0);
+    return loanTerms;
+}
+
+void LoanWidget::setLoanTerms(const LoanSchedule::LoanTerms &p_loanTerms)
+{
+    // Bills which are not loans yet start from a blank thirty year loan whose first payment is next month
+    bool isLoan = p_loanTerms.isValid();
+    m_principalInput->setValue(isLoan ? p_loanTerms.principalCents / 100.0 : 0.00);
+    m_rateInput->setValue(isLoan ? p_loanTerms.annualRatePercent : 0.0);
+    m_termInput->setValue(isLoan ? p_loanTerms.termMonths : m_DEFAULT_TERM_MONTHS);
+    m_firstPaymentInput->setDate(isLoan ? p_loanTerms.firstPaymentDate : QDate::currentDate().addMonths(1));
+    m_extraPaymentInput->setValue(isLoan ? p_loanTerms.extraPaymentCents / 100.0 : 0.00);
+    m_removeLoanButton->setEnabled(isLoan);
+}
+
+qint64 LoanWidget::getWhatIfExtraCents() const
+{
+    return std::llround(m_whatIfInput->value() * 100.0);
+}
+
+void LoanWidget::setLoans(const QVector<LoanRow> &p_loanRows, qint64 p_elapsedNsecs)
+{
+    m_loanTableWidget->setRowCount(p_loanRows.size());
+    qint64 interestSavedCents = 0;
+
+    // List each loan, with what paying extra would change
+    for(int row = 0; row < p_loanRows.size(); row++)
+    {
+        const LoanRow &loanRow = p_loanRows.at(row);
+        qint64 loanInterestSavedCents = loanRow.payoffSummary.totalInterestCents - loanRow.whatIfSummary.totalInterestCents;
+        QTableWidgetItem *billItem = new QTableWidgetItem(loanRow.billName);
+        billItem->setData(Qt::UserRole, loanRow.billKey);
+
+        m_loanTableWidget->setItem(row, 0, billItem);
+        m_loanTableWidget->setItem(row, 1, new QTableWidgetItem(formatCents(loanRow.payoffSummary.currentBalanceCents)));
+        m_loanTableWidget->setItem(row, 2, new QTableWidgetItem(formatCents(loanRow.payoffSummary.scheduledPaymentCents)));
+        m_loanTableWidget->setItem(row, 3, new QTableWidgetItem(loanRow.payoffSummary.payoffDate.toString(m_DATE_FORMAT)));
+        m_loanTableWidget->setItem(row, 4, new QTableWidgetItem(formatCents(loanRow.payoffSummary.totalInterestCents)));
+        m_loanTableWidget->setItem(row, 5, new QTableWidgetItem(loanRow.whatIfSummary.payoffDate.toString(m_DATE_FORMAT)));
+        m_loanTableWidget->setItem(row, 6, new QTableWidgetItem(QString::number(loanRow.payoffSummary.paymentCount - loanRow.whatIfSummary.paymentCount)));
+        m_loanTableWidget->setItem(row, 7, new QTableWidgetItem(formatCents(loanInterestSavedCents)));
+        m_loanTableWidget->setItem(row, 8, new QTableWidgetItem(loanRow.currencyCode));
+        interestSavedCents += loanInterestSavedCents;
+    }
+
+    // Summarize every loan, noting how long it took so the speed of recomputing can be seen
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(p_loanRows.size()).arg(formatCents(interestSavedCents)));
+    m_summaryLabel->setToolTip(m_SUMMARY_TOOLTIP_TEXT.arg(QString::number(p_elapsedNsecs / 1000000.0, 'f', 3)));
+}
+
+void LoanWidget::setSchedule(const QVector<LoanSchedule::Installment> &p_installments)
+{
+    m_scheduleTableWidget->setRowCount(p_installments.size());
+
+    for(int row = 0; row < p_installments.size(); row++)
+    {
+        const LoanSchedule::Installment &installment = p_installments.at(row);
+
+        m_scheduleTableWidget->setItem(row, 0, new QTableWidgetItem(QString::number(installment.paymentNumber)));
+        m_scheduleTableWidget->setItem(row, 1, new QTableWidgetItem(installment.paymentDate.toString(m_DATE_FORMAT)));
+        m_scheduleTableWidget->setItem(row, 2, new QTableWidgetItem(formatCents(installment.paymentCents)));
+        m_scheduleTableWidget->setItem(row, 3, new QTableWidgetItem(formatCents(installment.interestCents)));
+        m_scheduleTableWidget->setItem(row, 4, new QTableWidgetItem(formatCents(installment.principalCents)));
+        m_scheduleTableWidget->setItem(row, 5, new QTableWidgetItem(formatCents(installment.balanceCents)));
+    }
+}
+
+void LoanWidget::chooseLoanRow(int p_row, int p_column)
+{
+    Q_UNUSED(p_column);
+    QTableWidgetItem *billItem = m_loanTableWidget->item(p_row, 0);
+
+    if(billItem != nullptr)
+    {
+        m_billInput->setCurrentIndex(m_billInput->findData(billItem->data(Qt::UserRole)));
+    }
+}
+
+void LoanWidget::initializeWidget()
+{
+    // Create the bill label and combo box
+    m_billLabel = new QLabel(this);
+    m_billLabel->setText(m_BILL_LABEL_TEXT);
+    m_billInput = new QComboBox(this);
+
+    // Create the loan terms labels and inputs
+    m_principalLabel = new QLabel(this);
+    m_principalLabel->setText(m_PRINCIPAL_LABEL_TEXT);
+    m_principalInput = new QDoubleSpinBox(this);
+    m_principalInput->setRange(0.00, m_MAX_PRINCIPAL);
+
+    m_rateLabel = new QLabel(this);
+    m_rateLabel->setText(m_RATE_LABEL_TEXT);
+    m_rateInput = new QDoubleSpinBox(this);
+    m_rateInput->setRange(0.0, m_MAX_RATE_PERCENT);
+    m_rateInput->setDecimals(m_RATE_DECIMAL_PLACES);
+
+    m_termLabel = new QLabel(this);
+    m_termLabel->setText(m_TERM_LABEL_TEXT);
+    m_termInput = new QSpinBox(this);
+    m_termInput->setRange(1, m_MAX_TERM_MONTHS);
+
+    m_firstPaymentLabel = new QLabel(this);
+    m_firstPaymentLabel->setText(m_FIRST_PAYMENT_LABEL_TEXT);
+    m_firstPaymentInput = new QDateEdit(this);
+    m_firstPaymentInput->setCalendarPopup(true);
+    m_firstPaymentInput->setDisplayFormat(m_DATE_FORMAT);
+
+    m_extraPaymentLabel = new QLabel(this);
+    m_extraPaymentLabel->setText(m_EXTRA_PAYMENT_LABEL_TEXT);
+    m_extraPaymentInput = new QDoubleSpinBox(this);
+    m_extraPaymentInput->setRange(0.00, m_MAX_PRINCIPAL);
+
+    // Create the what-if label and spin box, which recomputes every loan as it is changed
+    m_whatIfLabel = new QLabel(this);
+    m_whatIfLabel->setText(m_WHAT_IF_LABEL_TEXT);
+    m_whatIfInput = new QDoubleSpinBox(this);
+    m_whatIfInput->setRange(0.00, m_MAX_PRINCIPAL);
+    m_whatIfInput->setSingleStep(m_WHAT_IF_STEP_SIZE);
+
+    // Create the summary label and the read-only loan and schedule tables
+    m_summaryLabel = new QLabel(this);
+
+    m_loanTableWidget = new QTableWidget(this);
+    m_loanTableWidget->setColumnCount(m_LOAN_TABLE_HEADER_STRING.split(";").size());
+    m_loanTableWidget->setHorizontalHeaderLabels(m_LOAN_TABLE_HEADER_STRING.split(";"));
+    m_loanTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_loanTableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_loanTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    m_scheduleTableWidget = new QTableWidget(this);
+    m_scheduleTableWidget->setColumnCount(m_SCHEDULE_TABLE_HEADER_STRING.split(";").size());
+    m_scheduleTableWidget->setHorizontalHeaderLabels(m_SCHEDULE_TABLE_HEADER_STRING.split(";"));
+    m_scheduleTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_scheduleTableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_scheduleTableWidget->verticalHeader()->hide();
+
+    // Create the Save Loan, Remove Loan, and Close buttons
+    m_saveLoanButton = new QPushButton(this);
+    m_saveLoanButton->setText(m_SAVE_LOAN_BUTTON_TEXT);
+    m_removeLoanButton = new QPushButton(this);
+    m_removeLoanButton->setText(m_REMOVE_LOAN_BUTTON_TEXT);
+    m_removeLoanButton->setEnabled(false);
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout, the terms above the loans and the chosen loan's schedule below them
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_billLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_billInput, 0, 1);
+    m_gridLayout->addWidget(m_principalLabel, 0, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_principalInput, 0, 3);
+    m_gridLayout->addWidget(m_rateLabel, 1, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_rateInput, 1, 1);
+    m_gridLayout->addWidget(m_termLabel, 1, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_termInput, 1, 3);
+    m_gridLayout->addWidget(m_firstPaymentLabel, 2, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_firstPaymentInput, 2, 1);
+    m_gridLayout->addWidget(m_extraPaymentLabel, 2, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_extraPaymentInput, 2, 3);
+    m_gridLayout->addWidget(m_saveLoanButton, 3, 2);
+    m_gridLayout->addWidget(m_removeLoanButton, 3, 3);
+    m_gridLayout->addWidget(m_whatIfLabel, 4, 0, 1, 2, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_whatIfInput, 4, 2);
+    m_gridLayout->addWidget(m_summaryLabel, 5, 0, 1, 4);
+    m_gridLayout->addWidget(m_loanTableWidget, 6, 0, 1, 4);
+    m_gridLayout->addWidget(m_scheduleTableWidget, 7, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 8, 3);
+    m_gridLayout->setRowStretch(6, 1);
+    m_gridLayout->setRowStretch(7, 2);
+
+    setLoanTerms(LoanSchedule::LoanTerms());
+}
+
+QString LoanWidget::formatCents(qint64 p_cents)
+{
+    return QString::number(p_cents / 100.0, 'f', 2);
+}
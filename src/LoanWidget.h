@@ -0,0 +1,203 @@
+/*##################################################################################
+#   File name:          LoanWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a LoanWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef LOANWIDGET_H
+#define LOANWIDGET_H
+
+// Local file includes
+#include "LoanSchedule.h"
+
+// Qt includes
+#include <QComboBox>
+#include <QDateEdit>
+#include <QDoubleSpinBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTableWidget>
+
+/**
+ * @brief The LoanWidget class represents a pop-up window for turning bills into loans, listing how each loan is paid off, and seeing how much sooner they would be paid off with an extra payment each month.
+ * The terms, summaries, and schedules are kept and computed by the MainWindow, which is asked for them whenever a bill is chosen, a loan is saved or removed, or the what-if extra payment changes.
+ */
+class LoanWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief The LoanRow struct is one loan as listed by the LoanWidget.
+     */
+    struct LoanRow
+    {
+        QString billKey; //!< The bill map key of the loan's bill.
+        QString billName; //!< The name of the loan's bill.
+        QString currencyCode; //!< The currency of the loan's bill, which its amounts are in.
+        LoanSchedule::PayoffSummary payoffSummary; //!< How the loan is paid off as it stands.
+        LoanSchedule::PayoffSummary whatIfSummary; //!< How the loan is paid off with the what-if extra payment.
+    };
+
+    /**
+     * @brief Constructs a widget for managing loans.
+     */
+    LoanWidget();
+
+    /**
+     * @brief Destructs the LoanWidget by deleting objects which were dynamically allocated.
+     */
+    ~LoanWidget();
+
+    /**
+     * @brief Offers bills to be made loans, keeping the chosen bill chosen if it is still offered.
+     * @param p_billKeys - The bill map keys of the bills, in the order they are offered.
+     * @param p_billNames - The names of the bills, in the same order.
+     */
+    void setBills(const QStringList &p_billKeys, const QStringList &p_billNames);
+
+    /**
+     * @brief Returns the chosen bill.
+     * @return The bill map key of the bill, or an empty string if there are no bills.
+     */
+    QString getChosenBillKey() const;
+
+    /**
+     * @brief Returns the loan terms entered.
+     * @return The terms.
+     */
+    LoanSchedule::LoanTerms getLoanTerms() const;
+
+    /**
+     * @brief Fills in the terms of the chosen bill's loan, or clears them for a new loan.
+     * @param p_loanTerms - The terms, which are cleared if they are not valid.
+     */
+    void setLoanTerms(const LoanSchedule::LoanTerms &p_loanTerms);
+
+    /**
+     * @brief Returns the what-if extra payment.
+     * @return The amount in cents added to every payment due from today on.
+     */
+    qint64 getWhatIfExtraCents() const;
+
+    /**
+     * @brief Lists the loans and summarizes them.
+     * @param p_loanRows - The loans.
+     * @param p_elapsedNsecs - How long summarizing every loan took, in nanoseconds.
+     */
+    void setLoans(const QVector<LoanRow> &p_loanRows, qint64 p_elapsedNsecs);
+
+    /**
+     * @brief Lists every payment of the chosen bill's loan with the what-if extra payment.
+     * @param p_installments - The payments, empty if the bill is not a loan.
+     */
+    void setSchedule(const QVector<LoanSchedule::Installment> &p_installments);
+
+signals:
+
+    /**
+     * @brief Emitted when another bill is chosen, so its terms and schedule can be filled in.
+     */
+    void billChosen();
+
+    /**
+     * @brief Emitted when the Save Loan button is clicked, so the chosen bill can be made a loan with the terms entered.
+     */
+    void saveLoanRequested();
+
+    /**
+     * @brief Emitted when the Remove Loan button is clicked, so the chosen bill can be made an ordinary bill again.
+     */
+    void removeLoanRequested();
+
+    /**
+     * @brief Emitted when the what-if extra payment changes, so the loans can be summarized again.
+     */
+    void whatIfRequested();
+
+private slots:
+
+    /**
+     * @brief Chooses the bill of a row of the loan table.
+     * @param p_row - The row.
+     * @param p_column - The column, which is unused.
+     */
+    void chooseLoanRow(int p_row, int p_column);
+
+private:
+
+    /**
+     * @brief Creates the labels, inputs, tables, and buttons of the LoanWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Formats an amount in cents with two decimal places.
+     * @param p_cents - The amount in cents.
+     * @return The amount in dollars.
+     */
+    static QString formatCents(qint64 p_cents);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Loans"; //!< Title of the LoanWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the LoanWidget.
+    const QString m_DATE_FORMAT = "M/d/yyyy"; //!< The format dates are shown in, the same as the bill table's.
+
+    // Loan terms fields
+    QLabel *m_billLabel = nullptr; //!< Label for the combo box used for choosing the loan's bill.
+    const QString m_BILL_LABEL_TEXT = "Bill:"; //!< Text for the label for the loan's bill.
+    QComboBox *m_billInput = nullptr; //!< The combo box used for choosing the loan's bill.
+    QLabel *m_principalLabel = nullptr; //!< Label for the spin box used for entering the amount borrowed.
+    const QString m_PRINCIPAL_LABEL_TEXT = "Principal:"; //!< Text for the label for the amount borrowed.
+    QDoubleSpinBox *m_principalInput = nullptr; //!< The spin box used for entering the amount borrowed.
+    QLabel *m_rateLabel = nullptr; //!< Label for the spin box used for entering the yearly interest rate.
+    const QString m_RATE_LABEL_TEXT = "Rate (%/yr):"; //!< Text for the label for the yearly interest rate.
+    QDoubleSpinBox *m_rateInput = nullptr; //!< The spin box used for entering the yearly interest rate.
+    QLabel *m_termLabel = nullptr; //!< Label for the spin box used for entering the number of monthly payments.
+    const QString m_TERM_LABEL_TEXT = "Term (months):"; //!< Text for the label for the number of monthly payments.
+    QSpinBox *m_termInput = nullptr; //!< The spin box used for entering the number of monthly payments.
+    QLabel *m_firstPaymentLabel = nullptr; //!< Label for the date edit used for choosing the date of the first payment.
+    const QString m_FIRST_PAYMENT_LABEL_TEXT = "First Payment:"; //!< Text for the label for the date of the first payment.
+    QDateEdit *m_firstPaymentInput = nullptr; //!< The date edit used for choosing the date of the first payment.
+    QLabel *m_extraPaymentLabel = nullptr; //!< Label for the spin box used for entering the amount paid on top of every payment.
+    const QString m_EXTRA_PAYMENT_LABEL_TEXT = "Extra Each Month:"; //!< Text for the label for the amount paid on top of every payment.
+    QDoubleSpinBox *m_extraPaymentInput = nullptr; //!< The spin box used for entering the amount paid on top of every payment.
+    const double m_MAX_PRINCIPAL = 99999999.99; //!< The largest amount which can be borrowed or paid, which a bill can still hold.
+    const double m_MAX_RATE_PERCENT = 100.0; //!< The largest yearly interest rate which can be entered.
+    const int m_RATE_DECIMAL_PLACES = 3; //!< The number of decimal places of the interest rate.
+    const int m_DEFAULT_TERM_MONTHS = 360; //!< The term filled in for a new loan, thirty years.
+    const int m_MAX_TERM_MONTHS = 1200; //!< The longest term which can be entered, a hundred years.
+
+    // What-if fields
+    QLabel *m_whatIfLabel = nullptr; //!< Label for the spin box used for entering the what-if extra payment.
+    const QString m_WHAT_IF_LABEL_TEXT = "What If I Paid Extra Each Month:"; //!< Text for the label for the what-if extra payment.
+    QDoubleSpinBox *m_whatIfInput = nullptr; //!< The spin box used for entering the what-if extra payment.
+    const double m_WHAT_IF_STEP_SIZE = 25.0; //!< The amount the what-if extra payment changes by per step.
+
+    // Loan table fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing every loan.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 loan(s), paying extra saves %2 in interest across them"; //!< Text of the summary label, given the number of loans and the interest saved.
+    const QString m_SUMMARY_TOOLTIP_TEXT = "Every loan was summarized in %1 ms"; //!< Tooltip of the summary label, noting how long summarizing took.
+    QTableWidget *m_loanTableWidget = nullptr; //!< Table listing how each loan is paid off.
+    const QString m_LOAN_TABLE_HEADER_STRING = "Bill;Balance;Payment;Payoff;Interest;What-If Payoff;Months Saved;Interest Saved;Currency"; //!< The loan table column titles, separated by semicolons.
+
+    // Schedule table fields
+    QTableWidget *m_scheduleTableWidget = nullptr; //!< Table listing every payment of the chosen bill's loan.
+    const QString m_SCHEDULE_TABLE_HEADER_STRING = "#;Date;Payment;Interest;Principal;Balance"; //!< The schedule table column titles, separated by semicolons.
+
+    // Button and button text variables
+    QPushButton *m_saveLoanButton = nullptr; //!< Push button used for making the chosen bill a loan.
+    const QString m_SAVE_LOAN_BUTTON_TEXT = "Save Loan"; //!< Text used for the Save Loan push button.
+    QPushButton *m_removeLoanButton = nullptr; //!< Push button used for making the chosen bill an ordinary bill again.
+    const QString m_REMOVE_LOAN_BUTTON_TEXT = "Remove Loan"; //!< Text used for the Remove Loan push button.
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the LoanWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // LOANWIDGET_H
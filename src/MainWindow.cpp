@@ -15,6 +15,18 @@
 #include <QInputDialog>
 #include <QApplication>
 #include <QComboBox>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QHeaderView>
+#include <QJsonArray>
+#include <QRandomGenerator>
+#include <QSet>
+#include <QStatusBar>
+#include <QStyle>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 MainWindow::MainWindow()
 {
@@ -22,7 +34,7 @@ MainWindow::MainWindow()
     this->setWindowTitle(m_APP_NAME);
 
     // Size the MainWindow appropriately
-    this->setGeometry(0, 0, 500, 520);
+    this->setGeometry(0, 0, 750, 520);
 
     // Create the BillWidget
     m_billWidget = new BillWidget(this);
@@ -39,19 +51,52 @@ MainWindow::MainWindow()
     // When the BillWidget's Done button is clicked, save the currently entered bill information to the config file and display the bill table widget
     connect(m_billWidget->getDoneButton(), SIGNAL(clicked()), this, SLOT(saveBillAndDisplayBillTableWidget()), Qt::AutoConnection);
 
+    // When bills are pasted into the BillWidget, check every row as the text changes
+    connect(m_billWidget->getPasteInput(), SIGNAL(textChanged()), this, SLOT(validatePastedBills()), Qt::AutoConnection);
+
+    // When the BillWidget's Add Pasted Bills button is clicked, save every valid pasted bill to the config file at once
+    connect(m_billWidget->getAddPastedButton(), SIGNAL(clicked()), this, SLOT(savePastedBills()), Qt::AutoConnection);
+
     // Create the amount available label and set its location and text
     m_amountAvailableLabel = new QLabel(this);
     m_amountAvailableLabel->setGeometry(0, 0, 150, 20);
-    m_amountAvailableLabel->setText(m_TOTAL_AMOUNT_AVAILABLE_STRING);
+    updateAmountAvailableLabel();
 
     // Create the amount available line edit and set its location
     m_amountAvailableEdit = new QLineEdit(this);
     m_amountAvailableEdit->setGeometry(155, 0, 75, 20);
 
+    // Create the left to fund label beneath the amount available
+    m_leftToFundLabel = new QLabel(this);
+    m_leftToFundLabel->setGeometry(0, 20, 245, 20);
+
+    // Create the read-only category summary table to the right of the amount available and buttons
+    m_categorySummaryTable = new QTableWidget(this);
+    m_categorySummaryTable->setGeometry(505, 0, 245, 520);
+    m_categorySummaryTable->setColumnCount(m_CATEGORY_SUMMARY_HEADER_STRING.split(";").size());
+    m_categorySummaryTable->setHorizontalHeaderLabels(m_CATEGORY_SUMMARY_HEADER_STRING.split(";"));
+    m_categorySummaryTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_categorySummaryTable->verticalHeader()->hide();
+
     // Create the bill table widget and set its location
     m_billTableWidget = new QTableWidget(this);
     m_billTableWidget->setGeometry(0, 100, 500, 500);
 
+    // When a bill name or amount due is edited in the bill table widget, re-index it so searches and sorting reflect the edit
+    connect(m_billTableWidget, SIGNAL(itemChanged(QTableWidgetItem*)), this, SLOT(updateIndexesForItem(QTableWidgetItem*)), Qt::AutoConnection);
+
+    // When a column header is clicked, sort the bills by that column
+    connect(m_billTableWidget->horizontalHeader(), SIGNAL(sectionClicked(int)), this, SLOT(sortBillsByColumn(int)), Qt::AutoConnection);
+
+    // Create the search line edit and set its location just above the bill table widget
+    m_searchEdit = new QLineEdit(this);
+    m_searchEdit->setGeometry(0, 75, 245, 20);
+    m_searchEdit->setPlaceholderText(m_SEARCH_PLACEHOLDER_TEXT);
+    m_searchEdit->setClearButtonEnabled(true);
+
+    // As the user types, filter the bill table widget down to the bills matching the search text
+    connect(m_searchEdit, SIGNAL(textChanged(QString)), this, SLOT(filterBillsBySearch(QString)), Qt::AutoConnection);
+
     // Create the save button
     m_saveButton = new QPushButton(this);
     m_saveButton->setText(m_SAVE_BUTTON_TEXT);
@@ -94,15 +139,202 @@ MainWindow::MainWindow()
     // When the Reset Bills button is clicked, prompt the user to confirm the action before resetting or retaining bill data
     connect(m_resetBillsButton, SIGNAL(clicked()), this, SLOT(createResetBillsConfirmationBox()), Qt::AutoConnection);
 
+    // Create the Tools button beneath the amount available, which opens a menu of additional tools
+    m_toolsButton = new QPushButton(this);
+    m_toolsButton->setText(m_TOOLS_BUTTON_TEXT);
+    m_toolsButton->setGeometry(0, 40, 100, 25);
+    m_toolsMenu = new QMenu(this);
+    m_toolsButton->setMenu(m_toolsMenu);
+
+    // When the Ledger History action is triggered, display the transaction history
+    connect(m_toolsMenu->addAction(m_LEDGER_HISTORY_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showLedgerHistory()), Qt::AutoConnection);
+
+    // Create the LedgerHistoryWidget which displays the transaction ledger
+    m_ledgerHistoryWidget = new LedgerHistoryWidget(&m_transactionLedger);
+
+    // When the Balance History action is triggered, display how the totals changed over time
+    connect(m_toolsMenu->addAction(m_BALANCE_HISTORY_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showBalanceHistory()), Qt::AutoConnection);
+
+    // Create the BalanceHistoryWidget which displays the balance history
+    m_balanceHistoryWidget = new BalanceHistoryWidget(&m_balanceHistory);
+
+    // When the Bill Archive action is triggered, display the archived bills
+    connect(m_toolsMenu->addAction(m_BILL_ARCHIVE_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showBillArchive()), Qt::AutoConnection);
+
+    // Create the BillArchiveWidget which displays the bill archive
+    m_billArchiveWidget = new BillArchiveWidget(&m_billArchive);
+
+    // When the Periodic Report action is triggered, display the totals of each period
+    connect(m_toolsMenu->addAction(m_PERIOD_REPORT_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showPeriodReport()), Qt::AutoConnection);
+
+    // Create the PeriodReportWidget, recomputing the report whenever its range or period length changes
+    m_periodReportWidget = new PeriodReportWidget();
+    connect(m_periodReportWidget, SIGNAL(reportRequested()), this, SLOT(refreshPeriodReport()), Qt::AutoConnection);
+
+    // When the Bill Calendar action is triggered, display the bills due in each day of a month
+    connect(m_toolsMenu->addAction(m_BILL_CALENDAR_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showBillCalendar()), Qt::AutoConnection);
+
+    // Create the BillCalendarWidget, filling it again whenever it pages to another month or a day is selected
+    m_billCalendarWidget = new BillCalendarWidget();
+    connect(m_billCalendarWidget, SIGNAL(calendarRequested()), this, SLOT(refreshBillCalendar()), Qt::AutoConnection);
+
+    // When the Reminder Lead Time action is triggered, ask how far ahead bills should be reminded of
+    connect(m_toolsMenu->addAction(m_REMINDER_LEAD_TIME_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(chooseReminderLeadDays()), Qt::AutoConnection);
+
+    // Use the saved reminder lead time, if there is one
+    QSettings reminderSettings(m_REMINDER_FILE_DIRECTORY_NAME, QSettings::IniFormat);
+    m_reminderScheduler.setLeadDays(reminderSettings.value(m_REMINDER_LEAD_DAYS_KEY, m_reminderScheduler.getLeadDays()).toInt());
+
+    // Create the timer which fires once the earliest reminder is due, and the tray icon reminders are shown from if the system has a tray
+    m_reminderTimer = new QTimer(this);
+    m_reminderTimer->setSingleShot(true);
+    connect(m_reminderTimer, SIGNAL(timeout()), this, SLOT(deliverDueReminders()), Qt::AutoConnection);
+    m_reminderTrayIcon = new QSystemTrayIcon(style()->standardIcon(QStyle::SP_MessageBoxInformation), this);
+    m_reminderTrayIcon->setToolTip(m_REMINDER_TITLE_TEXT);
+
+    if(QSystemTrayIcon::isSystemTrayAvailable())
+    {
+        m_reminderTrayIcon->show();
+    }
+
+    // When the Reconcile Statement action is triggered, display the window for matching a bank statement to the bills
+    connect(m_toolsMenu->addAction(m_RECONCILE_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showReconciliation()), Qt::AutoConnection);
+
+    // Create the ReconciliationWidget, loading statements as they are chosen and matching them again whenever the settings change
+    m_reconciliationWidget = new ReconciliationWidget();
+    connect(m_reconciliationWidget, SIGNAL(statementChosen(QString)), this, SLOT(loadStatement(QString)), Qt::AutoConnection);
+    connect(m_reconciliationWidget, SIGNAL(reconcileRequested()), this, SLOT(refreshReconciliation()), Qt::AutoConnection);
+    connect(m_reconciliationWidget, SIGNAL(applyRequested()), this, SLOT(applyReconciliationMatches()), Qt::AutoConnection);
+
+    // When the Loans action is triggered, display the loans and their payoff what-ifs
+    connect(m_toolsMenu->addAction(m_LOANS_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showLoans()), Qt::AutoConnection);
+
+    // Create the LoanWidget, filling in a loan whenever its bill is chosen and summarizing the loans again whenever the what-if extra payment changes
+    m_loanWidget = new LoanWidget();
+    connect(m_loanWidget, SIGNAL(billChosen()), this, SLOT(showChosenLoan()), Qt::AutoConnection);
+    connect(m_loanWidget, SIGNAL(whatIfRequested()), this, SLOT(refreshLoans()), Qt::AutoConnection);
+    connect(m_loanWidget, SIGNAL(saveLoanRequested()), this, SLOT(saveChosenLoan()), Qt::AutoConnection);
+    connect(m_loanWidget, SIGNAL(removeLoanRequested()), this, SLOT(removeChosenLoan()), Qt::AutoConnection);
+
+    // When the Scenarios action is triggered, display the what-if scenarios side by side
+    connect(m_toolsMenu->addAction(m_SCENARIOS_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showScenarios()), Qt::AutoConnection);
+
+    // Create the ScenarioWidget, listing a scenario's changes whenever it is chosen and totalling the scenarios again whenever one changes
+    m_scenarioWidget = new ScenarioWidget();
+    connect(m_scenarioWidget, SIGNAL(scenarioChosen()), this, SLOT(showChosenScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(newScenarioRequested()), this, SLOT(createScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(forkScenarioRequested()), this, SLOT(forkChosenScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(deleteScenarioRequested()), this, SLOT(deleteChosenScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(promoteScenarioRequested()), this, SLOT(promoteChosenScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(fundBillsRequested()), this, SLOT(fundBillsInScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(defundBillsRequested()), this, SLOT(defundBillsInScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(removeBillsRequested()), this, SLOT(removeBillsInScenario()), Qt::AutoConnection);
+    connect(m_scenarioWidget, SIGNAL(adjustAmountAvailableRequested()), this, SLOT(adjustScenarioAmountAvailable()), Qt::AutoConnection);
+
+    // When the Cash Flow Simulation action is triggered, display the chance of running short over the months ahead
+    connect(m_toolsMenu->addAction(m_CASH_FLOW_SIMULATION_ACTION_TEXT), SIGNAL(triggered()), this, SLOT(showCashFlowSimulation()), Qt::AutoConnection);
+
+    // Create the CashFlowSimulationWidget, starting and stopping simulations in the background as its buttons are clicked
+    m_cashFlowSimulationWidget = new CashFlowSimulationWidget();
+    connect(m_cashFlowSimulationWidget, SIGNAL(runRequested()), this, SLOT(runCashFlowSimulation()), Qt::AutoConnection);
+    connect(m_cashFlowSimulationWidget, SIGNAL(cancelRequested()), this, SLOT(cancelCashFlowSimulation()), Qt::AutoConnection);
+
     // Organize the buttons into a grid layout
     createButtonGridLayout();
 
+    // Create the job manager which loads and saves the config file off the GUI thread
+    m_jobManager = new JobManager(this);
+
+    // Display progress and apply results as background jobs post them
+    connect(m_jobManager, SIGNAL(jobProgress(quint64,int,QString)), this, SLOT(handleJobProgress(quint64,int,QString)), Qt::AutoConnection);
+    connect(m_jobManager, SIGNAL(jobFinished(quint64,QVariant)), this, SLOT(handleJobFinished(quint64,QVariant)), Qt::AutoConnection);
+    connect(m_jobManager, SIGNAL(jobPartialResult(quint64,int,QVariant)), this, SLOT(handleJobPartialResult(quint64,int,QVariant)), Qt::AutoConnection);
+    connect(m_jobManager, SIGNAL(jobCancelled(quint64,QVariant)), this, SLOT(handleJobCancelled(quint64,QVariant)), Qt::AutoConnection);
+
+    // Create the watcher which notices edits made to the config file outside the application, and the timer which waits for a burst of edits to settle
+    m_configFileWatcher = new QFileSystemWatcher(this);
+    m_configReloadTimer = new QTimer(this);
+    m_configReloadTimer->setSingleShot(true);
+    m_configReloadTimer->setInterval(m_CONFIG_RELOAD_DELAY_MSECS);
+
+    // When the config file changes, reload only the sections which changed once the edits settle
+    connect(m_configFileWatcher, SIGNAL(fileChanged(QString)), this, SLOT(scheduleConfigReload(QString)), Qt::AutoConnection);
+    connect(m_configReloadTimer, SIGNAL(timeout()), this, SLOT(reloadChangedConfigSections()), Qt::AutoConnection);
+
+    // Create the automation server, which only listens once the user opts in from the Tools menu or by setting the environment variable
+    m_automationServer = new AutomationServer([this](const QVector<QJsonObject> &p_requests)
+    {
+        return handleAutomationBatch(p_requests);
+    }, this);
+
+    m_automationAction = m_toolsMenu->addAction(m_AUTOMATION_ACTION_TEXT);
+    m_automationAction->setCheckable(true);
+    connect(m_automationAction, SIGNAL(toggled(bool)), this, SLOT(setAutomationServerEnabled(bool)), Qt::AutoConnection);
+
     // Kick off the start sequence where we check for the existence of the config file
     attemptConfigFileGeneration();
+
+    // Start listening straight away for scripts which launch the application themselves
+    if(qEnvironmentVariableIntValue(m_AUTOMATION_ENVIRONMENT_VARIABLE) == 1)
+    {
+        m_automationAction->setChecked(true);
+    }
 }
 
 MainWindow::~MainWindow()
 {
+    // If the automation server has been created successfully
+    if(m_automationServer != nullptr)
+    {
+        // Delete it first so no request arrives while the rest of the window is torn down, and set it to be null
+        delete m_automationServer;
+        m_automationServer = nullptr;
+    }
+
+    // If the job manager has been created successfully
+    if(m_jobManager != nullptr)
+    {
+        // Stop any load or simulation in progress, a save in progress is allowed to finish so no edits are lost
+        m_jobManager->cancel(m_loadJobId);
+        m_jobManager->cancel(m_simulationJobId);
+
+        // Delete it first, which waits for its workers, and set it to be null
+        delete m_jobManager;
+        m_jobManager = nullptr;
+    }
+
+    // If the config file watcher has been created successfully
+    if(m_configFileWatcher != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_configFileWatcher;
+        m_configFileWatcher = nullptr;
+    }
+
+    // If the config reload timer has been created successfully
+    if(m_configReloadTimer != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_configReloadTimer;
+        m_configReloadTimer = nullptr;
+    }
+
+    // If the reminder timer has been created successfully
+    if(m_reminderTimer != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_reminderTimer;
+        m_reminderTimer = nullptr;
+    }
+
+    // If the reminder tray icon has been created successfully
+    if(m_reminderTrayIcon != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_reminderTrayIcon;
+        m_reminderTrayIcon = nullptr;
+    }
+
     // If the BillWidget has been created successfully
     if(m_billWidget != nullptr)
     {
@@ -111,12 +343,88 @@ MainWindow::~MainWindow()
         m_billWidget = nullptr;
     }
 
-    // Properly delete the amount available label
+    // If the LedgerHistoryWidget has been created successfully
+    if(m_ledgerHistoryWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_ledgerHistoryWidget;
+        m_ledgerHistoryWidget = nullptr;
+    }
+
+    // If the BalanceHistoryWidget has been created successfully
+    if(m_balanceHistoryWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_balanceHistoryWidget;
+        m_balanceHistoryWidget = nullptr;
+    }
+
+    // If the BillArchiveWidget has been created successfully
+    if(m_billArchiveWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_billArchiveWidget;
+        m_billArchiveWidget = nullptr;
+    }
+
+    // If the PeriodReportWidget has been created successfully
+    if(m_periodReportWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_periodReportWidget;
+        m_periodReportWidget = nullptr;
+    }
+
+    // If the BillCalendarWidget has been created successfully
+    if(m_billCalendarWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_billCalendarWidget;
+        m_billCalendarWidget = nullptr;
+    }
+
+    // If the ReconciliationWidget has been created successfully
+    if(m_reconciliationWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_reconciliationWidget;
+        m_reconciliationWidget = nullptr;
+    }
+
+    // If the LoanWidget has been created successfully
+    if(m_loanWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_loanWidget;
+        m_loanWidget = nullptr;
+    }
+
+    // If the ScenarioWidget has been created successfully
+    if(m_scenarioWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_scenarioWidget;
+        m_scenarioWidget = nullptr;
+    }
+
+    // If the CashFlowSimulationWidget has been created successfully
+    if(m_cashFlowSimulationWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_cashFlowSimulationWidget;
+        m_cashFlowSimulationWidget = nullptr;
+    }
+
+    // Properly delete the amount available and left to fund labels
     deleteLabelIfNonNull(m_amountAvailableLabel);
+    deleteLabelIfNonNull(m_leftToFundLabel);
 
     // Properly delete the amount available line edit
     deleteLineEditIfNonNull(m_amountAvailableEdit);
 
+    // Properly delete the search line edit
+    deleteLineEditIfNonNull(m_searchEdit);
+
     // Properly delete the all buttons
     deleteButtonIfNonNull(m_saveButton);
     deleteButtonIfNonNull(m_addBillButton);
@@ -124,6 +432,23 @@ MainWindow::~MainWindow()
     deleteButtonIfNonNull(m_fundBillButton);
     deleteButtonIfNonNull(m_defundBillButton);
     deleteButtonIfNonNull(m_resetBillsButton);
+    deleteButtonIfNonNull(m_toolsButton);
+
+    // If the Tools menu has been created successfully
+    if(m_toolsMenu != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_toolsMenu;
+        m_toolsMenu = nullptr;
+    }
+
+    // If the category summary table has been created successfully
+    if(m_categorySummaryTable != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_categorySummaryTable;
+        m_categorySummaryTable = nullptr;
+    }
 
     // If the bill table widget has been created successfully
     if(m_billTableWidget != nullptr)
@@ -163,181 +488,225 @@ void MainWindow::terminateApplication()
 
 void MainWindow::createTableWidgetUsingMap()
 {
+    Profiler::Scope profileScope(m_PROFILE_TABLE_BUILD_PHASE);
+
     // Set the number of rows in the table widget to be the number of bills stored in the bill map
     m_billTableWidget->setRowCount(m_billMap.size());
 
     // Set the number of columns to the number of fields which each Bill displays
-    m_billTableWidget->setColumnCount(4);
+    m_billTableWidget->setColumnCount(m_BILL_COLUMN_COUNT);
 
     // Set the table widget headers to the appropriate fields each Bill displays
-    m_billTableWidget->setHorizontalHeaderLabels(QString(m_BILL_NAME_COLUMN_HEADER_STRING + ";" + m_BILL_AMOUNT_DUE_COLUMN_HEADER_STRING + ";" + m_BILL_DUE_DATE_COLUMN_HEADER_STRING + ";" + m_BILL_FUNDING_STATUS_COLUMN_HEADER_STRING).split(";"));
+    m_billTableWidget->setHorizontalHeaderLabels(QString(m_BILL_NAME_COLUMN_HEADER_STRING + ";" + m_BILL_AMOUNT_DUE_COLUMN_HEADER_STRING + ";" + m_BILL_DUE_DATE_COLUMN_HEADER_STRING + ";" + m_BILL_FUNDING_STATUS_COLUMN_HEADER_STRING
+                                                         + ";" + m_BILL_CURRENCY_COLUMN_HEADER_STRING + ";" + m_BILL_CATEGORY_COLUMN_HEADER_STRING + ";" + m_BILL_TAGS_COLUMN_HEADER_STRING).split(";"));
 
     // Initialize the row we're setting to zero
     int row = 0;
 
-    // Create an iterator to iterate over the bill map
-    QMap<QString, Bill>::iterator billMapIterator;
-
-
-    for(billMapIterator = m_billMap.begin(); billMapIterator != m_billMap.end(); ++billMapIterator)
-    {
-        // Retrieve the current Bill being checked
-        Bill currentBill = *billMapIterator;
+    // The rows are about to be recreated, so the row lookup and sort keys are rebuilt alongside them, and any search is applied to every row again
+    m_billRowByKey.clear();
+    m_isSearchFilterStale = true;
+    QVector<BillSorter::SortKey> sortKeys;
+    sortKeys.reserve(m_billMap.size());
 
-        // Create a date edit for displaying and allowing the editing of the bill's due date
-        QDateEdit *dateEdit = new QDateEdit(this);
+    // Create a const iterator to iterate over the bill map, which never detaches a map shared with a background job
+    QMap<QString, Bill>::const_iterator billMapIterator;
 
-        // Allow the display of a calendar for editing purposes
-        dateEdit->setCalendarPopup(true);
 
-        // Set the date edit based on the bill's due date
-        dateEdit->setDate(currentBill.getDueDate());
+    for(billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+    {
+        // Refer to the current Bill being checked rather than copying it
+        const Bill &currentBill = billMapIterator.value();
 
-        // Create a combo box to hold the funding status of the bill
-        QComboBox *fundedStatusBox = new QComboBox(this);
-        fundedStatusBox->addItem(m_NOT_FUNDED_STRING);
-        fundedStatusBox->addItem(m_FUNDED_STRING);
-        currentBill.isFunded() ? fundedStatusBox->setCurrentIndex(1) : fundedStatusBox->setCurrentIndex(0);
+        // Create the row's cells from the Bill
+        createBillRow(row, billMapIterator.key(), currentBill);
+        m_billRowByKey.insert(billMapIterator.key(), row);
 
-        // Set the columns appropriately to the Bill's attributes
-        m_billTableWidget->setItem(row, 0, new QTableWidgetItem(currentBill.getName()));
-        m_billTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(currentBill.getAmountDue(), 'f', 2)));
-        m_billTableWidget->setCellWidget(row, 2, dateEdit);
-        m_billTableWidget->setCellWidget(row, 3, fundedStatusBox);
+        // Precompute the row's typed sort key from the Bill rather than from the displayed strings
+        sortKeys.append(BillSorter::makeSortKey(currentBill.getName(), currentBill.getAmountDue(), currentBill.getDueDate(), currentBill.isFunded(), currentBill.getCurrencyCode(), currentBill.getCategory(),
+                                                CategoryRollup::joinTags(currentBill.getTags())));
 
         // Increment the row for the next Bill
         row++;
     }
+
+    // Sort the recreated rows by the current sort criteria
+    m_billSorter.resetRows(sortKeys);
+
+    // Re-apply any search the user has typed to the recreated rows, which otherwise displays them in sorted order
+    filterBillsBySearch(m_searchEdit->text());
+
+    // Total the unfunded bills which were just displayed
+    updateLeftToFundLabel();
 }
 
-QDate MainWindow::convertDateStringToDate(QString p_dateString)
+void MainWindow::createBillRow(int p_row, const QString &p_billKey, const Bill &p_bill)
 {
-    // Convert the due date string into a date object and return it
-    return QDate::fromString(removeSpaces(p_dateString), m_DATE_STRING_FORMAT);
+    // Create a date edit for displaying and allowing the editing of the bill's due date
+    QDateEdit *dateEdit = new QDateEdit(this);
+
+    // Allow the display of a calendar for editing purposes, offering only the dates a bill can hold
+    dateEdit->setCalendarPopup(true);
+    dateEdit->setDateRange(Bill::getMinDueDate(), Bill::getMaxDueDate());
+
+    // Set the date edit based on the bill's due date
+    dateEdit->setDate(p_bill.getDueDate());
+
+    // Create a combo box to hold the funding status of the bill
+    QComboBox *fundedStatusBox = new QComboBox(this);
+    fundedStatusBox->addItem(m_ledgerStore.fundingStatusToString(false));
+    fundedStatusBox->addItem(m_ledgerStore.fundingStatusToString(true));
+    p_bill.isFunded() ? fundedStatusBox->setCurrentIndex(1) : fundedStatusBox->setCurrentIndex(0);
+
+    // Set the columns appropriately to the Bill's attributes
+    m_billTableWidget->setItem(p_row, 0, new QTableWidgetItem(p_bill.getName()));
+    m_billTableWidget->setItem(p_row, 1, new QTableWidgetItem(QString::number(p_bill.getAmountDue(), 'f', 2)));
+    m_billTableWidget->setCellWidget(p_row, 2, dateEdit);
+    m_billTableWidget->setCellWidget(p_row, 3, fundedStatusBox);
+    m_billTableWidget->setItem(p_row, 4, new QTableWidgetItem(p_bill.getCurrencyCode()));
+    m_billTableWidget->setItem(p_row, 5, new QTableWidgetItem(p_bill.getCategory()));
+    m_billTableWidget->setItem(p_row, 6, new QTableWidgetItem(CategoryRollup::joinTags(p_bill.getTags())));
+
+    // Remember the bill map key the row was created from so edits to the row can be traced back to it
+    setRowBillKey(p_row, p_billKey);
+
+    // Once the cell widgets are populated, keep the row's sort key up to date as they are edited
+    connect(dateEdit, SIGNAL(dateChanged(QDate)), this, SLOT(updateSortKeyForCellWidget()), Qt::AutoConnection);
+    connect(fundedStatusBox, SIGNAL(currentIndexChanged(int)), this, SLOT(updateSortKeyForCellWidget()), Qt::AutoConnection);
 }
 
-void MainWindow::parseConfigContents(QString p_groupLabel, QString p_key, QString p_value)
+void MainWindow::readConfigAndCreateUI()
 {
-    // If the group label is the funds information section
-    if(p_groupLabel == m_FUNDS_INFORMATION_GROUP_LABEL)
+    // Only the most recent read of the config file is applied, so stop any read still in progress
+    m_jobManager->cancel(m_loadJobId);
+
+    // Copy the ledger store so the job does not touch the MainWindow's members while it runs
+    LedgerStore ledgerStore = m_ledgerStore;
+
+    // Read and parse the config file in the background so the GUI thread stays responsive for large ledgers
+    m_loadJobId = m_jobManager->submit(m_LOAD_JOB_NAME, [ledgerStore](JobContext &p_jobContext) -> QVariant
     {
-        // If there is no total amount of money available currently stored in the config file
-        if(p_value.isEmpty())
-        {
-            // Default the amount available to zero
-            m_totalAmountAvailable = 0.00;
-        }
+        LedgerSnapshot loadedLedger = ledgerStore.load(&p_jobContext);
 
-        // If an amount available was found
-        else
+        // Stop early if a newer read was requested
+        if(p_jobContext.isCancelled())
         {
-            // Update the amount available to the config file's contents
-            m_totalAmountAvailable = p_value.toDouble();
+            return QVariant();
         }
+
+        return QVariant::fromValue(loadedLedger);
+    });
+}
+
+void MainWindow::applyLoadedLedger(const LedgerSnapshot &p_loadedLedger)
+{
+    // If attempting to open the config file resulted in an error
+    if(!p_loadedLedger.isConfigReadable)
+    {
+        // Alert the user with an appropriate message box
+        createCorruptConfigFileBox();
+        return;
     }
 
-    // If the group label is a bill
-    else
+    // If any key/value pair was invalid
+    if(p_loadedLedger.invalidKeyCount > 0)
     {
-        // If the bill being checked has not been inserted into the bill map yet
-        if(!m_billMap.contains(p_groupLabel))
-        {
-            // Create a new Bill object
-            Bill readBill;
+        // Alert the user with a single invalid key message box
+        createFatalErrorBox(m_INVALID_KEY_BOX_PRIMARY_TEXT, m_INVALID_KEY_BOX_INFO_TEXT);
+        return;
+    }
 
-            // Set the Bill's name
-            readBill.setName(p_groupLabel);
+    // Adopt the loaded bills and funds, any deletions not yet saved being discarded with the table they were made in
+    m_billMap = p_loadedLedger.billMap;
+    m_unsavedDeletions.clear();
+    m_fundedBillsList = p_loadedLedger.fundedBillsList;
+    m_totalAmountAvailable = p_loadedLedger.totalAmountAvailable;
+    m_availableCurrencyIndex = CurrencyRegistry::indexForCode(p_loadedLedger.availableCurrencyCode);
+    updateAmountAvailableLabel();
 
-            // Since the amount due will be read before the due date and the funding status, set the amount due of the Bill
-            readBill.setAmountDue(p_value.toDouble());
+    // Remember the ledger as it is in the config file, so later saves only merge in what changed since
+    m_savedLedger = p_loadedLedger;
 
-            // Insert the Bill into the map mapped to the name of the bill
-            m_billMap[p_groupLabel] = readBill;
-        }
+    // Move bills which have been paid into the archive so the working set only holds current obligations
+    bool isAnyBillArchived = archivePaidBills();
 
-        // If the bill being checked already exists in the bill map, then we're checking its due date
-        else
-        {
-            // If the key label is the due date key
-            if(p_key == m_BILL_DUE_DATE_KEY)
-            {
-                // Set the appropriate Bill's due date from the bill map by converting the date string to a date object
-                m_billMap[p_groupLabel].setDueDate(convertDateStringToDate(p_value));
-            }
+    // Index the loaded bills so they can be searched for, and total them per category and tag, noting any whose names collide
+    QStringList collidingBillNames;
+    synchronizeSearchIndexWithMap();
+    rebuildBillTotals(&collidingBillNames);
 
-            // Otherwise, the key label is the funding status
-            else
-            {
-                // Set the appropriate Bill's funding status in the bill map by converting the funding status string to a boolean
-                m_billMap[p_groupLabel].setFundedStatus(fundingStatusStringToBoolean(p_value));
+    // Open the transaction history, starting one from the loaded amount available if there is none yet
+    m_transactionLedger.open(m_LEDGER_FILE_DIRECTORY_NAME, dollarsToCents(m_totalAmountAvailable));
 
-                // If the Bill is currently funded
-                if(m_billMap[p_groupLabel].isFunded())
-                {
-                    // Add the Bill's name to the funded list to assist with updating the total amount available
-                    m_fundedBillsList.append(m_billMap[p_groupLabel].getName());
-                }
-            }
-        }
-    }
-}
+    // Open the balance history, which is started by the first save if there is none yet
+    m_balanceHistory.open(m_BALANCE_HISTORY_FILE_DIRECTORY_NAME);
 
-void MainWindow::readConfigAndCreateUI()
-{
-    // Attempt to open the pre-existing config file
-    QSettings m_settings(m_CONFIG_FILE_DIRECTORY_NAME, QSettings::IniFormat);
+    // Set the amount avaiable line edit to the amount available amount in the config file, rounded to two decimal places
+    m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
 
-    // If attempting to open the config file resulted in an error
-    if(m_settings.status() != QSettings::NoError)
+    // Create the table widget using the bill map's contents
+    createTableWidgetUsingMap();
+
+    // Pick up edits made to the config file while the application is running
+    startWatchingConfigFile();
+
+    // Remove archived bills from the config file so later startups and saves skip them
+    if(isAnyBillArchived)
     {
-        // Alert the user with an appropriate message box
-        createCorruptConfigFileBox();
+        writeLedgerInBackground();
     }
 
-    // If the config file was opened successfully
-    else
-    {
-        // Store all the keys from the config file in a list
-        QStringList configFileKeys = m_settings.allKeys();
+    // Display the main window
+    this->show();
 
-        // Iterate over each key
-        foreach(QString key, configFileKeys)
-        {
-            // Split the keys at the "/" to isolate the current group label and key
-            QStringList splitKeys = key.split(QLatin1Char('/'));
+    // Let the user know of bills which only differ in case, so they can be renamed before the file is used on Windows
+    if(!collidingBillNames.isEmpty())
+    {
+        createBoxWithNoResult(m_LOAD_COLLISION_BOX_PRIMARY_TEXT, m_LOAD_COLLISION_BOX_INFO_TEXT.arg(collidingBillNames.join(", ")));
+    }
 
-            // If splitting the key did not result in both a group label and key
-            if(splitKeys.size() < 2)
-            {
-                // TODO: Pass the invalid key to the box to display to the user
-                // TODO: The box appears once for each incorrect pair, should the app just terminate after a single incorrect pair is found?
-                // Alert the user with an invalid key message box
-                createFatalErrorBox(m_INVALID_KEY_BOX_PRIMARY_TEXT, m_INVALID_KEY_BOX_INFO_TEXT);
-            }
+    // Let the user know of bills written in more than one section, whose sections were merged
+    if(!p_loadedLedger.repeatedBillKeys.isEmpty())
+    {
+        createBoxWithNoResult(m_REPEATED_BILLS_BOX_PRIMARY_TEXT, m_REPEATED_BILLS_BOX_INFO_TEXT.arg(p_loadedLedger.repeatedBillKeys.join(", ")));
+    }
 
-            else
-            {
-                // Save both the group label, key, and value
-                QString groupLabel = splitKeys.at(0);
-                QString keyLabel = splitKeys.at(1);
+    // Let the user know of bills which were left out rather than having their amount due clamped
+    if(!p_loadedLedger.outOfRangeBillKeys.isEmpty())
+    {
+        createBoxWithNoResult(m_OUT_OF_RANGE_BILLS_BOX_PRIMARY_TEXT, m_OUT_OF_RANGE_BILLS_BOX_INFO_TEXT.arg(QString::number(Bill::getMaxAmountDueCents() / 100.0, 'f', 2),
+                                                                                                       p_loadedLedger.outOfRangeBillKeys.join(", ")));
+    }
+}
 
-                // The keys are stored in "Group label/key" format so they need to be separated
-                QString keyValue = m_settings.value(key).toString();
+bool MainWindow::archivePaidBills()
+{
+    QVector<BillArchive::ArchivedBill> paidBills;
+    QDate currentDate = QDate::currentDate();
 
-                // Use group labels, keys, and values from config file to update the bill map and funded bills list
-                parseConfigContents(groupLabel, keyLabel, keyValue);
-            }
+    // Collect the bills which are funded and whose due date has passed
+    for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+    {
+        if(billMapIterator->isFunded() && billMapIterator->getDueDate().isValid() && billMapIterator->getDueDate() < currentDate)
+        {
+            paidBills.append({billMapIterator.key(), billMapIterator.value()});
         }
+    }
 
-        // Set the amount avaiable line edit to the amount available amount in the config file, rounded to two decimal places
-        m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
-
-        // Create the table widget using the bill map's contents
-        createTableWidgetUsingMap();
+    // Keep the bills in the working set if there are none or the archive could not be written, in which case it holds none of them
+    if(paidBills.isEmpty() || !m_billArchive.archiveBills(paidBills))
+    {
+        return false;
+    }
 
-        // Display the main window
-        this->show();
+    // Remove the archived bills, their funds were already taken out of the amount available when they were funded
+    for(const BillArchive::ArchivedBill &paidBill : paidBills)
+    {
+        m_billMap.remove(paidBill.billKey);
+        m_fundedBillsList.removeOne(paidBill.bill.getName());
     }
+
+    return true;
 }
 
 void MainWindow::attemptConfigFileGeneration()
@@ -347,14 +716,25 @@ void MainWindow::attemptConfigFileGeneration()
     {
         // Display a message box to alert the user
         createFatalErrorBox(m_CONFIG_FILE_GENERATE_FAIL_BOX_PRIMARY_TEXT, m_CONFIG_FILE_GENERATE_FAIL_BOX_INFO_TEXT);
+        return;
     }
 
+    // Open the bill archive alongside the config file, which only reads the footers of its segments
+    m_billArchive.open(m_ARCHIVE_DIRECTORY_NAME);
+
+    // Load the exchange rates the user maintains, and offer their currencies when entering bills
+    m_exchangeRateTable.load(m_EXCHANGE_RATE_FILE_DIRECTORY_NAME);
+    m_billWidget->getCurrencyInput()->clear();
+    m_billWidget->getCurrencyInput()->addItems(m_exchangeRateTable.currencyCodes());
+
+    // Load the terms of the bills which are loans
+    m_loanBook.load(m_LOAN_FILE_DIRECTORY_NAME);
+
     // The config file was found in the expected path
-    else if(QFile::exists(m_CONFIG_FILE_DIRECTORY_NAME))
+    if(QFile::exists(m_CONFIG_FILE_DIRECTORY_NAME))
     {
         // Read config file and create UI
         readConfigAndCreateUI();
-
     }
 
     // The config file path exists but the file is not in it
@@ -367,18 +747,23 @@ void MainWindow::attemptConfigFileGeneration()
 
 void MainWindow::welcomeFirstTimeUser()
 {
-    // Create a welcome message box with appropriate primary and informative text
-    QMessageBox welcomeBox;
-    welcomeBox.setText(m_WELCOME_BOX_PRIMARY_TEXT);
-    welcomeBox.setInformativeText(m_WELCOME_BOX_INFO_TEXT);
+    // Create a welcome message box with appropriate primary and informative text, deleted once the user responds
+    QMessageBox *welcomeBox = new QMessageBox();
+    welcomeBox->setAttribute(Qt::WA_DeleteOnClose);
+    welcomeBox->setText(m_WELCOME_BOX_PRIMARY_TEXT);
+    welcomeBox->setInformativeText(m_WELCOME_BOX_INFO_TEXT);
 
     // Allow options for advancing to the next screen or closing the application
-    welcomeBox.setStandardButtons(QMessageBox::Ok | QMessageBox::Close);
+    welcomeBox->setStandardButtons(QMessageBox::Ok | QMessageBox::Close);
 
-    // Save the user's selection
-    int welcomeBoxSelection = welcomeBox.exec();
+    // Handle the user's selection once it is made, rather than spinning a nested event loop
+    connect(welcomeBox, SIGNAL(finished(int)), this, SLOT(handleWelcomeBoxSelection(int)), Qt::AutoConnection);
+    welcomeBox->open();
+}
 
-    switch(welcomeBoxSelection)
+void MainWindow::handleWelcomeBoxSelection(int p_welcomeBoxSelection)
+{
+    switch(p_welcomeBoxSelection)
     {
         // If the user selects "Ok"
         case QMessageBox::Ok :
@@ -435,18 +820,23 @@ void MainWindow::createFatalErrorBox(const QString p_primaryText, const QString
 
 void MainWindow::createCorruptConfigFileBox()
 {
-    // Create the corrupt config file QMessageBox with appropriate displayed text
-    QMessageBox corruptBox;
-    corruptBox.setText(m_CONFIG_CORRUPT_FILE_BOX_PRIMARY_TEXT);
-    corruptBox.setInformativeText(m_CONFIG_CORRUPT_FILE_BOX_INFO_TEXT);
+    // Create the corrupt config file QMessageBox with appropriate displayed text, deleted once the user responds
+    QMessageBox *corruptBox = new QMessageBox();
+    corruptBox->setAttribute(Qt::WA_DeleteOnClose);
+    corruptBox->setText(m_CONFIG_CORRUPT_FILE_BOX_PRIMARY_TEXT);
+    corruptBox->setInformativeText(m_CONFIG_CORRUPT_FILE_BOX_INFO_TEXT);
 
     // Give the user the options of "Ok'ing" the error or closing the application
-    corruptBox.setStandardButtons(QMessageBox::Ok | QMessageBox::Close);
+    corruptBox->setStandardButtons(QMessageBox::Ok | QMessageBox::Close);
 
-    // Store the user's selection
-    int corruptBoxSelection = corruptBox.exec();
+    // Handle the user's selection once it is made, rather than spinning a nested event loop
+    connect(corruptBox, SIGNAL(finished(int)), this, SLOT(handleCorruptConfigFileBoxSelection(int)), Qt::AutoConnection);
+    corruptBox->open();
+}
 
-    switch(corruptBoxSelection)
+void MainWindow::handleCorruptConfigFileBoxSelection(int p_corruptBoxSelection)
+{
+    switch(p_corruptBoxSelection)
     {
     // If the user selected "Ok"
     case QMessageBox::Ok :
@@ -473,73 +863,153 @@ void MainWindow::createCorruptConfigFileBox()
     }
 }
 
-QString MainWindow::fundingStatusBooleanToString(bool p_isBillFunded)
+bool MainWindow::openConfigForBillCreation()
 {
-    // If the bill has been funded, return the funded string, otherwise return the not funded string
-    return p_isBillFunded ? m_FUNDED_STRING : m_NOT_FUNDED_STRING;
-}
+    // Save the entered Bill's name, amount due, and due date from the BillWidget
+    QString enteredBillName = m_billWidget->getNameInput()->text();
+    double enteredBillAmountDue = m_billWidget->getAmountDueInput()->text().toDouble();
+    QDate enteredBillDueDate = m_billWidget->getDueDateInput()->date();
 
-bool MainWindow::fundingStatusStringToBoolean(QString p_fundingStatus)
-{
-    // If the bill has a funding status of "Funded", return true, otherwise return false
-    return p_fundingStatus == m_FUNDED_STRING ? true : false;
-}
+    // Bills entered without a valid currency code are in the currency of the total amount available
+    QString enteredBillCurrency = CurrencyRegistry::normalizeCode(m_billWidget->getCurrencyInput()->currentText());
 
-QString MainWindow::removeSpaces(QString p_stringWithSpaces)
-{
-    // Convert the input string to a format in which characters can be replaced
-    QString noSpaces = p_stringWithSpaces.simplified();
+    if(enteredBillCurrency.isEmpty())
+    {
+        enteredBillCurrency = CurrencyRegistry::codeForIndex(m_availableCurrencyIndex);
+    }
 
-    // Return the string with spaces removed
-    return noSpaces.replace(" ", "");
-}
+    // Save the Bill's category and tags
+    QString enteredBillCategory = m_billWidget->getCategoryInput()->text().trimmed();
+    QStringList enteredBillTags = CategoryRollup::splitTags(m_billWidget->getTagsInput()->text());
 
-void MainWindow::openConfigForBillCreation()
-{
-    // Attempt to access the config file
-    QSettings m_settings(m_CONFIG_FILE_DIRECTORY_NAME, QSettings::IniFormat);
+    // Create a new Bill object for the bill information inputted into the BillWidget
+    Bill enteredBill;
+    enteredBill.setName(enteredBillName);
+    enteredBill.setAmountDue(enteredBillAmountDue);
+    enteredBill.setDueDate(enteredBillDueDate);
+    enteredBill.setCurrencyCode(enteredBillCurrency);
+    enteredBill.setCategory(enteredBillCategory);
+    enteredBill.setTags(enteredBillTags);
+
+    // Default the bill to not having been funded yet
+    enteredBill.setFundedStatus(false);
 
-    // If the attempt to open the config file results in an error
-    if(m_settings.status() != QSettings::NoError)
+    // If the Bill would overwrite or nearly duplicate a stored bill, let the user decide what happens rather than overwriting it silently
+    BillKeyIndex::Collision collision = m_billKeyIndex.findCollision(m_ledgerStore.billKeyForName(enteredBillName), enteredBill);
+
+    if(collision.kind != BillKeyIndex::NoCollision)
     {
-        // Alert the user with a message box
-        createCorruptConfigFileBox();
+        switch(askCollisionResolution(enteredBillName, collision))
+        {
+            // If the user chose to replace the existing bill
+            case ReplaceExisting :
+            {
+                // Return the existing bill's funds if it was funded, as deleting it would, leaving the Bill in the BillWidget if they cannot be converted
+                const Bill existingBill = m_billMap.value(collision.existingBillKey);
+
+                if(!applyFundsChange(availableFunds().deletionChange(existingBill), collision.existingBillKey, existingBill))
+                {
+                    return false;
+                }
+
+                m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+
+                // Remove the existing bill, the save below removes its config file entry
+                QVector<int> removedRows;
+                removeStoredBill(collision.existingBillKey, removedRows);
+                removeBillRows(removedRows);
+                break;
+            }
+
+            // If the user chose to keep both bills
+            case KeepBoth :
+            {
+                // Number the new Bill's name so it is stored under a key of its own
+                enteredBillName = m_billKeyIndex.uniqueName(enteredBillName);
+                enteredBill.setName(enteredBillName);
+                break;
+            }
+
+            // If the user chose to add a near duplicate bill anyway
+            case AddAnyway :
+            {
+                // Add the Bill as entered
+                break;
+            }
+
+            default:
+            {
+                // Default to leaving the Bill in the BillWidget without saving it
+                return false;
+            }
+        }
     }
 
-    // Otherwise if the config file was opened successfully
-    else
-    {
-        // Save the entered Bill's name, amount due, and due date from the BillWidget
-        QString enteredBillName = m_billWidget->getNameInput()->text();
-        double enteredBillAmountDue = m_billWidget->getAmountDueInput()->text().toDouble();
-        QDate enteredBillDueDate = m_billWidget->getDueDateInput()->date();
+    // Store the Bill under its name with spaces removed, defaulted to not funded
+    QString enteredBillKey = m_ledgerStore.billKeyForName(enteredBillName);
+
+    // Add the Bill to its category and tag totals and the bill key index
+    updateBillTotals(enteredBillKey, enteredBill);
+    refreshCategorySummary();
 
-        // Write the Bill's name with spaces removed to the config file
-        m_settings.beginGroup(removeSpaces(enteredBillName));
+    // Move the Bill object into the map with a key of the name of the bill with spaces removed
+    m_billMap[enteredBillKey] = std::move(enteredBill);
 
-        // Write the amount due to the config file in decimal format
-        m_settings.setValue(m_BILL_AMOUNT_DUE_KEY, QString::number(enteredBillAmountDue, 'f', 2));
+    // Index the Bill's name so it can be searched for
+    m_billSearchIndex.insertBill(enteredBillKey, enteredBillName);
+
+    // Write the Bill, and any funds returned from a replaced bill, through a save so the config file's version stamp is increased and other instances merge it
+    writeLedgerInBackground();
+    return true;
+}
 
-        // Write the Bill's due date to the config file in M/d/yyyy format
-        m_settings.setValue(m_BILL_DUE_DATE_KEY, enteredBillDueDate.toString(m_DATE_STRING_FORMAT));
+MainWindow::CollisionResolution MainWindow::askCollisionResolution(const QString &p_billName, const BillKeyIndex::Collision &p_collision)
+{
+    const Bill existingBill = m_billMap.value(p_collision.existingBillKey);
+    QMessageBox collisionBox;
+    QPushButton *replaceButton = nullptr;
+    QPushButton *keepBothButton = nullptr;
+    QPushButton *addAnywayButton = nullptr;
+
+    // Bills saved under the same key can replace the existing bill or be kept alongside it under a numbered name
+    if(p_collision.kind == BillKeyIndex::KeyCollision)
+    {
+        collisionBox.setText(m_KEY_COLLISION_BOX_PRIMARY_TEXT);
+        collisionBox.setInformativeText(m_KEY_COLLISION_BOX_INFO_TEXT.arg(p_billName, existingBill.getName()));
+        replaceButton = collisionBox.addButton(m_REPLACE_BUTTON_TEXT, QMessageBox::DestructiveRole);
+        keepBothButton = collisionBox.addButton(m_KEEP_BOTH_BUTTON_TEXT, QMessageBox::AcceptRole);
+    }
 
-        // Write the Bill's funding status to the config file, defaulted to not funded
-        m_settings.setValue(m_BILL_FUNDING_STATUS_KEY, fundingStatusBooleanToString(false));
-        m_settings.endGroup();
-        m_settings.sync();
+    // Near duplicates have keys of their own, so they can only be added anyway
+    else
+    {
+        collisionBox.setText(m_NEAR_DUPLICATE_BOX_PRIMARY_TEXT);
+        collisionBox.setInformativeText(m_NEAR_DUPLICATE_BOX_INFO_TEXT.arg(p_billName, existingBill.getName(), m_ledgerStore.formatDate(existingBill.getDueDate())));
+        addAnywayButton = collisionBox.addButton(m_ADD_ANYWAY_BUTTON_TEXT, QMessageBox::AcceptRole);
+    }
 
-        // Create a new Bill object for the bill information inputted into the BillWidget
-        Bill enteredBill;
-        enteredBill.setName(enteredBillName);
-        enteredBill.setAmountDue(enteredBillAmountDue);
-        enteredBill.setDueDate(enteredBillDueDate);
+    // Give the user the option of cancelling, which leaves the bill in the BillWidget to be corrected
+    collisionBox.addButton(QMessageBox::Cancel);
+    collisionBox.setDefaultButton(QMessageBox::Cancel);
+    collisionBox.exec();
 
-        // Default the bill to not having been funded yet
-        enteredBill.setFundedStatus(false);
+    // Custom buttons are told apart by which one was clicked rather than by the result of exec()
+    QAbstractButton *clickedButton = collisionBox.clickedButton();
 
-        // Insert the Bill object into the map with a key of the name of the bill with spaces removed
-        m_billMap[removeSpaces(enteredBillName)] = enteredBill;
+    if(clickedButton != nullptr && clickedButton == replaceButton)
+    {
+        return ReplaceExisting;
+    }
+    else if(clickedButton != nullptr && clickedButton == keepBothButton)
+    {
+        return KeepBoth;
+    }
+    else if(clickedButton != nullptr && clickedButton == addAnywayButton)
+    {
+        return AddAnyway;
     }
+
+    return CancelEntry;
 }
 
 void MainWindow::createBoxWithNoResult(QString p_noResultPrimaryText, QString p_noResultInfoText)
@@ -586,10 +1056,11 @@ void MainWindow::saveBillAndDisplayBillWidget()
     else
     {
         // Attempt to open the config file, if successful create a new Bill object and store contents in the config file
-        openConfigForBillCreation();
-
-        // Clear the BillWidget if the user elects to add another bill
-        clearBillWidget();
+        // Clear the BillWidget if the user elects to add another bill, unless they cancelled so they can correct the bill
+        if(openConfigForBillCreation())
+        {
+            clearBillWidget();
+        }
     }
 }
 
@@ -599,6 +1070,16 @@ void MainWindow::clearBillWidget()
     m_billWidget->getNameInput()->clear();
     m_billWidget->getAmountDueInput()->clear();
     m_billWidget->getDueDateInput()->setDate(QDate::currentDate());
+
+    // Default the currency to that of the total amount available
+    m_billWidget->getCurrencyInput()->setCurrentText(CurrencyRegistry::codeForIndex(m_availableCurrencyIndex));
+
+    // Clear the optional category and tags
+    m_billWidget->getCategoryInput()->clear();
+    m_billWidget->getTagsInput()->clear();
+
+    // Clear any pasted bills
+    m_billWidget->getPasteInput()->clear();
 }
 
 void MainWindow::displayBillTableWidget()
@@ -612,14 +1093,26 @@ void MainWindow::displayBillTableWidget()
     // Create the bill table widget using the bill map
     createTableWidgetUsingMap();
 
+    // Pick up edits made to the config file while the application is running
+    startWatchingConfigFile();
+
     // Show the window
     this->show();
 }
 
 void MainWindow::saveBillAndDisplayBillTableWidget()
 {
+    // If bills are being pasted, add the valid rows first and only move on once no rows are left to correct
+    if(m_billWidget->isPasteMode())
+    {
+        if(m_pastedRows.isEmpty() || (savePastedBills() && m_pastedRows.isEmpty()))
+        {
+            displayBillTableWidget();
+        }
+    }
+
     // If the user pressed the Done button but did not enter a name and amount due for the bill, do not attempt to finish creating this bill
-    if(m_billWidget->getNameInput()->text().isEmpty() && m_billWidget->getAmountDueInput()->text().isEmpty())
+    else if(m_billWidget->getNameInput()->text().isEmpty() && m_billWidget->getAmountDueInput()->text().isEmpty())
     {
         // Display the bill table widget
         displayBillTableWidget();
@@ -636,30 +1129,136 @@ void MainWindow::saveBillAndDisplayBillTableWidget()
     else
     {
         // Attempt to open the config file, if successful create a new Bill object and store contents in the config file
-        openConfigForBillCreation();
-
-        // After capturing the last entered Bill, display the bill table widget
-        displayBillTableWidget();
+        // After capturing the last entered Bill, display the bill table widget, unless the user cancelled so they can correct the bill
+        if(openConfigForBillCreation())
+        {
+            displayBillTableWidget();
+        }
     }
 }
 
-void MainWindow::showBillWidget()
+void MainWindow::validatePastedBills()
 {
-    // Make sure to clear the BillWidget from the previous entry if the user chooses to add another bill from the bill table widget
-    clearBillWidget();
+    m_pastedRows = BillPasteParser::parse(m_billWidget->getPasteInput()->toPlainText(), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex));
+    QHash<QString, int> pastedLineNumbers;
 
-    // Display the BillWidget so the user can add another bill
-    m_billWidget->show();
-}
+    for(BillPasteParser::PastedRow &pastedRow : m_pastedRows)
+    {
+        const QString &pastedName = pastedRow.bill.getName();
 
-void MainWindow::askForTotalAmountAvailable()
+        // Names are only compared once the row has one
+        if(pastedName.isEmpty())
+        {
+            continue;
+        }
+
+        // A row saved under the same key as a stored bill would overwrite it, which only the single bill entry can confirm, so it has to be renamed
+        BillKeyIndex::Collision collision = m_billKeyIndex.findCollision(m_ledgerStore.billKeyForName(pastedName), pastedRow.bill);
+
+        if(collision.kind == BillKeyIndex::KeyCollision)
+        {
+            pastedRow.fieldErrors[BillPasteParser::NameColumn] = m_PASTED_KEY_COLLISION_ERROR.arg(m_billMap.value(collision.existingBillKey).getName());
+        }
+        else if(collision.kind == BillKeyIndex::NearDuplicate)
+        {
+            const Bill existingBill = m_billMap.value(collision.existingBillKey);
+            pastedRow.fieldWarnings[BillPasteParser::NameColumn] = m_PASTED_NEAR_DUPLICATE_WARNING.arg(existingBill.getName(), m_ledgerStore.formatDate(existingBill.getDueDate()));
+        }
+
+        // Rows saved under the same key as an earlier row would overwrite it
+        QString normalizedKey = BillKeyIndex::normalizeKey(pastedName);
+
+        if(pastedLineNumbers.contains(normalizedKey))
+        {
+            pastedRow.fieldErrors[BillPasteParser::NameColumn] = m_PASTED_REPEATED_NAME_ERROR.arg(pastedLineNumbers.value(normalizedKey));
+        }
+        else
+        {
+            pastedLineNumbers.insert(normalizedKey, pastedRow.lineNumber);
+        }
+    }
+
+    m_billWidget->showPastedRows(m_pastedRows);
+}
+
+bool MainWindow::savePastedBills()
+{
+    // Check the rows against the bills as they are now
+    validatePastedBills();
+    QStringList invalidLines;
+    int addedBillCount = 0;
+
+    for(const BillPasteParser::PastedRow &pastedRow : qAsConst(m_pastedRows))
+    {
+        addedBillCount += pastedRow.isValid() ? 1 : 0;
+    }
+
+    // If none of the rows can be added, tell the user how to find out why
+    if(addedBillCount == 0)
+    {
+        createBoxWithNoResult(m_NO_VALID_PASTED_BILLS_BOX_PRIMARY_TEXT, m_NO_VALID_PASTED_BILLS_BOX_INFO_TEXT);
+        return true;
+    }
+
+    for(const BillPasteParser::PastedRow &pastedRow : qAsConst(m_pastedRows))
+    {
+        // Keep the rows to correct, so they can be given back to the user
+        if(!pastedRow.isValid())
+        {
+            invalidLines.append(pastedRow.lineText);
+            continue;
+        }
+
+        // Store the Bill under its name with spaces removed, as a bill entered on its own would be
+        const Bill &pastedBill = pastedRow.bill;
+        QString pastedBillKey = m_ledgerStore.billKeyForName(pastedBill.getName());
+
+        // Add the Bill to its totals, the bill key index, the bill map, and the search index
+        updateBillTotals(pastedBillKey, pastedBill);
+        m_billMap[pastedBillKey] = pastedBill;
+        m_billSearchIndex.insertBill(pastedBillKey, pastedBill.getName());
+    }
+
+    // Write every pasted bill in a single save, and total the categories once for all of them
+    writeLedgerInBackground();
+    refreshCategorySummary();
+
+    // Leave only the rows to correct in the BillWidget, which re-checks them against the bills just added
+    m_billWidget->getPasteInput()->setPlainText(invalidLines.join(QLatin1Char('\n')));
+    statusBar()->showMessage(m_PASTED_BILLS_STATUS_TEXT.arg(addedBillCount).arg(invalidLines.size()), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    return true;
+}
+
+void MainWindow::showBillWidget()
+{
+    // Make sure to clear the BillWidget from the previous entry if the user chooses to add another bill from the bill table widget
+    clearBillWidget();
+
+    // Display the BillWidget so the user can add another bill
+    m_billWidget->show();
+}
+
+void MainWindow::askForTotalAmountAvailable()
 {
     // Variable which is set to true if user pressed ok, false if user pressed cancel
     bool isTotalAmountAvailableRecorded;
 
+    // Ask which currency the money is held in first, offering the currencies with exchange rates but allowing any code to be typed
+    QString availableCurrency = QInputDialog::getItem(this, m_AVAILABLE_CURRENCY_TITLE_TEXT, m_ASK_FOR_AVAILABLE_CURRENCY_TEXT, m_exchangeRateTable.currencyCodes(), 0, true, &isTotalAmountAvailableRecorded);
+
+    // If no valid currency was chosen, use the base currency of the exchange rates
+    if(!isTotalAmountAvailableRecorded || CurrencyRegistry::normalizeCode(availableCurrency).isEmpty())
+    {
+        availableCurrency = m_exchangeRateTable.baseCurrencyCode();
+    }
+
+    m_availableCurrencyIndex = CurrencyRegistry::indexForCode(availableCurrency);
+    updateAmountAvailableLabel();
+
     // Set up the input dialog box with appropriate text and input restrictions and store the result
-    double amountAvailable = QInputDialog::getDouble(this, m_TOTAL_AMOUNT_AVAILABLE_STRING, m_ASK_FOR_AMOUNT_AVAILABLE_TEXT, m_DEFAULT_AMOUNT_AVAILABLE, m_MIN_AMOUNT_AVAILABLE, m_MAX_AMOUNT_AVAILABLE, m_NUM_DECIMAL_PLACES,
-                                                     &isTotalAmountAvailableRecorded, Qt::WindowFlags(), m_AMOUNT_AVAILABLE_STEP_SIZE);
+    double amountAvailable = QInputDialog::getDouble(this, m_TOTAL_AMOUNT_AVAILABLE_STRING.arg(CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)),
+                                                     m_ASK_FOR_AMOUNT_AVAILABLE_TEXT.arg(CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)), m_DEFAULT_AMOUNT_AVAILABLE, m_MIN_AMOUNT_AVAILABLE, m_MAX_AMOUNT_AVAILABLE,
+                                                     m_NUM_DECIMAL_PLACES, &isTotalAmountAvailableRecorded, Qt::WindowFlags(), m_AMOUNT_AVAILABLE_STEP_SIZE);
 
     // If the user pressed ok
     if(isTotalAmountAvailableRecorded)
@@ -667,30 +1266,20 @@ void MainWindow::askForTotalAmountAvailable()
         // Store the total amount available entered, if nothing was entered this defaults to $0.00
         m_totalAmountAvailable = amountAvailable;
 
-        // Attempt to open the config file
-        QSettings m_settings(m_CONFIG_FILE_DIRECTORY_NAME, QSettings::IniFormat);
-
-        // If attempting to open the config file resulted in an error
-        if(m_settings.status() != QSettings::NoError)
-        {
-            // Alert the user with an appropriate message box
-            createCorruptConfigFileBox();
-        }
+        // Write the total funds available and their currency out to the config file through a save, which stamps it with its first version
+        m_savedLedger = LedgerSnapshot();
+        writeLedgerInBackground();
 
-        // If the config file was opened without issue
-        else
-        {
-            // Create the funds information group
-            m_settings.beginGroup(m_FUNDS_INFORMATION_GROUP_LABEL);
+        // A first time setup starts a fresh transaction history whose opening balance is the amount entered
+        m_configFileDirectory.remove(m_LEDGER_FILE_DIRECTORY_NAME);
+        m_transactionLedger.open(m_LEDGER_FILE_DIRECTORY_NAME, dollarsToCents(m_totalAmountAvailable));
 
-            // Write the total funds available out to the config file
-            m_settings.setValue(m_TOTAL_FUNDS_AVAILABLE_KEY, QString::number(m_totalAmountAvailable, 'f', 2));
-            m_settings.endGroup();
-            m_settings.sync();
+        // Along with a fresh balance history
+        m_configFileDirectory.remove(m_BALANCE_HISTORY_FILE_DIRECTORY_NAME);
+        m_balanceHistory.open(m_BALANCE_HISTORY_FILE_DIRECTORY_NAME);
 
-            // Show the BillWidget for bill entry
-            m_billWidget->show();
-        }
+        // Show the BillWidget for bill entry
+        m_billWidget->show();
     }
 
     else
@@ -702,271 +1291,2677 @@ void MainWindow::askForTotalAmountAvailable()
 
 void MainWindow::updateConfigFromUI()
 {
-    // Attempt to access the config file
-    QSettings m_settings(m_CONFIG_FILE_DIRECTORY_NAME, QSettings::IniFormat);
+    Profiler::Scope profileScope(m_PROFILE_SAVE_PHASE);
+
+    // Rows whose names would be saved under the same key would silently overwrite each other, so ask for one to be renamed instead
+    QHash<QString, int> rowByNormalizedKey;
+    rowByNormalizedKey.reserve(m_billTableWidget->rowCount());
 
-    // If the attempt to open the config file results in an error
-    if(m_settings.status() != QSettings::NoError)
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
     {
-        // Alert the user with a message box
-        createCorruptConfigFileBox();
+        QString billName = m_billTableWidget->item(row, m_BILL_NAME_COLUMN)->text();
+        QHash<QString, int>::const_iterator keyIterator = rowByNormalizedKey.constFind(BillKeyIndex::normalizeKey(billName));
+
+        if(keyIterator != rowByNormalizedKey.cend())
+        {
+            createBoxWithNoResult(m_DUPLICATE_ROWS_BOX_PRIMARY_TEXT, m_DUPLICATE_ROWS_BOX_INFO_TEXT.arg(m_billTableWidget->item(keyIterator.value(), m_BILL_NAME_COLUMN)->text(), billName));
+            return;
+        }
+
+        rowByNormalizedKey.insert(BillKeyIndex::normalizeKey(billName), row);
     }
 
-    // Otherwise if the config file was opened successfully
-    else
+    // Clear the bill map as we wish to use the content from the bill table widget for updates
+    m_billMap.clear();
+
+    // Record any change the user made to the amount available line edit as a deposit, or a withdrawal if money was removed, for the transaction history once the save is written
+    double enteredAmountAvailable = m_amountAvailableEdit->text().toDouble();
+    qint64 depositCents = dollarsToCents(enteredAmountAvailable) - dollarsToCents(m_totalAmountAvailable);
+
+    if(depositCents != 0)
     {
-        // Clear the bill map as we wish to use the content from the bill table widget for updates
-        m_billMap.clear();
+        TransactionLedger::Transaction deposit;
+        deposit.type = TransactionLedger::depositTypeFor(depositCents);
+        deposit.amountCents = depositCents;
+        m_unsavedTransactions.append(deposit);
+    }
 
-        // Update the amount available per the amount available line edit's contents
-        m_totalAmountAvailable = m_amountAvailableEdit->text().toDouble();
+    // Update the amount available per the amount available line edit's contents
+    m_totalAmountAvailable = enteredAmountAvailable;
 
-        // Iterate over the rows of the bill table widget
-        for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    // Record the bills deleted since the last save, their funds having already been returned to the amount available
+    for(const QPair<QString, qint64> &unsavedDeletion : qAsConst(m_unsavedDeletions))
+    {
+        TransactionLedger::Transaction deletion;
+        deletion.type = TransactionLedger::Delete;
+        deletion.amountCents = unsavedDeletion.second;
+        deletion.billKey = unsavedDeletion.first;
+        m_unsavedTransactions.append(deletion);
+    }
+
+    m_unsavedDeletions.clear();
+
+    // Funding changes are moved in the currency of the amount available
+    LedgerFunds ledgerFunds = availableFunds();
+
+    // Iterate over the rows of the bill table widget
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        // Store the name of the bill which is stored in the first column
+        QString billName = m_billTableWidget->item(row, 0)->text();
+
+        // Remove spaces from the bill name for easier handling in the config file
+        QString billNameNoSpaces = m_ledgerStore.billKeyForName(billName);
+
+        // Refer to the bill's entry in the bill map, creating it if needed, so every column is written in place without further lookups
+        Bill &savedBill = m_billMap[billNameNoSpaces];
+
+        // Iterate over the columns in the bill table widget
+        for(int col = 0; col < m_billTableWidget->columnCount(); col++)
         {
-            // Store the name of the bill which is stored in the first column
-            QString billName = m_billTableWidget->item(row, 0)->text();
+            // Store the column header so we know which piece of data we're checking
+            QString columnHeader = m_billTableWidget->horizontalHeaderItem(col)->text();
 
-            // Remove spaces from the bill name for easier handling in the config file
-            QString billNameNoSpaces = removeSpaces(billName);
+            // If the column header is the bill name
+            if(columnHeader == m_BILL_NAME_COLUMN_HEADER_STRING)
+            {
+                // Since the bill name is checked first, start the bill afresh, then update its name
+                savedBill = Bill();
+                savedBill.setName(std::move(billName));
+            }
 
-            // Create a temporary bill object to be inserted into the bill map
-            Bill savedBill;
+            // Otherwise if the column header is the amount due
+            else if(columnHeader == m_BILL_AMOUNT_DUE_COLUMN_HEADER_STRING)
+            {
+                // Update the bill's amount due in the map
+                savedBill.setAmountDue(m_billTableWidget->item(row, col)->text().toDouble());
+            }
 
-            // Iterate over the columns in the bill table widget
-            for(int col = 0; col < m_billTableWidget->columnCount(); col++)
+            // Otherwise if the column header is the due date
+            else if(columnHeader == m_BILL_DUE_DATE_COLUMN_HEADER_STRING)
             {
-                // Store the column header so we know which piece of data we're checking
-                QString columnHeader = m_billTableWidget->horizontalHeaderItem(col)->text();
+                // Retrieve the due date edit from the bill table widget
+                QDateEdit *savedDate;
+                savedDate = (QDateEdit*)m_billTableWidget->cellWidget(row, col);
 
-                // If the column header is the bill name
-                if(columnHeader == m_BILL_NAME_COLUMN_HEADER_STRING)
-                {
-                    // Update the temporary bill object's name
-                    savedBill.setName(billName);
+                // Update the bill's due date in the map
+                savedBill.setDueDate(savedDate->date());
+            }
 
-                    // Since the bill name is checked first, we can insert a bill name, bill object key-value pair into the map
-                    m_billMap[billNameNoSpaces] = savedBill;
-                }
+            // Otherwise if the column header is the currency
+            else if(columnHeader == m_BILL_CURRENCY_COLUMN_HEADER_STRING)
+            {
+                // Update the bill's currency in the map, codes which are not valid are stored as the default currency
+                savedBill.setCurrencyCode(m_billTableWidget->item(row, col)->text());
+            }
 
-                // Otherwise if the column header is the amount due
-                else if(columnHeader == m_BILL_AMOUNT_DUE_COLUMN_HEADER_STRING)
-                {
-                    // Update the bill's amount due in the map
-                    m_billMap[billNameNoSpaces].setAmountDue(m_billTableWidget->item(row, col)->text().toDouble());
-                }
+            // Otherwise if the column header is the category
+            else if(columnHeader == m_BILL_CATEGORY_COLUMN_HEADER_STRING)
+            {
+                // Update the bill's category in the map
+                savedBill.setCategory(m_billTableWidget->item(row, col)->text().trimmed());
+            }
 
-                // Otherwise if the column header is the due date
-                else if(columnHeader == m_BILL_DUE_DATE_COLUMN_HEADER_STRING)
-                {
-                    // Retrieve the due date edit from the bill table widget
-                    QDateEdit *savedDate;
-                    savedDate = (QDateEdit*)m_billTableWidget->cellWidget(row, col);
+            // Otherwise if the column header is the tags
+            else if(columnHeader == m_BILL_TAGS_COLUMN_HEADER_STRING)
+            {
+                // Update the bill's tags in the map by splitting them at the commas
+                savedBill.setTags(CategoryRollup::splitTags(m_billTableWidget->item(row, col)->text()));
+            }
 
-                    // Update the bill's due date in the map
-                    m_billMap[billNameNoSpaces].setDueDate(savedDate->date());
-                }
+            // Otherwise the column header must be the funding status
+            else
+            {
+                // Retrieve the funded status combo box from the bill table widget
+                QComboBox *fundedStatusBox;
+                fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(row, col);
 
-                // Otherwise the column header must be the funding status
-                else
-                {
-                    // Retrieve the funded status combo box from the bill table widget
-                    QComboBox *fundedStatusBox;
-                    fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(row, col);
-
-                    // Store the current funding status
-                    QString fundingStatus = fundedStatusBox->currentText();
-
-                    // Update the bill's funding status in the map
-                    m_billMap[billNameNoSpaces].setFundedStatus(fundingStatusStringToBoolean(fundingStatus));
-
-                    // If a bill is marked as funded and is not already in the funded bill list
-                    if(m_billMap[billNameNoSpaces].isFunded() && !m_fundedBillsList.contains(savedBill.getName()))
-                    {
-                        // Subtract the bill's amount due from the amount available as the funds set aside for this bill are no longer available
-                        m_totalAmountAvailable -= m_billMap[billNameNoSpaces].getAmountDue();
-
-                        // Add this bill to the funded bill list
-                        m_fundedBillsList.append(savedBill.getName());
-                    }
-
-                    // Otherwise if a bill has been switched to no longer be funded (in the event of a defund) but is presently in the funded bill list
-                    else if(!m_billMap[billNameNoSpaces].isFunded() && m_fundedBillsList.contains(savedBill.getName()))
-                    {
-                        // Add the bill's amount due back into the amount available as the bill no longer requires the funding set aside previously
-                        m_totalAmountAvailable += m_billMap[billNameNoSpaces].getAmountDue();
-
-                        // Remove the bill from the funded bill list
-                        m_fundedBillsList.removeOne(savedBill.getName());
-                    }
-                }
+                // Store the current funding status
+                QString fundingStatus = fundedStatusBox->currentText();
+
+                // Update the bill's funding status in the map
+                savedBill.setFundedStatus(m_ledgerStore.fundingStatusFromString(fundingStatus));
             }
         }
-    }
 
-    // Update the amount available line edit with the updated value set to two decimal places
-    m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+        // Once every column is read, if the bill's funding status differs from the funded bill list, set its amount due aside or release it in the currency of the amount available
+        bool wasFunded = m_fundedBillsList.contains(savedBill.getName());
 
-    // Clear the settings object in preparation for updating the config file
-    m_settings.clear();
+        if(savedBill.isFunded() != wasFunded)
+        {
+            // Work the change out from the bill as it was before its funding status was switched
+            Bill previousBill = savedBill;
+            previousBill.setFundedStatus(wasFunded);
 
-    // Create the funds information group
-    m_settings.beginGroup(m_FUNDS_INFORMATION_GROUP_LABEL);
+            // Without a rate the funds cannot be moved, so the bill and its row keep the funding status they had
+            if(!applyFundsChange(ledgerFunds.fundingChange(previousBill, savedBill.isFunded()), billNameNoSpaces, savedBill))
+            {
+                savedBill.setFundedStatus(wasFunded);
+                ((QComboBox*)m_billTableWidget->cellWidget(row, 3))->setCurrentIndex(wasFunded ? 1 : 0);
+            }
 
-    // Write the total funds available out to the config file
-    m_settings.setValue(m_TOTAL_FUNDS_AVAILABLE_KEY, m_totalAmountAvailable);
-    m_settings.endGroup();
-    m_settings.sync();
+            // Keep the funded bill list in step with the bill
+            else if(savedBill.isFunded())
+            {
+                m_fundedBillsList.append(savedBill.getName());
+            }
+            else
+            {
+                m_fundedBillsList.removeOne(savedBill.getName());
+            }
+        }
 
-    // Create an iterator to iterate over the bill map
-    QMap<QString, Bill>::iterator billMapIterator;
+        // If the bill was renamed, take its totals out from under its previous key
+        QString previousBillKey = m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString();
 
-    // Iterate over the bill map
-    for(billMapIterator = m_billMap.begin(); billMapIterator != m_billMap.end(); ++billMapIterator)
-    {
-        // Retrieve the current bill being checked from the map
-        Bill currentBill = *billMapIterator;
+        if(previousBillKey != billNameNoSpaces)
+        {
+            removeBillTotals(previousBillKey);
+        }
 
-        // Set the group label as the bill name
-        m_settings.beginGroup(removeSpaces(currentBill.getName()));
+        // Replace only this bill's contribution to its category and tag totals
+        updateBillTotals(billNameNoSpaces, savedBill);
 
-        // Write the bill amount due, due date, and status key-value pairs to the config file
-        m_settings.setValue(m_BILL_AMOUNT_DUE_KEY, currentBill.getAmountDue());
-        m_settings.setValue(m_BILL_DUE_DATE_KEY, currentBill.getDueDate().toString(m_DATE_STRING_FORMAT));
-        m_settings.setValue(m_BILL_FUNDING_STATUS_KEY, fundingStatusBooleanToString(currentBill.isFunded()));
-        m_settings.endGroup();
+        // Re-key the row to the bill map key it was saved under, in case the bill was renamed
+        setRowBillKey(row, billNameNoSpaces);
     }
 
-    // Sync the settings object at the end
-    m_settings.sync();
+    // Bring the search index and row lookup in line with the rebuilt bill map
+    synchronizeSearchIndexWithMap();
+    rebuildBillRowLookup();
+
+    // Update the amount available line edit with the updated value set to two decimal places
+    m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+
+    // Total the saved bills which are still unfunded, and show the updated category totals
+    updateLeftToFundLabel();
+    refreshCategorySummary();
+
+    // Write the updated bill map out to the config file in the background
+    writeLedgerInBackground();
 }
 
-void MainWindow::switchFundingStatusIfSelected(int p_widgetRow, int p_isFunded)
+void MainWindow::writeLedgerInBackground()
 {
-    // If the current row being checked has been selected by the user
-    if(m_billTableWidget->item(p_widgetRow, 0)->isSelected())
+    // Only one save writes the config file at a time, a save requested meanwhile runs once the current one finishes
+    if(m_jobManager->isRunning(m_saveJobId))
     {
-        // Retrieve the funding status combo box found in the third column
-        QComboBox *fundedStatusBox;
-        fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(p_widgetRow, 3);
-
-        // Switch the funding status to either funded or not funded
-        fundedStatusBox->setCurrentIndex(p_isFunded);
+        m_isSaveQueued = true;
+        return;
     }
+
+    // Take a snapshot of the ledger so the GUI thread can keep editing while it is written
+    LedgerSnapshot ledgerToSave;
+    ledgerToSave.billMap = m_billMap;
+    ledgerToSave.totalAmountAvailable = m_totalAmountAvailable;
+    ledgerToSave.availableCurrencyCode = CurrencyRegistry::codeForIndex(m_availableCurrencyIndex);
+
+    // Copy the ledger store, the ledger last saved, and the exchange rates so the job does not touch the MainWindow's members while it runs
+    LedgerStore ledgerStore = m_ledgerStore;
+    LedgerSnapshot baseLedger = m_savedLedger;
+    ExchangeRateTable exchangeRateTable = m_exchangeRateTable;
+
+    // The funds moves made so far are written to the transaction history only once this save has written them to the config file
+    m_savingTransactions = std::move(m_unsavedTransactions);
+    m_unsavedTransactions.clear();
+
+    m_saveJobId = m_jobManager->submit(m_SAVE_JOB_NAME, [ledgerStore, ledgerToSave, baseLedger, exchangeRateTable](JobContext &p_jobContext) -> QVariant
+    {
+        // Write the snapshot, merging in changes other instances saved since the base, and let the GUI thread apply them
+        return QVariant::fromValue(ledgerStore.save(ledgerToSave, baseLedger, exchangeRateTable, &p_jobContext));
+    });
 }
 
-void MainWindow::fundBillOnClick()
+void MainWindow::applySaveResult(const LedgerStore::SaveResult &p_saveResult)
 {
-    // Iterate over the bill table widget rows
-    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    // Later saves are merged against what was just written
+    m_savedLedger = p_saveResult.savedLedger;
+
+    if(p_saveResult.mergedBillKeys.isEmpty() && p_saveResult.mergedRemovedBillKeys.isEmpty() && p_saveResult.mergedAmountAvailableChange == 0.00
+       && p_saveResult.savedLedger.availableCurrencyCode == CurrencyRegistry::codeForIndex(m_availableCurrencyIndex))
     {
-        // If a row is selected, set the Bill's funding status to funded
-        switchFundingStatusIfSelected(row, 1);
+        return;
     }
-}
 
-void MainWindow::defundBillOnClick()
-{
-    // Iterate over the bill table widget rows
-    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    // Store the bills other instances added or changed, the merged bill replaces the one shown
+    for(const QString &mergedBillKey : p_saveResult.mergedBillKeys)
     {
-        // If a row is selected, set the Bill's funding status to not funded
-        switchFundingStatusIfSelected(row, 0);
+        storeBill(mergedBillKey, p_saveResult.savedLedger.billMap.value(mergedBillKey));
     }
-}
 
-void MainWindow::deleteBillOnClick()
-{
-    // Iterate over the bill table widget rows
-    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    // Remove the bills other instances removed, and their rows together
+    QVector<int> removedRows;
+
+    for(const QString &removedBillKey : p_saveResult.mergedRemovedBillKeys)
     {
-        // If the current row being checked has been selected by the user
-        if(m_billTableWidget->item(row, 0)->isSelected())
-        {
-            // Retrieve the funding status combo box found in the third column
-            QComboBox *fundedStatusBox;
-            fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(row, 3);
+        removeStoredBill(removedBillKey, removedRows);
+    }
 
-            // If the funding status is marked as funded
-            if(fundedStatusBox->currentText() == m_FUNDED_STRING)
-            {
-                // Add the bill's amount due back to the amount available by accessing the bill's amount due in the second column
-                m_totalAmountAvailable+= m_billTableWidget->item(row, 1)->text().toDouble();
+    removeBillRows(removedRows);
 
-                // Update the amount available line edit
-                m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+    // Adopt a currency another instance changed to, and add the amount available it deposited or spent
+    quint8 savedCurrencyIndex = CurrencyRegistry::indexForCode(p_saveResult.savedLedger.availableCurrencyCode);
 
-                // Remove this bill from the funded bill list by accessing the bill's name in the first column
-                m_fundedBillsList.removeOne(m_billTableWidget->item(row, 0)->text());
-            }
+    if(savedCurrencyIndex != m_availableCurrencyIndex)
+    {
+        m_availableCurrencyIndex = savedCurrencyIndex;
+        updateAmountAvailableLabel();
+        rebuildBillTotals();
+    }
 
-            // Remove the selected row from the bill table widget
-            m_billTableWidget->removeRow(row);
+    m_totalAmountAvailable += p_saveResult.mergedAmountAvailableChange;
+    m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
 
-            // Decrement the row as there is now one less than before
-            row--;
-        }
+    // Re-apply any search the user has typed, so merged bills are filtered too
+    if(!m_searchEdit->text().trimmed().isEmpty())
+    {
+        filterBillsBySearch(m_searchEdit->text());
     }
+
+    // Let the user know other instances' changes were kept, naming the bills both changed
+    updateLeftToFundLabel();
+    refreshCategorySummary();
+    int mergedChangeCount = p_saveResult.mergedBillKeys.size() + p_saveResult.mergedRemovedBillKeys.size();
+    QString mergedStatusText = p_saveResult.conflictingBillKeys.isEmpty() ? m_SAVE_MERGED_STATUS_TEXT.arg(mergedChangeCount)
+                                                                          : m_SAVE_CONFLICT_STATUS_TEXT.arg(p_saveResult.conflictingBillKeys.size()).arg(p_saveResult.conflictingBillKeys.join(", "));
+    statusBar()->showMessage(mergedStatusText, m_STATUS_MESSAGE_TIMEOUT_MSECS);
 }
 
-void MainWindow::createResetBillsConfirmationBox()
+void MainWindow::recordBalanceSnapshot(const LedgerStore::SaveResult &p_saveResult)
 {
-    // Create the reset bills QMessageBox with appropriate displayed text
-    QMessageBox resetBillsConfirmationBox;
-    resetBillsConfirmationBox.setText(m_RESET_BILLS_BOX_PRIMARY_TEXT);
-    resetBillsConfirmationBox.setInformativeText(m_RESET_BILLS_BOX_INFO_TEXT);
+    // Totals missing the bills of a currency without a rate would show a drop which never happened, so they are not recorded
+    if(!p_saveResult.missingRateCurrencyCodes.isEmpty())
+    {
+        statusBar()->showMessage(m_BALANCE_HISTORY_MISSING_RATE_STATUS_TEXT.arg(p_saveResult.missingRateCurrencyCodes.join(", ")), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+        return;
+    }
 
-    // Give the user the options of electing yes or no to reset their bills
-    resetBillsConfirmationBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    // The save totalled what it wrote in the background, so only the append is left, the save itself having succeeded even if it fails
+    if(!m_balanceHistory.append(p_saveResult.balanceSnapshot))
+    {
+        statusBar()->showMessage(m_BALANCE_HISTORY_FAILED_STATUS_TEXT, m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
 
-    // Store the user's selection
-    int resetBillsConfirmationBoxSelection = resetBillsConfirmationBox.exec();
+    // Show the new snapshot if the history is open
+    else if(m_balanceHistoryWidget->isVisible())
+    {
+        m_balanceHistoryWidget->refreshHistory();
+    }
+}
 
-    switch(resetBillsConfirmationBoxSelection)
+void MainWindow::handleJobProgress(quint64 p_jobId, int p_percentComplete, QString p_statusText)
+{
+    // Show the job's progress in the status bar
+    Q_UNUSED(p_jobId);
+    statusBar()->showMessage(p_statusText + " " + QString::number(p_percentComplete) + "%");
+}
+
+void MainWindow::handleJobFinished(quint64 p_jobId, QVariant p_result)
+{
+    // Clear the progress message
+    statusBar()->clearMessage();
+
+    // If the config file finished loading, display its contents
+    if(p_jobId == m_loadJobId)
     {
-        // If the user selects yes
-        case QMessageBox::Yes :
+        applyLoadedLedger(p_result.value<LedgerSnapshot>());
+    }
+
+    // If the config file finished saving
+    else if(p_jobId == m_saveJobId)
+    {
+        LedgerStore::SaveResult saveResult = p_result.value<LedgerStore::SaveResult>();
+
+        // Alert the user if another instance held the config file for too long
+        if(saveResult.isLockTimedOut)
         {
-            // Remove the existing configuration file and launch the initialization sequence
-            resetBillsAndLaunchInitialization();
-            break;
+            createBoxWithNoResult(m_CONFIG_LOCKED_BOX_PRIMARY_TEXT, m_CONFIG_LOCKED_BOX_INFO_TEXT);
         }
 
-        // If the user selects no
-        case QMessageBox::No :
+        // Alert the user if it could not be written, a cancelled save having left the config file as it was
+        else if(!saveResult.isWritten && !saveResult.isCancelled)
         {
-            // Break and return to the bill table widget
-            break;
+            createCorruptConfigFileBox();
         }
 
-        default:
+        // Show the changes other instances saved, which were merged into the config file, and record the funds moves it wrote in a single append
+        else if(saveResult.isWritten)
         {
-            // Default to breaking and returning to the bill table widget
-            break;
+            m_transactionLedger.appendBatch(m_savingTransactions);
+            m_savingTransactions.clear();
+            applySaveResult(saveResult);
+            recordBalanceSnapshot(saveResult);
+        }
+
+        // The funds moves of a save which was not written are carried by the next one, ahead of any made since
+        if(!m_savingTransactions.isEmpty())
+        {
+            m_unsavedTransactions = m_savingTransactions + m_unsavedTransactions;
+            m_savingTransactions.clear();
         }
+
+        // Write any save which was requested while this one was running
+        if(m_isSaveQueued)
+        {
+            m_isSaveQueued = false;
+            writeLedgerInBackground();
+        }
+    }
+
+    // If the cash flow simulation finished, list the results of every path
+    else if(p_jobId == m_simulationJobId)
+    {
+        m_cashFlowSimulationWidget->setResult(p_result.value<CashFlowSimulation::Result>(), m_simulationCurrencyCode);
+        m_cashFlowSimulationWidget->setRunning(false);
     }
 }
 
-void MainWindow::resetBillsAndLaunchInitialization()
+void MainWindow::handleJobPartialResult(quint64 p_jobId, int p_percentComplete, QVariant p_partialResult)
 {
-    // If the configuration file was successfully removed
-    if(m_configFileDirectory.remove(m_CONFIG_FILE_DIRECTORY_NAME))
+    Q_UNUSED(p_percentComplete);
+
+    // List the paths the simulation has completed so far, a result from an earlier simulation being ignored
+    if(p_jobId == m_simulationJobId)
     {
-        // Hide the bill table widget
-        this->hide();
+        m_cashFlowSimulationWidget->setResult(p_partialResult.value<CashFlowSimulation::Result>(), m_simulationCurrencyCode);
+    }
+}
 
-        // Make sure to clear the bill map so the data to be shown in the bill table widget following initialization is reset
-        m_billMap.clear();
+void MainWindow::handleJobCancelled(quint64 p_jobId, QVariant p_result)
+{
+    // Clear the progress message
+    statusBar()->clearMessage();
 
-        // Begin the initialization sequence
-        welcomeFirstTimeUser();
+    // List the paths the simulation completed before it stopped, including its last batch, and allow another to be run
+    if(p_jobId == m_simulationJobId)
+    {
+        if(p_result.isValid())
+        {
+            m_cashFlowSimulationWidget->setResult(p_result.value<CashFlowSimulation::Result>(), m_simulationCurrencyCode);
+        }
+
+        m_cashFlowSimulationWidget->setMessage(m_SIMULATION_CANCELLED_TEXT);
+        m_cashFlowSimulationWidget->setRunning(false);
     }
 
-    // Otherwise if the configuration file could not be removed
-    else
+    // A save requested while a cancelled one was stopping, such as the first save after Reset, runs now
+    else if(p_jobId == m_saveJobId && m_isSaveQueued)
     {
-        // Create an appropriate message box to alert the user
-        createBoxWithNoResult(m_RESET_FAIL_BOX_PRIMARY_TEXT, m_RESET_FAIL_BOX_INFO_TEXT);
+        m_isSaveQueued = false;
+        writeLedgerInBackground();
     }
+}
+
+void MainWindow::showLedgerHistory()
+{
+    // Display the history with the latest transactions included
+    m_ledgerHistoryWidget->refreshHistory();
+    m_ledgerHistoryWidget->show();
+    m_ledgerHistoryWidget->raise();
+}
+
+void MainWindow::showBalanceHistory()
+{
+    // Display the history with the latest saves included, pft's among them
+    m_balanceHistory.refresh();
+    m_balanceHistoryWidget->refreshHistory();
+    m_balanceHistoryWidget->show();
+    m_balanceHistoryWidget->raise();
+}
+
+void MainWindow::showBillArchive()
+{
+    // Display the archive with any newly archived bills included
+    m_billArchiveWidget->refreshArchive();
+    m_billArchiveWidget->show();
+    m_billArchiveWidget->raise();
+}
 
+void MainWindow::showPeriodReport()
+{
+    // Display the report with any changes since it was last shown
+    refreshPeriodReport();
+    m_periodReportWidget->show();
+    m_periodReportWidget->raise();
+}
+
+void MainWindow::refreshPeriodReport()
+{
+    Profiler::Scope profileScope(m_PROFILE_PERIOD_REPORT_PHASE);
+
+    // Round the range out to the quarters or years shown, so the months a period covers beyond the chosen days are totalled too
+    QDate firstDate = m_periodReportWidget->getFirstDate();
+    QDate lastDate = m_periodReportWidget->getLastDate();
+    PeriodReport::roundToPeriods(m_periodReportWidget->getGranularity(), firstDate, lastDate);
+
+    // Every bill is totalled in the currency of the total amount available, using the cached exchange rates, bills without a rate being left out
+    PeriodReport::AmountFunction amountFunction = [this](const Bill &p_bill)
+    {
+        return m_exchangeRateTable.convertCents(p_bill.getAmountDueCents(), p_bill.getCurrencyIndex(), m_availableCurrencyIndex);
+    };
+
+    // Archived bills never change, so their segments are only loaded for months which have not been totalled yet
+    QVector<int> staleArchivedMonths = m_periodReport.staleMonths(PeriodReport::ArchivedBills, firstDate, lastDate);
+
+    if(!staleArchivedMonths.isEmpty())
+    {
+        QVector<BillArchive::ArchivedBill> archivedBills = m_billArchive.billsBetween(PeriodReport::firstDateOfMonth(staleArchivedMonths.first()),
+                                                                                      PeriodReport::firstDateOfMonth(staleArchivedMonths.last() + 1).addDays(-1));
+        QVector<const Bill*> archivedBillPointers;
+        archivedBillPointers.reserve(archivedBills.size());
+
+        for(const BillArchive::ArchivedBill &archivedBill : archivedBills)
+        {
+            archivedBillPointers.append(&archivedBill.bill);
+        }
+
+        m_periodReport.totalMonths(PeriodReport::ArchivedBills, staleArchivedMonths, archivedBillPointers, amountFunction);
+    }
+
+    // Only the months of bills which changed since the last report are totalled again
+    QVector<int> staleCurrentMonths = m_periodReport.staleMonths(PeriodReport::CurrentBills, firstDate, lastDate);
+
+    if(!staleCurrentMonths.isEmpty())
+    {
+        QVector<const Bill*> currentBillPointers;
+        currentBillPointers.reserve(m_billMap.size());
+
+        for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+        {
+            currentBillPointers.append(&billMapIterator.value());
+        }
+
+        m_periodReport.totalMonths(PeriodReport::CurrentBills, staleCurrentMonths, currentBillPointers, amountFunction);
+    }
+
+    // Merge the cached months into the selected periods
+    m_periodReportWidget->setReport(m_periodReport.periods(firstDate, lastDate, m_periodReportWidget->getGranularity()), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex),
+                                    std::max(staleArchivedMonths.size(), staleCurrentMonths.size()));
+}
+
+void MainWindow::showBillCalendar()
+{
+    // Display the calendar with any changes since it was last shown
+    refreshBillCalendar();
+    m_billCalendarWidget->show();
+    m_billCalendarWidget->raise();
+}
+
+void MainWindow::refreshBillCalendar()
+{
+    // Each day shown is a single bucket lookup, however many bills there are
+    m_billCalendarWidget->setDayTotals(m_billCalendar.rangeTotals(m_billCalendarWidget->getFirstShownDate(), m_billCalendarWidget->getLastShownDate()),
+                                       CurrencyRegistry::codeForIndex(m_availableCurrencyIndex));
+
+    // List the bills due on the selected day from its bucket
+    QStringList dayBillKeys = m_billCalendar.billKeysDueOn(m_billCalendarWidget->getSelectedDate());
+    QVector<Bill> dayBills;
+    dayBills.reserve(dayBillKeys.size());
+
+    for(const QString &dayBillKey : dayBillKeys)
+    {
+        dayBills.append(m_billMap.value(dayBillKey));
+    }
+
+    m_billCalendarWidget->setDayBills(dayBills);
+}
+
+void MainWindow::deliverDueReminders()
+{
+    QVector<ReminderScheduler::Reminder> dueReminders = m_reminderScheduler.takeDueReminders(QDate::currentDate());
+    int overdueCount = 0;
+    QStringList billNames;
+
+    // Count the overdue bills and name the first few bills, overdue ones first
+    std::stable_sort(dueReminders.begin(), dueReminders.end(), [](const ReminderScheduler::Reminder &p_firstReminder, const ReminderScheduler::Reminder &p_secondReminder)
+    {
+        return p_firstReminder.kind > p_secondReminder.kind;
+    });
+
+    for(const ReminderScheduler::Reminder &dueReminder : dueReminders)
+    {
+        overdueCount += dueReminder.kind == ReminderScheduler::OverdueReminder ? 1 : 0;
+
+        if(billNames.size() < m_MAX_REMINDER_NAMES)
+        {
+            billNames.append(m_REMINDER_NAME_TEXT.arg(m_billMap.value(dueReminder.billKey).getName(), m_ledgerStore.formatDate(dueReminder.dueDate)));
+        }
+    }
+
+    // Raise a single notification however many reminders fired together
+    if(!dueReminders.isEmpty())
+    {
+        if(dueReminders.size() > m_MAX_REMINDER_NAMES)
+        {
+            billNames.append(m_REMINDER_MORE_TEXT.arg(dueReminders.size() - m_MAX_REMINDER_NAMES));
+        }
+
+        QString reminderText = m_REMINDER_MESSAGE_TEXT.arg(overdueCount).arg(dueReminders.size() - overdueCount).arg(m_reminderScheduler.getLeadDays()).arg(billNames.join(", "));
+
+        if(m_reminderTrayIcon->isVisible())
+        {
+            m_reminderTrayIcon->showMessage(m_REMINDER_TITLE_TEXT, reminderText, overdueCount > 0 ? QSystemTrayIcon::Warning : QSystemTrayIcon::Information);
+        }
+
+        statusBar()->showMessage(reminderText);
+    }
+
+    // Wait for the next reminder
+    armReminderTimer();
+}
+
+void MainWindow::chooseReminderLeadDays()
+{
+    bool isLeadDaysChosen = false;
+    int leadDays = QInputDialog::getInt(this, m_REMINDER_TITLE_TEXT, m_REMINDER_LEAD_DAYS_TEXT, m_reminderScheduler.getLeadDays(), 0, m_MAX_REMINDER_LEAD_DAYS, 1, &isLeadDaysChosen);
+
+    // If the user pressed ok, save the lead time and reschedule every bill's upcoming reminder for it
+    if(isLeadDaysChosen)
+    {
+        QSettings reminderSettings(m_REMINDER_FILE_DIRECTORY_NAME, QSettings::IniFormat);
+        reminderSettings.setValue(m_REMINDER_LEAD_DAYS_KEY, leadDays);
+
+        m_reminderScheduler.setLeadDays(leadDays);
+        armReminderTimer();
+    }
+}
+
+void MainWindow::armReminderTimer()
+{
+    m_armedReminderDay = m_reminderScheduler.nextFireDay();
+
+    if(m_armedReminderDay == 0)
+    {
+        m_reminderTimer->stop();
+        return;
+    }
+
+    // Fire at the start of the reminder's day, checking again at least daily for reminders further off
+    qint64 msecsUntilReminder = QDateTime::currentDateTime().msecsTo(QDateTime(QDate::fromJulianDay(m_armedReminderDay), QTime(0, 0)));
+    m_reminderTimer->start(static_cast<int>(qBound(Q_INT64_C(0), msecsUntilReminder, m_MAX_REMINDER_TIMER_MSECS)));
+}
+
+void MainWindow::setAutomationServerEnabled(bool p_isEnabled)
+{
+    if(!p_isEnabled)
+    {
+        m_automationServer->stop();
+        return;
+    }
+
+    // Let the user know where scripts should connect, or why they cannot
+    if(m_automationServer->start(m_AUTOMATION_SERVER_NAME))
+    {
+        statusBar()->showMessage(m_AUTOMATION_STARTED_TEXT.arg(m_AUTOMATION_SERVER_NAME), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
+    else
+    {
+        statusBar()->showMessage(m_AUTOMATION_START_FAILED_TEXT.arg(m_automationServer->errorString()), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+
+        // Leave the action unchecked without toggling the server again
+        m_automationAction->blockSignals(true);
+        m_automationAction->setChecked(false);
+        m_automationAction->blockSignals(false);
+    }
+}
+
+void MainWindow::switchFundingStatusIfSelected(int p_widgetRow, int p_isFunded)
+{
+    // If the current row being checked has been selected by the user
+    if(m_billTableWidget->item(p_widgetRow, 0)->isSelected())
+    {
+        // Retrieve the funding status combo box found in the third column
+        QComboBox *fundedStatusBox;
+        fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(p_widgetRow, 3);
+
+        // Switch the funding status to either funded or not funded
+        fundedStatusBox->setCurrentIndex(p_isFunded);
+    }
+}
+
+void MainWindow::fundBillOnClick()
+{
+    // Iterate over the bill table widget rows
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        // If a row is selected, set the Bill's funding status to funded
+        switchFundingStatusIfSelected(row, 1);
+    }
+}
+
+void MainWindow::defundBillOnClick()
+{
+    // Iterate over the bill table widget rows
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        // If a row is selected, set the Bill's funding status to not funded
+        switchFundingStatusIfSelected(row, 0);
+    }
+}
+
+void MainWindow::deleteBillOnClick()
+{
+    // The rows of the deleted bills, removed together once every selected bill has been handled
+    QVector<int> removedRows;
+
+    // Iterate over the bill table widget rows
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        // If the current row being checked has been selected by the user
+        if(m_billTableWidget->item(row, 0)->isSelected())
+        {
+            // Retrieve the funding status combo box found in the third column
+            QComboBox *fundedStatusBox;
+            fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(row, 3);
+
+            // The amount returned to the amount available, which is nothing unless the bill was funded
+            qint64 returnedCents = 0;
+
+            // If the funding status is marked as funded
+            if(m_ledgerStore.fundingStatusFromString(fundedStatusBox->currentText()))
+            {
+                // Convert the bill's amount due in the second column from the currency in the fifth column into the currency of the amount available
+                bool isConverted = true;
+                returnedCents = convertToAvailableCurrency(dollarsToCents(m_billTableWidget->item(row, 1)->text().toDouble()),
+                                                           CurrencyRegistry::indexForCode(m_billTableWidget->item(row, 4)->text()), &isConverted);
+
+                // Without a rate its funds cannot be returned, so the bill is kept
+                if(!isConverted)
+                {
+                    continue;
+                }
+
+                // Add the bill's amount due back to the amount available
+                m_totalAmountAvailable += returnedCents / 100.0;
+
+                // Update the amount available line edit
+                m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+
+                // Remove this bill from the funded bill list by accessing the bill's name in the first column
+                m_fundedBillsList.removeOne(m_billTableWidget->item(row, 0)->text());
+            }
+
+            // Hold the deletion and any funds it returned until Save, which records it in the transaction history along with the funding changes made since
+            m_unsavedDeletions.append(qMakePair(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString(), returnedCents));
+
+            // Remove the bill from the search index, category totals, and periodic report so it no longer appears in any of them
+            m_billSearchIndex.removeBill(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString());
+            removeBillTotals(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString());
+
+            // Remove the selected row from the bill table widget along with its sort key once the others are handled
+            removedRows.append(row);
+        }
+    }
+
+    // Remove the rows together, then rebuild the row lookup for the rows which shifted
+    removeBillRows(removedRows);
+
+    // Show the category totals without the deleted bills
+    refreshCategorySummary();
+}
+
+void MainWindow::createResetBillsConfirmationBox()
+{
+    // Create the reset bills QMessageBox with appropriate displayed text
+    QMessageBox resetBillsConfirmationBox;
+    resetBillsConfirmationBox.setText(m_RESET_BILLS_BOX_PRIMARY_TEXT);
+    resetBillsConfirmationBox.setInformativeText(m_RESET_BILLS_BOX_INFO_TEXT);
+
+    // Give the user the options of electing yes or no to reset their bills
+    resetBillsConfirmationBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+
+    // Store the user's selection
+    int resetBillsConfirmationBoxSelection = resetBillsConfirmationBox.exec();
+
+    switch(resetBillsConfirmationBoxSelection)
+    {
+        // If the user selects yes
+        case QMessageBox::Yes :
+        {
+            // Remove the existing configuration file and launch the initialization sequence
+            resetBillsAndLaunchInitialization();
+            break;
+        }
+
+        // If the user selects no
+        case QMessageBox::No :
+        {
+            // Break and return to the bill table widget
+            break;
+        }
+
+        default:
+        {
+            // Default to breaking and returning to the bill table widget
+            break;
+        }
+    }
+}
+
+void MainWindow::resetBillsAndLaunchInitialization()
+{
+    // Stop any save still waiting to run so it does not recreate the removed config file, one already writing finishes before the file is removed
+    m_jobManager->cancel(m_saveJobId);
+    m_isSaveQueued = false;
+
+    // If the configuration file was successfully removed
+    if(m_ledgerStore.remove())
+    {
+        // Hide the bill table widget
+        this->hide();
+
+        // Stop watching the removed config file
+        stopWatchingConfigFile();
+
+        // Make sure to clear the bill map so the data to be shown in the bill table widget following initialization is reset
+        m_billMap.clear();
+        m_unsavedDeletions.clear();
+        m_savedLedger = LedgerSnapshot();
+
+        // Clear the search index, any search in progress, the category totals, the cached report months, the calendar, the key index, and the reminders along with the bills
+        m_billSearchIndex.clear();
+        m_searchEdit->clear();
+        m_categoryRollup.clear();
+        m_periodReport.clear();
+        m_billCalendar.clear();
+        m_billKeyIndex.reset(0);
+        m_reminderScheduler.clear();
+        armReminderTimer();
+        refreshCategorySummary();
+
+        // The loans belonged to the removed bills, so forget their terms too
+        m_configFileDirectory.remove(m_LOAN_FILE_DIRECTORY_NAME);
+        m_loanBook.load(m_LOAN_FILE_DIRECTORY_NAME);
+
+        // Scenarios of the removed bills can no longer be made real
+        m_scenarios.clear();
+        m_scenarioBase = LedgerScenario();
+        refreshScenarios();
+
+        // Begin the initialization sequence
+        welcomeFirstTimeUser();
+    }
+
+    // Otherwise if the configuration file could not be removed
+    else
+    {
+        // Create an appropriate message box to alert the user
+        createBoxWithNoResult(m_RESET_FAIL_BOX_PRIMARY_TEXT, m_RESET_FAIL_BOX_INFO_TEXT);
+    }
+
+}
+
+void MainWindow::rebuildBillRowLookup()
+{
+    // Clear the stale lookup, rows having moved or been removed the next search checks every row
+    m_billRowByKey.clear();
+    m_isSearchFilterStale = true;
+
+    // Map the bill map key stored in each row's name item to the row
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        m_billRowByKey.insert(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString(), row);
+    }
+}
+
+void MainWindow::applySortedRowOrder()
+{
+    // Retrieve the vertical header, which owns the order rows are displayed in, so rows are reordered without recreating their cell widgets
+    QHeaderView *rowHeader = m_billTableWidget->verticalHeader();
+    const QVector<int> &sortedRows = m_billSorter.sortedRows();
+
+    // Move each row to its sorted position, rows already in place are skipped
+    for(int position = 0; position < sortedRows.size(); position++)
+    {
+        int row = sortedRows.at(position);
+
+        if(rowHeader->visualIndex(row) != position)
+        {
+            rowHeader->moveSection(rowHeader->visualIndex(row), position);
+        }
+    }
+}
+
+void MainWindow::repositionSortedRow(int p_row)
+{
+    // Recompute the edited row's sort key and find where it now belongs
+    int sortedPosition = m_billSorter.updateRow(p_row, sortKeyForRow(p_row));
+
+    // While a search is ranking the rows, the new position is only applied once the search is cleared
+    if(!m_searchEdit->text().trimmed().isEmpty())
+    {
+        return;
+    }
+
+    // Every other row is already in sorted order, so moving the edited row is enough
+    QHeaderView *rowHeader = m_billTableWidget->verticalHeader();
+
+    if(rowHeader->visualIndex(p_row) != sortedPosition)
+    {
+        rowHeader->moveSection(rowHeader->visualIndex(p_row), sortedPosition);
+    }
+}
+
+BillSorter::SortKey MainWindow::sortKeyForRow(int p_row)
+{
+    // Retrieve the due date edit and funded status combo box of the row
+    QDateEdit *dueDateEdit = (QDateEdit*)m_billTableWidget->cellWidget(p_row, m_BILL_DUE_DATE_COLUMN);
+    QComboBox *fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(p_row, m_BILL_FUNDING_STATUS_COLUMN);
+
+    // Build the sort key from the values currently displayed in the row
+    return BillSorter::makeSortKey(m_billTableWidget->item(p_row, m_BILL_NAME_COLUMN)->text(), m_billTableWidget->item(p_row, m_BILL_AMOUNT_DUE_COLUMN)->text().toDouble(),
+                                   dueDateEdit->date(), m_ledgerStore.fundingStatusFromString(fundedStatusBox->currentText()), m_billTableWidget->item(p_row, m_BILL_CURRENCY_COLUMN)->text().trimmed().toUpper(),
+                                   m_billTableWidget->item(p_row, m_BILL_CATEGORY_COLUMN)->text().trimmed(), m_billTableWidget->item(p_row, m_BILL_TAGS_COLUMN)->text());
+}
+
+Bill MainWindow::billForRow(int p_row) const
+{
+    // Retrieve the due date edit and funded status combo box of the row
+    QDateEdit *dueDateEdit = (QDateEdit*)m_billTableWidget->cellWidget(p_row, m_BILL_DUE_DATE_COLUMN);
+    QComboBox *fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(p_row, m_BILL_FUNDING_STATUS_COLUMN);
+
+    // Read every column as a save would
+    Bill rowBill;
+    rowBill.setName(m_billTableWidget->item(p_row, m_BILL_NAME_COLUMN)->text());
+    rowBill.setAmountDue(m_billTableWidget->item(p_row, m_BILL_AMOUNT_DUE_COLUMN)->text().toDouble());
+    rowBill.setDueDate(dueDateEdit->date());
+    rowBill.setFundedStatus(m_ledgerStore.fundingStatusFromString(fundedStatusBox->currentText()));
+    rowBill.setCurrencyCode(m_billTableWidget->item(p_row, m_BILL_CURRENCY_COLUMN)->text());
+    rowBill.setCategory(m_billTableWidget->item(p_row, m_BILL_CATEGORY_COLUMN)->text().trimmed());
+    rowBill.setTags(CategoryRollup::splitTags(m_billTableWidget->item(p_row, m_BILL_TAGS_COLUMN)->text()));
+    return rowBill;
+}
+
+void MainWindow::showBillInRow(int p_row, const Bill &p_bill)
+{
+    QDateEdit *dueDateEdit = (QDateEdit*)m_billTableWidget->cellWidget(p_row, m_BILL_DUE_DATE_COLUMN);
+    QComboBox *fundedStatusBox = (QComboBox*)m_billTableWidget->cellWidget(p_row, m_BILL_FUNDING_STATUS_COLUMN);
+
+    // Block change signals while the cells are updated, so the row is repositioned once rather than per cell
+    m_billTableWidget->blockSignals(true);
+    dueDateEdit->blockSignals(true);
+    fundedStatusBox->blockSignals(true);
+
+    m_billTableWidget->item(p_row, m_BILL_NAME_COLUMN)->setText(p_bill.getName());
+    m_billTableWidget->item(p_row, m_BILL_AMOUNT_DUE_COLUMN)->setText(QString::number(p_bill.getAmountDue(), 'f', 2));
+    dueDateEdit->setDate(p_bill.getDueDate());
+    fundedStatusBox->setCurrentIndex(p_bill.isFunded() ? 1 : 0);
+    m_billTableWidget->item(p_row, m_BILL_CURRENCY_COLUMN)->setText(p_bill.getCurrencyCode());
+    m_billTableWidget->item(p_row, m_BILL_CATEGORY_COLUMN)->setText(p_bill.getCategory());
+    m_billTableWidget->item(p_row, m_BILL_TAGS_COLUMN)->setText(CategoryRollup::joinTags(p_bill.getTags()));
+
+    m_billTableWidget->blockSignals(false);
+    dueDateEdit->blockSignals(false);
+    fundedStatusBox->blockSignals(false);
+
+    // Move the row to its new sorted position
+    repositionSortedRow(p_row);
+}
+
+void MainWindow::setRowBillKey(int p_row, const QString &p_billKey)
+{
+    // Store the key on the name item, which is what the search index and row lookup read
+    m_billTableWidget->item(p_row, m_BILL_NAME_COLUMN)->setData(Qt::UserRole, p_billKey);
+
+    // Tag the cell widgets with the key too, since their change signals do not say which row they belong to
+    m_billTableWidget->cellWidget(p_row, m_BILL_DUE_DATE_COLUMN)->setProperty(m_BILL_KEY_PROPERTY, p_billKey);
+    m_billTableWidget->cellWidget(p_row, m_BILL_FUNDING_STATUS_COLUMN)->setProperty(m_BILL_KEY_PROPERTY, p_billKey);
+}
+
+void MainWindow::sortBillsByColumn(int p_column)
+{
+    QVector<BillSorter::SortCriterion> sortCriteria = m_billSorter.criteria();
+
+    // Find whether the column is already one of the sort keys
+    int criterionIndex = -1;
+
+    for(int index = 0; index < sortCriteria.size(); index++)
+    {
+        if(sortCriteria.at(index).column == p_column)
+        {
+            criterionIndex = index;
+        }
+    }
+
+    // If Shift is held, the column becomes an additional sort key, or has its direction toggled if it already is one
+    if(QApplication::keyboardModifiers() & Qt::ShiftModifier)
+    {
+        if(criterionIndex >= 0)
+        {
+            sortCriteria[criterionIndex].order = sortCriteria.at(criterionIndex).order == Qt::AscendingOrder ? Qt::DescendingOrder : Qt::AscendingOrder;
+        }
+        else
+        {
+            sortCriteria.append({p_column, Qt::AscendingOrder});
+        }
+    }
+
+    // Otherwise the column becomes the only sort key, toggling direction if it was already the primary key
+    else
+    {
+        Qt::SortOrder sortOrder = Qt::AscendingOrder;
+
+        if(criterionIndex == 0 && sortCriteria.first().order == Qt::AscendingOrder)
+        {
+            sortOrder = Qt::DescendingOrder;
+        }
+
+        sortCriteria = {{p_column, sortOrder}};
+    }
+
+    // Sort every row using the precomputed sort keys
+    m_billSorter.setCriteria(sortCriteria);
+
+    // Show which column is the primary sort key and in which direction
+    m_billTableWidget->horizontalHeader()->setSortIndicatorShown(true);
+    m_billTableWidget->horizontalHeader()->setSortIndicator(sortCriteria.first().column, sortCriteria.first().order);
+
+    // Display the sorted order, unless a search is currently ranking the rows
+    if(m_searchEdit->text().trimmed().isEmpty())
+    {
+        applySortedRowOrder();
+    }
+}
+
+void MainWindow::filterBillsBySearch(const QString &p_searchText)
+{
+    // If the search was cleared
+    if(p_searchText.trimmed().isEmpty())
+    {
+        // Show every row again, only touching rows which were hidden
+        for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+        {
+            if(m_billTableWidget->isRowHidden(row))
+            {
+                m_billTableWidget->setRowHidden(row, false);
+            }
+        }
+
+        // Every row is shown, so the next search has to hide all but its matches
+        m_searchShownBillKeys.clear();
+        m_isSearchFilterStale = true;
+
+        // Put the rows back in sorted order
+        applySortedRowOrder();
+        return;
+    }
+
+    // Look the search text up in the index, which returns the best matches first
+    int matchCount = 0;
+    QList<BillSearchIndex::SearchResult> searchResults = m_billSearchIndex.search(p_searchText, m_MAX_SEARCH_RESULTS, &matchCount);
+
+    // Retrieve the vertical header so matching rows can be ranked without recreating their cell widgets
+    QHeaderView *rowHeader = m_billTableWidget->verticalHeader();
+    QSet<QString> matchedBillKeys;
+    matchedBillKeys.reserve(searchResults.size());
+    int visualPosition = 0;
+
+    // Move each matching row into position according to its rank
+    for(const BillSearchIndex::SearchResult &searchResult : searchResults)
+    {
+        int row = m_billRowByKey.value(searchResult.billKey, -1);
+
+        // Skip bills which are indexed but not currently displayed
+        if(row < 0)
+        {
+            continue;
+        }
+
+        matchedBillKeys.insert(searchResult.billKey);
+        rowHeader->moveSection(rowHeader->visualIndex(row), visualPosition);
+        visualPosition++;
+    }
+
+    // If rows were added, removed, or shown since the last search, check every row once, showing matching rows and hiding the rest
+    if(m_isSearchFilterStale)
+    {
+        for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+        {
+            bool isRowMatched = matchedBillKeys.contains(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString());
+
+            if(m_billTableWidget->isRowHidden(row) == isRowMatched)
+            {
+                m_billTableWidget->setRowHidden(row, !isRowMatched);
+            }
+        }
+
+        m_isSearchFilterStale = false;
+    }
+
+    // Otherwise every row but the last search's matches is already hidden, so only those and the new matches are touched
+    else
+    {
+        for(const QString &shownBillKey : qAsConst(m_searchShownBillKeys))
+        {
+            int row = m_billRowByKey.value(shownBillKey, -1);
+
+            if(row >= 0 && !matchedBillKeys.contains(shownBillKey) && !m_billTableWidget->isRowHidden(row))
+            {
+                m_billTableWidget->setRowHidden(row, true);
+            }
+        }
+
+        for(const QString &matchedBillKey : qAsConst(matchedBillKeys))
+        {
+            int row = m_billRowByKey.value(matchedBillKey);
+
+            if(m_billTableWidget->isRowHidden(row))
+            {
+                m_billTableWidget->setRowHidden(row, false);
+            }
+        }
+    }
+
+    m_searchShownBillKeys.swap(matchedBillKeys);
+
+    // Let the user know when matches were left out, rather than hiding them silently
+    if(matchCount > searchResults.size())
+    {
+        statusBar()->showMessage(m_SEARCH_MORE_RESULTS_STATUS_TEXT.arg(searchResults.size()).arg(matchCount - searchResults.size()), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
+}
+
+void MainWindow::updateIndexesForItem(QTableWidgetItem *p_item)
+{
+    // Retrieve the name item of the edited row, which carries the row's bill map key
+    QTableWidgetItem *nameItem = m_billTableWidget->item(p_item->row(), m_BILL_NAME_COLUMN);
+
+    // Rows which have not been keyed yet are still being created
+    if(nameItem == nullptr || nameItem->data(Qt::UserRole).isNull())
+    {
+        return;
+    }
+
+    QString billKey = nameItem->data(Qt::UserRole).toString();
+
+    // Re-index the bill under its edited name
+    if(p_item->column() == m_BILL_NAME_COLUMN)
+    {
+        m_billSearchIndex.insertBill(billKey, p_item->text());
+    }
+
+    // Move the row to its new sorted position if one of its sort keys was edited
+    int row = m_billRowByKey.value(billKey, -1);
+
+    if(row >= 0 && (p_item->column() == m_BILL_NAME_COLUMN || p_item->column() == m_BILL_AMOUNT_DUE_COLUMN || p_item->column() == m_BILL_CURRENCY_COLUMN
+                    || p_item->column() == m_BILL_CATEGORY_COLUMN || p_item->column() == m_BILL_TAGS_COLUMN))
+    {
+        repositionSortedRow(row);
+    }
+}
+
+void MainWindow::updateSortKeyForCellWidget()
+{
+    // Find the row of the due date edit or funded status combo box which was changed
+    int row = m_billRowByKey.value(sender()->property(m_BILL_KEY_PROPERTY).toString(), -1);
+
+    // Widgets which have not been keyed yet are still being created
+    if(row < 0)
+    {
+        return;
+    }
+
+    // Move the row to its new sorted position
+    repositionSortedRow(row);
+}
+
+void MainWindow::synchronizeSearchIndexWithMap()
+{
+    // Remove bills which are no longer in the bill map, such as bills saved under a new name
+    foreach(QString indexedBillKey, m_billSearchIndex.billKeys())
+    {
+        if(!m_billMap.contains(indexedBillKey))
+        {
+            m_billSearchIndex.removeBill(indexedBillKey);
+        }
+    }
+
+    // Index any bills which are new or renamed, bills whose names are unchanged are left as they are
+    for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+    {
+        m_billSearchIndex.insertBill(billMapIterator.key(), billMapIterator->getName());
+    }
+}
+
+qint64 MainWindow::dollarsToCents(double p_amountDollars)
+{
+    // Round to the nearest cent so amounts such as 0.29 which are not exact in binary do not lose a cent
+    return qRound64(p_amountDollars * 100.0);
+}
+
+void MainWindow::startWatchingConfigFile()
+{
+    QFile configFile(m_CONFIG_FILE_DIRECTORY_NAME);
+
+    // Record the current sections so only later edits are reported
+    if(configFile.open(QIODevice::ReadOnly))
+    {
+        m_configSectionIndex.reset(configFile.readAll());
+    }
+
+    // Watch the config file, unless it is already being watched
+    if(!m_configFileWatcher->files().contains(m_CONFIG_FILE_DIRECTORY_NAME))
+    {
+        m_configFileWatcher->addPath(m_CONFIG_FILE_DIRECTORY_NAME);
+    }
+}
+
+void MainWindow::stopWatchingConfigFile()
+{
+    // Stop watching the config file and drop any reload which is pending
+    if(!m_configFileWatcher->files().isEmpty())
+    {
+        m_configFileWatcher->removePaths(m_configFileWatcher->files());
+    }
+
+    m_configReloadTimer->stop();
+    m_configSectionIndex.clear();
+}
+
+void MainWindow::scheduleConfigReload(const QString &p_filePath)
+{
+    // Restart the timer on every change, so the reload happens once the file has stopped changing
+    Q_UNUSED(p_filePath);
+    m_configReloadTimer->start();
+}
+
+void MainWindow::reloadChangedConfigSections()
+{
+    // Wait for a save in progress to finish, it shows any changes it merged in itself
+    if(m_jobManager->isRunning(m_saveJobId))
+    {
+        m_configReloadTimer->start();
+        return;
+    }
+
+    // Another instance which saved, such as pft, appends to the balance history just after, so read its snapshots and show them if the history is open
+    if(m_balanceHistory.refresh() && m_balanceHistoryWidget->isVisible())
+    {
+        m_balanceHistoryWidget->refreshHistory();
+    }
+
+    // Saving by writing a new file and renaming it over the old one, as QSettings and many editors do, stops the watcher from following the file, so watch it again
+    if(QFile::exists(m_CONFIG_FILE_DIRECTORY_NAME) && !m_configFileWatcher->files().contains(m_CONFIG_FILE_DIRECTORY_NAME))
+    {
+        m_configFileWatcher->addPath(m_CONFIG_FILE_DIRECTORY_NAME);
+    }
+
+    QFile configFile(m_CONFIG_FILE_DIRECTORY_NAME);
+
+    // The file may be briefly missing while it is being replaced, the watcher reports again once it is back
+    if(!configFile.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    // Find the sections which differ from the last version seen, parsing only those
+    QVector<ConfigSectionIndex::SectionChange> sectionChanges = m_configSectionIndex.update(configFile.readAll());
+
+    if(!sectionChanges.isEmpty())
+    {
+        applyConfigSectionChanges(sectionChanges);
+    }
+}
+
+void MainWindow::applyConfigSectionChanges(const QVector<ConfigSectionIndex::SectionChange> &p_sectionChanges)
+{
+    Profiler::Scope profileScope(m_PROFILE_CONFIG_RELOAD_PHASE);
+
+    QVector<int> removedRows;
+    int appliedChangeCount = 0;
+    int collidingChangeCount = 0;
+    QStringList outOfRangeBillKeys;
+    QStringList mergedBillKeys;
+
+    for(const ConfigSectionIndex::SectionChange &sectionChange : p_sectionChanges)
+    {
+        // If the funds information changed, adopt the new amount available
+        if(m_ledgerStore.isFundsInformationGroup(sectionChange.groupLabel))
+        {
+            double reloadedAmountAvailable = 0.00;
+            QString reloadedCurrencyCode;
+            m_ledgerStore.readFundsInformation(sectionChange.values, reloadedAmountAvailable, reloadedCurrencyCode);
+
+            // Every save stamps a newer version and records its own changes in the transaction history, so only a change made by hand is left to record here
+            quint64 reloadedVersion = m_ledgerStore.readVersion(sectionChange.values);
+            bool isSavedByAnotherInstance = reloadedVersion > m_savedLedger.version;
+
+            // Later saves are merged against the funds information as it now is in the file
+            if(sectionChange.type != ConfigSectionIndex::SectionRemoved)
+            {
+                m_savedLedger.totalAmountAvailable = reloadedAmountAvailable;
+                m_savedLedger.availableCurrencyCode = reloadedCurrencyCode;
+                m_savedLedger.version = reloadedVersion;
+            }
+
+            qint64 depositCents = dollarsToCents(reloadedAmountAvailable) - dollarsToCents(m_totalAmountAvailable);
+            quint8 reloadedCurrencyIndex = CurrencyRegistry::indexForCode(reloadedCurrencyCode);
+
+            // Adopt a changed currency, the amount is taken to already be in it
+            if(sectionChange.type != ConfigSectionIndex::SectionRemoved && reloadedCurrencyIndex != m_availableCurrencyIndex)
+            {
+                m_availableCurrencyIndex = reloadedCurrencyIndex;
+                updateAmountAvailableLabel();
+                rebuildBillTotals();
+                appliedChangeCount++;
+            }
+
+            // Skip it if it already matches, such as after a save
+            if(sectionChange.type != ConfigSectionIndex::SectionRemoved && depositCents != 0)
+            {
+                if(!isSavedByAnotherInstance)
+                {
+                    m_transactionLedger.append(TransactionLedger::depositTypeFor(depositCents), depositCents);
+                }
+
+                // Keep an amount the user is typing but has not saved, moving it by the same change
+                qint64 unsavedChangeCents = dollarsToCents(m_amountAvailableEdit->text().toDouble()) - dollarsToCents(m_totalAmountAvailable);
+                m_totalAmountAvailable = reloadedAmountAvailable;
+                m_amountAvailableEdit->setText(QString::number((dollarsToCents(m_totalAmountAvailable) + unsavedChangeCents) / 100.0, 'f', 2));
+                appliedChangeCount++;
+            }
+
+            continue;
+        }
+
+        // Unsaved edits are the differences between the bill's row and the bill as last read from or written to the file
+        int row = m_billRowByKey.value(sectionChange.groupLabel, -1);
+        bool hasBaseBill = m_savedLedger.billMap.contains(sectionChange.groupLabel);
+        Bill baseBill = m_savedLedger.billMap.value(sectionChange.groupLabel);
+        Bill rowBill = row >= 0 ? billForRow(row) : Bill();
+        bool hasUnsavedEdits = row >= 0 && hasBaseBill && !LedgerStore::haveSameSavedValues(rowBill, baseBill);
+
+        // If the bill was removed from the file, remove it here too, its row is removed with the others afterwards
+        if(sectionChange.type == ConfigSectionIndex::SectionRemoved)
+        {
+            m_savedLedger.billMap.remove(sectionChange.groupLabel);
+
+            // A bill with unsaved edits is kept, as a save keeps a bill edited on one side and deleted on the other
+            if(hasUnsavedEdits)
+            {
+                mergedBillKeys.append(sectionChange.groupLabel);
+                continue;
+            }
+
+            // Bills already gone, such as after deleting and saving them, need nothing more
+            if(removeStoredBill(sectionChange.groupLabel, removedRows))
+            {
+                appliedChangeCount++;
+            }
+
+            continue;
+        }
+
+        // Bills given an amount due too large to hold are left as they are rather than clamped, as when the config file is loaded
+        if(!m_ledgerStore.isAmountDueInRange(sectionChange.values))
+        {
+            outOfRangeBillKeys.append(sectionChange.groupLabel);
+            continue;
+        }
+
+        Bill reloadedBill = m_ledgerStore.readBill(sectionChange.groupLabel, sectionChange.values);
+
+        // Merge the file's changes into the row's unsaved edits field by field, the edits winning fields changed on both sides, before the baseline moves on
+        bool isConflicting = false;
+        Bill mergedBill = hasUnsavedEdits ? LedgerStore::mergeBill(baseBill, rowBill, reloadedBill, isConflicting) : reloadedBill;
+        m_savedLedger.billMap.insert(sectionChange.groupLabel, reloadedBill);
+        QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.constFind(sectionChange.groupLabel);
+
+        // Keep the displayed name of a bill whose name only differs by the spaces removed from its group label
+        if(billMapIterator != m_billMap.cend() && m_ledgerStore.billKeyForName(billMapIterator->getName()) == sectionChange.groupLabel)
+        {
+            reloadedBill.setName(billMapIterator->getName());
+        }
+
+        // Count new bills whose keys collide with a stored bill's once case is ignored, they are still stored so nothing in the file is lost
+        if(billMapIterator == m_billMap.cend() && m_billKeyIndex.findCollision(sectionChange.groupLabel, reloadedBill).kind == BillKeyIndex::KeyCollision)
+        {
+            collidingChangeCount++;
+        }
+
+        // Bills which already match the bill map, such as those just written by a save or by bill entry, are skipped
+        if(storeBill(sectionChange.groupLabel, reloadedBill))
+        {
+            appliedChangeCount++;
+        }
+
+        // The bill map and funded bills list hold the bill as saved, while its row shows it with the unsaved edits the next save writes and funds
+        if(hasUnsavedEdits)
+        {
+            showBillInRow(row, mergedBill);
+
+            // Only mention the bills the file changed, not those just written by this instance's own save
+            if(!LedgerStore::haveSameSavedValues(reloadedBill, baseBill))
+            {
+                mergedBillKeys.append(sectionChange.groupLabel);
+            }
+        }
+    }
+
+    // Remove the rows of removed bills together
+    removeBillRows(removedRows);
+
+    // Re-apply any search the user has typed, so new and renamed bills are filtered too
+    if(!m_searchEdit->text().trimmed().isEmpty())
+    {
+        filterBillsBySearch(m_searchEdit->text());
+    }
+
+    // Let the user know their external edits were picked up, and re-total the bills they changed
+    if(appliedChangeCount > 0 || !mergedBillKeys.isEmpty())
+    {
+        updateLeftToFundLabel();
+        refreshCategorySummary();
+        QString reloadedStatusText = collidingChangeCount > 0 ? m_CONFIG_RELOADED_COLLISION_STATUS_TEXT.arg(appliedChangeCount).arg(collidingChangeCount)
+                                                              : m_CONFIG_RELOADED_STATUS_TEXT.arg(appliedChangeCount);
+
+        if(!mergedBillKeys.isEmpty())
+        {
+            reloadedStatusText = m_CONFIG_RELOADED_MERGED_STATUS_TEXT.arg(appliedChangeCount).arg(mergedBillKeys.size()).arg(mergedBillKeys.join(", "));
+        }
+
+        statusBar()->showMessage(reloadedStatusText, m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
+
+    if(!outOfRangeBillKeys.isEmpty())
+    {
+        statusBar()->showMessage(m_CONFIG_RELOADED_OUT_OF_RANGE_STATUS_TEXT.arg(outOfRangeBillKeys.size()).arg(outOfRangeBillKeys.join(", ")), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
+}
+
+bool MainWindow::storeBill(const QString &p_billKey, const Bill &p_bill)
+{
+    QMap<QString, Bill>::iterator billMapIterator = m_billMap.find(p_billKey);
+    int row = m_billRowByKey.value(p_billKey, -1);
+
+    // Skip bills which already match the bill map
+    if(billMapIterator != m_billMap.end() && *billMapIterator == p_bill)
+    {
+        return false;
+    }
+
+    // Keep the funded bills list in step with the stored funding status
+    if(billMapIterator != m_billMap.end())
+    {
+        m_fundedBillsList.removeOne(billMapIterator->getName());
+    }
+
+    m_fundedBillsList.removeOne(p_bill.getName());
+
+    if(p_bill.isFunded())
+    {
+        m_fundedBillsList.append(p_bill.getName());
+    }
+
+    // Store the bill, index its name, and update the totals it contributes to
+    m_billMap[p_billKey] = p_bill;
+    m_billSearchIndex.insertBill(p_billKey, p_bill.getName());
+    updateBillTotals(p_billKey, p_bill);
+
+    // If the bill is already displayed, update only its row's cells
+    if(row >= 0)
+    {
+        showBillInRow(row, p_bill);
+    }
+
+    // Otherwise append a row for the new bill and place it in sorted order
+    else
+    {
+        row = m_billTableWidget->rowCount();
+        m_billTableWidget->insertRow(row);
+        createBillRow(row, p_billKey, p_bill);
+        m_billRowByKey.insert(p_billKey, row);
+        m_isSearchFilterStale = true;
+
+        int sortedPosition = m_billSorter.appendRow(sortKeyForRow(row));
+        QHeaderView *rowHeader = m_billTableWidget->verticalHeader();
+
+        if(rowHeader->visualIndex(row) != sortedPosition)
+        {
+            rowHeader->moveSection(rowHeader->visualIndex(row), sortedPosition);
+        }
+    }
+
+    return true;
+}
+
+bool MainWindow::removeStoredBill(const QString &p_billKey, QVector<int> &p_removedRows)
+{
+    QMap<QString, Bill>::iterator billMapIterator = m_billMap.find(p_billKey);
+    int row = m_billRowByKey.value(p_billKey, -1);
+
+    if(billMapIterator == m_billMap.end() && row < 0)
+    {
+        return false;
+    }
+
+    if(billMapIterator != m_billMap.end())
+    {
+        m_fundedBillsList.removeOne(billMapIterator->getName());
+        m_billMap.erase(billMapIterator);
+    }
+
+    // Rows are removed together by removeBillRows(), since each removal shifts the rows below it
+    if(row >= 0)
+    {
+        p_removedRows.append(row);
+    }
+
+    m_billSearchIndex.removeBill(p_billKey);
+    removeBillTotals(p_billKey);
+    return true;
+}
+
+void MainWindow::removeBillRows(QVector<int> p_removedRows)
+{
+    if(p_removedRows.isEmpty())
+    {
+        return;
+    }
+
+    // Remove the rows from the bottom up, so the rows still to be removed keep their numbers
+    std::sort(p_removedRows.begin(), p_removedRows.end(), std::greater<int>());
+
+    for(int removedRow : p_removedRows)
+    {
+        m_billTableWidget->removeRow(removedRow);
+    }
+
+    // The sort keys are removed together, renumbering the sorted order once
+    m_billSorter.removeRows(p_removedRows);
+    rebuildBillRowLookup();
+    applySortedRowOrder();
+}
+
+QVector<QJsonObject> MainWindow::handleAutomationBatch(const QVector<QJsonObject> &p_requests)
+{
+    Profiler::Scope profileScope(m_PROFILE_AUTOMATION_BATCH_PHASE);
+
+    QVector<QJsonObject> responses;
+    responses.reserve(p_requests.size());
+
+    // The bill map is incomplete while the config file loads, so refuse every request until it is done
+    if(m_jobManager->isRunning(m_loadJobId))
+    {
+        for(const QJsonObject &request : p_requests)
+        {
+            responses.append(AutomationServer::errorResponse(request, m_AUTOMATION_NOT_READY_TEXT));
+        }
+
+        return responses;
+    }
+
+    // Bills added or changed by the batch, and the keys of bills it deleted, applied to the bill map together at the end
+    QHash<QString, Bill> pendingBills;
+    QSet<QString> deletedBillKeys;
+    QHash<QString, QString> addedBillKeysByNormalizedKey;
+    QVector<TransactionLedger::Transaction> pendingTransactions;
+    double previousAmountAvailable = m_totalAmountAvailable;
+
+    // Looks a bill up as it stands after the requests handled so far
+    auto findBill = [this, &pendingBills, &deletedBillKeys](const QString &p_billKey, Bill &p_bill) -> bool
+    {
+        QHash<QString, Bill>::const_iterator pendingIterator = pendingBills.constFind(p_billKey);
+
+        if(pendingIterator != pendingBills.cend())
+        {
+            p_bill = pendingIterator.value();
+            return true;
+        }
+
+        QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.constFind(p_billKey);
+
+        if(billMapIterator == m_billMap.cend() || deletedBillKeys.contains(p_billKey))
+        {
+            return false;
+        }
+
+        p_bill = billMapIterator.value();
+        return true;
+    };
+
+    // Visits every bill as it stands after the requests handled so far
+    auto forEachBill = [this, &pendingBills, &deletedBillKeys](const std::function<void(const QString&, const Bill&)> &p_visitor)
+    {
+        for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+        {
+            if(!pendingBills.contains(billMapIterator.key()) && !deletedBillKeys.contains(billMapIterator.key()))
+            {
+                p_visitor(billMapIterator.key(), billMapIterator.value());
+            }
+        }
+
+        for(QHash<QString, Bill>::const_iterator pendingIterator = pendingBills.cbegin(); pendingIterator != pendingBills.cend(); ++pendingIterator)
+        {
+            p_visitor(pendingIterator.key(), pendingIterator.value());
+        }
+    };
+
+    for(const QJsonObject &request : p_requests)
+    {
+        QString operation = request.value(m_AUTOMATION_OPERATION_KEY).toString();
+        QString billKey = request.value(m_AUTOMATION_KEY_KEY).toString();
+        QJsonObject response = AutomationServer::successResponse(request);
+        Bill requestedBill;
+
+        // List every bill
+        if(operation == m_AUTOMATION_LIST_OPERATION)
+        {
+            QJsonArray billArray;
+
+            forEachBill([this, &billArray](const QString &p_billKey, const Bill &p_bill)
+            {
+                billArray.append(billToAutomationJson(p_billKey, p_bill));
+            });
+
+            response.insert(m_AUTOMATION_BILLS_KEY, billArray);
+        }
+
+        // Report the amount available and the unfunded amount due, summed per currency and converted once per currency as the left to fund label is
+        else if(operation == m_AUTOMATION_TOTALS_OPERATION)
+        {
+            LedgerFunds::BillTotals billTotals;
+
+            forEachBill([&billTotals](const QString &p_billKey, const Bill &p_bill)
+            {
+                Q_UNUSED(p_billKey);
+                billTotals.addBill(p_bill);
+            });
+
+            response.insert(m_AUTOMATION_AMOUNT_AVAILABLE_KEY, m_totalAmountAvailable);
+            response.insert(m_AUTOMATION_CURRENCY_KEY, CurrencyRegistry::codeForIndex(m_availableCurrencyIndex));
+            response.insert(m_AUTOMATION_LEFT_TO_FUND_KEY, availableFunds().convertTotals(billTotals.unfundedCentsByCurrency) / 100.0);
+            response.insert(m_AUTOMATION_BILL_COUNT_KEY, billTotals.billCount);
+            response.insert(m_AUTOMATION_FUNDED_BILL_COUNT_KEY, billTotals.fundedBillCount);
+        }
+
+        // Add a new, unfunded bill keyed by its name with spaces removed, in the currency of the amount available unless another is given
+        else if(operation == m_AUTOMATION_ADD_OPERATION)
+        {
+            QString billName = request.value(m_AUTOMATION_NAME_KEY).toString().trimmed();
+            billKey = m_ledgerStore.billKeyForName(billName);
+            requestedBill.setName(billName);
+            requestedBill.setCurrencyIndex(m_availableCurrencyIndex);
+            requestedBill.setDueDate(QDate::currentDate());
+            QString fieldError = applyAutomationFields(request, requestedBill);
+
+            if(billKey.isEmpty() || m_ledgerStore.isFundsInformationGroup(billKey))
+            {
+                response = AutomationServer::errorResponse(request, m_AUTOMATION_INVALID_FIELD_TEXT.arg(m_AUTOMATION_NAME_KEY));
+            }
+            else if(!fieldError.isEmpty())
+            {
+                response = AutomationServer::errorResponse(request, fieldError);
+            }
+            else
+            {
+                // Bills deleted earlier in the batch are still in the key index, but no longer collide
+                BillKeyIndex::Collision collision = m_billKeyIndex.findCollision(billKey, requestedBill);
+                Bill existingBill;
+
+                if(collision.kind != BillKeyIndex::NoCollision && !findBill(collision.existingBillKey, existingBill))
+                {
+                    collision.kind = BillKeyIndex::NoCollision;
+                }
+
+                // Bills added earlier in the batch are not in the key index yet, so their keys are checked here
+                QString collidingBillKey = addedBillKeysByNormalizedKey.value(BillKeyIndex::normalizeKey(billKey));
+
+                if(findBill(billKey, existingBill) || collision.kind == BillKeyIndex::KeyCollision || (!collidingBillKey.isEmpty() && findBill(collidingBillKey, existingBill)))
+                {
+                    response = AutomationServer::errorResponse(request, m_AUTOMATION_BILL_EXISTS_TEXT.arg(collidingBillKey.isEmpty() ? collision.existingBillKey : collidingBillKey));
+                }
+                else if(collision.kind == BillKeyIndex::NearDuplicate && !request.value(m_AUTOMATION_ALLOW_DUPLICATE_KEY).toBool())
+                {
+                    response = AutomationServer::errorResponse(request, m_AUTOMATION_NEAR_DUPLICATE_TEXT.arg(collision.existingBillKey));
+                }
+                else
+                {
+                    requestedBill.setFundedStatus(false);
+                    pendingBills.insert(billKey, requestedBill);
+                    addedBillKeysByNormalizedKey.insert(BillKeyIndex::normalizeKey(billKey), billKey);
+                    response.insert(m_AUTOMATION_KEY_KEY, billKey);
+                }
+            }
+        }
+
+        // Every other operation acts on an existing bill
+        else if(operation != m_AUTOMATION_UPDATE_OPERATION && operation != m_AUTOMATION_FUND_OPERATION && operation != m_AUTOMATION_DEFUND_OPERATION
+                && operation != m_AUTOMATION_DELETE_OPERATION)
+        {
+            response = AutomationServer::errorResponse(request, m_AUTOMATION_UNKNOWN_OPERATION_TEXT.arg(operation));
+        }
+        else if(!findBill(billKey, requestedBill))
+        {
+            response = AutomationServer::errorResponse(request, m_AUTOMATION_NO_SUCH_BILL_TEXT.arg(billKey));
+        }
+
+        // Change the fields given, the bill's key must stay the same so renames may only change spacing
+        else if(operation == m_AUTOMATION_UPDATE_OPERATION)
+        {
+            QString fieldError = applyAutomationFields(request, requestedBill);
+
+            if(!fieldError.isEmpty())
+            {
+                response = AutomationServer::errorResponse(request, fieldError);
+            }
+            else if(m_ledgerStore.billKeyForName(requestedBill.getName()) != billKey)
+            {
+                response = AutomationServer::errorResponse(request, m_AUTOMATION_RENAME_TEXT);
+            }
+            else
+            {
+                pendingBills.insert(billKey, requestedBill);
+            }
+        }
+
+        // Set funds aside for the bill, or release them, in the currency of the amount available and record it as the Fund and Defund buttons do on saving
+        else if(operation == m_AUTOMATION_FUND_OPERATION || operation == m_AUTOMATION_DEFUND_OPERATION)
+        {
+            bool isFunding = operation == m_AUTOMATION_FUND_OPERATION;
+            LedgerFunds::FundsChange fundsChange = availableFunds().fundingChange(requestedBill, isFunding);
+
+            if(!fundsChange.isConverted)
+            {
+                response = AutomationServer::errorResponse(request, m_AUTOMATION_MISSING_RATE_TEXT.arg(requestedBill.getCurrencyCode(), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)));
+            }
+            else if(fundsChange.isChanged)
+            {
+                applyFundsChange(fundsChange, billKey, requestedBill, &pendingTransactions);
+                requestedBill.setFundedStatus(isFunding);
+                pendingBills.insert(billKey, requestedBill);
+            }
+        }
+
+        // Delete the bill, returning its funds if it was funded
+        else
+        {
+            LedgerFunds::FundsChange fundsChange = availableFunds().deletionChange(requestedBill);
+
+            if(!fundsChange.isConverted)
+            {
+                response = AutomationServer::errorResponse(request, m_AUTOMATION_MISSING_RATE_TEXT.arg(requestedBill.getCurrencyCode(), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)));
+            }
+            else
+            {
+                applyFundsChange(fundsChange, billKey, requestedBill, &pendingTransactions);
+                pendingBills.remove(billKey);
+                deletedBillKeys.insert(billKey);
+            }
+        }
+
+        responses.append(response);
+    }
+
+    // Nothing more to do for batches which only read
+    if(pendingBills.isEmpty() && deletedBillKeys.isEmpty() && m_totalAmountAvailable == previousAmountAvailable)
+    {
+        return responses;
+    }
+
+    // Record the batch's funds moves for the transaction history, appended once the save below is written
+    m_unsavedTransactions += pendingTransactions;
+
+    // Apply every change to the bill map and table as one, bills deleted and then added again are replaced rather than removed
+    QVector<int> removedRows;
+
+    for(const QString &deletedBillKey : deletedBillKeys)
+    {
+        if(!pendingBills.contains(deletedBillKey))
+        {
+            removeStoredBill(deletedBillKey, removedRows);
+        }
+    }
+
+    for(QHash<QString, Bill>::const_iterator pendingIterator = pendingBills.cbegin(); pendingIterator != pendingBills.cend(); ++pendingIterator)
+    {
+        storeBill(pendingIterator.key(), pendingIterator.value());
+    }
+
+    removeBillRows(removedRows);
+
+    // Show the new totals and save once for the whole batch
+    finishBillChanges(m_AUTOMATION_APPLIED_STATUS_TEXT.arg(p_requests.size()));
+    return responses;
+}
+
+QString MainWindow::applyAutomationFields(const QJsonObject &p_request, Bill &p_bill)
+{
+    // Names may be changed in updates, as long as the key they give stays the same
+    if(p_request.contains(m_AUTOMATION_NAME_KEY))
+    {
+        QString billName = p_request.value(m_AUTOMATION_NAME_KEY).toString().trimmed();
+
+        if(billName.isEmpty())
+        {
+            return m_AUTOMATION_INVALID_FIELD_TEXT.arg(m_AUTOMATION_NAME_KEY);
+        }
+
+        p_bill.setName(billName);
+    }
+
+    if(p_request.contains(m_AUTOMATION_AMOUNT_DUE_KEY))
+    {
+        if(!p_request.value(m_AUTOMATION_AMOUNT_DUE_KEY).isDouble() || p_request.value(m_AUTOMATION_AMOUNT_DUE_KEY).toDouble() < 0.0)
+        {
+            return m_AUTOMATION_INVALID_FIELD_TEXT.arg(m_AUTOMATION_AMOUNT_DUE_KEY);
+        }
+
+        p_bill.setAmountDue(p_request.value(m_AUTOMATION_AMOUNT_DUE_KEY).toDouble());
+    }
+
+    if(p_request.contains(m_AUTOMATION_DUE_DATE_KEY))
+    {
+        QDate dueDate = m_ledgerStore.parseDate(p_request.value(m_AUTOMATION_DUE_DATE_KEY).toString());
+
+        if(!dueDate.isValid())
+        {
+            return m_AUTOMATION_INVALID_FIELD_TEXT.arg(m_AUTOMATION_DUE_DATE_KEY);
+        }
+
+        p_bill.setDueDate(dueDate);
+    }
+
+    // Only codes of three letters are accepted, rather than silently falling back to the default currency
+    if(p_request.contains(m_AUTOMATION_CURRENCY_KEY))
+    {
+        if(CurrencyRegistry::normalizeCode(p_request.value(m_AUTOMATION_CURRENCY_KEY).toString()).isEmpty())
+        {
+            return m_AUTOMATION_INVALID_FIELD_TEXT.arg(m_AUTOMATION_CURRENCY_KEY);
+        }
+
+        p_bill.setCurrencyCode(p_request.value(m_AUTOMATION_CURRENCY_KEY).toString());
+    }
+
+    if(p_request.contains(m_AUTOMATION_CATEGORY_KEY))
+    {
+        p_bill.setCategory(p_request.value(m_AUTOMATION_CATEGORY_KEY).toString().trimmed());
+    }
+
+    // Tags may be given as an array or in the comma separated form they are entered in
+    if(p_request.contains(m_AUTOMATION_TAGS_KEY))
+    {
+        QJsonValue tagsValue = p_request.value(m_AUTOMATION_TAGS_KEY);
+        QStringList tags;
+
+        for(const QJsonValue &tagValue : tagsValue.toArray())
+        {
+            tags.append(tagValue.toString());
+        }
+
+        p_bill.setTags(CategoryRollup::splitTags(tagsValue.isArray() ? CategoryRollup::joinTags(tags) : tagsValue.toString()));
+    }
+
+    return QString();
+}
+
+QJsonObject MainWindow::billToAutomationJson(const QString &p_billKey, const Bill &p_bill)
+{
+    QJsonObject billObject;
+    billObject.insert(m_AUTOMATION_KEY_KEY, p_billKey);
+    billObject.insert(m_AUTOMATION_NAME_KEY, p_bill.getName());
+    billObject.insert(m_AUTOMATION_AMOUNT_DUE_KEY, p_bill.getAmountDue());
+    billObject.insert(m_AUTOMATION_DUE_DATE_KEY, m_ledgerStore.formatDate(p_bill.getDueDate()));
+    billObject.insert(m_AUTOMATION_CURRENCY_KEY, p_bill.getCurrencyCode());
+    billObject.insert(m_AUTOMATION_CATEGORY_KEY, p_bill.getCategory());
+    billObject.insert(m_AUTOMATION_TAGS_KEY, QJsonArray::fromStringList(p_bill.getTags()));
+    billObject.insert(m_AUTOMATION_FUNDED_KEY, p_bill.isFunded());
+    return billObject;
+}
+
+void MainWindow::finishBillChanges(const QString &p_statusText)
+{
+    // Re-apply any search the user has typed, so new bills are filtered too
+    if(!m_searchEdit->text().trimmed().isEmpty())
+    {
+        filterBillsBySearch(m_searchEdit->text());
+    }
+
+    // Show the new totals and save once for every change made
+    m_amountAvailableEdit->setText(QString::number(m_totalAmountAvailable, 'f', 2));
+    updateLeftToFundLabel();
+    refreshCategorySummary();
+    statusBar()->showMessage(p_statusText, m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    writeLedgerInBackground();
+}
+
+void MainWindow::showReconciliation()
+{
+    // Match any loaded statement against the bills as they are now
+    refreshReconciliation();
+    m_reconciliationWidget->show();
+    m_reconciliationWidget->raise();
+}
+
+void MainWindow::loadStatement(const QString &p_filePath)
+{
+    QString errorText;
+    m_statementTransactions.clear();
+
+    if(!StatementReconciler::readStatement(p_filePath, m_availableCurrencyIndex, m_statementTransactions, errorText))
+    {
+        m_statementTransactions.clear();
+        m_reconcileBills.clear();
+        m_reconcileResult = StatementReconciler::Result();
+        m_reconciliationWidget->setMessage(m_STATEMENT_READ_FAIL_TEXT.arg(errorText));
+        return;
+    }
+
+    refreshReconciliation();
+}
+
+void MainWindow::refreshReconciliation()
+{
+    if(m_statementTransactions.isEmpty())
+    {
+        return;
+    }
+
+    // The bill map is incomplete while the config file loads
+    if(m_jobManager->isRunning(m_loadJobId))
+    {
+        m_reconciliationWidget->setMessage(m_RECONCILE_NOT_READY_TEXT);
+        return;
+    }
+
+    Profiler::Scope profileScope(m_PROFILE_RECONCILE_PHASE);
+
+    // Bills are matched in their own currency, against debits in the same currency
+    m_reconcileBills.clear();
+    m_reconcileBills.reserve(m_billMap.size());
+
+    for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+    {
+        // Bills without a rate cannot be funded once matched, so they are not offered
+        bool isConverted = true;
+        convertToAvailableCurrency(billMapIterator->getAmountDueCents(), billMapIterator->getCurrencyIndex(), &isConverted);
+
+        if(isConverted)
+        {
+            m_reconcileBills.append({billMapIterator.key(), billMapIterator->getName(), billMapIterator->getDueDate(), billMapIterator->getAmountDueCents(),
+                                     billMapIterator->getCurrencyIndex()});
+        }
+    }
+
+    // Time the matching itself, which is what grows with the size of the statement
+    QElapsedTimer matchTimer;
+    matchTimer.start();
+    m_reconcileResult = StatementReconciler::reconcile(m_statementTransactions, m_reconcileBills, m_reconciliationWidget->getDateWindowDays(),
+                                                       m_reconciliationWidget->getMinimumNameScore());
+    m_reconciliationWidget->setResult(m_statementTransactions, m_reconcileBills, m_reconcileResult, matchTimer.elapsed());
+}
+
+void MainWindow::applyReconciliationMatches()
+{
+    if(m_jobManager->isRunning(m_loadJobId))
+    {
+        m_reconciliationWidget->setMessage(m_RECONCILE_NOT_READY_TEXT);
+        return;
+    }
+
+    Profiler::Scope profileScope(m_PROFILE_APPLY_MATCHES_PHASE);
+    QVector<BillArchive::ArchivedBill> paidBills;
+    QVector<TransactionLedger::Transaction> pendingTransactions;
+    int fundedBillCount = 0;
+
+    // Fund each matched bill which is not funded yet, recording it as the Fund button does, skipping bills deleted since the statement was matched
+    for(const StatementReconciler::Match &match : m_reconcileResult.matches)
+    {
+        const QString &billKey = m_reconcileBills.at(match.billIndex).billKey;
+        QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.constFind(billKey);
+
+        if(billMapIterator == m_billMap.cend())
+        {
+            continue;
+        }
+
+        Bill matchedBill = billMapIterator.value();
+
+        if(!matchedBill.isFunded())
+        {
+            // A bill moved into a currency without a rate since it was matched is left for the next statement
+            if(!applyFundsChange(availableFunds().fundingChange(matchedBill, true), billKey, matchedBill, &pendingTransactions))
+            {
+                continue;
+            }
+
+            matchedBill.setFundedStatus(true);
+            storeBill(billKey, matchedBill);
+            fundedBillCount++;
+        }
+
+        paidBills.append({billKey, matchedBill});
+    }
+
+    // Record every bill funded for the transaction history, appended once the save below is written
+    m_unsavedTransactions += pendingTransactions;
+
+    // The statement shows the matched bills were paid, so they can leave the working set for the archive just as paid bills do at startup
+    int archivedBillCount = 0;
+
+    QVector<BillArchive::ArchivedBill> writtenBills;
+
+    if(m_reconciliationWidget->isArchiveMatchedChecked() && !paidBills.isEmpty() && m_billArchive.archiveBills(paidBills, &writtenBills))
+    {
+        QVector<int> removedRows;
+
+        for(const BillArchive::ArchivedBill &paidBill : paidBills)
+        {
+            removeStoredBill(paidBill.billKey, removedRows);
+        }
+
+        // Bills the archive already held are counted by the report already
+        for(const BillArchive::ArchivedBill &writtenBill : qAsConst(writtenBills))
+        {
+            m_periodReport.addArchivedBill(writtenBill.bill.getDueDate());
+        }
+
+        removeBillRows(removedRows);
+        archivedBillCount = paidBills.size();
+    }
+
+    // The matches refer to bills which may no longer exist, so they cannot be applied twice
+    QString appliedText = m_RECONCILE_APPLIED_TEXT.arg(fundedBillCount).arg(archivedBillCount).arg(m_reconcileResult.matches.size());
+    m_statementTransactions.clear();
+    m_reconcileBills.clear();
+    m_reconcileResult = StatementReconciler::Result();
+    m_reconciliationWidget->setMessage(appliedText);
+    finishBillChanges(appliedText);
+}
+
+void MainWindow::showLoans()
+{
+    // Offer every bill, in the order of the bill map, to be made a loan
+    QStringList billKeys = m_billMap.keys();
+    QStringList billNames;
+    billNames.reserve(billKeys.size());
+
+    for(const Bill &bill : qAsConst(m_billMap))
+    {
+        billNames.append(bill.getName());
+    }
+
+    m_loanWidget->setBills(billKeys, billNames);
+    refreshLoans();
+    m_loanWidget->show();
+    m_loanWidget->raise();
+}
+
+void MainWindow::refreshLoans()
+{
+    Profiler::Scope profileScope(m_PROFILE_LOAN_SUMMARY_PHASE);
+
+    // List the loans whose bills still exist, the terms of deleted bills being kept in case a bill of the same name is added again
+    QVector<LoanSchedule::LoanTerms> loans;
+    QVector<LoanWidget::LoanRow> loanRows;
+
+    for(const QString &billKey : m_loanBook.billKeys())
+    {
+        QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.constFind(billKey);
+
+        if(billMapIterator == m_billMap.cend())
+        {
+            continue;
+        }
+
+        LoanWidget::LoanRow loanRow;
+        loanRow.billKey = billKey;
+        loanRow.billName = billMapIterator->getName();
+        loanRow.currencyCode = billMapIterator->getCurrencyCode();
+        loanRows.append(loanRow);
+        loans.append(m_loanBook.loanTerms(billKey));
+    }
+
+    // Summarize every loan as it stands and with the what-if extra payment from today on, each in a single pass stepping all the loans together
+    QElapsedTimer summaryTimer;
+    summaryTimer.start();
+    QDate today = QDate::currentDate();
+    QVector<LoanSchedule::PayoffSummary> payoffSummaries = LoanSchedule::summarize(loans, 0, today);
+    QVector<LoanSchedule::PayoffSummary> whatIfSummaries = LoanSchedule::summarize(loans, m_loanWidget->getWhatIfExtraCents(), today);
+    qint64 summaryNsecs = summaryTimer.nsecsElapsed();
+
+    for(int loanIndex = 0; loanIndex < loanRows.size(); loanIndex++)
+    {
+        loanRows[loanIndex].payoffSummary = payoffSummaries.at(loanIndex);
+        loanRows[loanIndex].whatIfSummary = whatIfSummaries.at(loanIndex);
+    }
+
+    m_loanWidget->setLoans(loanRows, summaryNsecs);
+    refreshChosenLoanSchedule();
+}
+
+void MainWindow::showChosenLoan()
+{
+    // Fill in the chosen bill's terms, or blank terms if it is not a loan yet
+    m_loanWidget->setLoanTerms(m_loanBook.loanTerms(m_loanWidget->getChosenBillKey()));
+    refreshChosenLoanSchedule();
+}
+
+void MainWindow::refreshChosenLoanSchedule()
+{
+    // Only the chosen loan's schedule is built, with the what-if extra payment from today on
+    QString billKey = m_loanWidget->getChosenBillKey();
+    m_loanWidget->setSchedule(m_loanBook.contains(billKey) ? LoanSchedule::schedule(m_loanBook.loanTerms(billKey), m_loanWidget->getWhatIfExtraCents(), QDate::currentDate())
+                                                           : QVector<LoanSchedule::Installment>());
+}
+
+void MainWindow::saveChosenLoan()
+{
+    QString billKey = m_loanWidget->getChosenBillKey();
+    LoanSchedule::LoanTerms loanTerms = m_loanWidget->getLoanTerms();
+
+    // The bill must still exist and the terms must describe a loan which can be repaid
+    if(!m_billMap.contains(billKey) || !loanTerms.isValid())
+    {
+        createBoxWithNoResult(m_LOAN_NOT_SAVED_BOX_PRIMARY_TEXT, m_INVALID_LOAN_BOX_INFO_TEXT);
+        return;
+    }
+
+    if(!m_loanBook.setLoanTerms(billKey, loanTerms))
+    {
+        createBoxWithNoResult(m_LOAN_NOT_SAVED_BOX_PRIMARY_TEXT, m_LOAN_FILE_FAIL_BOX_INFO_TEXT);
+        return;
+    }
+
+    // The bill now stands for the loan's next payment, which is saved like any other change to a bill
+    if(applyLoanPayment(billKey))
+    {
+        Bill loanBill = m_billMap.value(billKey);
+        finishBillChanges(m_LOAN_PAYMENT_STATUS_TEXT.arg(loanBill.getName(), QString::number(loanBill.getAmountDue(), 'f', 2), m_ledgerStore.formatDate(loanBill.getDueDate())));
+    }
+
+    showChosenLoan();
+    refreshLoans();
+}
+
+void MainWindow::removeChosenLoan()
+{
+    if(!m_loanBook.removeLoan(m_loanWidget->getChosenBillKey()))
+    {
+        createBoxWithNoResult(m_LOAN_NOT_SAVED_BOX_PRIMARY_TEXT, m_LOAN_FILE_FAIL_BOX_INFO_TEXT);
+        return;
+    }
+
+    showChosenLoan();
+    refreshLoans();
+}
+
+bool MainWindow::applyLoanPayment(const QString &p_billKey)
+{
+    Bill loanBill = m_billMap.value(p_billKey);
+    LoanSchedule::LoanTerms loanTerms = m_loanBook.loanTerms(p_billKey);
+
+    if(loanBill.isFunded())
+    {
+        return false;
+    }
+
+    // Loans which have been paid off keep their last payment
+    QVector<LoanSchedule::Installment> installments = LoanSchedule::schedule(loanTerms);
+    int nextPaymentIndex = LoanSchedule::paymentsBefore(loanTerms, QDate::currentDate());
+
+    if(nextPaymentIndex >= installments.size())
+    {
+        return false;
+    }
+
+    loanBill.setAmountDueCents(installments.at(nextPaymentIndex).paymentCents);
+    loanBill.setDueDate(installments.at(nextPaymentIndex).paymentDate);
+    return storeBill(p_billKey, loanBill);
+}
+
+void MainWindow::showScenarios()
+{
+    refreshScenarios();
+    m_scenarioWidget->show();
+    m_scenarioWidget->raise();
+}
+
+void MainWindow::refreshScenarios()
+{
+    Profiler::Scope profileScope(m_PROFILE_SCENARIO_TOTALS_PHASE);
+    QElapsedTimer totalsTimer;
+    totalsTimer.start();
+    QVector<ScenarioWidget::ScenarioRow> scenarioRows;
+    scenarioRows.reserve(m_scenarios.size());
+
+    // Each scenario is totalled from its base's totals and its own changes, so every scenario can be totalled again as one changes
+    for(const LedgerScenario &scenario : qAsConst(m_scenarios))
+    {
+        ScenarioWidget::ScenarioRow scenarioRow;
+        scenarioRow.name = scenario.getName();
+        scenarioRow.currencyCode = scenario.getBaseLedger().availableCurrencyCode;
+        scenarioRow.totals = scenario.totals(m_exchangeRateTable);
+        scenarioRows.append(scenarioRow);
+    }
+
+    m_scenarioWidget->setScenarios(scenarioRows, totalsTimer.nsecsElapsed());
+}
+
+void MainWindow::showChosenScenario()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size())
+    {
+        m_scenarioWidget->setChanges(QVector<LedgerScenario::BillChange>(), 0, QString());
+        return;
+    }
+
+    const LedgerScenario &scenario = m_scenarios.at(scenarioIndex);
+    m_scenarioWidget->setChanges(scenario.diff(), scenario.getAmountAvailableChangeCents(), scenario.getBaseLedger().availableCurrencyCode);
+}
+
+void MainWindow::createScenario()
+{
+    QString scenarioName;
+
+    if(!askScenarioName(scenarioName))
+    {
+        return;
+    }
+
+    // Take a new base only once the bills have changed, so forking the same bills again shares the base and its totals
+    QString availableCurrencyCode = CurrencyRegistry::codeForIndex(m_availableCurrencyIndex);
+
+    if(!m_scenarioBase.isBasedOn(m_billMap, m_totalAmountAvailable, availableCurrencyCode))
+    {
+        LedgerSnapshot baseLedger;
+        baseLedger.billMap = m_billMap;
+        baseLedger.totalAmountAvailable = m_totalAmountAvailable;
+        baseLedger.availableCurrencyCode = availableCurrencyCode;
+        m_scenarioBase = LedgerScenario(QString(), baseLedger);
+    }
+
+    m_scenarios.append(m_scenarioBase.fork(scenarioName));
+    refreshScenarios();
+    m_scenarioWidget->setChosenScenarioIndex(m_scenarios.size() - 1);
+}
+
+void MainWindow::forkChosenScenario()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+    QString scenarioName;
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size() || !askScenarioName(scenarioName))
+    {
+        return;
+    }
+
+    m_scenarios.append(m_scenarios.at(scenarioIndex).fork(scenarioName));
+    refreshScenarios();
+    m_scenarioWidget->setChosenScenarioIndex(m_scenarios.size() - 1);
+}
+
+void MainWindow::deleteChosenScenario()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size())
+    {
+        return;
+    }
+
+    m_scenarios.remove(scenarioIndex);
+    refreshScenarios();
+}
+
+void MainWindow::promoteChosenScenario()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size())
+    {
+        return;
+    }
+
+    LedgerScenario scenario = m_scenarios.at(scenarioIndex);
+    QVector<LedgerScenario::BillChange> billChanges = scenario.diff();
+
+    // Confirm before changing the real bills
+    QMessageBox promoteScenarioConfirmationBox;
+    promoteScenarioConfirmationBox.setText(m_PROMOTE_SCENARIO_BOX_PRIMARY_TEXT);
+    promoteScenarioConfirmationBox.setInformativeText(m_PROMOTE_SCENARIO_BOX_INFO_TEXT.arg(billChanges.size()).arg(scenario.getName()));
+    promoteScenarioConfirmationBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+
+    if(promoteScenarioConfirmationBox.exec() != QMessageBox::Yes)
+    {
+        return;
+    }
+
+    // Apply what each change meant to do to the bills as they are now, moving funds and recording them as the Fund, Defund, and Delete buttons do
+    // Scenarios only fund, defund, and remove bills, so edits made to a bill since the scenario was forked are kept rather than overwritten with the forked copy
+    QVector<int> removedRows;
+    QVector<TransactionLedger::Transaction> pendingTransactions;
+    int appliedChangeCount = 0;
+    int skippedChangeCount = 0;
+
+    for(const LedgerScenario::BillChange &billChange : qAsConst(billChanges))
+    {
+        QMap<QString, Bill>::const_iterator storedBillIterator = m_billMap.constFind(billChange.billKey);
+
+        // Bills deleted since the scenario was forked have nothing left to change
+        if(storedBillIterator == m_billMap.cend())
+        {
+            skippedChangeCount += billChange.kind == LedgerScenario::RemovedBill ? 0 : 1;
+            continue;
+        }
+
+        Bill storedBill = storedBillIterator.value();
+
+        if(billChange.kind == LedgerScenario::RemovedBill)
+        {
+            // Bills whose funds cannot be returned without a rate are kept
+            if(!applyFundsChange(availableFunds().deletionChange(storedBill), billChange.billKey, storedBill, &pendingTransactions))
+            {
+                skippedChangeCount++;
+                continue;
+            }
+
+            removeStoredBill(billChange.billKey, removedRows);
+            appliedChangeCount++;
+            continue;
+        }
+
+        // Only the funding status is taken from the scenario, the amount moved being the bill's current amount due
+        bool isFunding = billChange.scenarioBill.isFunded();
+
+        if(storedBill.isFunded() != isFunding)
+        {
+            if(!applyFundsChange(availableFunds().fundingChange(storedBill, isFunding), billChange.billKey, storedBill, &pendingTransactions))
+            {
+                skippedChangeCount++;
+                continue;
+            }
+
+            storedBill.setFundedStatus(isFunding);
+            storeBill(billChange.billKey, storedBill);
+            appliedChangeCount++;
+        }
+    }
+
+    removeBillRows(removedRows);
+
+    // Money the scenario added or held back, such as a late paycheck, is recorded as a deposit or withdrawal
+    if(scenario.getAdjustmentCents() != 0)
+    {
+        TransactionLedger::Transaction deposit;
+        deposit.type = TransactionLedger::depositTypeFor(scenario.getAdjustmentCents());
+        deposit.amountCents = scenario.getAdjustmentCents();
+        pendingTransactions.append(deposit);
+        m_totalAmountAvailable += scenario.getAdjustmentCents() / 100.0;
+    }
+
+    // Record every funds move of the promotion for the transaction history, appended once the save below is written
+    m_unsavedTransactions += pendingTransactions;
+
+    // The scenario is now the real bills, so it is no longer listed
+    m_scenarios.remove(scenarioIndex);
+    finishBillChanges(skippedChangeCount == 0 ? m_SCENARIO_PROMOTED_STATUS_TEXT.arg(scenario.getName()).arg(appliedChangeCount)
+                                              : m_SCENARIO_PROMOTED_SKIPPED_STATUS_TEXT.arg(scenario.getName()).arg(appliedChangeCount).arg(skippedChangeCount));
+    refreshScenarios();
+}
+
+void MainWindow::fundBillsInScenario()
+{
+    setScenarioFundingStatus(true);
+}
+
+void MainWindow::defundBillsInScenario()
+{
+    setScenarioFundingStatus(false);
+}
+
+void MainWindow::removeBillsInScenario()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+    QStringList billKeys = selectedBillKeys();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size())
+    {
+        return;
+    }
+
+    if(billKeys.isEmpty())
+    {
+        statusBar()->showMessage(m_NO_SELECTED_BILLS_STATUS_TEXT, m_STATUS_MESSAGE_TIMEOUT_MSECS);
+        return;
+    }
+
+    // Funded bills return their funds to the scenario's amount available, as deleting them would
+    LedgerScenario &scenario = m_scenarios[scenarioIndex];
+
+    for(const QString &billKey : qAsConst(billKeys))
+    {
+        Bill bill;
+
+        // Funds in a currency without a rate cannot be returned, so such bills stay in the scenario
+        bool isConverted = true;
+
+        if(scenario.findBill(billKey, bill))
+        {
+            qint64 returnedCents = bill.isFunded() ? convertToAvailableCurrency(bill.getAmountDueCents(), bill.getCurrencyIndex(), &isConverted) : 0;
+
+            if(isConverted)
+            {
+                scenario.removeBill(billKey, returnedCents);
+            }
+        }
+    }
+
+    refreshScenarios();
+}
+
+void MainWindow::adjustScenarioAmountAvailable()
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size() || m_scenarioWidget->getAdjustmentCents() == 0)
+    {
+        return;
+    }
+
+    m_scenarios[scenarioIndex].adjustAmountAvailable(m_scenarioWidget->getAdjustmentCents());
+    refreshScenarios();
+}
+
+void MainWindow::showCashFlowSimulation()
+{
+    m_cashFlowSimulationWidget->show();
+    m_cashFlowSimulationWidget->raise();
+}
+
+void MainWindow::runCashFlowSimulation()
+{
+    CashFlowSimulation::Model model = m_cashFlowSimulationWidget->getModel();
+
+    {
+        Profiler::Scope profileScope(m_PROFILE_SIMULATION_MODEL_PHASE);
+        QStringList variableCategories = m_cashFlowSimulationWidget->getVariableCategories();
+        bool isRepeatedMonthly = m_cashFlowSimulationWidget->isRepeatMonthlyChecked();
+
+        // Start from the total amount available, which funded bills were already taken out of
+        model.startingBalanceCents = dollarsToCents(m_totalAmountAvailable);
+        model.startDate = QDate::currentDate();
+        model.seed = QRandomGenerator::global()->generate64();
+        model.bills.reserve(m_billMap.size());
+
+        for(const Bill &bill : qAsConst(m_billMap))
+        {
+            // Funded bills only cost anything once they repeat
+            if(bill.isFunded() && !isRepeatedMonthly)
+            {
+                continue;
+            }
+
+            // Bills without a rate have no amount in the currency simulated, so they are left out
+            bool isConverted = true;
+            CashFlowSimulation::SimulatedBill simulatedBill;
+            simulatedBill.amountCents = convertToAvailableCurrency(bill.getAmountDueCents(), bill.getCurrencyIndex(), &isConverted);
+
+            if(!isConverted)
+            {
+                continue;
+            }
+
+            simulatedBill.dueDate = bill.getDueDate();
+            simulatedBill.spreadFraction = variableCategories.contains(bill.getCategory(), Qt::CaseInsensitive) ? m_cashFlowSimulationWidget->getBillSpreadFraction() : 0.0;
+            simulatedBill.isRepeatedMonthly = isRepeatedMonthly;
+            simulatedBill.isFunded = bill.isFunded();
+            model.bills.append(simulatedBill);
+        }
+    }
+
+    // Only the most recent simulation is listed, so stop any simulation still running
+    m_jobManager->cancel(m_simulationJobId);
+    m_simulationCurrencyCode = CurrencyRegistry::codeForIndex(m_availableCurrencyIndex);
+    m_cashFlowSimulationWidget->setMessage(m_SIMULATION_STARTED_TEXT.arg(model.bills.size()).arg(model.horizonMonths));
+    m_cashFlowSimulationWidget->setRunning(true);
+
+    // Simulate the paths in the background, the job sending the results of the paths completed so far as it goes
+    m_simulationJobId = m_jobManager->submit(m_SIMULATION_JOB_NAME, [model](JobContext &p_jobContext) -> QVariant
+    {
+        return QVariant::fromValue(CashFlowSimulation::run(model, &p_jobContext));
+    });
+}
+
+void MainWindow::cancelCashFlowSimulation()
+{
+    m_jobManager->cancel(m_simulationJobId);
+}
+
+bool MainWindow::askScenarioName(QString &p_scenarioName)
+{
+    bool isNameEntered = false;
+    p_scenarioName = QInputDialog::getText(this, m_SCENARIO_NAME_TITLE_TEXT, m_ASK_FOR_SCENARIO_NAME_TEXT, QLineEdit::Normal, m_SCENARIO_NAME_TEXT.arg(m_nextScenarioNumber), &isNameEntered).trimmed();
+
+    if(!isNameEntered || p_scenarioName.isEmpty())
+    {
+        return false;
+    }
+
+    m_nextScenarioNumber++;
+    return true;
+}
+
+QStringList MainWindow::selectedBillKeys() const
+{
+    QStringList billKeys;
+
+    for(int row = 0; row < m_billTableWidget->rowCount(); row++)
+    {
+        if(m_billTableWidget->item(row, 0)->isSelected())
+        {
+            billKeys.append(m_billTableWidget->item(row, 0)->data(Qt::UserRole).toString());
+        }
+    }
+
+    return billKeys;
+}
+
+void MainWindow::setScenarioFundingStatus(bool p_isFunded)
+{
+    int scenarioIndex = m_scenarioWidget->getChosenScenarioIndex();
+    QStringList billKeys = selectedBillKeys();
+
+    if(scenarioIndex < 0 || scenarioIndex >= m_scenarios.size())
+    {
+        return;
+    }
+
+    if(billKeys.isEmpty())
+    {
+        statusBar()->showMessage(m_NO_SELECTED_BILLS_STATUS_TEXT, m_STATUS_MESSAGE_TIMEOUT_MSECS);
+        return;
+    }
+
+    // Only the scenario's copy of each bill changes, the real bills are left as they are
+    LedgerScenario &scenario = m_scenarios[scenarioIndex];
+
+    for(const QString &billKey : qAsConst(billKeys))
+    {
+        Bill bill;
+
+        // Funds in a currency without a rate cannot be moved, so such bills keep their funding status
+        bool isConverted = true;
+
+        if(scenario.findBill(billKey, bill))
+        {
+            qint64 amountCents = convertToAvailableCurrency(bill.getAmountDueCents(), bill.getCurrencyIndex(), &isConverted);
+
+            if(isConverted)
+            {
+                scenario.setFundedStatus(billKey, p_isFunded, amountCents);
+            }
+        }
+    }
+
+    refreshScenarios();
+}
+
+qint64 MainWindow::convertToAvailableCurrency(qint64 p_amountCents, quint8 p_currencyIndex, bool *p_isConverted)
+{
+    bool isConverted = true;
+    qint64 convertedCents = availableFunds().convertToAvailableCurrency(p_amountCents, p_currencyIndex, &isConverted);
+
+    // Let the user know the amount could not be converted, so they can add the missing rate
+    if(!isConverted)
+    {
+        statusBar()->showMessage(m_MISSING_RATE_STATUS_TEXT.arg(CurrencyRegistry::codeForIndex(p_currencyIndex), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+    }
+
+    if(p_isConverted != nullptr)
+    {
+        *p_isConverted = isConverted;
+    }
+
+    return convertedCents;
+}
+
+LedgerFunds MainWindow::availableFunds() const
+{
+    return LedgerFunds(m_exchangeRateTable, m_availableCurrencyIndex);
+}
+
+bool MainWindow::applyFundsChange(const LedgerFunds::FundsChange &p_fundsChange, const QString &p_billKey, const Bill &p_bill, QVector<TransactionLedger::Transaction> *p_pendingTransactions)
+{
+    if(!p_fundsChange.isChanged)
+    {
+        return true;
+    }
+
+    // Funds in another currency cannot be moved without a rate, so refuse the change and let the user know, so they can add the missing rate
+    if(!p_fundsChange.isConverted)
+    {
+        statusBar()->showMessage(m_MISSING_RATE_STATUS_TEXT.arg(p_bill.getCurrencyCode(), CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)), m_STATUS_MESSAGE_TIMEOUT_MSECS);
+        return false;
+    }
+
+    // Move the funds and record the move for the transaction history once the next save is written, or leave it for the caller to record with the rest of its batch
+    m_totalAmountAvailable += p_fundsChange.amountAvailableChangeCents / 100.0;
+
+    TransactionLedger::Transaction transaction;
+    transaction.type = p_fundsChange.transactionType;
+    transaction.amountCents = p_fundsChange.amountAvailableChangeCents;
+    transaction.billKey = p_billKey;
+    (p_pendingTransactions != nullptr ? *p_pendingTransactions : m_unsavedTransactions).append(transaction);
+    return true;
+}
+
+void MainWindow::updateAmountAvailableLabel()
+{
+    // Show the currency the amount available is held in
+    m_amountAvailableLabel->setText(m_TOTAL_AMOUNT_AVAILABLE_STRING.arg(CurrencyRegistry::codeForIndex(m_availableCurrencyIndex)));
+}
+
+void MainWindow::updateLeftToFundLabel()
+{
+    // Sum the unfunded amounts per currency, then convert the sums into the currency of the amount available, one conversion per currency
+    QStringList missingCurrencyCodes;
+    qint64 leftToFundCents = availableFunds().convertTotals(LedgerFunds::totalBills(m_billMap).unfundedCentsByCurrency, &missingCurrencyCodes);
+
+    // Mark the total when some bills had no rate and were left out of it
+    QString leftToFundText = m_LEFT_TO_FUND_STRING.arg(CurrencyRegistry::codeForIndex(m_availableCurrencyIndex), QString::number(leftToFundCents / 100.0, 'f', 2));
+    m_leftToFundLabel->setText(missingCurrencyCodes.isEmpty() ? leftToFundText : leftToFundText + m_MISSING_RATES_MARKER);
+    m_leftToFundLabel->setToolTip(missingCurrencyCodes.isEmpty() ? QString() : m_MISSING_RATES_TOOLTIP_TEXT.arg(missingCurrencyCodes.join(", ")));
+}
+
+void MainWindow::updateBillTotals(const QString &p_billKey, const Bill &p_bill)
+{
+    // Totals are kept in the currency of the amount available, bills without an exchange rate being left out of them as they are from the left to fund total
+    qint64 amountDueCents = m_exchangeRateTable.convertCents(p_bill.getAmountDueCents(), p_bill.getCurrencyIndex(), m_availableCurrencyIndex);
+    m_categoryRollup.setBill(p_billKey, p_bill.getCategory(), p_bill.getTags(), amountDueCents, p_bill.isFunded());
+    m_periodReport.setCurrentBill(p_billKey, p_bill.getDueDate(), amountDueCents, p_bill.isFunded());
+    m_billCalendar.setBill(p_billKey, p_bill.getDueDate(), amountDueCents, p_bill.isFunded());
+    m_billKeyIndex.insertBill(p_billKey, p_bill);
+
+    // Only re-arm the reminder timer when this bill's next reminder comes before the one it is armed for
+    qint64 reminderDay = m_reminderScheduler.setBill(p_billKey, p_bill.getDueDate(), p_bill.isFunded());
+
+    if(reminderDay != 0 && (m_armedReminderDay == 0 || reminderDay < m_armedReminderDay))
+    {
+        armReminderTimer();
+    }
+}
+
+void MainWindow::removeBillTotals(const QString &p_billKey)
+{
+    m_categoryRollup.removeBill(p_billKey);
+    m_periodReport.removeCurrentBill(p_billKey);
+    m_billCalendar.removeBill(p_billKey);
+    m_billKeyIndex.removeBill(p_billKey);
+    m_reminderScheduler.removeBill(p_billKey);
+}
+
+void MainWindow::rebuildBillTotals(QStringList *p_collidingBillNames)
+{
+    Profiler::Scope profileScope(m_PROFILE_REBUILD_TOTALS_PHASE);
+
+    // Start over and add every bill once, every cached report month may have been totalled from other bills or in another currency
+    // Reminders are kept, as they do not depend on the currency, so bills which did not change are not reminded of again
+    m_categoryRollup.clear();
+    m_periodReport.clear();
+    m_billCalendar.clear();
+
+    // Size the key index's filters for every bill up front, so they are not refilled part way through a large file
+    m_billKeyIndex.reset(m_billMap.size());
+
+    for(QMap<QString, Bill>::const_iterator billMapIterator = m_billMap.cbegin(); billMapIterator != m_billMap.cend(); ++billMapIterator)
+    {
+        // Note bills whose keys only differ from an earlier bill's in case, most are ruled out by the key filter without a table lookup
+        if(p_collidingBillNames != nullptr && m_billKeyIndex.findCollision(billMapIterator.key(), billMapIterator.value()).kind == BillKeyIndex::KeyCollision)
+        {
+            p_collidingBillNames->append(billMapIterator->getName());
+        }
+
+        updateBillTotals(billMapIterator.key(), billMapIterator.value());
+    }
+
+    refreshCategorySummary();
+}
+
+void MainWindow::refreshCategorySummary()
+{
+    const QHash<QString, CategoryRollup::RollupTotals> &categoryTotals = m_categoryRollup.categoryTotals();
+    const QHash<QString, CategoryRollup::RollupTotals> &tagTotals = m_categoryRollup.tagTotals();
+
+    // List categories alphabetically with bills lacking one last, then tags alphabetically
+    QStringList categoryNames = categoryTotals.keys();
+    QStringList tagNames = tagTotals.keys();
+    categoryNames.sort(Qt::CaseInsensitive);
+    tagNames.sort(Qt::CaseInsensitive);
+
+    if(categoryNames.removeOne(QString()))
+    {
+        categoryNames.append(QString());
+    }
+
+    m_categorySummaryTable->setRowCount(categoryNames.size() + tagNames.size());
+    int row = 0;
+
+    // Fill a row of the summary with a category or tag's totals
+    auto setSummaryRow = [this, &row](const QString &p_label, const CategoryRollup::RollupTotals &p_totals)
+    {
+        m_categorySummaryTable->setItem(row, 0, new QTableWidgetItem(p_label));
+        m_categorySummaryTable->setItem(row, 1, new QTableWidgetItem(QString::number(p_totals.dueCents / 100.0, 'f', 2)));
+        m_categorySummaryTable->setItem(row, 2, new QTableWidgetItem(QString::number(p_totals.fundedCents / 100.0, 'f', 2)));
+        m_categorySummaryTable->setItem(row, 3, new QTableWidgetItem(QString::number(p_totals.outstandingCents() / 100.0, 'f', 2)));
+        row++;
+    };
+
+    for(const QString &categoryName : categoryNames)
+    {
+        setSummaryRow(categoryName.isEmpty() ? m_UNCATEGORIZED_STRING : categoryName, categoryTotals.value(categoryName));
+    }
+
+    for(const QString &tagName : tagNames)
+    {
+        setSummaryRow(m_TAG_SUMMARY_PREFIX + tagName, tagTotals.value(tagName));
+    }
+
+    // Every change to the totals also changes the day buckets, so refill the bill calendar too if it is open
+    if(m_billCalendarWidget->isVisible())
+    {
+        refreshBillCalendar();
+    }
 }
@@ -11,15 +11,53 @@
 #define MAINWINDOW_H
 
 // Local file includes
+#include "AutomationServer.h"
+#include "BalanceHistory.h"
+#include "BalanceHistoryWidget.h"
 #include "Bill.h"
+#include "BillArchive.h"
+#include "BillArchiveWidget.h"
+#include "BillCalendar.h"
+#include "BillCalendarWidget.h"
+#include "BillKeyIndex.h"
 #include "BillWidget.h"
+#include "BillSearchIndex.h"
+#include "BillSorter.h"
+#include "CashFlowSimulation.h"
+#include "CashFlowSimulationWidget.h"
+#include "CategoryRollup.h"
+#include "ConfigSectionIndex.h"
+#include "CurrencyRegistry.h"
+#include "ExchangeRateTable.h"
+#include "JobManager.h"
+#include "LedgerFunds.h"
+#include "LedgerHistoryWidget.h"
+#include "LedgerScenario.h"
+#include "LedgerSnapshot.h"
+#include "LedgerStore.h"
+#include "LoanBook.h"
+#include "LoanWidget.h"
+#include "PeriodReport.h"
+#include "PeriodReportWidget.h"
+#include "Profiler.h"
+#include "ReconciliationWidget.h"
+#include "ReminderScheduler.h"
+#include "ScenarioWidget.h"
+#include "StatementReconciler.h"
+#include "TransactionLedger.h"
 
 // Qt includes
+#include <QFileSystemWatcher>
 #include <QMainWindow>
+#include <QMenu>
+#include <QSet>
 #include <QSettings>
+#include <QSystemTrayIcon>
 #include <QTableWidget>
+#include <QTimer>
 #include <QDir>
 
+
 /**
  * @brief The MainWindow class represents the primary window which will display the user's personal financial information.
  */
@@ -55,9 +93,10 @@ public slots:
 
     /**
      * @brief Attempts to open the config file, if successful a new Bill object is created for the current information inputted into the BillWidget.
-     * Information is also written as a new bill entry in the config file.
+     * Information is also written as a new bill entry in the config file. If the bill collides with or nearly duplicates a stored bill, the user chooses how to resolve it first.
+     * @return False if the user cancelled entering the bill, so it should stay in the BillWidget.
      */
-    void openConfigForBillCreation();
+    bool openConfigForBillCreation();
 
     /**
      * @brief Calls the openConfigForBillCreation() helper method, before the BillWidget is reset for entry of another bill.
@@ -70,6 +109,19 @@ public slots:
      */
     void saveBillAndDisplayBillTableWidget();
 
+    /**
+     * @brief Called when the text pasted into the BillWidget changes. Reads every pasted row, checks each against the stored bills and the other rows,
+     * and shows the rows in the BillWidget with the fields to correct highlighted.
+     */
+    void validatePastedBills();
+
+    /**
+     * @brief Called when the Add Pasted Bills button is pressed. Writes every valid pasted row to the config file at once and adds them to the bill map,
+     * leaving only the rows to correct in the BillWidget.
+     * @return False if the config file could not be opened, in which case no rows were added.
+     */
+    bool savePastedBills();
+
     /**
      * @brief Called when the Save button is pressed. Opens the config file and initially updates the bill map to match the contents of the bill table widget.
      * Then updates the config file with the contents of the updated bill map.
@@ -108,10 +160,283 @@ public slots:
      */
     void createResetBillsConfirmationBox();
 
+    /**
+     * @brief Called as the user types in the search line edit. Looks the text up in the bill search index and shows only the matching rows of the bill table widget, best matches first.
+     * Once a search has hidden the other rows, each keystroke only touches the rows of the previous and new matches. If more bills match than are shown, the user is told how many were left out.
+     * If the search text is empty, every row is shown again in its original order.
+     * @param p_searchText - The current contents of the search line edit.
+     */
+    void filterBillsBySearch(const QString &p_searchText);
+
+    /**
+     * @brief Called when an item of the bill table widget is edited. If the item is a bill name, the bill is re-indexed under its new name so searches reflect the edit immediately.
+     * If the item is a bill name or amount due, the row's sort key is recomputed and only that row is moved to its new sorted position.
+     * @param p_item - The edited table widget item.
+     */
+    void updateIndexesForItem(QTableWidgetItem *p_item);
+
+    /**
+     * @brief Called when a due date edit or funding status combo box in the bill table widget changes. Recomputes the sort key of the row the widget belongs to and moves only that row to its new sorted position.
+     */
+    void updateSortKeyForCellWidget();
+
+    /**
+     * @brief Called when a column header of the bill table widget is clicked. Sorts the bills by that column, toggling between ascending and descending order on repeated clicks.
+     * If Shift is held, the column is added as an additional sort key rather than replacing the existing ones.
+     * @param p_column - The column whose header was clicked.
+     */
+    void sortBillsByColumn(int p_column);
+
+    /**
+     * @brief Called when the user responds to the welcome message box.
+     * If the user selects "Ok", they are asked for their total amount available. If they select "Close", the application terminates.
+     * @param p_welcomeBoxSelection - The button the user selected.
+     */
+    void handleWelcomeBoxSelection(int p_welcomeBoxSelection);
+
+    /**
+     * @brief Called when the user responds to the corrupt config file message box.
+     * If the user selects "Ok", the welcome sequence begins. If they select "Close", the application terminates.
+     * @param p_corruptBoxSelection - The button the user selected.
+     */
+    void handleCorruptConfigFileBoxSelection(int p_corruptBoxSelection);
+
+    /**
+     * @brief Called on the GUI thread when a background job reports progress. Displays the progress in the status bar.
+     * @param p_jobId - The id of the job.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_statusText - Short description of what the job is doing.
+     */
+    void handleJobProgress(quint64 p_jobId, int p_percentComplete, QString p_statusText);
+
+    /**
+     * @brief Called on the GUI thread when a background job finishes. Displays a loaded config file or the changes a save merged in, or alerts the user if a save failed.
+     * @param p_jobId - The id of the job.
+     * @param p_result - The value the job returned.
+     */
+    void handleJobFinished(quint64 p_jobId, QVariant p_result);
+
+    /**
+     * @brief Called on the GUI thread when a background job reports its results so far. Lists the paths a cash flow simulation has completed.
+     * @param p_jobId - The id of the job.
+     * @param p_percentComplete - How far along the job is, from 0 to 100.
+     * @param p_partialResult - The results so far.
+     */
+    void handleJobPartialResult(quint64 p_jobId, int p_percentComplete, QVariant p_partialResult);
+
+    /**
+     * @brief Called on the GUI thread when a background job stops after being cancelled. Lets the user know a cash flow simulation was stopped, listing the results of the paths it completed.
+     * @param p_jobId - The id of the job.
+     * @param p_result - The value the job returned after it stopped, invalid if it was cancelled before it started.
+     */
+    void handleJobCancelled(quint64 p_jobId, QVariant p_result);
+
+    /**
+     * @brief Called when the Ledger History action of the Tools menu is triggered. Displays the LedgerHistoryWidget for the current day.
+     */
+    void showLedgerHistory();
+
+    /**
+     * @brief Called when the Balance History action of the Tools menu is triggered. Displays the BalanceHistoryWidget for the past few months.
+     */
+    void showBalanceHistory();
+
+    /**
+     * @brief Called when the Bill Archive action of the Tools menu is triggered. Displays the BillArchiveWidget for the past year.
+     */
+    void showBillArchive();
+
+    /**
+     * @brief Called when the Periodic Report action of the Tools menu is triggered. Displays the PeriodReportWidget.
+     */
+    void showPeriodReport();
+
+    /**
+     * @brief Recomputes the periodic report for the range and period length selected in the PeriodReportWidget.
+     * Only months whose bills changed since they were last totalled are totalled again, and archived months are only totalled the first time they are reported on.
+     */
+    void refreshPeriodReport();
+
+    /**
+     * @brief Called when the Bill Calendar action of the Tools menu is triggered. Displays the BillCalendarWidget.
+     */
+    void showBillCalendar();
+
+    /**
+     * @brief Fills the BillCalendarWidget with the totals of each day it shows and the bills due on its selected day, read from the day buckets of the bill calendar.
+     */
+    void refreshBillCalendar();
+
+    /**
+     * @brief Called when the reminder timer fires. Notifies the user of the bills whose reminders are due today, then waits for the next reminder.
+     */
+    void deliverDueReminders();
+
+    /**
+     * @brief Called when the Reminder Lead Time action of the Tools menu is triggered. Asks how many days before its due date each unfunded bill should be reminded of, and saves the answer.
+     */
+    void chooseReminderLeadDays();
+
+    /**
+     * @brief Called when the Automation Server action of the Tools menu is toggled. Starts or stops listening for requests from local scripts.
+     * @param p_isEnabled - Whether or not the automation server should be listening.
+     */
+    void setAutomationServerEnabled(bool p_isEnabled);
+
+    /**
+     * @brief Called when the Reconcile Statement action of the Tools menu is triggered. Displays the ReconciliationWidget.
+     */
+    void showReconciliation();
+
+    /**
+     * @brief Reads the transactions of a bank statement chosen in the ReconciliationWidget and matches them to the bills.
+     * @param p_filePath - The path of the statement file.
+     */
+    void loadStatement(const QString &p_filePath);
+
+    /**
+     * @brief Matches the transactions of the loaded statement to the current bills using the settings of the ReconciliationWidget, and displays the outcome.
+     */
+    void refreshReconciliation();
+
+    /**
+     * @brief Called when matches are applied in the ReconciliationWidget. Funds each matched bill which is not funded yet, moves the matched bills into the bill archive
+     * as paid if the user chose to, and saves once.
+     */
+    void applyReconciliationMatches();
+
+    /**
+     * @brief Called when the Loans action of the Tools menu is triggered. Displays the LoanWidget, offering every bill to be made a loan.
+     */
+    void showLoans();
+
+    /**
+     * @brief Summarizes every loan as it stands and with the what-if extra payment of the LoanWidget, and lists the chosen loan's schedule.
+     * Both summaries step every loan through each month together, so they are recomputed as the what-if extra payment is typed.
+     */
+    void refreshLoans();
+
+    /**
+     * @brief Called when a bill is chosen in the LoanWidget. Fills in the terms of its loan and lists its schedule.
+     */
+    void showChosenLoan();
+
+    /**
+     * @brief Called when the Save Loan button of the LoanWidget is clicked. Makes the chosen bill a loan with the terms entered, setting its amount due and due date to the loan's next payment.
+     */
+    void saveChosenLoan();
+
+    /**
+     * @brief Called when the Remove Loan button of the LoanWidget is clicked. Makes the chosen bill an ordinary bill again, leaving its amount due and due date as they are.
+     */
+    void removeChosenLoan();
+
+    /**
+     * @brief Called when the Scenarios action of the Tools menu is triggered. Displays the ScenarioWidget with every scenario totalled.
+     */
+    void showScenarios();
+
+    /**
+     * @brief Totals every scenario side by side in the ScenarioWidget.
+     */
+    void refreshScenarios();
+
+    /**
+     * @brief Called when a scenario is chosen in the ScenarioWidget. Lists how it differs from the bills it was forked from.
+     */
+    void showChosenScenario();
+
+    /**
+     * @brief Called when the New Scenario button of the ScenarioWidget is clicked. Forks a scenario without changes from the bills as they were last saved.
+     */
+    void createScenario();
+
+    /**
+     * @brief Called when the Fork Scenario button of the ScenarioWidget is clicked. Forks the chosen scenario along with its changes.
+     */
+    void forkChosenScenario();
+
+    /**
+     * @brief Called when the Delete Scenario button of the ScenarioWidget is clicked. Discards the chosen scenario.
+     */
+    void deleteChosenScenario();
+
+    /**
+     * @brief Called when the Make Real button of the ScenarioWidget is clicked. Once confirmed, makes the chosen scenario's changes to the bills and saves them, recording funding as the Fund and Defund buttons do.
+     */
+    void promoteChosenScenario();
+
+    /**
+     * @brief Called when the Fund Selected button of the ScenarioWidget is clicked. Funds the bills selected in the bill table widget in the chosen scenario.
+     */
+    void fundBillsInScenario();
+
+    /**
+     * @brief Called when the Defund Selected button of the ScenarioWidget is clicked. Defunds the bills selected in the bill table widget in the chosen scenario.
+     */
+    void defundBillsInScenario();
+
+    /**
+     * @brief Called when the Remove Selected button of the ScenarioWidget is clicked. Removes the bills selected in the bill table widget from the chosen scenario.
+     */
+    void removeBillsInScenario();
+
+    /**
+     * @brief Called when the Adjust button of the ScenarioWidget is clicked. Adds the amount entered to the chosen scenario's amount available.
+     */
+    void adjustScenarioAmountAvailable();
+
+    /**
+     * @brief Called when the Cash Flow Simulation action of the Tools menu is triggered. Displays the CashFlowSimulationWidget.
+     */
+    void showCashFlowSimulation();
+
+    /**
+     * @brief Called when the Run button of the CashFlowSimulationWidget is clicked. Simulates the bills and paychecks over the months ahead in the background, starting from the total amount available.
+     * Unfunded bills are paid on their due date, or straight away if they are overdue, and when the bills repeat monthly every bill is paid again each following month. Bills in the variable categories vary by the percentage entered.
+     */
+    void runCashFlowSimulation();
+
+    /**
+     * @brief Called when the Cancel button of the CashFlowSimulationWidget is clicked. Stops the running simulation after its current batch of paths.
+     */
+    void cancelCashFlowSimulation();
+
+    /**
+     * @brief Called when the config file changes on disk. Starts a short timer so a burst of writes, such as a script saving the file in pieces, results in a single reload.
+     * @param p_filePath - The path of the config file.
+     */
+    void scheduleConfigReload(const QString &p_filePath);
+
+    /**
+     * @brief Called once the config file has stopped changing. Reads the file, parses only the sections which differ from the last version seen, and applies just those changes to the bill map and bill table widget.
+     * Also reads the balance history snapshots the other instance appended after saving.
+     */
+    void reloadChangedConfigSections();
+
 private:
 
     /**
-     * @brief Creates a message box in the event that attempting to open the config file resulted in an error.
+     * @brief The CollisionResolution enum lists how the user can resolve a new bill clashing with a stored bill.
+     */
+    enum CollisionResolution
+    {
+        ReplaceExisting,
+        KeepBoth,
+        AddAnyway,
+        CancelEntry
+    };
+
+    /**
+     * @brief Asks the user how to resolve a new bill colliding with, or nearly duplicating, a stored bill.
+     * @param p_billName - The name of the new bill.
+     * @param p_collision - The stored bill it clashes with.
+     * @return How the user chose to resolve the collision.
+     */
+    CollisionResolution askCollisionResolution(const QString &p_billName, const BillKeyIndex::Collision &p_collision);
+
+    /**
+     * @brief Opens a message box in the event that attempting to open the config file resulted in an error. The user's selection is handled by handleCorruptConfigFileBoxSelection().
      *  If the user chooses to press the "Ok" button, the welcome sequence will initiate where the user will provide their financial information again.
      *  If the user chooses to press the "Close" button, the application will terminate.
      */
@@ -138,7 +463,7 @@ private:
     void attemptConfigFileGeneration();
 
     /**
-     * @brief Generates a message box to welcome a first time user.
+     * @brief Opens a message box to welcome a first time user. The user's selection is handled by handleWelcomeBoxSelection().
      * Has clickable buttons allowing the user to advance to the total funds available prompt, and to exit the application.
      */
     void welcomeFirstTimeUser();
@@ -156,38 +481,38 @@ private:
     void createTableWidgetUsingMap();
 
     /**
-     * @brief In the event that a config file already exists in the desired directory, read the config file and store its contents in the bill map.
-     * Then, iterate over the bill map and use its contents to display the user's financial information.
+     * @brief Creates the cells of a row of the bill table widget from a Bill.
+     * @param p_row - The row of the bill table widget, which must already exist.
+     * @param p_billKey - The bill map key of the Bill.
+     * @param p_bill - The Bill displayed in the row.
      */
-    void readConfigAndCreateUI();
+    void createBillRow(int p_row, const QString &p_billKey, const Bill &p_bill);
 
     /**
-     * @brief Checks a funding status and returns "Funded" or "Not Funded" if the status is true or false respectively.
-     * @param p_isBillFunded - Funding status as a boolean, true or false.
-     * @return The funding status as a string.
+     * @brief In the event that a config file already exists in the desired directory, starts a background job which reads the config file into a LedgerSnapshot.
+     * Once the job finishes, applyLoadedLedger() displays the user's financial information.
      */
-    QString fundingStatusBooleanToString(bool p_isBillFunded);
+    void readConfigAndCreateUI();
 
     /**
-     * @brief Checks a funding status and returns true or false if the status is "Funded" or "Not Funded" respectively.
-     * @param p_fundingStatus - Funding status as a string, "Funded" or "Not Funded".
-     * @return The funding status as a boolean.
+     * @brief Stores the contents of a loaded config file in the bill map, then iterates over the bill map and uses its contents to display the user's financial information.
+     * If the config file could not be read or contained invalid keys, the user is alerted instead.
+     * @param p_loadedLedger - The contents of the config file read by the load job.
      */
-    bool fundingStatusStringToBoolean(QString p_fundingStatus);
+    void applyLoadedLedger(const LedgerSnapshot &p_loadedLedger);
 
     /**
-     * @brief Converts a date represented as a string into a date object in the appropriate "M/d/yyyy" format.
-     * @param p_dateString - A date represented as a string.
-     * @return The input string as a date object in "M/d/yyyy" format.
+     * @brief Moves funded bills whose due date has passed out of the bill map and the funded bills list and into the bill archive, so the bill map only holds current obligations.
+     * Bills are only removed once their archive segments have been written.
+     * @return True if any bills were archived.
      */
-    QDate convertDateStringToDate(QString p_dateString);
+    bool archivePaidBills();
 
     /**
-     * @brief Removes spaces from an input string containing spaces.
-     * @param p_stringWithSpaces - String with spaces.
-     * @return The original string but with spaces removed.
+     * @brief Starts a background job which writes a snapshot of the bill map and total amount available out to the config file.
+     * If a save is already running, the new save is queued and starts once the current one finishes.
      */
-    QString removeSpaces(QString p_stringWithSpaces);
+    void writeLedgerInBackground();
 
     /**
      * @brief Clears the name, amount due, and due date fields in preparation for allowing a user to enter another bill.
@@ -199,14 +524,6 @@ private:
      */
     void createButtonGridLayout();
 
-    /**
-     * @brief Parses group labels, keys, and values in the config file in order to update the bill map and funded bills list before bill table widget is shown.
-     * @param p_groupLabel - Group label being checked in config file, will be either FundsInformation group or a bill name.
-     * @param p_key - Key being checked in config file, whill be either the amount due, due date, or funding status.
-     * @param p_value - Value being checked in config file, will be the information the user entered for the specific bill.
-     */
-    void parseConfigContents(QString p_groupLabel, QString p_key, QString p_value);
-
     /**
      * @brief Hides the BillWidget before displaying the bill table widget using the updated contents of the bill map.
      */
@@ -225,6 +542,246 @@ private:
      */
     void resetBillsAndLaunchInitialization();
 
+    /**
+     * @brief Rebuilds the lookup from bill map keys to bill table widget rows, needed after rows are created or removed.
+     */
+    void rebuildBillRowLookup();
+
+    /**
+     * @brief Moves every row of the bill table widget to the position given by the bill sorter, used after sorting and after search results were ranked.
+     */
+    void applySortedRowOrder();
+
+    /**
+     * @brief Recomputes the sort key of a single row from the bill table widget and moves only that row to its new sorted position.
+     * @param p_row - The row which was edited.
+     */
+    void repositionSortedRow(int p_row);
+
+    /**
+     * @brief Computes the sort key of a row from the values currently displayed in the bill table widget.
+     * @param p_row - The row of the bill table widget.
+     * @return The sort key of the row.
+     */
+    BillSorter::SortKey sortKeyForRow(int p_row);
+
+    /**
+     * @brief Reads a bill from the values currently displayed in a row of the bill table widget, including edits which have not been saved yet.
+     * @param p_row - The row of the bill table widget.
+     * @return The bill as the row shows it.
+     */
+    Bill billForRow(int p_row) const;
+
+    /**
+     * @brief Displays a bill's values in an existing row of the bill table widget and moves the row to its sorted position, without changing the bill map.
+     * @param p_row - The row of the bill table widget.
+     * @param p_bill - The bill.
+     */
+    void showBillInRow(int p_row, const Bill &p_bill);
+
+    /**
+     * @brief Records the bill map key a row was created from on its name item and cell widgets, so edits to the row can be traced back to it.
+     * @param p_row - The row of the bill table widget.
+     * @param p_billKey - The bill map key of the bill displayed in the row.
+     */
+    void setRowBillKey(int p_row, const QString &p_billKey);
+
+    /**
+     * @brief Brings the bill search index in line with the bill map after the map was rebuilt, only re-indexing bills which were added, renamed, or removed.
+     */
+    void synchronizeSearchIndexWithMap();
+
+    /**
+     * @brief Converts an amount of money in dollars into whole cents, rounding to the nearest cent.
+     * @param p_amountDollars - The amount in dollars.
+     * @return The amount in cents.
+     */
+    qint64 dollarsToCents(double p_amountDollars);
+
+    /**
+     * @brief Records the current contents of the config file as the version external edits are compared against, then starts watching it for changes.
+     */
+    void startWatchingConfigFile();
+
+    /**
+     * @brief Stops watching the config file and forgets its contents, used when the bills are reset.
+     */
+    void stopWatchingConfigFile();
+
+    /**
+     * @brief Applies sections of the config file which were edited outside the application. Removed bills have their rows removed, new bills are appended as rows, and edited bills have only their row's cells updated.
+     * Sections which already match the bill map, such as those just written by a save, are skipped. Rows and an amount available with unsaved edits keep them: edited bills are merged field by field
+     * as a save would merge them, a removed bill with unsaved edits is kept, and a changed amount available is added to the one being typed. A change to the amount available made by hand,
+     * rather than by a save which recorded it itself, is recorded as a deposit or withdrawal.
+     * @param p_sectionChanges - The sections which differ from the last version of the config file seen.
+     */
+    void applyConfigSectionChanges(const QVector<ConfigSectionIndex::SectionChange> &p_sectionChanges);
+
+    /**
+     * @brief Stores a bill in the bill map and displays it, updating its row in place if it is already displayed or appending a row in sorted order if not.
+     * The search index, funded bill list, and totals are updated with it. Bills which already match the bill map are left alone.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     * @return True if the bill was added or changed.
+     */
+    bool storeBill(const QString &p_billKey, const Bill &p_bill);
+
+    /**
+     * @brief Removes a bill from the bill map, search index, funded bill list, and totals. Its row is not removed, but added to a list so the rows of several bills can be removed together by removeBillRows().
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_removedRows - Receives the row of the bill, if it is displayed.
+     * @return True if the bill was stored or displayed.
+     */
+    bool removeStoredBill(const QString &p_billKey, QVector<int> &p_removedRows);
+
+    /**
+     * @brief Adopts the ledger a save wrote, and shows the bills and funds other instances changed which it merged in.
+     * @param p_saveResult - The result of the save.
+     */
+    void applySaveResult(const LedgerStore::SaveResult &p_saveResult);
+
+    /**
+     * @brief Appends the totals a save took of what it wrote to the balance history, unless bills in a currency without an exchange rate were left out of them.
+     * @param p_saveResult - The result of the save.
+     */
+    void recordBalanceSnapshot(const LedgerStore::SaveResult &p_saveResult);
+
+    /**
+     * @brief Removes rows from the bill table widget along with their sort keys, then rebuilds the row lookup and sorted order once.
+     * @param p_removedRows - The rows to remove, in any order.
+     */
+    void removeBillRows(QVector<int> p_removedRows);
+
+    /**
+     * @brief Sets the amount due and due date of a loan's bill to the loan's next payment on or after today. Funded bills are left alone, since their funds were set aside for the amount they hold.
+     * @param p_billKey - The bill map key of the loan's bill.
+     * @return True if the bill was changed.
+     */
+    bool applyLoanPayment(const QString &p_billKey);
+
+    /**
+     * @brief Lists the schedule of the loan chosen in the LoanWidget, with its what-if extra payment.
+     */
+    void refreshChosenLoanSchedule();
+
+    /**
+     * @brief Asks the user to name a scenario, suggesting the next numbered name.
+     * @param p_scenarioName - Set to the name entered.
+     * @return False if the user cancelled or entered no name.
+     */
+    bool askScenarioName(QString &p_scenarioName);
+
+    /**
+     * @brief Returns the bills selected in the bill table widget.
+     * @return The bill map keys of the selected rows.
+     */
+    QStringList selectedBillKeys() const;
+
+    /**
+     * @brief Funds or defunds the bills selected in the bill table widget in the chosen scenario, moving their amounts due out of or back into its amount available.
+     * @param p_isFunded - Whether the bills should be funded.
+     */
+    void setScenarioFundingStatus(bool p_isFunded);
+
+    /**
+     * @brief Handles a batch of requests received by the automation server. The requests are applied in order to a pending copy of the bills they touch,
+     * and once every request has been handled the changes are stored, displayed, and saved together, so a batch of any size results in one save.
+     * @param p_requests - The requests, in the order they were received.
+     * @return One response per request, in the same order.
+     */
+    QVector<QJsonObject> handleAutomationBatch(const QVector<QJsonObject> &p_requests);
+
+    /**
+     * @brief Sets the fields of a bill which are present in an automation request, leaving the others as they are.
+     * @param p_request - The request.
+     * @param p_bill - The bill to update.
+     * @return Why a field could not be used, or an empty string if every field present was valid.
+     */
+    QString applyAutomationFields(const QJsonObject &p_request, Bill &p_bill);
+
+    /**
+     * @brief Describes a bill in the form automation responses use.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     * @return The bill as a JSON object.
+     */
+    QJsonObject billToAutomationJson(const QString &p_billKey, const Bill &p_bill);
+
+    /**
+     * @brief Brings the totals, search results, and status bar up to date after bills were changed outside the bill table widget, then saves the bills and ledger once.
+     * @param p_statusText - The status bar message describing the change.
+     */
+    void finishBillChanges(const QString &p_statusText);
+
+    /**
+     * @brief Converts an amount into the currency of the total amount available. If either currency has no exchange rate, the user is told in the status bar.
+     * @param p_amountCents - The amount in cents.
+     * @param p_currencyIndex - The CurrencyRegistry index of the currency the amount is in.
+     * @param p_isConverted - If not null, set to false when there is no exchange rate for the conversion.
+     * @return The amount in cents of the currency of the total amount available, or zero if it could not be converted.
+     */
+    qint64 convertToAvailableCurrency(qint64 p_amountCents, quint8 p_currencyIndex, bool *p_isConverted = nullptr);
+
+    /**
+     * @brief Returns a LedgerFunds moving funds in the currency of the total amount available with the cached exchange rates.
+     * @return The LedgerFunds, which refers to the MainWindow's exchange rates.
+     */
+    LedgerFunds availableFunds() const;
+
+    /**
+     * @brief Applies funding, defunding, or deleting a bill to the total amount available and records it for the transaction history, which it is appended to once the next save is written.
+     * If the bill's amount could not be converted, nothing is changed and the user is told in the status bar.
+     * @param p_fundsChange - The change, as worked out by LedgerFunds.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     * @param p_pendingTransactions - If not null, the transaction is added to it for the caller to record with the rest of a batch, rather than recorded on its own.
+     * @return False if the change was refused because the bill's amount could not be converted, in which case the caller must leave the bill as it is.
+     */
+    bool applyFundsChange(const LedgerFunds::FundsChange &p_fundsChange, const QString &p_billKey, const Bill &p_bill, QVector<TransactionLedger::Transaction> *p_pendingTransactions = nullptr);
+
+    /**
+     * @brief Updates the amount available label to show the currency of the total amount available.
+     */
+    void updateAmountAvailableLabel();
+
+    /**
+     * @brief Totals the amounts due of the unfunded bills in the bill map and displays it in the currency of the total amount available.
+     * Amounts are summed per currency in a single pass over the bills and then converted once per currency, rather than converting each bill.
+     */
+    void updateLeftToFundLabel();
+
+    /**
+     * @brief Replaces a bill's contribution to the category and tag totals with its current values, converting its amount due into the currency of the total amount available,
+     * marks the months it was and is due in as needing to be totalled again by the periodic report, moves it to its due day's calendar bucket, reschedules its reminders, and re-indexes it for collision detection.
+     * Only the bill's own contribution changes, so the cost does not depend on how many bills there are.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_bill - The bill.
+     */
+    void updateBillTotals(const QString &p_billKey, const Bill &p_bill);
+
+    /**
+     * @brief Removes a bill from the category and tag totals, the bill calendar, the reminder scheduler, and the bill key index, and marks the month it was due in as needing to be totalled again by the periodic report.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBillTotals(const QString &p_billKey);
+
+    /**
+     * @brief Arms the reminder timer for the start of the day the earliest pending reminder fires on, or stops it if none are pending.
+     */
+    void armReminderTimer();
+
+    /**
+     * @brief Recomputes the category and tag totals, the bill calendar, and the bill key index from every bill in the bill map and drops every month cached by the periodic report,
+     * needed after the bills are loaded or the currency of the total amount available changes.
+     * @param p_collidingBillNames - If not null, receives the names of bills whose keys collide with an earlier bill's once case is ignored.
+     */
+    void rebuildBillTotals(QStringList *p_collidingBillNames = nullptr);
+
+    /**
+     * @brief Displays the current category and tag totals in the category summary table, and refills the BillCalendarWidget if it is open.
+     */
+    void refreshCategorySummary();
+
     // Window variables
     const QString m_APP_NAME = "PersonalFinanceTool"; //!< The name of the application displayed as the window title.
     QGridLayout *m_buttonGridLayout = nullptr; //!< Grid layout used to organize buttons on the MainWindow.
@@ -234,6 +791,12 @@ private:
     const QString m_CONFIG_FILE_NAME = m_APP_NAME + ".ini"; //!< The name of the config file.
     const QString m_CONFIG_PARENT_FOLDER = "config/"; //!< The parent folder of the config file.
     const QString m_CONFIG_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + m_CONFIG_FILE_NAME; //!< The path where the config file should be read or generated if absent.
+    LedgerStore m_ledgerStore{m_CONFIG_FILE_DIRECTORY_NAME}; //!< Reads and writes the bills and funds information of the config file.
+    const QString m_ARCHIVE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + "archive"; //!< The directory where archived bills are stored in segment files.
+    const QString m_LEDGER_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + m_APP_NAME + ".ledger"; //!< The path where the transaction ledger is read or generated if absent.
+    const QString m_BALANCE_HISTORY_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + m_APP_NAME + ".history"; //!< The path where the balance history is read or generated if absent.
+    const QString m_EXCHANGE_RATE_FILE_NAME = "ExchangeRates.ini"; //!< The name of the exchange rate file.
+    const QString m_EXCHANGE_RATE_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + m_EXCHANGE_RATE_FILE_NAME; //!< The path where the exchange rates are read or generated if absent.
 
     // Message box strings
     const QString m_INVALID_KEY_BOX_PRIMARY_TEXT = "Invalid Configuration File Key/Value Pair"; //!< The invalid key message box title.
@@ -253,28 +816,45 @@ private:
                                                " from the application folder, and re-launch the application."; //!< The failed to reset bills informative text.
 
     // Total amount available variables
-    const QString m_TOTAL_AMOUNT_AVAILABLE_STRING = "Total Amount Available: $"; //!< The total amount available represented as a string.
-    const QString m_ASK_FOR_AMOUNT_AVAILABLE_TEXT = "Please enter the total amount of money available in USD."; //!< The total amount available informative text.
+    const QString m_TOTAL_AMOUNT_AVAILABLE_STRING = "Amount Available (%1):"; //!< The total amount available represented as a string, given the currency code.
+    const QString m_ASK_FOR_AMOUNT_AVAILABLE_TEXT = "Please enter the total amount of money available in %1."; //!< The total amount available informative text, given the currency code.
+    const QString m_AVAILABLE_CURRENCY_TITLE_TEXT = "Currency"; //!< The title of the currency input dialog.
+    const QString m_ASK_FOR_AVAILABLE_CURRENCY_TEXT = "Please choose the currency your money available is held in."; //!< The currency of the total amount available informative text.
     const double m_DEFAULT_AMOUNT_AVAILABLE = 0.00; //!< The default amount of money available assigned if the user does not provide the actual amount.
     const double m_MIN_AMOUNT_AVAILABLE = 0.00; //!< The minimum amount the user can specify for the total amount of money they have available.
     const double m_MAX_AMOUNT_AVAILABLE = static_cast<double>(INT64_MAX); //!< The maximum amount the user can specify for the total amount of money they have available.
     const int m_NUM_DECIMAL_PLACES = 2; //!< The number of decimal places allowed in the total amount available input box.
     double m_AMOUNT_AVAILABLE_STEP_SIZE = 1.00; //!< The step size for the up and down arrows in the total amount available input box.
     double m_totalAmountAvailable = 0.00; //!< The total amount of money the user has available, defaulted to zero dollars.
+    quint8 m_availableCurrencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the currency the total amount available is held in.
+
+    // Currency variables
+    ExchangeRateTable m_exchangeRateTable; //!< The exchange rates the user maintains, used to convert bills into the currency of the total amount available.
+    const QString m_LEFT_TO_FUND_STRING = "Left To Fund (%1): %2"; //!< The total of the unfunded bills represented as a string, given the currency code and the total.
+    const QString m_MISSING_RATES_MARKER = " *"; //!< Appended to the left to fund total when some bills could not be converted.
+    const QString m_MISSING_RATES_TOOLTIP_TEXT = "Excludes bills in %1, which have no rate in " + m_EXCHANGE_RATE_FILE_NAME; //!< Tooltip of the left to fund label, given the currencies which could not be converted.
+    const QString m_MISSING_RATE_STATUS_TEXT = "No exchange rate between %1 and %2 in " + m_EXCHANGE_RATE_FILE_NAME + , bills in %1 were skipped"; //!< Status bar text shown when a bill's amount could not be converted, given the two currency codes.
 
     // Config file content strings
     QSettings m_settings; //!< The QSettings object which reads and writes to the configuration file.
-    const QString m_FUNDS_INFORMATION_GROUP_LABEL = "FundsInformation"; //!< The group label for the funds information section of the configuration file.
-    const QString m_TOTAL_FUNDS_AVAILABLE_KEY = "TotalFundsAvailable"; //!< The total funds available key which maps to the total funds available value.
-    const QString m_BILL_AMOUNT_DUE_KEY = "AmountDue"; //!< The amount due key which maps to various amounts due of bills.
-    const QString m_BILL_DUE_DATE_KEY = "DueDate"; //!< The due date key which maps to various due dates of bills.
-    const QString m_BILL_FUNDING_STATUS_KEY = "FundingStatus"; //!< The funding status key which maps to whether or not a bill has been funded.
 
     // Bill table widget strings
     const QString m_BILL_NAME_COLUMN_HEADER_STRING = "Bill Name"; //!< The bill name column title.
     const QString m_BILL_AMOUNT_DUE_COLUMN_HEADER_STRING = "Amount Due"; //!< The bill amount due column title.
     const QString m_BILL_DUE_DATE_COLUMN_HEADER_STRING = "Due Date"; //!< The bill due date column title.
     const QString m_BILL_FUNDING_STATUS_COLUMN_HEADER_STRING = "Funding Status"; //!< The bill funding status column title.
+    const QString m_BILL_CURRENCY_COLUMN_HEADER_STRING = "Currency"; //!< The bill currency column title.
+    const QString m_BILL_CATEGORY_COLUMN_HEADER_STRING = "Category"; //!< The bill category column title.
+    const QString m_BILL_TAGS_COLUMN_HEADER_STRING = "Tags"; //!< The bill tags column title.
+    const int m_BILL_NAME_COLUMN = BillSorter::NameColumn; //!< The column of the bill table widget displaying bill names.
+    const int m_BILL_AMOUNT_DUE_COLUMN = BillSorter::AmountDueColumn; //!< The column of the bill table widget displaying amounts due.
+    const int m_BILL_DUE_DATE_COLUMN = BillSorter::DueDateColumn; //!< The column of the bill table widget displaying due dates.
+    const int m_BILL_FUNDING_STATUS_COLUMN = BillSorter::FundingStatusColumn; //!< The column of the bill table widget displaying funding statuses.
+    const int m_BILL_CURRENCY_COLUMN = BillSorter::CurrencyColumn; //!< The column of the bill table widget displaying currencies.
+    const int m_BILL_CATEGORY_COLUMN = BillSorter::CategoryColumn; //!< The column of the bill table widget displaying categories.
+    const int m_BILL_TAGS_COLUMN = BillSorter::TagsColumn; //!< The column of the bill table widget displaying tags.
+    const int m_BILL_COLUMN_COUNT = 7; //!< The number of columns of the bill table widget.
+    const char *m_BILL_KEY_PROPERTY = "billKey"; //!< The property name used to tag cell widgets with the bill map key of their row.
 
     // Button text strings
     const QString m_SAVE_BUTTON_TEXT = "Save"; //!< Save button text.
@@ -283,14 +863,35 @@ private:
     const QString m_FUND_BILL_BUTTON_TEXT = "Fund Bill"; //!< Fund bill button text.
     const QString m_DEFUND_BILL_BUTTON_TEXT = "Defund Bill"; //!< Defund bill button text.
     const QString m_RESET_BILLS_BUTTON_TEXT = "Reset Bills"; //!< Reset bills button text.
+    const QString m_TOOLS_BUTTON_TEXT = "Tools"; //!< Tools button text.
+    const QString m_LEDGER_HISTORY_ACTION_TEXT = "Ledger History"; //!< Ledger history menu action text.
+    const QString m_BALANCE_HISTORY_ACTION_TEXT = "Balance History"; //!< Balance history menu action text.
+    const QString m_BILL_ARCHIVE_ACTION_TEXT = "Bill Archive"; //!< Bill archive menu action text.
+    const QString m_PERIOD_REPORT_ACTION_TEXT = "Periodic Report"; //!< Periodic report menu action text.
+    const QString m_BILL_CALENDAR_ACTION_TEXT = "Bill Calendar"; //!< Bill calendar menu action text.
+    const QString m_REMINDER_LEAD_TIME_ACTION_TEXT = "Reminder Lead Time..."; //!< Reminder lead time menu action text.
+    const QString m_AUTOMATION_ACTION_TEXT = "Automation Server"; //!< Automation server menu action text.
+    const QString m_RECONCILE_ACTION_TEXT = "Reconcile Statement"; //!< Statement reconciliation menu action text.
+    const QString m_LOANS_ACTION_TEXT = "Loans"; //!< Loans menu action text.
+    const QString m_SCENARIOS_ACTION_TEXT = "Scenarios"; //!< Scenarios menu action text.
+    const QString m_CASH_FLOW_SIMULATION_ACTION_TEXT = "Cash Flow Simulation"; //!< Cash flow simulation menu action text.
 
     // Widgets used throughout the MainWindow
     BillWidget *m_billWidget = nullptr; //!< Pointer to a BillWidget which allows the user to enter the bills they wish to keep track of.
     QTableWidget *m_billTableWidget = nullptr; //!< Table widget displaying inputted bill information.
 
+    // Search UI objects
+    QLineEdit *m_searchEdit = nullptr; //!< The input field used to filter the bill table widget by bill name as the user types.
+    const QString m_SEARCH_PLACEHOLDER_TEXT = "Search bills by name..."; //!< Placeholder text shown in the empty search line edit.
+    const int m_MAX_SEARCH_RESULTS = 500; //!< The maximum number of ranked rows shown for a search.
+    const QString m_SEARCH_MORE_RESULTS_STATUS_TEXT = "Showing the best %1 matches, %2 more match the search"; //!< Status bar text shown when a search matches more bills than are shown, given the number shown and the number left out.
+    QSet<QString> m_searchShownBillKeys; //!< The bills whose rows the current search shows, so the next search only touches their rows and those of its own matches.
+    bool m_isSearchFilterStale = true; //!< Whether or not rows were added, removed, or shown since the current search was applied, in which case the next search checks every row.
+
     // Amount avaiable UI objects
     QLabel *m_amountAvailableLabel = nullptr; //!< The label for the total amount available.
     QLineEdit *m_amountAvailableEdit = nullptr; //!< The input field for the total amount available, initially set to the user's amount available but can be edited.
+    QLabel *m_leftToFundLabel = nullptr; //!< The label showing the total amount due of the unfunded bills, in the currency of the total amount available.
 
     // Buttons used for manipulating the bill table widget
     QPushButton *m_saveButton = nullptr; //!< Button used to save the current state of the tool to the configuration file for subsequent launches of the application.
@@ -299,14 +900,203 @@ private:
     QPushButton *m_fundBillButton = nullptr; //!< Button used to fund a bill in the bill table widget.
     QPushButton *m_defundBillButton = nullptr; //!< Button used to defund a bill in the bill table widget.
     QPushButton *m_resetBillsButton = nullptr; //!< Button used to reset the bills recorded in the bill table widget as well as in the bill map.
+    QPushButton *m_toolsButton = nullptr; //!< Button which opens the Tools menu.
+    QMenu *m_toolsMenu = nullptr; //!< Menu of additional tools, such as the ledger history.
+
+    // Transaction history objects
+    TransactionLedger m_transactionLedger; //!< Append-only history of deposits, funding, defunding, and deletions.
+    LedgerHistoryWidget *m_ledgerHistoryWidget = nullptr; //!< Pop-up window displaying the transaction history of a chosen day.
+
+    // Balance history objects
+    BalanceHistory m_balanceHistory; //!< Append-only series of the totals at each save, rolled up by day, week, and month.
+    BalanceHistoryWidget *m_balanceHistoryWidget = nullptr; //!< Pop-up window displaying the balance history over a chosen range.
+
+    // Category summary objects
+    CategoryRollup m_categoryRollup; //!< Running totals of the amount due, funded, and outstanding per category and tag, in the currency of the total amount available.
+    QTableWidget *m_categorySummaryTable = nullptr; //!< Read-only table beside the amount available showing the totals of each category and tag.
+    const QString m_CATEGORY_SUMMARY_HEADER_STRING = "Category;Due;Funded;Outstanding"; //!< The category summary table column titles, separated by semicolons.
+    const QString m_UNCATEGORIZED_STRING = "Uncategorized"; //!< Shown in the category summary for bills without a category.
+    const QString m_TAG_SUMMARY_PREFIX = "#"; //!< Prefixed to tags in the category summary to tell them apart from categories.
+
+    // Bill archive objects
+    BillArchive m_billArchive; //!< Cold tier holding paid bills in compressed segment files, loaded only when browsed.
+    BillArchiveWidget *m_billArchiveWidget = nullptr; //!< Pop-up window for browsing archived bills.
+
+    // Periodic report objects
+    PeriodReport m_periodReport; //!< Totals bills per month in parallel, caching months until a bill due in them changes.
+    PeriodReportWidget *m_periodReportWidget = nullptr; //!< Pop-up window displaying the periodic report.
+
+    // Bill calendar objects
+    BillCalendar m_billCalendar; //!< The bills in the bill map bucketed by due day, with each day's totals in the currency of the total amount available.
+    BillCalendarWidget *m_billCalendarWidget = nullptr; //!< Pop-up window displaying a month of bills as a calendar.
+
+    // Loan objects
+    LoanBook m_loanBook; //!< The terms of the bills which are loans, kept in a file beside the config file.
+    LoanWidget *m_loanWidget = nullptr; //!< Pop-up window for making bills loans and seeing how extra payments change their payoff.
+    const QString m_LOAN_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + "Loans.ini"; //!< The path where the loan terms are read and written.
+    const QString m_LOAN_NOT_SAVED_BOX_PRIMARY_TEXT = "Loan Not Saved"; //!< The title of the message box shown when a loan could not be saved or removed.
+    const QString m_INVALID_LOAN_BOX_INFO_TEXT = "Choose a bill and enter a principal above zero to make it a loan."; //!< The informative text shown when the loan terms entered cannot be amortized.
+    const QString m_LOAN_FILE_FAIL_BOX_INFO_TEXT = "The loan terms could not be written to " + m_LOAN_FILE_DIRECTORY_NAME + "."; //!< The informative text shown when the loan file could not be written.
+    const QString m_LOAN_PAYMENT_STATUS_TEXT = "%1 is now a loan, its next payment of %2 is due %3"; //!< Status bar text shown after a bill is made a loan, given its name, payment, and due date.
+
+    // Scenario objects
+    QVector<LedgerScenario> m_scenarios; //!< The what-if scenarios, in the order they are listed.
+    LedgerScenario m_scenarioBase; //!< A scenario without changes of the bills as they last were, which new scenarios are forked from for as long as the bills stay unchanged.
+    ScenarioWidget *m_scenarioWidget = nullptr; //!< Pop-up window for trying out what-if scenarios side by side.
+    int m_nextScenarioNumber = 1; //!< The number suggested in the name of the next scenario.
+    const QString m_SCENARIO_NAME_TEXT = "Scenario %1"; //!< The name suggested for a scenario, given its number.
+    const QString m_SCENARIO_NAME_TITLE_TEXT = "Scenario Name"; //!< The title of the scenario name input dialog.
+    const QString m_ASK_FOR_SCENARIO_NAME_TEXT = "Please enter a name for the scenario."; //!< The scenario name input dialog informative text.
+    const QString m_NO_SELECTED_BILLS_STATUS_TEXT = "Select bills in the bill table to change them in the scenario"; //!< Status bar text shown when a scenario is changed without any bills selected.
+    const QString m_PROMOTE_SCENARIO_BOX_PRIMARY_TEXT = "Make Scenario Real?"; //!< The promote scenario message box primary text.
+    const QString m_PROMOTE_SCENARIO_BOX_INFO_TEXT = "The %1 bill change(s) of \"%2\" will be made to your bills and saved. Bills edited since the scenario was forked keep their edits and only take its funding changes and removals."; //!< The promote scenario message box informative text, given the number of changes and the scenario's name.
+    const QString m_SCENARIO_PROMOTED_STATUS_TEXT = "Made \"%1\" real, changing %2 bill(s)"; //!< Status bar text shown after a scenario is promoted, given its name and number of changes.
+    const QString m_SCENARIO_PROMOTED_SKIPPED_STATUS_TEXT = "Made \"%1\" real, changing %2 bill(s) and skipping %3 to bills deleted since it was forked or without an exchange rate"; //!< Status bar text shown after a scenario is promoted, given its name, number of changes made, and number of changes skipped.
+
+    // Cash flow simulation objects
+    CashFlowSimulationWidget *m_cashFlowSimulationWidget = nullptr; //!< Pop-up window for simulating the chance of running short over the months ahead.
+    quint64 m_simulationJobId = 0; //!< The id of the most recent cash flow simulation job.
+    QString m_simulationCurrencyCode; //!< The currency of the running or last simulation's balances.
+    const QString m_SIMULATION_JOB_NAME = "Cash Flow Simulation"; //!< The name of the cash flow simulation job.
+    const QString m_SIMULATION_STARTED_TEXT = "Simulating %1 bill payment(s) over %2 month(s)..."; //!< Summary shown once a simulation starts, given the number of bills and months.
+    const QString m_SIMULATION_CANCELLED_TEXT = "Simulation cancelled, the results of the paths completed so far are listed"; //!< Summary shown once a simulation is cancelled.
+
+    // Reminder objects
+    ReminderScheduler m_reminderScheduler; //!< Min-heap of the next reminder of each unfunded bill, ordered by the day it fires.
+    QTimer *m_reminderTimer = nullptr; //!< Single shot timer armed for the start of the day the earliest reminder fires on.
+    QSystemTrayIcon *m_reminderTrayIcon = nullptr; //!< System tray icon used to show reminder notifications, only shown if the system has a tray.
+    qint64 m_armedReminderDay = 0; //!< The day number the reminder timer was last armed for, zero if it is not armed.
+    const qint64 m_MAX_REMINDER_TIMER_MSECS = 24 * 60 * 60 * 1000; //!< The longest the reminder timer waits before checking again, so far off reminders survive clock changes.
+    const int m_MAX_REMINDER_LEAD_DAYS = 365; //!< The most days before its due date a bill can be reminded of.
+    const int m_MAX_REMINDER_NAMES = 5; //!< The most bill names listed in a reminder notification.
+    const QString m_REMINDER_FILE_DIRECTORY_NAME = m_CONFIG_PARENT_FOLDER + "Reminders.ini"; //!< The path where the reminder settings are read and written.
+    const QString m_REMINDER_LEAD_DAYS_KEY = "LeadDays"; //!< The key of the reminder lead time in the reminder settings file.
+    const QString m_REMINDER_TITLE_TEXT = "Bill Reminders"; //!< The title of reminder notifications and of the lead time dialog.
+    const QString m_REMINDER_LEAD_DAYS_TEXT = "Remind me of unfunded bills this many days before they are due:"; //!< The reminder lead time dialog informative text.
+    const QString m_REMINDER_MESSAGE_TEXT = "%1 bill(s) overdue, %2 due within %3 day(s): %4"; //!< Text of a reminder notification, given the overdue and upcoming counts, the lead time, and the bill names.
+    const QString m_REMINDER_NAME_TEXT = "%1 (%2)"; //!< A bill listed in a reminder notification, given its name and due date.
+    const QString m_REMINDER_MORE_TEXT = "and %1 more"; //!< Ends the list of bills in a reminder notification, given how many were not listed.
+
+    // Statement reconciliation objects
+    ReconciliationWidget *m_reconciliationWidget = nullptr; //!< Pop-up window for matching bank statement transactions to bills.
+    QVector<StatementReconciler::StatementTransaction> m_statementTransactions; //!< The transactions of the loaded bank statement.
+    QVector<StatementReconciler::ReconcileBill> m_reconcileBills; //!< The bills the statement was last matched against, indexed by the reconciliation result.
+    StatementReconciler::Result m_reconcileResult; //!< The outcome of last matching the statement.
+    const QString m_STATEMENT_READ_FAIL_TEXT = "The statement could not be read: %1"; //!< Message shown when a statement cannot be read.
+    const QString m_RECONCILE_NOT_READY_TEXT = "Bills are still loading, try again once they are loaded"; //!< Message shown when a statement is matched before the bills are loaded.
+    const QString m_RECONCILE_APPLIED_TEXT = "Funded %1 and archived %2 of %3 matched bills"; //!< Message shown once matches are applied.
 
     // Data structures used for storing bill information
     QMap<QString, Bill> m_billMap; //!< Map which stores (key, value) pairs of (the names of bills, corresponding bill objects).
     QList<QString> m_fundedBillsList; //!< List which holds the currently funded bills.
+    QVector<QPair<QString, qint64>> m_unsavedDeletions; //!< The keys of bills deleted from the bill table widget since the last save and the funds each returned, recorded for the transaction history on Save along with funding changes.
+    BillSearchIndex m_billSearchIndex; //!< Trigram index over bill names used for incremental search.
+    QHash<QString, int> m_billRowByKey; //!< Map which stores (key, value) pairs of (bill map keys, rows of the bill table widget displaying them).
+    BillSorter m_billSorter; //!< Typed sort keys and sorted order of the rows of the bill table widget.
+
+    // Bill collision variables
+    BillKeyIndex m_billKeyIndex; //!< Normalized keys, amounts, and due dates of the stored bills, used to detect colliding and near duplicate bills.
+    const QString m_KEY_COLLISION_BOX_PRIMARY_TEXT = "Bill Already Exists"; //!< The key collision message box title.
+    const QString m_KEY_COLLISION_BOX_INFO_TEXT = "\"%1\" would be saved under the same name as \"%2\", which differs only in spacing or case. Replace the existing bill or keep both?"; //!< The key collision message box informative text, given the new and existing bill names.
+    const QString m_NEAR_DUPLICATE_BOX_PRIMARY_TEXT = "Possible Duplicate Bill"; //!< The near duplicate message box title.
+    const QString m_NEAR_DUPLICATE_BOX_INFO_TEXT = "\"%1\" has the same amount due as \"%2\", due %3, and a similar name. Add it anyway?"; //!< The near duplicate message box informative text, given the new and existing bill names and the existing due date.
+    const QString m_REPLACE_BUTTON_TEXT = "Replace"; //!< The text of the button replacing the existing bill.
+    const QString m_KEEP_BOTH_BUTTON_TEXT = "Keep Both"; //!< The text of the button keeping both bills by numbering the new bill's name.
+    const QString m_ADD_ANYWAY_BUTTON_TEXT = "Add Anyway"; //!< The text of the button adding a near duplicate bill.
+    const QString m_DUPLICATE_ROWS_BOX_PRIMARY_TEXT = "Duplicate Bill Names"; //!< The duplicate rows message box title.
+    const QString m_DUPLICATE_ROWS_BOX_INFO_TEXT = "\"%1\" and \"%2\" would be saved under the same name. Please rename one of them and save again."; //!< The duplicate rows message box informative text, given the two bill names.
+    const QString m_LOAD_COLLISION_BOX_PRIMARY_TEXT = "Colliding Bill Names"; //!< The load collision message box title.
+    const QString m_LOAD_COLLISION_BOX_INFO_TEXT = "These bills in " + m_CONFIG_FILE_NAME + " differ from another bill only in case, and would overwrite it on Windows: %1. Please rename them."; //!< The load collision message box informative text, given the bill names.
+    const QString m_PASTED_KEY_COLLISION_ERROR = "Would be saved under the same name as the stored bill \"%1\""; //!< Error shown for a pasted bill colliding with a stored bill, given the stored bill's name.
+    const QString m_PASTED_REPEATED_NAME_ERROR = "Would be saved under the same name as the bill on line %1"; //!< Error shown for a pasted bill colliding with an earlier pasted bill, given the earlier bill's line.
+    const QString m_PASTED_NEAR_DUPLICATE_WARNING = "Has the same amount due as \"%1\", due %2, and a similar name"; //!< Warning shown for a pasted bill nearly duplicating a stored bill, given the stored bill's name and due date.
+    const QString m_PASTED_BILLS_STATUS_TEXT = "Added %1 pasted bill(s), %2 row(s) left to correct"; //!< Status bar text shown after pasted bills are added, given the added and remaining row counts.
+    const QString m_NO_VALID_PASTED_BILLS_BOX_PRIMARY_TEXT = "No Bills To Add"; //!< The no valid pasted bills message box title.
+    const QString m_NO_VALID_PASTED_BILLS_BOX_INFO_TEXT = "None of the pasted rows can be added yet. Hover over the highlighted fields to see what needs correcting."; //!< The no valid pasted bills message box informative text.
+    QVector<BillPasteParser::PastedRow> m_pastedRows; //!< The rows last pasted into the BillWidget, as read and checked by validatePastedBills().
+    const QString m_REPEATED_BILLS_BOX_PRIMARY_TEXT = "Repeated Bills"; //!< The repeated bills message box title.
+    const QString m_OUT_OF_RANGE_BILLS_BOX_PRIMARY_TEXT = "Bills Not Loaded"; //!< The out of range bills message box title.
+    const QString m_OUT_OF_RANGE_BILLS_BOX_INFO_TEXT = "These bills in " + m_CONFIG_FILE_NAME + " have an amount due larger than %1 and were not loaded: %2. They are kept in the file as they are, lower their amount due there to use them."; //!< The out of range bills message box informative text, given the largest amount due and the bill names.
+    const QString m_REPEATED_BILLS_BOX_INFO_TEXT = "These bills appear more than once in " + m_CONFIG_FILE_NAME + ", where a value is given more than once the last one was used: %1. Saving will keep a single copy of each."; //!< The repeated bills message box informative text, given the bill names.
+    const QString m_CONFIG_RELOADED_COLLISION_STATUS_TEXT = "Reloaded %1 changed bill(s) from " + m_CONFIG_FILE_NAME + ", %2 collide with another bill's name"; //!< Status bar text shown after external edits are applied, some of which collide.
+
+    // Background job variables
+    JobManager *m_jobManager = nullptr; //!< Runs loading and saving of the config file on worker threads so the GUI thread is never blocked.
+    quint64 m_loadJobId = 0; //!< The id of the most recent config file load job.
+    quint64 m_saveJobId = 0; //!< The id of the most recent config file save job.
+    bool m_isSaveQueued = false; //!< Whether or not a save was requested while another save was still running.
+    QVector<TransactionLedger::Transaction> m_unsavedTransactions; //!< Funds moves made since the last save was started, appended to the transaction history once a save carrying them is written.
+    QVector<TransactionLedger::Transaction> m_savingTransactions; //!< Funds moves carried by the save which is running, appended to the transaction history only if it is written.
+    LedgerSnapshot m_savedLedger; //!< The bills and funds information as last loaded from or saved to the config file, which saves are merged against so changes saved by other instances are kept.
+    const QString m_LOAD_JOB_NAME = "Load"; //!< The name of the config file load job.
+    const QString m_SAVE_JOB_NAME = "Save"; //!< The name of the config file save job.
+    const QString m_SAVE_MERGED_STATUS_TEXT = "Saved, keeping %1 bill change(s) another instance saved to " + m_CONFIG_FILE_NAME; //!< Status bar text shown after a save merged other instances' changes, given their count.
+    const QString m_SAVE_CONFLICT_STATUS_TEXT = "Saved, %1 bill(s) were also changed by another instance, fields changed by both kept this window's values: %2"; //!< Status bar text shown after a save merged conflicting changes, given their count and bill names.
+    const QString m_BALANCE_HISTORY_FAILED_STATUS_TEXT = "Saved, but the balance history could not be written"; //!< Status bar text shown when a save's totals could not be added to the balance history.
+    const QString m_BALANCE_HISTORY_MISSING_RATE_STATUS_TEXT = "Saved, but the balance history was not updated, there is no exchange rate for %1"; //!< Status bar text shown when a save's totals left out bills without a rate, given their currency codes.
+    const QString m_CONFIG_LOCKED_BOX_PRIMARY_TEXT = "Configuration File Is Busy"; //!< The title of the config file locked message box.
+    const QString m_CONFIG_LOCKED_BOX_INFO_TEXT = "Another instance of the application has been saving " + m_CONFIG_FILE_NAME + " for too long, so the bills were not saved. Please save again shortly."; //!< The informative text of the config file locked message box.
+
+    // Config file watching variables
+    QFileSystemWatcher *m_configFileWatcher = nullptr; //!< Watches the config file for edits made outside the application.
+    QTimer *m_configReloadTimer = nullptr; //!< Single shot timer which coalesces a burst of config file changes into one reload.
+    ConfigSectionIndex m_configSectionIndex; //!< Fingerprints of each config file section as of the last version seen, used to find which sections an external edit changed.
+    const int m_CONFIG_RELOAD_DELAY_MSECS = 50; //!< How long the config file must go unchanged before it is reloaded.
+    const QString m_CONFIG_RELOADED_STATUS_TEXT = "Reloaded %1 changed bill(s) from " + m_CONFIG_FILE_NAME; //!< Status bar text shown after external edits are applied.
+    const QString m_CONFIG_RELOADED_MERGED_STATUS_TEXT = "Reloaded %1 changed bill(s) from " + m_CONFIG_FILE_NAME + ", keeping the unsaved edits to %2 bill(s): %3"; //!< Status bar text shown after external edits are merged with unsaved edits, given the changes and the number and keys of the bills merged.
+    const QString m_CONFIG_RELOADED_OUT_OF_RANGE_STATUS_TEXT = "Skipped %1 bill(s) in " + m_CONFIG_FILE_NAME + " whose amount due is too large to hold: %2"; //!< Status bar text shown when external edits give bills an amount due which cannot be held, given their number and keys.
+    const int m_STATUS_MESSAGE_TIMEOUT_MSECS = 3000; //!< How long transient status bar messages are shown for.
+
+    // Automation server variables
+    AutomationServer *m_automationServer = nullptr; //!< Local socket server handling requests from scripts, only listening once the user opts in.
+    QAction *m_automationAction = nullptr; //!< Checkable Tools menu action which starts and stops the automation server.
+    const QString m_AUTOMATION_SERVER_NAME = "PersonalFinanceTool"; //!< The name of the local socket scripts connect to.
+    const char *m_AUTOMATION_ENVIRONMENT_VARIABLE = "PFT_AUTOMATION"; //!< Environment variable which, when set to 1, starts the automation server at launch.
+    const QString m_AUTOMATION_OPERATION_KEY = "op"; //!< The key of a request holding the name of its operation.
+    const QString m_AUTOMATION_LIST_OPERATION = "list"; //!< Operation listing every bill.
+    const QString m_AUTOMATION_TOTALS_OPERATION = "totals"; //!< Operation reporting the amount available and the amount left to fund.
+    const QString m_AUTOMATION_ADD_OPERATION = "add"; //!< Operation adding a bill.
+    const QString m_AUTOMATION_UPDATE_OPERATION = "update"; //!< Operation changing fields of a bill.
+    const QString m_AUTOMATION_FUND_OPERATION = "fund"; //!< Operation funding a bill.
+    const QString m_AUTOMATION_DEFUND_OPERATION = "defund"; //!< Operation defunding a bill.
+    const QString m_AUTOMATION_DELETE_OPERATION = "delete"; //!< Operation deleting a bill.
+    const QString m_AUTOMATION_KEY_KEY = "key"; //!< The key of a request or bill holding the bill map key.
+    const QString m_AUTOMATION_NAME_KEY = "name"; //!< The key of a request or bill holding the bill name.
+    const QString m_AUTOMATION_AMOUNT_DUE_KEY = "amountDue"; //!< The key of a request or bill holding the amount due.
+    const QString m_AUTOMATION_DUE_DATE_KEY = "dueDate"; //!< The key of a request or bill holding the due date, in the config file's date format.
+    const QString m_AUTOMATION_CURRENCY_KEY = "currency"; //!< The key of a request or bill holding the currency code.
+    const QString m_AUTOMATION_CATEGORY_KEY = "category"; //!< The key of a request or bill holding the category.
+    const QString m_AUTOMATION_TAGS_KEY = "tags"; //!< The key of a request or bill holding the tags, an array of strings.
+    const QString m_AUTOMATION_FUNDED_KEY = "funded"; //!< The key of a bill saying whether or not it is funded.
+    const QString m_AUTOMATION_BILLS_KEY = "bills"; //!< The key of a list response holding the bills.
+    const QString m_AUTOMATION_AMOUNT_AVAILABLE_KEY = "amountAvailable"; //!< The key of a totals response holding the amount available.
+    const QString m_AUTOMATION_LEFT_TO_FUND_KEY = "leftToFund"; //!< The key of a totals response holding the amount due of the unfunded bills.
+    const QString m_AUTOMATION_BILL_COUNT_KEY = "billCount"; //!< The key of a totals response holding the number of bills.
+    const QString m_AUTOMATION_FUNDED_BILL_COUNT_KEY = "fundedBillCount"; //!< The key of a totals response holding the number of funded bills.
+    const QString m_AUTOMATION_UNKNOWN_OPERATION_TEXT = "Unknown operation \"%1\""; //!< Error for requests with an operation which does not exist.
+    const QString m_AUTOMATION_NO_SUCH_BILL_TEXT = "No bill with the key \"%1\""; //!< Error for requests naming a bill which does not exist.
+    const QString m_AUTOMATION_BILL_EXISTS_TEXT = "A bill with the key \"%1\" already exists"; //!< Error for adding a bill whose key is taken.
+    const QString m_AUTOMATION_ALLOW_DUPLICATE_KEY = "allowDuplicate"; //!< The key of an add request which, when true, adds the bill even if it nearly duplicates another.
+    const QString m_AUTOMATION_NEAR_DUPLICATE_TEXT = "The bill nearly duplicates \"%1\", set \"allowDuplicate\" to add it anyway"; //!< Error for adding a bill which nearly duplicates another.
+    const QString m_AUTOMATION_INVALID_FIELD_TEXT = "Invalid value for \"%1\""; //!< Error for requests with a field which cannot be used.
+    const QString m_AUTOMATION_RENAME_TEXT = "Renaming would change the bill's key, delete and add it instead"; //!< Error for updates changing the bill map key.
+    const QString m_AUTOMATION_MISSING_RATE_TEXT = "No exchange rate between %1 and %2, the bill's funds cannot be moved"; //!< Error for funding, defunding, or deleting a bill whose amount could not be converted, given the two currency codes.
+    const QString m_AUTOMATION_NOT_READY_TEXT = "Bills are still loading"; //!< Error for requests received before the bills are loaded.
+    const QString m_AUTOMATION_APPLIED_STATUS_TEXT = "Applied %1 automation request(s)"; //!< Status bar text shown after a batch of requests changes the bills.
+    const QString m_AUTOMATION_START_FAILED_TEXT = "Automation server could not start: %1"; //!< Status bar text shown when the automation server cannot listen.
+    const QString m_AUTOMATION_STARTED_TEXT = "Automation server listening on \"%1\""; //!< Status bar text shown when the automation server starts listening.
 
-    // Miscellaneous variables
-    const QString m_FUNDED_STRING = "Funded"; //!< Funded status of funded represented as a string.
-    const QString m_NOT_FUNDED_STRING = "Not Funded"; //!< Funded status of not funded represented as a string.
-    const QString m_DATE_STRING_FORMAT = "M/d/yyyy"; //!< The format to use when converting dates to strings.
+    // Profiling variables, each names a phase reported when the application is launched with --profile
+    const char *m_PROFILE_TABLE_BUILD_PHASE = "Table Build"; //!< Filling the bill table from the bill map.
+    const char *m_PROFILE_SAVE_PHASE = "Save"; //!< Reading the bill table back into the bill map.
+    const char *m_PROFILE_REBUILD_TOTALS_PHASE = "Rebuild Totals"; //!< Retotalling every bill per category, period, and day.
+    const char *m_PROFILE_CONFIG_RELOAD_PHASE = "Config Reload"; //!< Applying external edits of the config file.
+    const char *m_PROFILE_AUTOMATION_BATCH_PHASE = "Automation Batch"; //!< Handling a batch of automation requests.
+    const char *m_PROFILE_PERIOD_REPORT_PHASE = "Period Report"; //!< Totalling the bills of a report period.
+    const char *m_PROFILE_RECONCILE_PHASE = "Reconcile"; //!< Matching statement transactions against the bills.
+    const char *m_PROFILE_APPLY_MATCHES_PHASE = "Apply Matches"; //!< Funding the bills matched by a reconciliation.
+    const char *m_PROFILE_LOAN_SUMMARY_PHASE = "Loan Summary"; //!< Summarizing every loan with and without the what-if extra payment.
+    const char *m_PROFILE_SCENARIO_TOTALS_PHASE = "Scenario Totals"; //!< Totalling every what-if scenario.
+    const char *m_PROFILE_SIMULATION_MODEL_PHASE = "Simulation Model"; //!< Gathering the bills a cash flow simulation pays.
 };
 #endif // MAINWINDOW_H
@@ -0,0 +1,291 @@
+/*##################################################################################
+#   File name:          PeriodReport.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a PeriodReport
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "PeriodReport.h"
+
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    const int MONTHS_PER_YEAR = 12; //!< The number of months in a year.
+    const int MONTHS_PER_QUARTER = 3; //!< The number of months in a quarter.
+
+    /**
+     * @brief The MonthChunk struct holds a range of bills totalled by one worker, and the totals of each month it found in them.
+     */
+    struct MonthChunk
+    {
+        int firstBillIndex = 0; //!< The index of the first bill in the chunk.
+        int lastBillIndex = 0; //!< One past the index of the last bill in the chunk.
+        QVector<PeriodReport::PeriodTotals> totalsByMonthOffset; //!< The chunk's totals of each month, indexed from the first month being totalled.
+    };
+}
+
+void PeriodReport::PeriodTotals::add(const PeriodTotals &p_otherTotals)
+{
+    dueCents += p_otherTotals.dueCents;
+    fundedCents += p_otherTotals.fundedCents;
+    billCount += p_otherTotals.billCount;
+}
+
+int PeriodReport::monthNumber(const QDate &p_date)
+{
+    // Convert the day number into a calendar date once, rather than once for the year and again for the month
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    p_date.getDate(&year, &month, &day);
+    return year * MONTHS_PER_YEAR + month - 1;
+}
+
+QDate PeriodReport::firstDateOfMonth(int p_monthNumber)
+{
+    // Round towards negative infinity so months before year zero still map to the right year
+    int year = p_monthNumber >= 0 ? p_monthNumber / MONTHS_PER_YEAR : (p_monthNumber - MONTHS_PER_YEAR + 1) / MONTHS_PER_YEAR;
+    return QDate(year, p_monthNumber - year * MONTHS_PER_YEAR + 1, 1);
+}
+
+void PeriodReport::roundToPeriods(Granularity p_granularity, QDate &p_firstDate, QDate &p_lastDate)
+{
+    if(!p_firstDate.isValid() || !p_lastDate.isValid())
+    {
+        return;
+    }
+
+    // Periods always start on a multiple of their length, since a year divides evenly into them
+    int periodLength = monthsPerPeriod(p_granularity);
+    int firstMonth = monthNumber(p_firstDate);
+    int lastMonth = monthNumber(p_lastDate);
+    firstMonth -= ((firstMonth % periodLength) + periodLength) % periodLength;
+    lastMonth += periodLength - 1 - ((lastMonth % periodLength) + periodLength) % periodLength;
+    p_firstDate = firstDateOfMonth(firstMonth);
+    p_lastDate = firstDateOfMonth(lastMonth + 1).addDays(-1);
+}
+
+void PeriodReport::setCurrentBill(const QString &p_billKey, const QDate &p_dueDate, qint64 p_amountDueCents, bool p_isFunded)
+{
+    CurrentBillValues billValues;
+    billValues.dueMonth = monthNumber(p_dueDate);
+    billValues.amountDueCents = p_amountDueCents;
+    billValues.isFunded = p_isFunded;
+
+    QHash<QString, CurrentBillValues>::iterator valuesIterator = m_valuesByCurrentBillKey.find(p_billKey);
+
+    if(valuesIterator != m_valuesByCurrentBillKey.end())
+    {
+        const CurrentBillValues &previousValues = valuesIterator.value();
+
+        // Saving a bill which did not change keeps its month cached
+        if(previousValues.dueMonth == billValues.dueMonth && previousValues.amountDueCents == billValues.amountDueCents && previousValues.isFunded == billValues.isFunded)
+        {
+            return;
+        }
+
+        // The month the bill was previously due in has lost it, or its old values
+        m_totalsByMonth[CurrentBills].remove(previousValues.dueMonth);
+        valuesIterator.value() = billValues;
+    }
+    else
+    {
+        m_valuesByCurrentBillKey.insert(p_billKey, billValues);
+    }
+
+    m_totalsByMonth[CurrentBills].remove(billValues.dueMonth);
+}
+
+void PeriodReport::removeCurrentBill(const QString &p_billKey)
+{
+    QHash<QString, CurrentBillValues>::iterator valuesIterator = m_valuesByCurrentBillKey.find(p_billKey);
+
+    if(valuesIterator == m_valuesByCurrentBillKey.end())
+    {
+        return;
+    }
+
+    m_totalsByMonth[CurrentBills].remove(valuesIterator.value().dueMonth);
+    m_valuesByCurrentBillKey.erase(valuesIterator);
+}
+
+void PeriodReport::addArchivedBill(const QDate &p_dueDate)
+{
+    m_totalsByMonth[ArchivedBills].remove(monthNumber(p_dueDate));
+}
+
+void PeriodReport::clear()
+{
+    for(int billSource = 0; billSource < BillSourceCount; billSource++)
+    {
+        m_totalsByMonth[billSource].clear();
+    }
+
+    m_valuesByCurrentBillKey.clear();
+}
+
+QVector<int> PeriodReport::staleMonths(BillSource p_billSource, const QDate &p_firstDate, const QDate &p_lastDate) const
+{
+    QVector<int> monthNumbers;
+
+    if(!p_firstDate.isValid() || !p_lastDate.isValid())
+    {
+        return monthNumbers;
+    }
+
+    for(int month = monthNumber(p_firstDate); month <= monthNumber(p_lastDate); month++)
+    {
+        if(!m_totalsByMonth[p_billSource].contains(month))
+        {
+            monthNumbers.append(month);
+        }
+    }
+
+    return monthNumbers;
+}
+
+void PeriodReport::totalMonths(BillSource p_billSource, const QVector<int> &p_monthNumbers, const QVector<const Bill*> &p_bills, const AmountFunction &p_amountFunction)
+{
+    if(p_monthNumbers.isEmpty())
+    {
+        return;
+    }
+
+    // Totals are kept in arrays indexed from the first month, with a flag for each month which was asked for
+    int firstMonth = p_monthNumbers.first();
+    int monthSpan = p_monthNumbers.last() - firstMonth + 1;
+    QVector<bool> isMonthRequested(monthSpan, false);
+
+    for(int month : p_monthNumbers)
+    {
+        isMonthRequested[month - firstMonth] = true;
+    }
+
+    auto totalChunk = [&](MonthChunk &p_chunk)
+    {
+        p_chunk.totalsByMonthOffset = QVector<PeriodTotals>(monthSpan);
+
+        for(int billIndex = p_chunk.firstBillIndex; billIndex < p_chunk.lastBillIndex; billIndex++)
+        {
+            const Bill &bill = *p_bills.at(billIndex);
+            int monthOffset = monthNumber(bill.getDueDate()) - firstMonth;
+
+            // Skip bills due in months which are already cached, or outside the range
+            if(monthOffset < 0 || monthOffset >= monthSpan || !isMonthRequested.at(monthOffset))
+            {
+                continue;
+            }
+
+            PeriodTotals &monthTotals = p_chunk.totalsByMonthOffset[monthOffset];
+            qint64 amountDueCents = p_amountFunction(bill);
+            monthTotals.dueCents += amountDueCents;
+            monthTotals.fundedCents += bill.isFunded() ? amountDueCents : 0;
+            monthTotals.billCount++;
+        }
+    };
+
+    // Split the bills into one chunk per core, but only as many chunks as there are enough bills for
+    int billCount = p_bills.size();
+    int chunkCount = std::max(1, std::min(QThread::idealThreadCount(), billCount / m_MIN_BILLS_PER_CHUNK));
+    int chunkSize = std::max(1, (billCount + chunkCount - 1) / chunkCount);
+    QVector<MonthChunk> chunks;
+
+    for(int firstBillIndex = 0; firstBillIndex < billCount || chunks.isEmpty(); firstBillIndex += chunkSize)
+    {
+        MonthChunk chunk;
+        chunk.firstBillIndex = firstBillIndex;
+        chunk.lastBillIndex = std::min(firstBillIndex + chunkSize, billCount);
+        chunks.append(chunk);
+    }
+
+    // A single chunk is totalled on the calling thread, several are totalled concurrently
+    if(chunks.size() == 1)
+    {
+        totalChunk(chunks.first());
+    }
+    else
+    {
+        QtConcurrent::blockingMap(chunks, totalChunk);
+    }
+
+    // Merge the chunks and cache every month which was asked for, including those without any bills
+    QVector<PeriodTotals> mergedTotals = chunks.first().totalsByMonthOffset;
+
+    for(int chunkIndex = 1; chunkIndex < chunks.size(); chunkIndex++)
+    {
+        for(int monthOffset = 0; monthOffset < monthSpan; monthOffset++)
+        {
+            mergedTotals[monthOffset].add(chunks.at(chunkIndex).totalsByMonthOffset.at(monthOffset));
+        }
+    }
+
+    for(int month : p_monthNumbers)
+    {
+        m_totalsByMonth[p_billSource].insert(month, mergedTotals.at(month - firstMonth));
+    }
+}
+
+QVector<PeriodReport::PeriodRow> PeriodReport::periods(const QDate &p_firstDate, const QDate &p_lastDate, Granularity p_granularity) const
+{
+    QVector<PeriodRow> periodRows;
+
+    if(!p_firstDate.isValid() || !p_lastDate.isValid() || p_firstDate > p_lastDate)
+    {
+        return periodRows;
+    }
+
+    // Round the range out to whole periods
+    QDate firstDate = p_firstDate;
+    QDate lastDate = p_lastDate;
+    roundToPeriods(p_granularity, firstDate, lastDate);
+    int periodLength = monthsPerPeriod(p_granularity);
+    int firstMonth = monthNumber(firstDate);
+    int lastMonth = monthNumber(lastDate);
+
+    for(int periodFirstMonth = firstMonth; periodFirstMonth <= lastMonth; periodFirstMonth += periodLength)
+    {
+        PeriodRow periodRow;
+        periodRow.firstDate = firstDateOfMonth(periodFirstMonth);
+        periodRow.lastDate = firstDateOfMonth(periodFirstMonth + periodLength).addDays(-1);
+
+        // Add up the cached months of each bill source
+        for(int month = periodFirstMonth; month < periodFirstMonth + periodLength; month++)
+        {
+            for(int billSource = 0; billSource < BillSourceCount; billSource++)
+            {
+                periodRow.totals.add(m_totalsByMonth[billSource].value(month));
+            }
+        }
+
+        periodRows.append(periodRow);
+    }
+
+    return periodRows;
+}
+
+int PeriodReport::monthsPerPeriod(Granularity p_granularity)
+{
+    switch(p_granularity)
+    {
+        case Quarterly :
+        {
+            return MONTHS_PER_QUARTER;
+        }
+
+        case Yearly :
+        {
+            return MONTHS_PER_YEAR;
+        }
+
+        default :
+        {
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*##################################################################################
+#   File name:          PeriodReport.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a PeriodReport
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef PERIODREPORT_H
+#define PERIODREPORT_H
+
+// Local file includes
+#include "Bill.h"
+
+// Qt includes
+#include <QDate>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+/**
+ * @brief The PeriodReport class totals the amount due, funded, and outstanding of bills for each month, quarter, or year.
+ * Bills are partitioned by the month they are due and the partitions are totalled in parallel chunks, one per core, whose results are then merged.
+ * The totals of each month are cached separately for bills still in the bill map and for archived bills. A month is only recomputed once a bill due in it changes,
+ * so after an edit only the months of the edited bills are totalled again, and archived months are totalled once. Quarters and years are merged from the cached months.
+ */
+class PeriodReport
+{
+
+public:
+
+    /**
+     * @brief The Granularity enum lists the lengths of period a report can be broken into.
+     */
+    enum Granularity
+    {
+        Monthly,
+        Quarterly,
+        Yearly
+    };
+
+    /**
+     * @brief The BillSource enum lists the sets of bills whose months are cached separately.
+     */
+    enum BillSource
+    {
+        CurrentBills,
+        ArchivedBills,
+        BillSourceCount
+    };
+
+    /**
+     * @brief The PeriodTotals struct holds the totals of one month or period, in cents.
+     */
+    struct PeriodTotals
+    {
+        qint64 dueCents = 0; //!< The total amount due of the bills.
+        qint64 fundedCents = 0; //!< The total amount due of the bills which have been funded.
+        int billCount = 0; //!< The number of bills.
+
+        /**
+         * @brief Returns the amount due which has not been funded yet.
+         * @return The outstanding amount in cents.
+         */
+        qint64 outstandingCents() const { return dueCents - fundedCents; }
+
+        /**
+         * @brief Adds another set of totals to these ones.
+         * @param p_otherTotals - The totals to add.
+         */
+        void add(const PeriodTotals &p_otherTotals);
+    };
+
+    /**
+     * @brief The PeriodRow struct holds the totals of one period of a report.
+     */
+    struct PeriodRow
+    {
+        QDate firstDate; //!< The first day of the period.
+        QDate lastDate; //!< The last day of the period.
+        PeriodTotals totals; //!< The totals of the bills due within the period.
+    };
+
+    using AmountFunction = std::function<qint64(const Bill&)>; //!< Returns a bill's amount due in cents of the currency the report is totalled in. Called from several threads at once.
+
+    /**
+     * @brief Returns the number identifying the month a date falls in, which increases by one each month.
+     * @param p_date - The date.
+     * @return The month number.
+     */
+    static int monthNumber(const QDate &p_date);
+
+    /**
+     * @brief Returns the first day of a month.
+     * @param p_monthNumber - The month number, as returned by monthNumber().
+     * @return The first day of the month.
+     */
+    static QDate firstDateOfMonth(int p_monthNumber);
+
+    /**
+     * @brief Rounds a range out to whole periods, the first day back to the start of its period and the last day forward to the end of its period.
+     * @param p_granularity - The length of each period.
+     * @param p_firstDate - The first day of the range, rounded in place.
+     * @param p_lastDate - The last day of the range, rounded in place.
+     */
+    static void roundToPeriods(Granularity p_granularity, QDate &p_firstDate, QDate &p_lastDate);
+
+    /**
+     * @brief Records a bill in the bill map. If the bill is new or any of its values changed, the month it is due in and the month it was previously due in are marked as needing to be totalled again.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_dueDate - The bill's due date.
+     * @param p_amountDueCents - The bill's amount due in cents, in the currency the report is totalled in.
+     * @param p_isFunded - Whether or not the bill has been funded.
+     */
+    void setCurrentBill(const QString &p_billKey, const QDate &p_dueDate, qint64 p_amountDueCents, bool p_isFunded);
+
+    /**
+     * @brief Forgets a bill which was removed from the bill map, marking the month it was due in as needing to be totalled again.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeCurrentBill(const QString &p_billKey);
+
+    /**
+     * @brief Marks the month a bill which was just archived is due in as needing to be totalled again for archived bills.
+     * @param p_dueDate - The archived bill's due date.
+     */
+    void addArchivedBill(const QDate &p_dueDate);
+
+    /**
+     * @brief Drops every cached month and remembered bill, needed when the bills are reloaded or the currency the report is totalled in changes.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the months within a range which have not been totalled since they last changed.
+     * @param p_billSource - The set of bills the months are cached for.
+     * @param p_firstDate - The first day of the range.
+     * @param p_lastDate - The last day of the range.
+     * @return The month numbers in increasing order.
+     */
+    QVector<int> staleMonths(BillSource p_billSource, const QDate &p_firstDate, const QDate &p_lastDate) const;
+
+    /**
+     * @brief Totals the bills due in the given months in parallel and caches the totals of each month, including months without any bills.
+     * Bills due in other months are skipped, so the caller can pass every bill without partitioning them first.
+     * @param p_billSource - The set of bills being totalled.
+     * @param p_monthNumbers - The months to total, in increasing order.
+     * @param p_bills - The bills, which must not change until this returns.
+     * @param p_amountFunction - Returns a bill's amount due in the currency the report is totalled in.
+     */
+    void totalMonths(BillSource p_billSource, const QVector<int> &p_monthNumbers, const QVector<const Bill*> &p_bills, const AmountFunction &p_amountFunction);
+
+    /**
+     * @brief Merges the cached months of every bill source into periods. Months which have not been totalled count as having no bills.
+     * @param p_firstDate - The first day of the report, rounded back to the start of its period.
+     * @param p_lastDate - The last day of the report, rounded forward to the end of its period.
+     * @param p_granularity - The length of each period.
+     * @return The periods in increasing order.
+     */
+    QVector<PeriodRow> periods(const QDate &p_firstDate, const QDate &p_lastDate, Granularity p_granularity) const;
+
+private:
+
+    /**
+     * @brief The CurrentBillValues struct holds the values a bill in the bill map was last recorded with, so saving an unchanged bill does not mark its month as changed.
+     */
+    struct CurrentBillValues
+    {
+        int dueMonth = 0; //!< The month the bill is due in.
+        qint64 amountDueCents = 0; //!< The bill's amount due in cents.
+        bool isFunded = false; //!< Whether or not the bill has been funded.
+    };
+
+    /**
+     * @brief Returns the number of months in a period of the given granularity.
+     * @param p_granularity - The length of the period.
+     * @return The number of months.
+     */
+    static int monthsPerPeriod(Granularity p_granularity);
+
+    const int m_MIN_BILLS_PER_CHUNK = 20000; //!< Fewer bills than this are totalled on the calling thread, since starting workers would cost more than it saves.
+
+    QHash<int, PeriodTotals> m_totalsByMonth[BillSourceCount]; //!< The cached totals of each month, per bill source. A month missing from the cache needs to be totalled.
+    QHash<QString, CurrentBillValues> m_valuesByCurrentBillKey; //!< The values of each bill in the bill map, so its month can be recomputed once the bill changes, moves, or is removed.
+
+};
+
+#endif // PERIODREPORT_H
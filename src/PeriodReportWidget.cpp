@@ -0,0 +1,181 @@
+/*##################################################################################
+#   File name:          PeriodReportWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a PeriodReportWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "PeriodReportWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+PeriodReportWidget::PeriodReportWidget()
+{
+    // Set the title and size of the PeriodReportWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(500, 400);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When either end of the range or the period length changes, ask for the report to be recomputed
+    connect(m_fromDateInput, SIGNAL(dateChanged(QDate)), this, SIGNAL(reportRequested()), Qt::AutoConnection);
+    connect(m_toDateInput, SIGNAL(dateChanged(QDate)), this, SIGNAL(reportRequested()), Qt::AutoConnection);
+    connect(m_granularityInput, SIGNAL(currentIndexChanged(int)), this, SIGNAL(reportRequested()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the PeriodReportWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+PeriodReportWidget::~PeriodReportWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_fromDateLabel);
+    deleteLabelIfNonNull(m_toDateLabel);
+    deleteLabelIfNonNull(m_granularityLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the start of range date edit was created successfully
+    if(m_fromDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_fromDateInput;
+        m_fromDateInput = nullptr;
+    }
+
+    // If the end of range date edit was created successfully
+    if(m_toDateInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_toDateInput;
+        m_toDateInput = nullptr;
+    }
+
+    // If the period length combo box was created successfully
+    if(m_granularityInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_granularityInput;
+        m_granularityInput = nullptr;
+    }
+
+    // If the report table widget was created successfully
+    if(m_reportTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_reportTableWidget;
+        m_reportTableWidget = nullptr;
+    }
+}
+
+QDate PeriodReportWidget::getFirstDate() const
+{
+    return m_fromDateInput->date();
+}
+
+QDate PeriodReportWidget::getLastDate() const
+{
+    return m_toDateInput->date();
+}
+
+PeriodReport::Granularity PeriodReportWidget::getGranularity() const
+{
+    return static_cast<PeriodReport::Granularity>(m_granularityInput->currentIndex());
+}
+
+void PeriodReportWidget::initializeWidget()
+{
+    // Create the range date labels and associated date edits, covering the past and coming year by default
+    m_fromDateLabel = new QLabel(this);
+    m_fromDateLabel->setText(m_FROM_DATE_LABEL_TEXT);
+    m_fromDateInput = new QDateEdit(this);
+    m_fromDateInput->setCalendarPopup(true);
+    m_fromDateInput->setDate(QDate::currentDate().addMonths(-m_DEFAULT_RANGE_MONTHS));
+
+    m_toDateLabel = new QLabel(this);
+    m_toDateLabel->setText(m_TO_DATE_LABEL_TEXT);
+    m_toDateInput = new QDateEdit(this);
+    m_toDateInput->setCalendarPopup(true);
+    m_toDateInput->setDate(QDate::currentDate().addMonths(m_DEFAULT_RANGE_MONTHS));
+
+    // Create the period length label and combo box, monthly by default
+    m_granularityLabel = new QLabel(this);
+    m_granularityLabel->setText(m_GRANULARITY_LABEL_TEXT);
+    m_granularityInput = new QComboBox(this);
+    m_granularityInput->addItems(m_GRANULARITY_STRING.split(";"));
+
+    // Create the summary label
+    m_summaryLabel = new QLabel(this);
+
+    // Create the read-only report table
+    m_reportTableWidget = new QTableWidget(this);
+    m_reportTableWidget->setColumnCount(m_REPORT_TABLE_HEADER_STRING.split(";").size());
+    m_reportTableWidget->setHorizontalHeaderLabels(m_REPORT_TABLE_HEADER_STRING.split(";"));
+    m_reportTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_reportTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the Close button
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_fromDateLabel, 0, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_fromDateInput, 0, 1);
+    m_gridLayout->addWidget(m_toDateLabel, 0, 2);
+    m_gridLayout->addWidget(m_toDateInput, 0, 3);
+    m_gridLayout->addWidget(m_granularityLabel, 1, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_granularityInput, 1, 1);
+    m_gridLayout->addWidget(m_summaryLabel, 2, 0, 1, 4);
+    m_gridLayout->addWidget(m_reportTableWidget, 3, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 4, 3);
+}
+
+void PeriodReportWidget::setReport(const QVector<PeriodReport::PeriodRow> &p_periodRows, const QString &p_currencyCode, int p_recomputedMonthCount)
+{
+    m_reportTableWidget->setRowCount(p_periodRows.size());
+    PeriodReport::PeriodTotals reportTotals;
+
+    // List each period in date order
+    for(int row = 0; row < p_periodRows.size(); row++)
+    {
+        const PeriodReport::PeriodRow &periodRow = p_periodRows.at(row);
+
+        m_reportTableWidget->setItem(row, 0, new QTableWidgetItem(periodName(periodRow)));
+        m_reportTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(periodRow.totals.dueCents / 100.0, 'f', 2)));
+        m_reportTableWidget->setItem(row, 2, new QTableWidgetItem(QString::number(periodRow.totals.fundedCents / 100.0, 'f', 2)));
+        m_reportTableWidget->setItem(row, 3, new QTableWidgetItem(QString::number(periodRow.totals.outstandingCents() / 100.0, 'f', 2)));
+        m_reportTableWidget->setItem(row, 4, new QTableWidgetItem(QString::number(periodRow.totals.billCount)));
+        reportTotals.add(periodRow.totals);
+    }
+
+    // Summarize the whole report, noting how many months were not already cached
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(reportTotals.billCount).arg(QString::number(reportTotals.dueCents / 100.0, 'f', 2))
+                            .arg(QString::number(reportTotals.fundedCents / 100.0, 'f', 2)).arg(QString::number(reportTotals.outstandingCents() / 100.0, 'f', 2)).arg(p_currencyCode));
+    m_summaryLabel->setToolTip(m_RECOMPUTED_TOOLTIP_TEXT.arg(p_recomputedMonthCount));
+}
+
+QString PeriodReportWidget::periodName(const PeriodReport::PeriodRow &p_periodRow) const
+{
+    switch(getGranularity())
+    {
+        case PeriodReport::Quarterly :
+        {
+            return m_QUARTER_STRING_FORMAT.arg((p_periodRow.firstDate.month() - 1) / 3 + 1).arg(p_periodRow.firstDate.year());
+        }
+
+        case PeriodReport::Yearly :
+        {
+            return p_periodRow.firstDate.toString(m_YEAR_STRING_FORMAT);
+        }
+
+        default :
+        {
+            return p_periodRow.firstDate.toString(m_MONTH_STRING_FORMAT);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/*##################################################################################
+#   File name:          PeriodReportWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a PeriodReportWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef PERIODREPORTWIDGET_H
+#define PERIODREPORTWIDGET_H
+
+// Local file includes
+#include "PeriodReport.h"
+
+// Qt includes
+#include <QComboBox>
+#include <QDateEdit>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The PeriodReportWidget class represents a pop-up window showing the amount due, funded, and outstanding of the bills due in each month, quarter, or year of a chosen range.
+ * The report itself is computed by the MainWindow, which is asked to do so whenever the range or period length changes.
+ */
+class PeriodReportWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget for displaying periodic reports.
+     */
+    PeriodReportWidget();
+
+    /**
+     * @brief Destructs the PeriodReportWidget by deleting objects which were dynamically allocated.
+     */
+    ~PeriodReportWidget();
+
+    /**
+     * @brief Returns the first day of the selected range.
+     * @return The first date.
+     */
+    QDate getFirstDate() const;
+
+    /**
+     * @brief Returns the last day of the selected range.
+     * @return The last date.
+     */
+    QDate getLastDate() const;
+
+    /**
+     * @brief Returns the selected length of each period.
+     * @return The period granularity.
+     */
+    PeriodReport::Granularity getGranularity() const;
+
+    /**
+     * @brief Lists the periods of a report and summarizes them.
+     * @param p_periodRows - The periods of the report.
+     * @param p_currencyCode - The currency the report is totalled in.
+     * @param p_recomputedMonthCount - The number of months which had to be totalled again rather than read from the cache.
+     */
+    void setReport(const QVector<PeriodReport::PeriodRow> &p_periodRows, const QString &p_currencyCode, int p_recomputedMonthCount);
+
+signals:
+
+    /**
+     * @brief Emitted when the range or period length changes, so the report can be recomputed.
+     */
+    void reportRequested();
+
+private:
+
+    /**
+     * @brief Creates the labels, date edits, combo box, table, and button of the PeriodReportWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Returns the name of a period as shown in the report, such as "Mar 2026", "Q1 2026", or "2026".
+     * @param p_periodRow - The period.
+     * @return The name of the period.
+     */
+    QString periodName(const PeriodReport::PeriodRow &p_periodRow) const;
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Periodic Report"; //!< Title of the PeriodReportWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the PeriodReportWidget.
+
+    // Date range fields
+    QLabel *m_fromDateLabel = nullptr; //!< Label for the date edit used for choosing the start of the range.
+    const QString m_FROM_DATE_LABEL_TEXT = "Due From:"; //!< Text for the label for the start of the range.
+    QDateEdit *m_fromDateInput = nullptr; //!< The date edit used for choosing the start of the range.
+    QLabel *m_toDateLabel = nullptr; //!< Label for the date edit used for choosing the end of the range.
+    const QString m_TO_DATE_LABEL_TEXT = "Due To:"; //!< Text for the label for the end of the range.
+    QDateEdit *m_toDateInput = nullptr; //!< The date edit used for choosing the end of the range.
+    const int m_DEFAULT_RANGE_MONTHS = 12; //!< How many months before and after the current date the range covers when the widget is first shown.
+
+    // Granularity fields
+    QLabel *m_granularityLabel = nullptr; //!< Label for the combo box used for choosing the length of each period.
+    const QString m_GRANULARITY_LABEL_TEXT = "Period:"; //!< Text for the label for the period length.
+    QComboBox *m_granularityInput = nullptr; //!< The combo box used for choosing the length of each period.
+    const QString m_GRANULARITY_STRING = "Monthly;Quarterly;Yearly"; //!< The period lengths in the order of PeriodReport::Granularity, separated by semicolons.
+
+    // Summary fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the whole report.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 bills totalling %2 due, %3 funded, and %4 outstanding (%5)"; //!< Text of the summary label.
+    const QString m_RECOMPUTED_TOOLTIP_TEXT = "Months recomputed for this report: %1, the rest were cached"; //!< Tooltip of the summary label, noting how much of the report had to be totalled again.
+
+    // Report table fields
+    QTableWidget *m_reportTableWidget = nullptr; //!< Table listing the totals of each period.
+    const QString m_REPORT_TABLE_HEADER_STRING = "Period;Due;Funded;Outstanding;Bills"; //!< The report table column titles, separated by semicolons.
+    const QString m_MONTH_STRING_FORMAT = "MMM yyyy"; //!< The format used to name monthly periods.
+    const QString m_QUARTER_STRING_FORMAT = "Q%1 %2"; //!< The format used to name quarterly periods, from the quarter and year.
+    const QString m_YEAR_STRING_FORMAT = "yyyy"; //!< The format used to name yearly periods.
+
+    // Button and button text variables
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the PeriodReportWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // PERIODREPORTWIDGET_H
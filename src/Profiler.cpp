@@ -0,0 +1,220 @@
+/*##################################################################################
+#   File name:          Profiler.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a Profiler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "Profiler.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <QVector>
+
+#include <atomic>
+
+namespace
+{
+    /**
+     * @brief The PhaseTotals struct holds the totals of every run of one phase.
+     */
+    struct PhaseTotals
+    {
+        const char *phaseName = nullptr; //!< The name of the phase.
+        quint64 callCount = 0; //!< The number of runs.
+        qint64 wallNsecs = 0; //!< The total wall time of the runs in nanoseconds.
+        quint64 allocationCount = 0; //!< The total number of allocations made during the runs.
+        quint64 allocatedBytes = 0; //!< The total number of bytes allocated during the runs.
+    };
+
+    // The counters are constant initialized, so allocations made before main() are safe to count
+    std::atomic<bool> isProfilingEnabled(false); //!< Whether or not allocations are counted and phases recorded.
+    std::atomic<quint64> allocationCount(0); //!< The number of allocations made while profiling was enabled.
+    std::atomic<quint64> allocatedBytes(0); //!< The number of bytes allocated while profiling was enabled.
+
+    const QString REPORT_ROW_TEXT = "%1 %2 %3 %4 %5"; //!< Format of a row of the printed report, given the phase, calls, wall time, allocations, and bytes.
+    const int PHASE_COLUMN_WIDTH = -24; //!< Width of the phase column of the printed report, negative to align it left.
+    const int NUMBER_COLUMN_WIDTH = 14; //!< Width of the numeric columns of the printed report.
+
+    /**
+     * @brief Returns the mutex guarding the phase totals, created on first use so it exists whenever a phase ends.
+     * @return The mutex.
+     */
+    QMutex& phaseMutex()
+    {
+        static QMutex mutex;
+        return mutex;
+    }
+
+    /**
+     * @brief Returns the totals of every phase in the order they first ran, created on first use.
+     * @return The phase totals.
+     */
+    QVector<PhaseTotals>& phaseTotals()
+    {
+        static QVector<PhaseTotals> totals;
+        return totals;
+    }
+
+    /**
+     * @brief Returns the timer measuring the total wall time since profiling was enabled.
+     * @return The timer.
+     */
+    QElapsedTimer& profileTimer()
+    {
+        static QElapsedTimer timer;
+        return timer;
+    }
+}
+
+Profiler::Scope::Scope(const char *p_phaseName)
+{
+    if(!Profiler::isEnabled())
+    {
+        return;
+    }
+
+    m_phaseName = p_phaseName;
+    m_startAllocationCount = allocationCount.load(std::memory_order_relaxed);
+    m_startAllocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+    m_timer.start();
+}
+
+Profiler::Scope::~Scope()
+{
+    stop();
+}
+
+void Profiler::Scope::stop()
+{
+    if(m_phaseName == nullptr)
+    {
+        return;
+    }
+
+    qint64 wallNsecs = m_timer.nsecsElapsed();
+    quint64 runAllocationCount = allocationCount.load(std::memory_order_relaxed) - m_startAllocationCount;
+    quint64 runAllocatedBytes = allocatedBytes.load(std::memory_order_relaxed) - m_startAllocatedBytes;
+
+    // Phases are few, so they are found by a linear search of the names, compared by address first since callers pass literals
+    QMutexLocker phaseLocker(&phaseMutex());
+    QVector<PhaseTotals> &totals = phaseTotals();
+    int phaseIndex = 0;
+
+    while(phaseIndex < totals.size() && totals.at(phaseIndex).phaseName != m_phaseName && qstrcmp(totals.at(phaseIndex).phaseName, m_phaseName) != 0)
+    {
+        phaseIndex++;
+    }
+
+    if(phaseIndex == totals.size())
+    {
+        PhaseTotals newPhase;
+        newPhase.phaseName = m_phaseName;
+        totals.append(newPhase);
+    }
+
+    PhaseTotals &phase = totals[phaseIndex];
+    phase.callCount++;
+    phase.wallNsecs += wallNsecs;
+    phase.allocationCount += runAllocationCount;
+    phase.allocatedBytes += runAllocatedBytes;
+
+    // Only record the run once
+    m_phaseName = nullptr;
+}
+
+void Profiler::setEnabled(bool p_isEnabled)
+{
+    if(p_isEnabled)
+    {
+        profileTimer().start();
+    }
+
+    isProfilingEnabled.store(p_isEnabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled()
+{
+    return isProfilingEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::countAllocation(size_t p_byteCount)
+{
+    if(isProfilingEnabled.load(std::memory_order_relaxed))
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(p_byteCount, std::memory_order_relaxed);
+    }
+}
+
+quint64 Profiler::getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+quint64 Profiler::getAllocatedBytes()
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+bool Profiler::writeReport(const QString &p_reportFilePath)
+{
+    // Stop counting so the report's own allocations are left out
+    qint64 totalWallNsecs = profileTimer().isValid() ? profileTimer().nsecsElapsed() : 0;
+    isProfilingEnabled.store(false, std::memory_order_relaxed);
+
+    QVector<PhaseTotals> totals;
+    {
+        QMutexLocker phaseLocker(&phaseMutex());
+        totals = phaseTotals();
+    }
+
+    QTextStream reportStream(stdout);
+    QJsonArray phaseArray;
+
+    // Print a row per phase, in the order the phases first ran
+    reportStream << REPORT_ROW_TEXT.arg("Phase", PHASE_COLUMN_WIDTH).arg("Calls", NUMBER_COLUMN_WIDTH).arg("Wall ms", NUMBER_COLUMN_WIDTH).arg("Allocations", NUMBER_COLUMN_WIDTH)
+                    .arg("Bytes", NUMBER_COLUMN_WIDTH) << "\n";
+
+    for(const PhaseTotals &phase : totals)
+    {
+        reportStream << REPORT_ROW_TEXT.arg(QString::fromLatin1(phase.phaseName), PHASE_COLUMN_WIDTH).arg(phase.callCount, NUMBER_COLUMN_WIDTH)
+                        .arg(QString::number(phase.wallNsecs / 1000000.0, 'f', 2), NUMBER_COLUMN_WIDTH).arg(phase.allocationCount, NUMBER_COLUMN_WIDTH)
+                        .arg(phase.allocatedBytes, NUMBER_COLUMN_WIDTH) << "\n";
+
+        QJsonObject phaseObject;
+        phaseObject.insert("name", QString::fromLatin1(phase.phaseName));
+        phaseObject.insert("calls", static_cast<double>(phase.callCount));
+        phaseObject.insert("wallMsecs", phase.wallNsecs / 1000000.0);
+        phaseObject.insert("allocations", static_cast<double>(phase.allocationCount));
+        phaseObject.insert("bytes", static_cast<double>(phase.allocatedBytes));
+        phaseArray.append(phaseObject);
+    }
+
+    // Finish with the totals of the whole run, which include allocations made outside any phase
+    reportStream << REPORT_ROW_TEXT.arg("Total", PHASE_COLUMN_WIDTH).arg(QString(), NUMBER_COLUMN_WIDTH).arg(QString::number(totalWallNsecs / 1000000.0, 'f', 2), NUMBER_COLUMN_WIDTH)
+                    .arg(allocationCount.load(std::memory_order_relaxed), NUMBER_COLUMN_WIDTH).arg(allocatedBytes.load(std::memory_order_relaxed), NUMBER_COLUMN_WIDTH) << "\n";
+    reportStream.flush();
+
+    QJsonObject reportObject;
+    reportObject.insert("phases", phaseArray);
+    reportObject.insert("wallMsecs", totalWallNsecs / 1000000.0);
+    reportObject.insert("allocations", static_cast<double>(allocationCount.load(std::memory_order_relaxed)));
+    reportObject.insert("bytes", static_cast<double>(allocatedBytes.load(std::memory_order_relaxed)));
+
+    QFile reportFile(p_reportFilePath);
+
+    if(!reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    return reportFile.write(QJsonDocument(reportObject).toJson()) >= 0;
+}
@@ -0,0 +1,103 @@
+/*##################################################################################
+#   File name:          Profiler.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a Profiler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Qt includes
+#include <QElapsedTimer>
+#include <QString>
+
+/**
+ * @brief The Profiler class measures the wall time and heap allocations of the application's phases when it is launched with --profile.
+ * Allocations are counted by the global operator new replacements in ProfilerAllocator.cpp, aligned forms included, which only count while profiling is enabled.
+ * That file is built into the PersonalFinanceTool and the LoadBenchmark alone, so programs which only link the PersonalFinanceCore, such as pft, keep the standard operator new and count nothing.
+ * Memory allocated with malloc rather than new is not counted, which includes the buffers Qt allocates for QString, QByteArray, and its containers, so phases which mostly build strings and lists report fewer bytes than they use.
+ * The counters are shared by every thread, so a phase also counts allocations other threads make while it runs, such as the worker threads of a parallel phase.
+ * On Linux and macOS allocations made inside the Qt libraries are counted too, while on Windows each DLL has its own operator new so only the application's own allocations are.
+ */
+class Profiler
+{
+
+public:
+
+    /**
+     * @brief The Scope class measures one run of a phase, from its construction until it is destroyed. It does nothing if profiling is disabled.
+     */
+    class Scope
+    {
+
+    public:
+
+        /**
+         * @brief Starts measuring a run of a phase.
+         * @param p_phaseName - The name of the phase, which must outlive the application.
+         */
+        explicit Scope(const char *p_phaseName);
+
+        /**
+         * @brief Stops measuring the run and adds it to the phase's totals.
+         */
+        ~Scope();
+
+        /**
+         * @brief Stops measuring the run before the scope is destroyed, for phases which end partway through a block. Does nothing if the run already stopped.
+         */
+        void stop();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+
+        const char *m_phaseName = nullptr; //!< The name of the phase, null if profiling was disabled when the run started.
+        QElapsedTimer m_timer; //!< Measures the wall time of the run.
+        quint64 m_startAllocationCount = 0; //!< The number of allocations made before the run started.
+        quint64 m_startAllocatedBytes = 0; //!< The number of bytes allocated before the run started.
+    };
+
+    /**
+     * @brief Starts or stops counting allocations and recording phases. Enabling it also restarts the total wall time.
+     * @param p_isEnabled - Whether or not profiling should be enabled.
+     */
+    static void setEnabled(bool p_isEnabled);
+
+    /**
+     * @brief Returns whether profiling is enabled.
+     * @return True if phases and allocations are being recorded.
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Counts an allocation, called by the global operator new replacements.
+     * @param p_byteCount - The number of bytes requested.
+     */
+    static void countAllocation(size_t p_byteCount);
+
+    /**
+     * @brief Returns the number of allocations counted since the application started, only counting while profiling is enabled.
+     * @return The number of allocations.
+     */
+    static quint64 getAllocationCount();
+
+    /**
+     * @brief Returns the number of bytes allocated since the application started, only counting while profiling is enabled.
+     * @return The number of bytes.
+     */
+    static quint64 getAllocatedBytes();
+
+    /**
+     * @brief Prints a table of every phase's calls, wall time, allocations, and bytes to standard output and writes the same figures to a JSON file.
+     * @param p_reportFilePath - The path of the JSON file.
+     * @return False if the JSON file could not be written.
+     */
+    static bool writeReport(const QString &p_reportFilePath);
+};
+
+#endif // PROFILER_H
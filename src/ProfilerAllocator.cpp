@@ -0,0 +1,183 @@
+/*##################################################################################
+#   File name:          ProfilerAllocator.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for the Profiler's operator new replacements, built only into programs which profile
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef Q_OS_WIN
+#include <malloc.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief Allocates memory for the operator new replacements, counting it if profiling is enabled.
+     * @param p_byteCount - The number of bytes requested.
+     * @return The memory, or null if it could not be allocated.
+     */
+    void* countedAllocate(size_t p_byteCount)
+    {
+        Profiler::countAllocation(p_byteCount);
+
+        // Zero byte requests must still return a unique pointer
+        return std::malloc(p_byteCount == 0 ? 1 : p_byteCount);
+    }
+
+    /**
+     * @brief Allocates memory with an alignment for the aligned operator new replacements, counting it if profiling is enabled.
+     * @param p_byteCount - The number of bytes requested.
+     * @param p_alignment - The alignment requested, a power of two.
+     * @return The memory, which must be freed by alignedFree(), or null if it could not be allocated.
+     */
+    void* countedAlignedAllocate(size_t p_byteCount, std::align_val_t p_alignment)
+    {
+        Profiler::countAllocation(p_byteCount);
+        size_t alignment = std::max(static_cast<size_t>(p_alignment), sizeof(void*));
+
+#ifdef Q_OS_WIN
+        // Windows has no aligned malloc which free() can release, so it is paired with _aligned_free()
+        return _aligned_malloc(p_byteCount == 0 ? 1 : p_byteCount, alignment);
+#else
+        void *memory = nullptr;
+        return posix_memalign(&memory, alignment, p_byteCount == 0 ? 1 : p_byteCount) == 0 ? memory : nullptr;
+#endif
+    }
+
+    /**
+     * @brief Frees memory allocated by countedAlignedAllocate().
+     * @param p_memory - The memory, which may be null.
+     */
+    void alignedFree(void *p_memory)
+    {
+#ifdef Q_OS_WIN
+        _aligned_free(p_memory);
+#else
+        std::free(p_memory);
+#endif
+    }
+}
+
+// Replace the global allocation functions so every allocation made through new is counted while profiling, only in the programs built with this file rather than every user of the PersonalFinanceCore
+void* operator new(size_t p_byteCount)
+{
+    void *memory = countedAllocate(p_byteCount);
+
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](size_t p_byteCount)
+{
+    return operator new(p_byteCount);
+}
+
+void* operator new(size_t p_byteCount, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(p_byteCount);
+}
+
+void* operator new[](size_t p_byteCount, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(p_byteCount);
+}
+
+void operator delete(void *p_memory) noexcept
+{
+    std::free(p_memory);
+}
+
+void operator delete[](void *p_memory) noexcept
+{
+    std::free(p_memory);
+}
+
+void operator delete(void *p_memory, size_t) noexcept
+{
+    std::free(p_memory);
+}
+
+void operator delete[](void *p_memory, size_t) noexcept
+{
+    std::free(p_memory);
+}
+
+void operator delete(void *p_memory, const std::nothrow_t&) noexcept
+{
+    std::free(p_memory);
+}
+
+void operator delete[](void *p_memory, const std::nothrow_t&) noexcept
+{
+    std::free(p_memory);
+}
+
+// Types aligned beyond what malloc guarantees are allocated through the aligned forms, which are replaced too so they are counted and freed consistently
+void* operator new(size_t p_byteCount, std::align_val_t p_alignment)
+{
+    void *memory = countedAlignedAllocate(p_byteCount, p_alignment);
+
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](size_t p_byteCount, std::align_val_t p_alignment)
+{
+    return operator new(p_byteCount, p_alignment);
+}
+
+void* operator new(size_t p_byteCount, std::align_val_t p_alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlignedAllocate(p_byteCount, p_alignment);
+}
+
+void* operator new[](size_t p_byteCount, std::align_val_t p_alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlignedAllocate(p_byteCount, p_alignment);
+}
+
+void operator delete(void *p_memory, std::align_val_t) noexcept
+{
+    alignedFree(p_memory);
+}
+
+void operator delete[](void *p_memory, std::align_val_t) noexcept
+{
+    alignedFree(p_memory);
+}
+
+void operator delete(void *p_memory, size_t, std::align_val_t) noexcept
+{
+    alignedFree(p_memory);
+}
+
+void operator delete[](void *p_memory, size_t, std::align_val_t) noexcept
+{
+    alignedFree(p_memory);
+}
+
+void operator delete(void *p_memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    alignedFree(p_memory);
+}
+
+void operator delete[](void *p_memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    alignedFree(p_memory);
+}
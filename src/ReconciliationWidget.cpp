@@ -0,0 +1,240 @@
+/*##################################################################################
+#   File name:          ReconciliationWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a ReconciliationWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ReconciliationWidget.h"
+#include "BillWidget.h"
+
+#include <QFileDialog>
+#include <QHeaderView>
+
+ReconciliationWidget::ReconciliationWidget()
+{
+    // Set the title and size of the ReconciliationWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(650, 450);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When the Open Statement button is clicked, ask for a statement file
+    connect(m_openButton, SIGNAL(clicked()), this, SLOT(chooseStatement()), Qt::AutoConnection);
+
+    // When the date window or name similarity changes, ask for the statement to be matched again
+    connect(m_dateWindowInput, SIGNAL(valueChanged(int)), this, SIGNAL(reconcileRequested()), Qt::AutoConnection);
+    connect(m_nameScoreInput, SIGNAL(valueChanged(int)), this, SIGNAL(reconcileRequested()), Qt::AutoConnection);
+
+    // When the Apply Matches button is clicked, ask for the matched bills to be marked
+    connect(m_applyButton, SIGNAL(clicked()), this, SIGNAL(applyRequested()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the ReconciliationWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+ReconciliationWidget::~ReconciliationWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_dateWindowLabel);
+    deleteLabelIfNonNull(m_nameScoreLabel);
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteButtonIfNonNull(m_openButton);
+    deleteButtonIfNonNull(m_applyButton);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the date window spin box was created successfully
+    if(m_dateWindowInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_dateWindowInput;
+        m_dateWindowInput = nullptr;
+    }
+
+    // If the name similarity spin box was created successfully
+    if(m_nameScoreInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_nameScoreInput;
+        m_nameScoreInput = nullptr;
+    }
+
+    // If the archive check box was created successfully
+    if(m_archiveMatchedInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_archiveMatchedInput;
+        m_archiveMatchedInput = nullptr;
+    }
+
+    // If the result tab widget was created successfully
+    if(m_resultTabWidget != nullptr)
+    {
+        // Delete it along with the result tables it holds, and set them all to be null
+        delete m_resultTabWidget;
+        m_resultTabWidget = nullptr;
+        m_matchTableWidget = nullptr;
+        m_unmatchedTransactionTableWidget = nullptr;
+        m_unmatchedBillTableWidget = nullptr;
+    }
+}
+
+int ReconciliationWidget::getDateWindowDays() const
+{
+    return m_dateWindowInput->value();
+}
+
+int ReconciliationWidget::getMinimumNameScore() const
+{
+    return m_nameScoreInput->value();
+}
+
+bool ReconciliationWidget::isArchiveMatchedChecked() const
+{
+    return m_archiveMatchedInput->isChecked();
+}
+
+void ReconciliationWidget::initializeWidget()
+{
+    // Create the matching settings labels and associated spin boxes
+    m_dateWindowLabel = new QLabel(this);
+    m_dateWindowLabel->setText(m_DATE_WINDOW_LABEL_TEXT);
+    m_dateWindowInput = new QSpinBox(this);
+    m_dateWindowInput->setRange(0, m_MAX_DATE_WINDOW_DAYS);
+    m_dateWindowInput->setValue(m_DEFAULT_DATE_WINDOW_DAYS);
+
+    m_nameScoreLabel = new QLabel(this);
+    m_nameScoreLabel->setText(m_NAME_SCORE_LABEL_TEXT);
+    m_nameScoreInput = new QSpinBox(this);
+    m_nameScoreInput->setRange(0, 100);
+    m_nameScoreInput->setValue(m_DEFAULT_NAME_SCORE);
+
+    // Create the archive check box, matched bills are archived as paid by default
+    m_archiveMatchedInput = new QCheckBox(this);
+    m_archiveMatchedInput->setText(m_ARCHIVE_MATCHED_TEXT);
+    m_archiveMatchedInput->setChecked(true);
+
+    // Create the summary label
+    m_summaryLabel = new QLabel(this);
+    m_summaryLabel->setText(m_NO_STATEMENT_TEXT);
+
+    // Create the result tables, each on its own tab
+    m_matchTableWidget = createTable(m_MATCH_TABLE_HEADER_STRING);
+    m_unmatchedTransactionTableWidget = createTable(m_UNMATCHED_TRANSACTION_TABLE_HEADER_STRING);
+    m_unmatchedBillTableWidget = createTable(m_UNMATCHED_BILL_TABLE_HEADER_STRING);
+
+    m_resultTabWidget = new QTabWidget(this);
+    m_resultTabWidget->addTab(m_matchTableWidget, m_MATCH_TAB_TEXT);
+    m_resultTabWidget->addTab(m_unmatchedTransactionTableWidget, m_UNMATCHED_TRANSACTION_TAB_TEXT);
+    m_resultTabWidget->addTab(m_unmatchedBillTableWidget, m_UNMATCHED_BILL_TAB_TEXT);
+
+    // Create the buttons, nothing can be applied until a statement has been matched
+    m_openButton = new QPushButton(this);
+    m_openButton->setText(m_OPEN_BUTTON_TEXT);
+    m_applyButton = new QPushButton(this);
+    m_applyButton->setText(m_APPLY_BUTTON_TEXT);
+    m_applyButton->setEnabled(false);
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_openButton, 0, 0);
+    m_gridLayout->addWidget(m_archiveMatchedInput, 0, 1, 1, 3);
+    m_gridLayout->addWidget(m_dateWindowLabel, 1, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_dateWindowInput, 1, 1);
+    m_gridLayout->addWidget(m_nameScoreLabel, 1, 2);
+    m_gridLayout->addWidget(m_nameScoreInput, 1, 3);
+    m_gridLayout->addWidget(m_summaryLabel, 2, 0, 1, 4);
+    m_gridLayout->addWidget(m_resultTabWidget, 3, 0, 1, 4);
+    m_gridLayout->addWidget(m_applyButton, 4, 2);
+    m_gridLayout->addWidget(m_closeButton, 4, 3);
+}
+
+QTableWidget* ReconciliationWidget::createTable(const QString &p_headerString)
+{
+    QTableWidget *tableWidget = new QTableWidget(this);
+    tableWidget->setColumnCount(p_headerString.split(";").size());
+    tableWidget->setHorizontalHeaderLabels(p_headerString.split(";"));
+    tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    tableWidget->horizontalHeader()->setStretchLastSection(true);
+    return tableWidget;
+}
+
+void ReconciliationWidget::chooseStatement()
+{
+    QString filePath = QFileDialog::getOpenFileName(this, m_OPEN_BUTTON_TEXT, QString(), m_OPEN_DIALOG_FILTER);
+
+    if(!filePath.isEmpty())
+    {
+        emit statementChosen(filePath);
+    }
+}
+
+void ReconciliationWidget::setResult(const QVector<StatementReconciler::StatementTransaction> &p_transactions, const QVector<StatementReconciler::ReconcileBill> &p_bills,
+                                     const StatementReconciler::Result &p_result, qint64 p_elapsedMsecs)
+{
+    // List the matched pairs, up to the display limit
+    int matchRowCount = qMin(p_result.matches.size(), m_MAX_DISPLAYED_ROWS);
+    m_matchTableWidget->setRowCount(matchRowCount);
+
+    for(int row = 0; row < matchRowCount; row++)
+    {
+        const StatementReconciler::Match &match = p_result.matches.at(row);
+        const StatementReconciler::StatementTransaction &transaction = p_transactions.at(match.transactionIndex);
+        const StatementReconciler::ReconcileBill &bill = p_bills.at(match.billIndex);
+
+        m_matchTableWidget->setItem(row, 0, new QTableWidgetItem(transaction.date.toString(m_DATE_STRING_FORMAT)));
+        m_matchTableWidget->setItem(row, 1, new QTableWidgetItem(transaction.description));
+        m_matchTableWidget->setItem(row, 2, new QTableWidgetItem(QString::number(transaction.amountCents / 100.0, 'f', 2)));
+        m_matchTableWidget->setItem(row, 3, new QTableWidgetItem(bill.name));
+        m_matchTableWidget->setItem(row, 4, new QTableWidgetItem(bill.dueDate.toString(m_DATE_STRING_FORMAT)));
+        m_matchTableWidget->setItem(row, 5, new QTableWidgetItem(QString::number(match.nameScore) + "%"));
+    }
+
+    // List the transactions which did not pay any bill
+    int transactionRowCount = qMin(p_result.unmatchedTransactionIndexes.size(), m_MAX_DISPLAYED_ROWS);
+    m_unmatchedTransactionTableWidget->setRowCount(transactionRowCount);
+
+    for(int row = 0; row < transactionRowCount; row++)
+    {
+        const StatementReconciler::StatementTransaction &transaction = p_transactions.at(p_result.unmatchedTransactionIndexes.at(row));
+
+        m_unmatchedTransactionTableWidget->setItem(row, 0, new QTableWidgetItem(transaction.date.toString(m_DATE_STRING_FORMAT)));
+        m_unmatchedTransactionTableWidget->setItem(row, 1, new QTableWidgetItem(transaction.description));
+        m_unmatchedTransactionTableWidget->setItem(row, 2, new QTableWidgetItem(QString::number(transaction.amountCents / 100.0, 'f', 2)));
+    }
+
+    // List the bills which no transaction paid
+    int billRowCount = qMin(p_result.unmatchedBillIndexes.size(), m_MAX_DISPLAYED_ROWS);
+    m_unmatchedBillTableWidget->setRowCount(billRowCount);
+
+    for(int row = 0; row < billRowCount; row++)
+    {
+        const StatementReconciler::ReconcileBill &bill = p_bills.at(p_result.unmatchedBillIndexes.at(row));
+
+        m_unmatchedBillTableWidget->setItem(row, 0, new QTableWidgetItem(bill.name));
+        m_unmatchedBillTableWidget->setItem(row, 1, new QTableWidgetItem(bill.dueDate.toString(m_DATE_STRING_FORMAT)));
+        m_unmatchedBillTableWidget->setItem(row, 2, new QTableWidgetItem(QString::number(bill.amountCents / 100.0, 'f', 2) + " " + CurrencyRegistry::codeForIndex(bill.currencyIndex)));
+    }
+
+    // Summarize the outcome, noting the display limit and how many pairs had to be compared by name
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(p_result.matches.size()).arg(p_transactions.size()).arg(p_elapsedMsecs).arg(p_result.unmatchedBillIndexes.size())
+                            .arg(p_bills.size()));
+    m_summaryLabel->setToolTip(m_TRUNCATED_TOOLTIP_TEXT.arg(m_MAX_DISPLAYED_ROWS).arg(p_result.candidateCount));
+    m_applyButton->setEnabled(!p_result.matches.isEmpty());
+}
+
+void ReconciliationWidget::setMessage(const QString &p_message)
+{
+    // Clear the previous result, so matches from another statement cannot be applied
+    m_matchTableWidget->setRowCount(0);
+    m_unmatchedTransactionTableWidget->setRowCount(0);
+    m_unmatchedBillTableWidget->setRowCount(0);
+    m_summaryLabel->setText(p_message);
+    m_summaryLabel->setToolTip(QString());
+    m_applyButton->setEnabled(false);
+}
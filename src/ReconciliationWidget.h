@@ -0,0 +1,166 @@
+/*##################################################################################
+#   File name:          ReconciliationWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a ReconciliationWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef RECONCILIATIONWIDGET_H
+#define RECONCILIATIONWIDGET_H
+
+// Local file includes
+#include "StatementReconciler.h"
+
+// Qt includes
+#include <QCheckBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTabWidget>
+#include <QTableWidget>
+
+/**
+ * @brief The ReconciliationWidget class represents a pop-up window for matching the transactions of a bank statement to bills.
+ * It lists the matched pairs along with the transactions and bills which were left unmatched. The statement is read and matched by the MainWindow,
+ * which is asked to do so whenever a statement is chosen or the matching settings change.
+ */
+class ReconciliationWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief Constructs a widget for reconciling bank statements.
+     */
+    ReconciliationWidget();
+
+    /**
+     * @brief Destructs the ReconciliationWidget by deleting objects which were dynamically allocated.
+     */
+    ~ReconciliationWidget();
+
+    /**
+     * @brief Returns the most days a transaction may be posted before or after a bill's due date to match it.
+     * @return The number of days.
+     */
+    int getDateWindowDays() const;
+
+    /**
+     * @brief Returns the lowest percentage of a bill name which must be found in a transaction's description to match it.
+     * @return The percentage.
+     */
+    int getMinimumNameScore() const;
+
+    /**
+     * @brief Returns whether or not matched bills should be moved into the bill archive as paid once they are applied.
+     * @return True if matched bills should be archived.
+     */
+    bool isArchiveMatchedChecked() const;
+
+    /**
+     * @brief Lists the outcome of reconciling a statement and summarizes it.
+     * @param p_transactions - The statement's transactions.
+     * @param p_bills - The bills the transactions were matched against.
+     * @param p_result - The matched pairs and unmatched transactions and bills.
+     * @param p_elapsedMsecs - How long matching took, in milliseconds.
+     */
+    void setResult(const QVector<StatementReconciler::StatementTransaction> &p_transactions, const QVector<StatementReconciler::ReconcileBill> &p_bills,
+                   const StatementReconciler::Result &p_result, qint64 p_elapsedMsecs);
+
+    /**
+     * @brief Clears the result and shows a message in place of the summary, such as why a statement could not be read.
+     * @param p_message - The message.
+     */
+    void setMessage(const QString &p_message);
+
+signals:
+
+    /**
+     * @brief Emitted when the user chooses a statement file to reconcile.
+     * @param p_filePath - The path of the statement file.
+     */
+    void statementChosen(const QString &p_filePath);
+
+    /**
+     * @brief Emitted when the matching settings change, so the statement can be matched again.
+     */
+    void reconcileRequested();
+
+    /**
+     * @brief Emitted when the user asks for the matched bills to be marked as funded, and archived as paid if chosen.
+     */
+    void applyRequested();
+
+private slots:
+
+    /**
+     * @brief Called when the Open Statement button is clicked. Asks the user for a CSV or OFX file and emits statementChosen() if one was chosen.
+     */
+    void chooseStatement();
+
+private:
+
+    /**
+     * @brief Creates the labels, spin boxes, check box, tables, and buttons of the ReconciliationWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Creates a read-only table with the given column titles.
+     * @param p_headerString - The column titles, separated by semicolons.
+     * @return The table.
+     */
+    QTableWidget* createTable(const QString &p_headerString);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Reconcile Statement"; //!< Title of the ReconciliationWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the ReconciliationWidget.
+
+    // Matching settings fields
+    QLabel *m_dateWindowLabel = nullptr; //!< Label for the spin box used for choosing the date window.
+    const QString m_DATE_WINDOW_LABEL_TEXT = "Date Window (days):"; //!< Text for the label for the date window.
+    QSpinBox *m_dateWindowInput = nullptr; //!< The spin box used for choosing the date window.
+    const int m_DEFAULT_DATE_WINDOW_DAYS = 5; //!< The date window used until the user changes it.
+    const int m_MAX_DATE_WINDOW_DAYS = 60; //!< The widest date window which can be chosen.
+    QLabel *m_nameScoreLabel = nullptr; //!< Label for the spin box used for choosing the minimum name similarity.
+    const QString m_NAME_SCORE_LABEL_TEXT = "Name Similarity (%):"; //!< Text for the label for the minimum name similarity.
+    QSpinBox *m_nameScoreInput = nullptr; //!< The spin box used for choosing the minimum name similarity.
+    const int m_DEFAULT_NAME_SCORE = 30; //!< The minimum name similarity used until the user changes it, low enough for the abbreviations banks use.
+    QCheckBox *m_archiveMatchedInput = nullptr; //!< Check box used for choosing whether applied matches are archived as paid.
+    const QString m_ARCHIVE_MATCHED_TEXT = "Archive matched bills as paid"; //!< Text of the archive check box.
+
+    // Summary fields
+    QLabel *m_summaryLabel = nullptr; //!< Label summarizing the outcome of matching.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 of %2 transactions matched a bill in %3 ms, %4 of %5 bills are unmatched"; //!< Text of the summary label.
+    const QString m_TRUNCATED_TOOLTIP_TEXT = "Each list shows at most %1 rows, pairs compared by name: %2"; //!< Tooltip of the summary label, noting the display limit and how much work matching did.
+    const QString m_NO_STATEMENT_TEXT = "Open a CSV or OFX statement exported from your bank"; //!< Text of the summary label before a statement is chosen.
+
+    // Result table fields
+    QTabWidget *m_resultTabWidget = nullptr; //!< Tab widget holding the result tables.
+    QTableWidget *m_matchTableWidget = nullptr; //!< Table listing the matched pairs.
+    const QString m_MATCH_TAB_TEXT = "Matched"; //!< Title of the tab of matched pairs.
+    const QString m_MATCH_TABLE_HEADER_STRING = "Posted;Description;Amount;Bill;Due Date;Similarity"; //!< The matched pairs table column titles, separated by semicolons.
+    QTableWidget *m_unmatchedTransactionTableWidget = nullptr; //!< Table listing the unmatched transactions.
+    const QString m_UNMATCHED_TRANSACTION_TAB_TEXT = "Unmatched Transactions"; //!< Title of the tab of unmatched transactions.
+    const QString m_UNMATCHED_TRANSACTION_TABLE_HEADER_STRING = "Posted;Description;Amount"; //!< The unmatched transactions table column titles, separated by semicolons.
+    QTableWidget *m_unmatchedBillTableWidget = nullptr; //!< Table listing the unmatched bills.
+    const QString m_UNMATCHED_BILL_TAB_TEXT = "Unmatched Bills"; //!< Title of the tab of unmatched bills.
+    const QString m_UNMATCHED_BILL_TABLE_HEADER_STRING = "Bill;Due Date;Amount"; //!< The unmatched bills table column titles, separated by semicolons.
+    const int m_MAX_DISPLAYED_ROWS = 5000; //!< The most rows shown in each table, since filling a table with every row of a large statement would take longer than matching it.
+    const QString m_DATE_STRING_FORMAT = "M/d/yyyy"; //!< The format used to display dates.
+
+    // Button and button text variables
+    QPushButton *m_openButton = nullptr; //!< Push button used for choosing a statement file.
+    const QString m_OPEN_BUTTON_TEXT = "Open Statement..."; //!< Text used for the Open Statement push button.
+    const QString m_OPEN_DIALOG_FILTER = "Bank statements (*.csv *.ofx *.qfx);;All files (*)"; //!< File types offered when choosing a statement.
+    QPushButton *m_applyButton = nullptr; //!< Push button used for applying the matches.
+    const QString m_APPLY_BUTTON_TEXT = "Apply Matches"; //!< Text used for the Apply Matches push button.
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the ReconciliationWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // RECONCILIATIONWIDGET_H
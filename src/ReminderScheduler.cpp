@@ -0,0 +1,196 @@
+/*##################################################################################
+#   File name:          ReminderScheduler.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a ReminderScheduler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ReminderScheduler.h"
+
+#include <algorithm>
+
+void ReminderScheduler::setLeadDays(int p_leadDays)
+{
+    m_leadDays = std::max(p_leadDays, 0);
+
+    // Every pending upcoming reminder moves, so rebuild the heap rather than pushing an entry per bill
+    compactHeap();
+}
+
+int ReminderScheduler::getLeadDays() const
+{
+    return m_leadDays;
+}
+
+qint64 ReminderScheduler::setBill(const QString &p_billKey, const QDate &p_dueDate, bool p_isFunded)
+{
+    if(!p_dueDate.isValid())
+    {
+        removeBill(p_billKey);
+        return 0;
+    }
+
+    ScheduledBill scheduledBill;
+    scheduledBill.dueDay = p_dueDate.toJulianDay();
+    scheduledBill.isFunded = p_isFunded;
+
+    QHash<QString, ScheduledBill>::const_iterator scheduledIterator = m_scheduledBillByKey.constFind(p_billKey);
+
+    if(scheduledIterator != m_scheduledBillByKey.cend())
+    {
+        // Bills whose due date and funding did not change keep their pending reminder
+        if(scheduledIterator->dueDay == scheduledBill.dueDay && scheduledIterator->isFunded == scheduledBill.isFunded)
+        {
+            qint64 fireDay = 0;
+            return nextReminder(scheduledIterator.value(), fireDay) != NoReminder ? fireDay : 0;
+        }
+
+        // Otherwise move past the pending reminder, keeping the reminders already raised unless the due date moved
+        scheduledBill.generation = scheduledIterator->generation + 1;
+        scheduledBill.raisedKind = scheduledIterator->dueDay == scheduledBill.dueDay ? scheduledIterator->raisedKind : NoReminder;
+    }
+
+    m_scheduledBillByKey.insert(p_billKey, scheduledBill);
+    return pushNextReminder(p_billKey, scheduledBill);
+}
+
+void ReminderScheduler::removeBill(const QString &p_billKey)
+{
+    // The bill's heap entry is left to be discarded once it reaches the top or the heap is compacted
+    m_scheduledBillByKey.remove(p_billKey);
+}
+
+void ReminderScheduler::clear()
+{
+    m_scheduledBillByKey.clear();
+    m_heap.clear();
+}
+
+qint64 ReminderScheduler::nextFireDay()
+{
+    // Discard stale entries until a pending reminder is on top
+    while(!m_heap.isEmpty() && !isLive(m_heap.first()))
+    {
+        std::pop_heap(m_heap.begin(), m_heap.end(), firesLater);
+        m_heap.removeLast();
+    }
+
+    return m_heap.isEmpty() ? 0 : m_heap.first().fireDay;
+}
+
+QVector<ReminderScheduler::Reminder> ReminderScheduler::takeDueReminders(const QDate &p_today)
+{
+    QVector<Reminder> dueReminders;
+    qint64 today = p_today.toJulianDay();
+
+    while(!m_heap.isEmpty() && m_heap.first().fireDay <= today)
+    {
+        std::pop_heap(m_heap.begin(), m_heap.end(), firesLater);
+        HeapEntry heapEntry = m_heap.takeLast();
+
+        if(!isLive(heapEntry))
+        {
+            continue;
+        }
+
+        // A bill only noticed once it is overdue skips straight to its overdue reminder
+        ScheduledBill &scheduledBill = m_scheduledBillByKey[heapEntry.billKey];
+        ReminderKind firedKind = (heapEntry.kind == UpcomingReminder && today > scheduledBill.dueDay) ? OverdueReminder : heapEntry.kind;
+        scheduledBill.raisedKind = firedKind;
+
+        Reminder dueReminder;
+        dueReminder.billKey = heapEntry.billKey;
+        dueReminder.kind = firedKind;
+        dueReminder.dueDate = QDate::fromJulianDay(scheduledBill.dueDay);
+        dueReminders.append(dueReminder);
+
+        // Schedule the bill's overdue reminder after its upcoming one
+        pushNextReminder(heapEntry.billKey, scheduledBill);
+    }
+
+    return dueReminders;
+}
+
+bool ReminderScheduler::firesLater(const HeapEntry &p_firstEntry, const HeapEntry &p_secondEntry)
+{
+    return p_firstEntry.fireDay > p_secondEntry.fireDay;
+}
+
+ReminderScheduler::ReminderKind ReminderScheduler::nextReminder(const ScheduledBill &p_scheduledBill, qint64 &p_fireDay) const
+{
+    // Funded bills have their money set aside, so there is nothing to remind the user of
+    if(p_scheduledBill.isFunded)
+    {
+        return NoReminder;
+    }
+
+    if(p_scheduledBill.raisedKind < UpcomingReminder)
+    {
+        p_fireDay = p_scheduledBill.dueDay - m_leadDays;
+        return UpcomingReminder;
+    }
+
+    if(p_scheduledBill.raisedKind < OverdueReminder)
+    {
+        p_fireDay = p_scheduledBill.dueDay + 1;
+        return OverdueReminder;
+    }
+
+    return NoReminder;
+}
+
+qint64 ReminderScheduler::pushNextReminder(const QString &p_billKey, const ScheduledBill &p_scheduledBill)
+{
+    HeapEntry heapEntry;
+    heapEntry.kind = nextReminder(p_scheduledBill, heapEntry.fireDay);
+
+    if(heapEntry.kind == NoReminder)
+    {
+        return 0;
+    }
+
+    // Once stale entries could outnumber pending ones, rebuild the heap, which schedules this reminder along with the rest
+    if(m_heap.size() >= m_MIN_COMPACTED_HEAP_SIZE && m_heap.size() >= 2 * m_scheduledBillByKey.size())
+    {
+        compactHeap();
+        return heapEntry.fireDay;
+    }
+
+    heapEntry.generation = p_scheduledBill.generation;
+    heapEntry.billKey = p_billKey;
+    m_heap.append(heapEntry);
+    std::push_heap(m_heap.begin(), m_heap.end(), firesLater);
+    return heapEntry.fireDay;
+}
+
+bool ReminderScheduler::isLive(const HeapEntry &p_heapEntry) const
+{
+    QHash<QString, ScheduledBill>::const_iterator scheduledIterator = m_scheduledBillByKey.constFind(p_heapEntry.billKey);
+
+    return scheduledIterator != m_scheduledBillByKey.cend() && scheduledIterator->generation == p_heapEntry.generation && !scheduledIterator->isFunded
+           && scheduledIterator->raisedKind < p_heapEntry.kind;
+}
+
+void ReminderScheduler::compactHeap()
+{
+    m_heap.clear();
+    m_heap.reserve(m_scheduledBillByKey.size());
+
+    // Collect each bill's pending reminder and heapify them at once, which is linear in the number of bills
+    for(QHash<QString, ScheduledBill>::const_iterator scheduledIterator = m_scheduledBillByKey.cbegin(); scheduledIterator != m_scheduledBillByKey.cend(); ++scheduledIterator)
+    {
+        HeapEntry heapEntry;
+        heapEntry.kind = nextReminder(scheduledIterator.value(), heapEntry.fireDay);
+
+        if(heapEntry.kind != NoReminder)
+        {
+            heapEntry.generation = scheduledIterator->generation;
+            heapEntry.billKey = scheduledIterator.key();
+            m_heap.append(heapEntry);
+        }
+    }
+
+    std::make_heap(m_heap.begin(), m_heap.end(), firesLater);
+}
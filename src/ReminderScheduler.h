@@ -0,0 +1,165 @@
+/*##################################################################################
+#   File name:          ReminderScheduler.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a ReminderScheduler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef REMINDERSCHEDULER_H
+#define REMINDERSCHEDULER_H
+
+// Qt includes
+#include <QDate>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The ReminderScheduler class decides when each unfunded bill should be brought to the user's attention, a number of days before it is due and again once it is overdue.
+ * Each bill has at most one pending reminder, kept in a min-heap ordered by the day it fires, so finding the next reminder is constant time and nothing is polled.
+ * Changing or removing a bill leaves its old heap entry in place to be discarded when it reaches the top, and the heap is rebuilt once such stale entries outnumber the live ones,
+ * so memory stays proportional to the number of bills however often they change.
+ */
+class ReminderScheduler
+{
+
+public:
+
+    /**
+     * @brief The ReminderKind enum lists the reminders a bill can raise, in the order it raises them.
+     */
+    enum ReminderKind
+    {
+        NoReminder,
+        UpcomingReminder,
+        OverdueReminder
+    };
+
+    /**
+     * @brief The Reminder struct describes a reminder which has fired.
+     */
+    struct Reminder
+    {
+        QString billKey; //!< The bill map key of the bill.
+        ReminderKind kind = NoReminder; //!< Whether the bill is coming due or overdue.
+        QDate dueDate; //!< The bill's due date.
+    };
+
+    /**
+     * @brief Sets how many days before its due date a bill raises its upcoming reminder, and reschedules every bill for it.
+     * @param p_leadDays - The number of days, zero to remind on the due date itself.
+     */
+    void setLeadDays(int p_leadDays);
+
+    /**
+     * @brief Returns how many days before its due date a bill raises its upcoming reminder.
+     * @return The number of days.
+     */
+    int getLeadDays() const;
+
+    /**
+     * @brief Schedules the next reminder of a bill, replacing any it had. Funded bills and bills without a valid due date have no reminders.
+     * Reminders a bill already raised are not raised again unless its due date changes.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_dueDate - The bill's due date.
+     * @param p_isFunded - Whether or not the bill has been funded.
+     * @return The day number the bill's next reminder fires on, or zero if it has none.
+     */
+    qint64 setBill(const QString &p_billKey, const QDate &p_dueDate, bool p_isFunded);
+
+    /**
+     * @brief Cancels the reminders of a bill, does nothing if the bill was never scheduled.
+     * @param p_billKey - The bill map key of the bill.
+     */
+    void removeBill(const QString &p_billKey);
+
+    /**
+     * @brief Cancels every reminder, needed when the bills are reloaded or reset.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the day the earliest pending reminder fires on, discarding stale entries from the top of the heap.
+     * @return The day number, or zero if no reminders are pending.
+     */
+    qint64 nextFireDay();
+
+    /**
+     * @brief Removes and returns every reminder which fires on or before a day, scheduling each bill's next reminder.
+     * A bill whose upcoming reminder fires after it is already overdue raises only its overdue reminder.
+     * @param p_today - The current date.
+     * @return The reminders in the order they fired.
+     */
+    QVector<Reminder> takeDueReminders(const QDate &p_today);
+
+private:
+
+    /**
+     * @brief The ScheduledBill struct holds what a bill's reminders were scheduled from.
+     */
+    struct ScheduledBill
+    {
+        qint64 dueDay = 0; //!< The day the bill is due, as a day number.
+        bool isFunded = false; //!< Whether or not the bill has been funded.
+        ReminderKind raisedKind = NoReminder; //!< The last reminder the bill raised.
+        quint32 generation = 0; //!< Incremented whenever the bill is rescheduled, so heap entries from earlier schedules can be recognized.
+    };
+
+    /**
+     * @brief The HeapEntry struct is a pending reminder in the heap.
+     */
+    struct HeapEntry
+    {
+        qint64 fireDay = 0; //!< The day the reminder fires on, as a day number.
+        ReminderKind kind = NoReminder; //!< The reminder which fires.
+        quint32 generation = 0; //!< The bill's generation when the reminder was scheduled.
+        QString billKey; //!< The bill map key of the bill.
+    };
+
+    /**
+     * @brief Orders heap entries so the earliest firing one is at the top of the heap.
+     * @param p_firstEntry - The first entry.
+     * @param p_secondEntry - The second entry.
+     * @return True if the first entry fires after the second.
+     */
+    static bool firesLater(const HeapEntry &p_firstEntry, const HeapEntry &p_secondEntry);
+
+    /**
+     * @brief Returns the next reminder a bill should raise and the day it fires on.
+     * @param p_scheduledBill - The bill.
+     * @param p_fireDay - Receives the day the reminder fires on.
+     * @return The reminder, NoReminder if the bill has none left to raise.
+     */
+    ReminderKind nextReminder(const ScheduledBill &p_scheduledBill, qint64 &p_fireDay) const;
+
+    /**
+     * @brief Pushes a bill's next reminder onto the heap, if it has one.
+     * @param p_billKey - The bill map key of the bill.
+     * @param p_scheduledBill - The bill.
+     * @return The day the reminder fires on, or zero if the bill has none.
+     */
+    qint64 pushNextReminder(const QString &p_billKey, const ScheduledBill &p_scheduledBill);
+
+    /**
+     * @brief Returns whether a heap entry is still the pending reminder of its bill.
+     * @param p_heapEntry - The heap entry.
+     * @return False if the bill was removed, rescheduled, or already raised the reminder since the entry was pushed.
+     */
+    bool isLive(const HeapEntry &p_heapEntry) const;
+
+    /**
+     * @brief Rebuilds the heap from the bills' pending reminders alone, used once stale entries outnumber them or the lead time changes.
+     */
+    void compactHeap();
+
+    static constexpr int m_DEFAULT_LEAD_DAYS = 3; //!< How many days before its due date a bill raises its upcoming reminder by default.
+    static constexpr int m_MIN_COMPACTED_HEAP_SIZE = 1024; //!< Heaps smaller than this are never compacted, since stale entries cost little there.
+
+    int m_leadDays = m_DEFAULT_LEAD_DAYS; //!< How many days before its due date a bill raises its upcoming reminder.
+    QHash<QString, ScheduledBill> m_scheduledBillByKey; //!< Map of (bill map key, what the bill's reminders were scheduled from).
+    QVector<HeapEntry> m_heap; //!< Min-heap of pending reminders ordered by the day they fire, possibly holding stale entries.
+};
+
+#endif // REMINDERSCHEDULER_H
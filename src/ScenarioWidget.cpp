@@ -0,0 +1,261 @@
+/*##################################################################################
+#   File name:          ScenarioWidget.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a ScenarioWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "ScenarioWidget.h"
+#include "BillWidget.h"
+
+#include <QHeaderView>
+
+#include <cmath>
+
+ScenarioWidget::ScenarioWidget()
+{
+    // Set the title and size of the ScenarioWidget
+    this->setWindowTitle(m_WINDOW_TITLE);
+    this->resize(800, 600);
+
+    // Create the widgets and organize them into a grid layout
+    initializeWidget();
+
+    // When another scenario is chosen, list its changes
+    connect(m_scenarioTableWidget, SIGNAL(itemSelectionChanged()), this, SIGNAL(scenarioChosen()), Qt::AutoConnection);
+
+    // When a scenario button is clicked, ask for the scenarios to be changed
+    connect(m_newScenarioButton, SIGNAL(clicked()), this, SIGNAL(newScenarioRequested()), Qt::AutoConnection);
+    connect(m_forkScenarioButton, SIGNAL(clicked()), this, SIGNAL(forkScenarioRequested()), Qt::AutoConnection);
+    connect(m_deleteScenarioButton, SIGNAL(clicked()), this, SIGNAL(deleteScenarioRequested()), Qt::AutoConnection);
+    connect(m_promoteScenarioButton, SIGNAL(clicked()), this, SIGNAL(promoteScenarioRequested()), Qt::AutoConnection);
+
+    // When a change button is clicked, ask for the chosen scenario to be changed
+    connect(m_fundBillsButton, SIGNAL(clicked()), this, SIGNAL(fundBillsRequested()), Qt::AutoConnection);
+    connect(m_defundBillsButton, SIGNAL(clicked()), this, SIGNAL(defundBillsRequested()), Qt::AutoConnection);
+    connect(m_removeBillsButton, SIGNAL(clicked()), this, SIGNAL(removeBillsRequested()), Qt::AutoConnection);
+    connect(m_adjustButton, SIGNAL(clicked()), this, SIGNAL(adjustAmountAvailableRequested()), Qt::AutoConnection);
+
+    // When the Close button is clicked, hide the ScenarioWidget
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(hide()), Qt::AutoConnection);
+}
+
+ScenarioWidget::~ScenarioWidget()
+{
+    // Properly delete dynamically allocated labels and buttons
+    deleteLabelIfNonNull(m_summaryLabel);
+    deleteLabelIfNonNull(m_changesLabel);
+    deleteLabelIfNonNull(m_adjustmentLabel);
+    deleteButtonIfNonNull(m_newScenarioButton);
+    deleteButtonIfNonNull(m_forkScenarioButton);
+    deleteButtonIfNonNull(m_deleteScenarioButton);
+    deleteButtonIfNonNull(m_promoteScenarioButton);
+    deleteButtonIfNonNull(m_fundBillsButton);
+    deleteButtonIfNonNull(m_defundBillsButton);
+    deleteButtonIfNonNull(m_removeBillsButton);
+    deleteButtonIfNonNull(m_adjustButton);
+    deleteButtonIfNonNull(m_closeButton);
+
+    // If the adjustment spin box was created successfully
+    if(m_adjustmentInput != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_adjustmentInput;
+        m_adjustmentInput = nullptr;
+    }
+
+    // If the scenario table widget was created successfully
+    if(m_scenarioTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_scenarioTableWidget;
+        m_scenarioTableWidget = nullptr;
+    }
+
+    // If the change table widget was created successfully
+    if(m_changeTableWidget != nullptr)
+    {
+        // Delete it and set it to be null
+        delete m_changeTableWidget;
+        m_changeTableWidget = nullptr;
+    }
+}
+
+void ScenarioWidget::setScenarios(const QVector<ScenarioRow> &p_scenarioRows, qint64 p_elapsedNsecs)
+{
+    // Refill the table without announcing each change, then announce the choice once
+    int chosenScenarioIndex = getChosenScenarioIndex();
+    m_scenarioTableWidget->blockSignals(true);
+    m_scenarioTableWidget->setRowCount(p_scenarioRows.size());
+
+    for(int row = 0; row < p_scenarioRows.size(); row++)
+    {
+        const ScenarioRow &scenarioRow = p_scenarioRows.at(row);
+        const LedgerScenario::Totals &totals = scenarioRow.totals;
+        qint64 amountAvailableCents = std::llround(totals.amountAvailable * 100.0);
+        QTableWidgetItem *leftToFundItem = new QTableWidgetItem(formatCents(totals.leftToFundCents) + (totals.missingCurrencyCodes.isEmpty() ? QString() : m_MISSING_RATES_MARKER));
+        leftToFundItem->setToolTip(totals.missingCurrencyCodes.isEmpty() ? QString() : m_MISSING_RATES_TOOLTIP_TEXT.arg(totals.missingCurrencyCodes.join(", ")));
+
+        m_scenarioTableWidget->setItem(row, 0, new QTableWidgetItem(scenarioRow.name));
+        m_scenarioTableWidget->setItem(row, 1, new QTableWidgetItem(QString::number(totals.changeCount)));
+        m_scenarioTableWidget->setItem(row, 2, new QTableWidgetItem(formatCents(amountAvailableCents)));
+        m_scenarioTableWidget->setItem(row, 3, leftToFundItem);
+        m_scenarioTableWidget->setItem(row, 4, new QTableWidgetItem(formatCents(qMax(Q_INT64_C(0), totals.leftToFundCents - amountAvailableCents))));
+        m_scenarioTableWidget->setItem(row, 5, new QTableWidgetItem(QString::number(totals.fundedBillCount) + " / " + QString::number(totals.billCount)));
+        m_scenarioTableWidget->setItem(row, 6, new QTableWidgetItem(scenarioRow.currencyCode));
+    }
+
+    m_scenarioTableWidget->blockSignals(false);
+    setChosenScenarioIndex(p_scenarioRows.isEmpty() ? -1 : qBound(0, chosenScenarioIndex, p_scenarioRows.size() - 1));
+
+    // The buttons acting on a scenario need one to be chosen
+    bool isScenarioListed = !p_scenarioRows.isEmpty();
+    m_forkScenarioButton->setEnabled(isScenarioListed);
+    m_deleteScenarioButton->setEnabled(isScenarioListed);
+    m_promoteScenarioButton->setEnabled(isScenarioListed);
+    m_fundBillsButton->setEnabled(isScenarioListed);
+    m_defundBillsButton->setEnabled(isScenarioListed);
+    m_removeBillsButton->setEnabled(isScenarioListed);
+    m_adjustButton->setEnabled(isScenarioListed);
+
+    m_summaryLabel->setText(m_SUMMARY_LABEL_TEXT.arg(p_scenarioRows.size()));
+    m_summaryLabel->setToolTip(m_SUMMARY_TOOLTIP_TEXT.arg(QString::number(p_elapsedNsecs / 1000000.0, 'f', 3)));
+}
+
+int ScenarioWidget::getChosenScenarioIndex() const
+{
+    return m_scenarioTableWidget->currentRow();
+}
+
+void ScenarioWidget::setChosenScenarioIndex(int p_scenarioIndex)
+{
+    // Choosing the row already chosen does not announce itself, so announce it here
+    if(p_scenarioIndex == getChosenScenarioIndex())
+    {
+        emit scenarioChosen();
+        return;
+    }
+
+    m_scenarioTableWidget->selectRow(p_scenarioIndex);
+}
+
+void ScenarioWidget::setChanges(const QVector<LedgerScenario::BillChange> &p_billChanges, qint64 p_amountAvailableChangeCents, const QString &p_currencyCode)
+{
+    // The amount available is listed first whenever the scenario changed it
+    int firstBillRow = p_amountAvailableChangeCents != 0 ? 1 : 0;
+    m_changeTableWidget->setRowCount(firstBillRow + p_billChanges.size());
+
+    if(p_amountAvailableChangeCents != 0)
+    {
+        m_changeTableWidget->setItem(0, 0, new QTableWidgetItem(m_AMOUNT_AVAILABLE_TEXT));
+        m_changeTableWidget->setItem(0, 1, new QTableWidgetItem(m_CHANGED_TEXT));
+        m_changeTableWidget->setItem(0, 2, new QTableWidgetItem());
+        m_changeTableWidget->setItem(0, 3, new QTableWidgetItem(m_AMOUNT_AVAILABLE_CHANGE_TEXT.arg((p_amountAvailableChangeCents > 0 ? "+" : "") + formatCents(p_amountAvailableChangeCents), p_currencyCode)));
+    }
+
+    for(int changeIndex = 0; changeIndex < p_billChanges.size(); changeIndex++)
+    {
+        const LedgerScenario::BillChange &billChange = p_billChanges.at(changeIndex);
+        int row = firstBillRow + changeIndex;
+        bool isAdded = billChange.kind == LedgerScenario::AddedBill;
+        bool isRemoved = billChange.kind == LedgerScenario::RemovedBill;
+
+        m_changeTableWidget->setItem(row, 0, new QTableWidgetItem(isRemoved ? billChange.baseBill.getName() : billChange.scenarioBill.getName()));
+        m_changeTableWidget->setItem(row, 1, new QTableWidgetItem(isAdded ? m_ADDED_TEXT : (isRemoved ? m_REMOVED_TEXT : m_CHANGED_TEXT)));
+        m_changeTableWidget->setItem(row, 2, new QTableWidgetItem(isAdded ? QString() : describeBill(billChange.baseBill)));
+        m_changeTableWidget->setItem(row, 3, new QTableWidgetItem(isRemoved ? QString() : describeBill(billChange.scenarioBill)));
+    }
+}
+
+qint64 ScenarioWidget::getAdjustmentCents() const
+{
+    return std::llround(m_adjustmentInput->value() * 100.0);
+}
+
+void ScenarioWidget::initializeWidget()
+{
+    // Create the summary label and the read-only scenario table, one row per scenario
+    m_summaryLabel = new QLabel(this);
+
+    m_scenarioTableWidget = new QTableWidget(this);
+    m_scenarioTableWidget->setColumnCount(m_SCENARIO_TABLE_HEADER_STRING.split(";").size());
+    m_scenarioTableWidget->setHorizontalHeaderLabels(m_SCENARIO_TABLE_HEADER_STRING.split(";"));
+    m_scenarioTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_scenarioTableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_scenarioTableWidget->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_scenarioTableWidget->horizontalHeader()->setStretchLastSection(true);
+
+    // Create the scenario buttons
+    m_newScenarioButton = new QPushButton(this);
+    m_newScenarioButton->setText(m_NEW_SCENARIO_BUTTON_TEXT);
+    m_forkScenarioButton = new QPushButton(this);
+    m_forkScenarioButton->setText(m_FORK_SCENARIO_BUTTON_TEXT);
+    m_deleteScenarioButton = new QPushButton(this);
+    m_deleteScenarioButton->setText(m_DELETE_SCENARIO_BUTTON_TEXT);
+    m_promoteScenarioButton = new QPushButton(this);
+    m_promoteScenarioButton->setText(m_PROMOTE_SCENARIO_BUTTON_TEXT);
+
+    // Create the change label and buttons, and the adjustment label, spin box, and button
+    m_changesLabel = new QLabel(this);
+    m_changesLabel->setText(m_CHANGES_LABEL_TEXT);
+    m_fundBillsButton = new QPushButton(this);
+    m_fundBillsButton->setText(m_FUND_BILLS_BUTTON_TEXT);
+    m_defundBillsButton = new QPushButton(this);
+    m_defundBillsButton->setText(m_DEFUND_BILLS_BUTTON_TEXT);
+    m_removeBillsButton = new QPushButton(this);
+    m_removeBillsButton->setText(m_REMOVE_BILLS_BUTTON_TEXT);
+
+    m_adjustmentLabel = new QLabel(this);
+    m_adjustmentLabel->setText(m_ADJUSTMENT_LABEL_TEXT);
+    m_adjustmentInput = new QDoubleSpinBox(this);
+    m_adjustmentInput->setRange(-m_MAX_ADJUSTMENT, m_MAX_ADJUSTMENT);
+    m_adjustButton = new QPushButton(this);
+    m_adjustButton->setText(m_ADJUST_BUTTON_TEXT);
+
+    // Create the read-only change table
+    m_changeTableWidget = new QTableWidget(this);
+    m_changeTableWidget->setColumnCount(m_CHANGE_TABLE_HEADER_STRING.split(";").size());
+    m_changeTableWidget->setHorizontalHeaderLabels(m_CHANGE_TABLE_HEADER_STRING.split(";"));
+    m_changeTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_changeTableWidget->horizontalHeader()->setStretchLastSection(true);
+    m_changeTableWidget->verticalHeader()->hide();
+
+    // Create the Close button
+    m_closeButton = new QPushButton(this);
+    m_closeButton->setText(m_CLOSE_BUTTON_TEXT);
+
+    // Add the widgets into a grid layout, the scenarios above the chosen scenario's changes
+    m_gridLayout = new QGridLayout(this);
+    m_gridLayout->addWidget(m_summaryLabel, 0, 0, 1, 4);
+    m_gridLayout->addWidget(m_scenarioTableWidget, 1, 0, 1, 4);
+    m_gridLayout->addWidget(m_newScenarioButton, 2, 0);
+    m_gridLayout->addWidget(m_forkScenarioButton, 2, 1);
+    m_gridLayout->addWidget(m_deleteScenarioButton, 2, 2);
+    m_gridLayout->addWidget(m_promoteScenarioButton, 2, 3);
+    m_gridLayout->addWidget(m_changesLabel, 3, 0, 1, 4, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_fundBillsButton, 4, 0);
+    m_gridLayout->addWidget(m_defundBillsButton, 4, 1);
+    m_gridLayout->addWidget(m_removeBillsButton, 4, 2);
+    m_gridLayout->addWidget(m_adjustmentLabel, 5, 0, Qt::AlignmentFlag::AlignLeft);
+    m_gridLayout->addWidget(m_adjustmentInput, 5, 1);
+    m_gridLayout->addWidget(m_adjustButton, 5, 2);
+    m_gridLayout->addWidget(m_changeTableWidget, 6, 0, 1, 4);
+    m_gridLayout->addWidget(m_closeButton, 7, 3);
+    m_gridLayout->setRowStretch(1, 1);
+    m_gridLayout->setRowStretch(6, 2);
+
+    setScenarios(QVector<ScenarioRow>(), 0);
+}
+
+QString ScenarioWidget::describeBill(const Bill &p_bill) const
+{
+    return m_BILL_DESCRIPTION_TEXT.arg(formatCents(p_bill.getAmountDueCents()), p_bill.getCurrencyCode(), p_bill.getDueDate().toString(m_DATE_FORMAT),
+                                       p_bill.isFunded() ? m_FUNDED_TEXT : m_NOT_FUNDED_TEXT);
+}
+
+QString ScenarioWidget::formatCents(qint64 p_cents)
+{
+    return QString::number(p_cents / 100.0, 'f', 2);
+}
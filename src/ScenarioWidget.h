@@ -0,0 +1,207 @@
+/*##################################################################################
+#   File name:          ScenarioWidget.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a ScenarioWidget
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef SCENARIOWIDGET_H
+#define SCENARIOWIDGET_H
+
+// Local file includes
+#include "LedgerScenario.h"
+
+// Qt includes
+#include <QDoubleSpinBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+
+/**
+ * @brief The ScenarioWidget class represents a pop-up window for trying out what-if scenarios, such as funding a few bills while a paycheck is late, without changing the real bills.
+ * Every scenario is totalled side by side, and the chosen scenario's differences from the bills it was forked from are listed below. The scenarios are kept and changed by the MainWindow, which acts on the bills selected in the bill table widget.
+ */
+class ScenarioWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @brief The ScenarioRow struct is one scenario as listed by the ScenarioWidget.
+     */
+    struct ScenarioRow
+    {
+        QString name; //!< The name of the scenario.
+        QString currencyCode; //!< The currency of the amount available, which the totals are in.
+        LedgerScenario::Totals totals; //!< What the scenario leaves the user with.
+    };
+
+    /**
+     * @brief Constructs a widget for trying out what-if scenarios.
+     */
+    ScenarioWidget();
+
+    /**
+     * @brief Destructs the ScenarioWidget by deleting objects which were dynamically allocated.
+     */
+    ~ScenarioWidget();
+
+    /**
+     * @brief Lists the scenarios side by side, keeping the chosen scenario chosen if it is still listed.
+     * @param p_scenarioRows - The scenarios.
+     * @param p_elapsedNsecs - How long totalling every scenario took, in nanoseconds.
+     */
+    void setScenarios(const QVector<ScenarioRow> &p_scenarioRows, qint64 p_elapsedNsecs);
+
+    /**
+     * @brief Returns the chosen scenario.
+     * @return The index of the scenario, or -1 if none is chosen.
+     */
+    int getChosenScenarioIndex() const;
+
+    /**
+     * @brief Chooses a scenario.
+     * @param p_scenarioIndex - The index of the scenario.
+     */
+    void setChosenScenarioIndex(int p_scenarioIndex);
+
+    /**
+     * @brief Lists how the chosen scenario differs from the bills it was forked from.
+     * @param p_billChanges - The bills which differ.
+     * @param p_amountAvailableChangeCents - How much the scenario changed the amount available by.
+     * @param p_currencyCode - The currency of the amount available.
+     */
+    void setChanges(const QVector<LedgerScenario::BillChange> &p_billChanges, qint64 p_amountAvailableChangeCents, const QString &p_currencyCode);
+
+    /**
+     * @brief Returns the amount entered to add to or take from the chosen scenario's amount available.
+     * @return The amount in cents, negative to take it away.
+     */
+    qint64 getAdjustmentCents() const;
+
+signals:
+
+    /**
+     * @brief Emitted when another scenario is chosen, so its changes can be listed.
+     */
+    void scenarioChosen();
+
+    /**
+     * @brief Emitted when the New Scenario button is clicked, so a scenario without changes can be forked from the bills.
+     */
+    void newScenarioRequested();
+
+    /**
+     * @brief Emitted when the Fork Scenario button is clicked, so the chosen scenario can be forked.
+     */
+    void forkScenarioRequested();
+
+    /**
+     * @brief Emitted when the Delete Scenario button is clicked, so the chosen scenario can be discarded.
+     */
+    void deleteScenarioRequested();
+
+    /**
+     * @brief Emitted when the Make Real button is clicked, so the chosen scenario's changes can be made to the bills.
+     */
+    void promoteScenarioRequested();
+
+    /**
+     * @brief Emitted when the Fund Selected button is clicked, so the bills selected in the bill table widget can be funded in the chosen scenario.
+     */
+    void fundBillsRequested();
+
+    /**
+     * @brief Emitted when the Defund Selected button is clicked, so the bills selected in the bill table widget can be defunded in the chosen scenario.
+     */
+    void defundBillsRequested();
+
+    /**
+     * @brief Emitted when the Remove Selected button is clicked, so the bills selected in the bill table widget can be removed from the chosen scenario.
+     */
+    void removeBillsRequested();
+
+    /**
+     * @brief Emitted when the Adjust button is clicked, so the amount entered can be added to the chosen scenario's amount available.
+     */
+    void adjustAmountAvailableRequested();
+
+private:
+
+    /**
+     * @brief Creates the labels, input, tables, and buttons of the ScenarioWidget and adds them into a grid layout.
+     */
+    void initializeWidget();
+
+    /**
+     * @brief Describes a bill as it is before or after a change.
+     * @param p_bill - The bill.
+     * @return The bill's amount due, currency, due date, and funding status.
+     */
+    QString describeBill(const Bill &p_bill) const;
+
+    /**
+     * @brief Formats an amount in cents with two decimal places.
+     * @param p_cents - The amount in cents.
+     * @return The amount in dollars.
+     */
+    static QString formatCents(qint64 p_cents);
+
+    // General UI variables
+    const QString m_WINDOW_TITLE = "Scenarios"; //!< Title of the ScenarioWidget window.
+    QGridLayout *m_gridLayout = nullptr; //!< Grid layout used for organizing the widgets of the ScenarioWidget.
+    const QString m_DATE_FORMAT = "M/d/yyyy"; //!< The format dates are shown in, the same as the bill table's.
+
+    // Scenario table fields
+    QLabel *m_summaryLabel = nullptr; //!< Label explaining the scenarios, noting how long totalling them took.
+    const QString m_SUMMARY_LABEL_TEXT = "%1 scenario(s), none of which change your bills until made real"; //!< Text of the summary label, given the number of scenarios.
+    const QString m_SUMMARY_TOOLTIP_TEXT = "Every scenario was totalled in %1 ms"; //!< Tooltip of the summary label, noting how long totalling took.
+    QTableWidget *m_scenarioTableWidget = nullptr; //!< Table listing what each scenario leaves the user with.
+    const QString m_SCENARIO_TABLE_HEADER_STRING = "Scenario;Changes;Amount Available;Left To Fund;Shortfall;Funded Bills;Currency"; //!< The scenario table column titles, separated by semicolons.
+    const QString m_MISSING_RATES_MARKER = " *"; //!< Appended to a left to fund total when some bills could not be converted.
+    const QString m_MISSING_RATES_TOOLTIP_TEXT = "Excludes bills in %1, which have no exchange rate"; //!< Tooltip of a left to fund total, given the currencies which could not be converted.
+
+    // Change fields
+    QLabel *m_changesLabel = nullptr; //!< Label for the buttons which change the chosen scenario.
+    const QString m_CHANGES_LABEL_TEXT = "Change the chosen scenario using the bills selected in the bill table:"; //!< Text for the label for the buttons which change the chosen scenario.
+    QLabel *m_adjustmentLabel = nullptr; //!< Label for the spin box used for entering an adjustment to the amount available.
+    const QString m_ADJUSTMENT_LABEL_TEXT = "Add To Amount Available:"; //!< Text for the label for the adjustment to the amount available.
+    QDoubleSpinBox *m_adjustmentInput = nullptr; //!< The spin box used for entering an adjustment to the amount available, negative for money which has not arrived.
+    const double m_MAX_ADJUSTMENT = 99999999.99; //!< The largest amount which can be added to or taken from the amount available at once.
+    QTableWidget *m_changeTableWidget = nullptr; //!< Table listing how the chosen scenario differs from the bills it was forked from.
+    const QString m_CHANGE_TABLE_HEADER_STRING = "Bill;Change;Before;After"; //!< The change table column titles, separated by semicolons.
+    const QString m_ADDED_TEXT = "Added"; //!< Describes a bill the scenario added.
+    const QString m_CHANGED_TEXT = "Changed"; //!< Describes a bill the scenario changed.
+    const QString m_REMOVED_TEXT = "Removed"; //!< Describes a bill the scenario removed.
+    const QString m_AMOUNT_AVAILABLE_TEXT = "Amount Available"; //!< Names the row listing how the scenario changed the amount available.
+    const QString m_AMOUNT_AVAILABLE_CHANGE_TEXT = "%1 %2"; //!< Describes the change to the amount available, given the signed amount and the currency code.
+    const QString m_BILL_DESCRIPTION_TEXT = "%1 %2 due %3, %4"; //!< Describes a bill, given its amount due, currency code, due date, and funding status.
+    const QString m_FUNDED_TEXT = "Funded"; //!< Describes a funded bill.
+    const QString m_NOT_FUNDED_TEXT = "Not Funded"; //!< Describes an unfunded bill.
+
+    // Button and button text variables
+    QPushButton *m_newScenarioButton = nullptr; //!< Push button used for forking a scenario from the bills.
+    const QString m_NEW_SCENARIO_BUTTON_TEXT = "New Scenario"; //!< Text used for the New Scenario push button.
+    QPushButton *m_forkScenarioButton = nullptr; //!< Push button used for forking the chosen scenario.
+    const QString m_FORK_SCENARIO_BUTTON_TEXT = "Fork Scenario"; //!< Text used for the Fork Scenario push button.
+    QPushButton *m_deleteScenarioButton = nullptr; //!< Push button used for discarding the chosen scenario.
+    const QString m_DELETE_SCENARIO_BUTTON_TEXT = "Delete Scenario"; //!< Text used for the Delete Scenario push button.
+    QPushButton *m_promoteScenarioButton = nullptr; //!< Push button used for making the chosen scenario's changes to the bills.
+    const QString m_PROMOTE_SCENARIO_BUTTON_TEXT = "Make Real"; //!< Text used for the Make Real push button.
+    QPushButton *m_fundBillsButton = nullptr; //!< Push button used for funding the selected bills in the chosen scenario.
+    const QString m_FUND_BILLS_BUTTON_TEXT = "Fund Selected"; //!< Text used for the Fund Selected push button.
+    QPushButton *m_defundBillsButton = nullptr; //!< Push button used for defunding the selected bills in the chosen scenario.
+    const QString m_DEFUND_BILLS_BUTTON_TEXT = "Defund Selected"; //!< Text used for the Defund Selected push button.
+    QPushButton *m_removeBillsButton = nullptr; //!< Push button used for removing the selected bills from the chosen scenario.
+    const QString m_REMOVE_BILLS_BUTTON_TEXT = "Remove Selected"; //!< Text used for the Remove Selected push button.
+    QPushButton *m_adjustButton = nullptr; //!< Push button used for adding the adjustment to the chosen scenario's amount available.
+    const QString m_ADJUST_BUTTON_TEXT = "Adjust"; //!< Text used for the Adjust push button.
+    QPushButton *m_closeButton = nullptr; //!< Push button used for closing the ScenarioWidget.
+    const QString m_CLOSE_BUTTON_TEXT = "Close"; //!< Text used for the Close push button.
+};
+
+#endif // SCENARIOWIDGET_H
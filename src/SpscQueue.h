@@ -0,0 +1,97 @@
+/*##################################################################################
+#   File name:          SpscQueue.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a SpscQueue
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The SpscQueue class is a bounded, lock-free ring buffer for passing values from exactly one producer thread to exactly one consumer thread.
+ * The producer only writes the tail index and the consumer only writes the head index, so neither side ever waits on a lock held by the other.
+ */
+template <typename T>
+class SpscQueue
+{
+
+public:
+
+    /**
+     * @brief Constructs a SpscQueue.
+     * @param p_capacity - The minimum number of values the queue can hold, rounded up to a power of two.
+     */
+    explicit SpscQueue(std::size_t p_capacity)
+    {
+        std::size_t capacity = 1;
+
+        // Round the capacity up to a power of two so positions wrap with a mask rather than a division
+        while(capacity < p_capacity)
+        {
+            capacity <<= 1;
+        }
+
+        m_slots.resize(capacity);
+        m_indexMask = capacity - 1;
+    }
+
+    /**
+     * @brief Adds a value to the back of the queue. Must only be called from the producer thread.
+     * @param p_value - The value to add.
+     * @return True if the value was added, false if the queue was full.
+     */
+    bool tryPush(T p_value)
+    {
+        std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        // The queue is full if the consumer has not yet freed the slot the producer would write
+        if(tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+        {
+            return false;
+        }
+
+        // Fill the slot, then publish it to the consumer
+        m_slots[tail & m_indexMask] = std::move(p_value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the value at the front of the queue. Must only be called from the consumer thread.
+     * @param p_value - Receives the removed value.
+     * @return True if a value was removed, false if the queue was empty.
+     */
+    bool tryPop(T &p_value)
+    {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+
+        // The queue is empty if the producer has not published anything past the head
+        if(head == m_tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        // Take the value and release anything it holds before handing the slot back to the producer
+        p_value = std::move(m_slots[head & m_indexMask]);
+        m_slots[head & m_indexMask] = T();
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+
+    std::vector<T> m_slots; //!< Storage for the queued values.
+    std::size_t m_indexMask = 0; //!< Mask which wraps an ever increasing position onto a slot.
+    alignas(64) std::atomic<std::size_t> m_head{0}; //!< Position of the next value to pop, written only by the consumer.
+    alignas(64) std::atomic<std::size_t> m_tail{0}; //!< Position of the next slot to push into, written only by the producer.
+};
+
+#endif // SPSCQUEUE_H
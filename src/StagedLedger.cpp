@@ -0,0 +1,352 @@
+/*##################################################################################
+#   File name:          StagedLedger.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a StagedLedger
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "StagedLedger.h"
+#include "CategoryRollup.h"
+
+#include <algorithm>
+
+StagedLedger::StagedLedger(LoadArena &p_arena)
+    : m_arena(p_arena)
+{
+}
+
+QDate StagedLedger::parseDate(QStringView p_dateText)
+{
+    int dateParts[3] = {0, 0, 0};
+    int digitCounts[3] = {0, 0, 0};
+    int partIndex = 0;
+
+    // Read the month, day, and year between the slashes
+    for(QChar character : p_dateText)
+    {
+        if(character.isSpace())
+        {
+            continue;
+        }
+
+        if(character == QLatin1Char('/') && partIndex < 2)
+        {
+            partIndex++;
+        }
+        else if(character.unicode() >= '0' && character.unicode() <= '9' && digitCounts[partIndex] < 4)
+        {
+            dateParts[partIndex] = dateParts[partIndex] * 10 + (character.unicode() - '0');
+            digitCounts[partIndex]++;
+        }
+        else
+        {
+            return QDate();
+        }
+    }
+
+    if(partIndex != 2 || digitCounts[0] < 1 || digitCounts[0] > 2 || digitCounts[1] < 1 || digitCounts[1] > 2 || digitCounts[2] != 4)
+    {
+        return QDate();
+    }
+
+    return QDate(dateParts[2], dateParts[0], dateParts[1]);
+}
+
+void StagedLedger::stageBill(QStringView p_billKey)
+{
+    // Entries of a section arrive together, so only a new section needs a new record
+    if(m_currentBill != nullptr && m_currentBill->billKey == p_billKey)
+    {
+        return;
+    }
+
+    StagedBill *stagedBill = m_arena.create<StagedBill>();
+    stagedBill->billKey = p_billKey;
+    stagedBill->sectionOrder = m_stagedSectionCount++;
+    stagedBill->previousBill = m_currentBill;
+    m_currentBill = stagedBill;
+}
+
+void StagedLedger::setAmountDue(double p_amountDue)
+{
+    m_currentBill->amountDue = p_amountDue;
+    m_currentBill->setFields |= AmountDueField;
+}
+
+void StagedLedger::setDueDate(const QDate &p_dueDate)
+{
+    m_currentBill->dueDate = p_dueDate;
+    m_currentBill->setFields |= DueDateField;
+}
+
+void StagedLedger::setCurrencyCode(QStringView p_currencyCode)
+{
+    // Most bills share a currency with the bill before them, so only look up codes which differ from the last one
+    if(m_lastCurrencyCode.isNull() || p_currencyCode != m_lastCurrencyCode)
+    {
+        m_lastCurrencyIndex = CurrencyRegistry::indexForCode(p_currencyCode);
+        m_lastCurrencyCode = p_currencyCode;
+    }
+
+    m_currentBill->currencyIndex = m_lastCurrencyIndex;
+    m_currentBill->setFields |= CurrencyField;
+}
+
+void StagedLedger::setCategory(QStringView p_category)
+{
+    m_currentBill->category = p_category;
+    m_currentBill->setFields |= CategoryField;
+}
+
+void StagedLedger::setTags(QStringView p_tagsText)
+{
+    m_currentBill->tagsText = p_tagsText;
+    m_currentBill->setFields |= TagsField;
+}
+
+void StagedLedger::setFundedStatus(bool p_isFunded)
+{
+    m_currentBill->isFunded = p_isFunded;
+    m_currentBill->setFields |= FundingStatusField;
+}
+
+int StagedLedger::getStagedSectionCount() const
+{
+    return m_stagedSectionCount;
+}
+
+void StagedLedger::buildBills()
+{
+    // Gather the staged sections into an array in the arena, in file order
+    StagedBill **sortedBills = static_cast<StagedBill**>(m_arena.allocate(static_cast<size_t>(m_stagedSectionCount) * sizeof(StagedBill*), alignof(StagedBill*)));
+
+    for(StagedBill *stagedBill = m_currentBill; stagedBill != nullptr; stagedBill = stagedBill->previousBill)
+    {
+        sortedBills[stagedBill->sectionOrder] = stagedBill;
+    }
+
+    // Sort them into bill map key order, so every insertion lands at the end of the map, and so sections of the same bill end up next to each other in file order
+    std::sort(sortedBills, sortedBills + m_stagedSectionCount, [](const StagedBill *p_firstBill, const StagedBill *p_secondBill)
+    {
+        int keyComparison = p_firstBill->billKey.compare(p_secondBill->billKey);
+        return keyComparison < 0 || (keyComparison == 0 && p_firstBill->sectionOrder < p_secondBill->sectionOrder);
+    });
+
+    m_builtBills.clear();
+    m_builtBills.reserve(m_stagedSectionCount);
+
+    for(int sectionIndex = 0; sectionIndex < m_stagedSectionCount;)
+    {
+        // The map key and the bill's name share one string
+        BuiltBill builtBill;
+        builtBill.bill.setName(sortedBills[sectionIndex]->billKey.toString());
+        int firstSectionIndex = sectionIndex;
+
+        // Apply every section of the bill in file order, so later sections win
+        do
+        {
+            applyStagedFields(*sortedBills[sectionIndex], builtBill.bill);
+            builtBill.setFields |= sortedBills[sectionIndex]->setFields;
+
+            // The last amount due given is the one kept, so only it decides whether the bill can be held
+            if(sortedBills[sectionIndex]->setFields & AmountDueField)
+            {
+                builtBill.isAmountDueOutOfRange = !Bill::isAmountDueInRange(sortedBills[sectionIndex]->amountDue);
+            }
+
+            sectionIndex++;
+        }
+        while(sectionIndex < m_stagedSectionCount && sortedBills[sectionIndex]->billKey == sortedBills[sectionIndex - 1]->billKey);
+
+        builtBill.isRepeated = sectionIndex - firstSectionIndex > 1;
+        m_builtBills.append(std::move(builtBill));
+    }
+
+    // The records are left to be released along with the arena
+    m_currentBill = nullptr;
+    m_stagedSectionCount = 0;
+    m_lastCurrencyCode = QStringView();
+}
+
+void StagedLedger::moveInto(LedgerSnapshot &p_loadedLedger)
+{
+    buildBills();
+    mergeInto({this}, p_loadedLedger);
+}
+
+void StagedLedger::mergeInto(const QVector<StagedLedger*> &p_stagedLedgers, LedgerSnapshot &p_loadedLedger)
+{
+    // Each ledger's bills are already sorted, so the next bill to add is the smallest of the bills each ledger has left
+    // A heap of ledger indexes orders them by their next bill's key, and the earlier chunk first for equal keys so later chunks win when merged
+    QVector<int> nextBillIndexes(p_stagedLedgers.size(), 0);
+    QVector<int> ledgerHeap;
+
+    auto isLaterInMap = [&](int p_firstLedgerIndex, int p_secondLedgerIndex)
+    {
+        const QString &firstKey = p_stagedLedgers.at(p_firstLedgerIndex)->m_builtBills.at(nextBillIndexes.at(p_firstLedgerIndex)).bill.getName();
+        const QString &secondKey = p_stagedLedgers.at(p_secondLedgerIndex)->m_builtBills.at(nextBillIndexes.at(p_secondLedgerIndex)).bill.getName();
+        int keyComparison = firstKey.compare(secondKey);
+        return keyComparison > 0 || (keyComparison == 0 && p_firstLedgerIndex > p_secondLedgerIndex);
+    };
+
+    for(int ledgerIndex = 0; ledgerIndex < p_stagedLedgers.size(); ledgerIndex++)
+    {
+        if(!p_stagedLedgers.at(ledgerIndex)->m_builtBills.isEmpty())
+        {
+            ledgerHeap.append(ledgerIndex);
+        }
+    }
+
+    std::make_heap(ledgerHeap.begin(), ledgerHeap.end(), isLaterInMap);
+
+    // Hold each bill back until every chunk's copy of it has been merged into it
+    BuiltBill mergedBill;
+    bool hasMergedBill = false;
+
+    while(!ledgerHeap.isEmpty())
+    {
+        std::pop_heap(ledgerHeap.begin(), ledgerHeap.end(), isLaterInMap);
+        int ledgerIndex = ledgerHeap.last();
+        QVector<BuiltBill> &builtBills = p_stagedLedgers.at(ledgerIndex)->m_builtBills;
+        BuiltBill &builtBill = builtBills[nextBillIndexes.at(ledgerIndex)];
+
+        if(hasMergedBill && builtBill.bill.getName() == mergedBill.bill.getName())
+        {
+            applyBuiltFields(builtBill, mergedBill);
+        }
+        else
+        {
+            if(hasMergedBill)
+            {
+                appendBuiltBill(mergedBill, p_loadedLedger);
+            }
+
+            mergedBill = std::move(builtBill);
+            hasMergedBill = true;
+        }
+
+        // Put the ledger back in the heap if it has bills left
+        nextBillIndexes[ledgerIndex]++;
+
+        if(nextBillIndexes.at(ledgerIndex) < builtBills.size())
+        {
+            std::push_heap(ledgerHeap.begin(), ledgerHeap.end(), isLaterInMap);
+        }
+        else
+        {
+            ledgerHeap.removeLast();
+        }
+    }
+
+    if(hasMergedBill)
+    {
+        appendBuiltBill(mergedBill, p_loadedLedger);
+    }
+
+    for(StagedLedger *stagedLedger : p_stagedLedgers)
+    {
+        stagedLedger->m_builtBills.clear();
+    }
+}
+
+void StagedLedger::applyStagedFields(const StagedBill &p_stagedBill, Bill &p_bill)
+{
+    if(p_stagedBill.setFields & AmountDueField)
+    {
+        p_bill.setAmountDue(p_stagedBill.amountDue);
+    }
+
+    if(p_stagedBill.setFields & DueDateField)
+    {
+        p_bill.setDueDate(p_stagedBill.dueDate);
+    }
+
+    if(p_stagedBill.setFields & CurrencyField)
+    {
+        p_bill.setCurrencyIndex(p_stagedBill.currencyIndex);
+    }
+
+    // Only bills with a category or tags allocate strings for them
+    if(p_stagedBill.setFields & CategoryField)
+    {
+        p_bill.setCategory(p_stagedBill.category.toString());
+    }
+
+    if(p_stagedBill.setFields & TagsField)
+    {
+        p_bill.setTags(CategoryRollup::splitTags(p_stagedBill.tagsText.toString()));
+    }
+
+    if(p_stagedBill.setFields & FundingStatusField)
+    {
+        p_bill.setFundedStatus(p_stagedBill.isFunded);
+    }
+}
+
+void StagedLedger::applyBuiltFields(const BuiltBill &p_laterBill, BuiltBill &p_builtBill)
+{
+    const Bill &laterBill = p_laterBill.bill;
+    Bill &builtBill = p_builtBill.bill;
+
+    if(p_laterBill.setFields & AmountDueField)
+    {
+        builtBill.setAmountDueCents(laterBill.getAmountDueCents());
+        p_builtBill.isAmountDueOutOfRange = p_laterBill.isAmountDueOutOfRange;
+    }
+
+    if(p_laterBill.setFields & DueDateField)
+    {
+        builtBill.setDueDate(laterBill.getDueDate());
+    }
+
+    if(p_laterBill.setFields & CurrencyField)
+    {
+        builtBill.setCurrencyIndex(laterBill.getCurrencyIndex());
+    }
+
+    if(p_laterBill.setFields & CategoryField)
+    {
+        builtBill.setCategory(laterBill.getCategory());
+    }
+
+    if(p_laterBill.setFields & TagsField)
+    {
+        builtBill.setTags(laterBill.getTags());
+    }
+
+    if(p_laterBill.setFields & FundingStatusField)
+    {
+        builtBill.setFundedStatus(laterBill.isFunded());
+    }
+
+    // A bill found in more than one chunk appeared in more than one section
+    p_builtBill.setFields |= p_laterBill.setFields;
+    p_builtBill.isRepeated = true;
+}
+
+void StagedLedger::appendBuiltBill(const BuiltBill &p_builtBill, LedgerSnapshot &p_loadedLedger)
+{
+    const QString &billKey = p_builtBill.bill.getName();
+
+    // Bills whose amount due would be clamped are left out and reported, their sections being kept in the config file as they are
+    if(p_builtBill.isAmountDueOutOfRange)
+    {
+        p_loadedLedger.outOfRangeBillKeys.append(billKey);
+        return;
+    }
+
+    p_loadedLedger.billMap.insert(p_loadedLedger.billMap.cend(), billKey, p_builtBill.bill);
+
+    // Add funded bills to the funded list to assist with updating the total amount available
+    if(p_builtBill.bill.isFunded())
+    {
+        p_loadedLedger.fundedBillsList.append(billKey);
+    }
+
+    if(p_builtBill.isRepeated)
+    {
+        p_loadedLedger.repeatedBillKeys.append(billKey);
+    }
+}
@@ -0,0 +1,187 @@
+/*##################################################################################
+#   File name:          StagedLedger.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a StagedLedger
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef STAGEDLEDGER_H
+#define STAGEDLEDGER_H
+
+// Local file includes
+#include "LedgerSnapshot.h"
+#include "LoadArena.h"
+
+// Qt includes
+#include <QDate>
+#include <QStringView>
+#include <QVector>
+
+/**
+ * @brief The StagedLedger class collects the bills read from a config file as plain records in a LoadArena, and turns them into a LedgerSnapshot's bill map once the whole file is read.
+ * Staging a bill makes no heap allocations, so a load only allocates the bill map's nodes and the strings each Bill keeps: its name, and its category and tags when it has them.
+ * Sections which appear more than once are merged field by field, later sections winning, as QSettings does.
+ * A large file can be split into chunks staged by separate StagedLedgers on separate threads, each building its own bills, which are then merged in chunk order.
+ */
+class StagedLedger
+{
+
+public:
+
+    /**
+     * @brief Stages bills in an arena.
+     * @param p_arena - The arena the bill records are allocated from, which must outlive the staged ledger.
+     */
+    explicit StagedLedger(LoadArena &p_arena);
+
+    /**
+     * @brief Reads a date written in the config file's "M/d/yyyy" format without creating any strings, ignoring spaces.
+     * @param p_dateText - The date as written.
+     * @return The date, or a null date if the text is not a one or two digit month and day and a four digit year separated by slashes.
+     */
+    static QDate parseDate(QStringView p_dateText);
+
+    /**
+     * @brief Makes a bill the one the setters below fill in, continuing the current bill while consecutive entries belong to the same section.
+     * @param p_billKey - The bill map key of the bill, a view into the arena.
+     */
+    void stageBill(QStringView p_billKey);
+
+    /**
+     * @brief Sets the amount due of the current bill.
+     * @param p_amountDue - The amount due.
+     */
+    void setAmountDue(double p_amountDue);
+
+    /**
+     * @brief Sets the due date of the current bill.
+     * @param p_dueDate - The due date.
+     */
+    void setDueDate(const QDate &p_dueDate);
+
+    /**
+     * @brief Sets the currency of the current bill.
+     * The index of the last code looked up is remembered, so ledgers staged on separate threads rarely contend for the CurrencyRegistry's lock.
+     * @param p_currencyCode - The currency code, a view into the arena.
+     */
+    void setCurrencyCode(QStringView p_currencyCode);
+
+    /**
+     * @brief Sets the category of the current bill.
+     * @param p_category - The category, a view into the arena.
+     */
+    void setCategory(QStringView p_category);
+
+    /**
+     * @brief Sets the tags of the current bill, which are split once the bill is moved into the bill map.
+     * @param p_tagsText - The tags separated by commas, a view into the arena.
+     */
+    void setTags(QStringView p_tagsText);
+
+    /**
+     * @brief Sets the funding status of the current bill.
+     * @param p_isFunded - Whether or not the bill has been funded.
+     */
+    void setFundedStatus(bool p_isFunded);
+
+    /**
+     * @brief Returns the number of sections staged, which counts a bill once per section it appeared in.
+     * @return The number of sections.
+     */
+    int getStagedSectionCount() const;
+
+    /**
+     * @brief Turns the staged bills into Bills sorted by key, merging sections of the same bill, after which the arena is no longer used and may be released.
+     * Makes the allocations the Bills keep, so chunks staged on separate threads are best built on those threads too.
+     */
+    void buildBills();
+
+    /**
+     * @brief Builds the bill map and funded bills list of a snapshot from the staged bills, in bill map key order.
+     * @param p_loadedLedger - The snapshot, whose bill map and funded bills list are expected to be empty.
+     */
+    void moveInto(LedgerSnapshot &p_loadedLedger);
+
+    /**
+     * @brief Merges the built bills of the staged ledgers of consecutive chunks of a file into a snapshot's bill map and funded bills list, as if the whole file had been staged by one.
+     * Bills in more than one section, in the same chunk or not, are merged with later sections winning, and their keys are listed in the snapshot's repeated bill keys.
+     * @param p_stagedLedgers - The staged ledgers in file order, each of which has built its bills.
+     * @param p_loadedLedger - The snapshot, whose bill map and funded bills list are expected to be empty.
+     */
+    static void mergeInto(const QVector<StagedLedger*> &p_stagedLedgers, LedgerSnapshot &p_loadedLedger);
+
+private:
+
+    /**
+     * @brief The StagedField enum flags which fields of a staged bill its section set.
+     */
+    enum StagedField : quint8
+    {
+        AmountDueField = 0x01,
+        DueDateField = 0x02,
+        CurrencyField = 0x04,
+        CategoryField = 0x08,
+        TagsField = 0x10,
+        FundingStatusField = 0x20
+    };
+
+    /**
+     * @brief The StagedBill struct holds the fields one section of the config file set for a bill, allocated in the arena.
+     */
+    struct StagedBill
+    {
+        QStringView billKey; //!< The bill map key of the bill.
+        double amountDue = 0.00; //!< The amount due.
+        QDate dueDate; //!< The due date.
+        QStringView category; //!< The category.
+        QStringView tagsText; //!< The tags separated by commas.
+        int sectionOrder = 0; //!< The position of the section in the file, used to let later sections win when a bill appears more than once.
+        quint8 currencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the currency.
+        quint8 setFields = 0; //!< The StagedField flags of the fields the section set.
+        bool isFunded = false; //!< Whether or not the bill has been funded.
+        StagedBill *previousBill = nullptr; //!< The bill staged before this one, null for the first.
+    };
+
+    /**
+     * @brief The BuiltBill struct is a Bill built from every section of it staged in one ledger, along with which fields those sections set.
+     */
+    struct BuiltBill
+    {
+        Bill bill; //!< The bill.
+        quint8 setFields = 0; //!< The StagedField flags of the fields any of its sections set.
+        bool isRepeated = false; //!< Whether or not the bill appeared in more than one section.
+        bool isAmountDueOutOfRange = false; //!< Whether or not the amount due its last section gave is too large for a Bill to hold, in which case the bill is rejected rather than clamped.
+    };
+
+    /**
+     * @brief Copies the fields a section set onto a Bill.
+     * @param p_stagedBill - The staged section.
+     * @param p_bill - The Bill to fill in.
+     */
+    static void applyStagedFields(const StagedBill &p_stagedBill, Bill &p_bill);
+
+    /**
+     * @brief Copies the fields a bill built by a later chunk set onto the same bill built by an earlier one.
+     * @param p_laterBill - The bill built by the later chunk.
+     * @param p_builtBill - The bill built by the earlier chunk, which receives the fields.
+     */
+    static void applyBuiltFields(const BuiltBill &p_laterBill, BuiltBill &p_builtBill);
+
+    /**
+     * @brief Adds a merged bill to the end of a snapshot's bill map, and to its funded bills list and repeated bill keys as needed.
+     * @param p_builtBill - The merged bill, which sorts after every bill already in the map.
+     * @param p_loadedLedger - The snapshot.
+     */
+    static void appendBuiltBill(const BuiltBill &p_builtBill, LedgerSnapshot &p_loadedLedger);
+
+    LoadArena &m_arena; //!< The arena the bill records are allocated from.
+    StagedBill *m_currentBill = nullptr; //!< The bill being filled in, which is also the most recently staged one.
+    int m_stagedSectionCount = 0; //!< The number of sections staged.
+    QStringView m_lastCurrencyCode; //!< The currency code last looked up, a view into the arena.
+    quint8 m_lastCurrencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the currency code last looked up.
+    QVector<BuiltBill> m_builtBills; //!< The bills built from the staged sections, sorted by key, until they are merged into a snapshot.
+};
+
+#endif // STAGEDLEDGER_H
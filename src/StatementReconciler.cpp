@@ -0,0 +1,610 @@
+/*##################################################################################
+#   File name:          StatementReconciler.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a StatementReconciler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "StatementReconciler.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QRegularExpression>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    const QStringList DATE_FORMATS = {"M/d/yyyy", "MM/dd/yyyy", "yyyy-MM-dd", "M/d/yy", "yyyyMMdd", "d.M.yyyy"}; //!< The date formats statements are read in, tried in order.
+    const QStringList DATE_COLUMN_NAMES = {"posted date", "transaction date", "date"}; //!< Column names for the posting date, in order of preference.
+    const QStringList DESCRIPTION_COLUMN_NAMES = {"description", "payee", "name", "memo", "details"}; //!< Column names for the description, in order of preference.
+    const QString AMOUNT_COLUMN_NAME = "amount"; //!< The column name for a signed amount, matched exactly as headers such as "balance amount" contain it too.
+    const QStringList DEBIT_COLUMN_NAMES = {"debit", "withdrawal"}; //!< Column names for money leaving the account, when amounts are split into two columns.
+    const QStringList CREDIT_COLUMN_NAMES = {"credit", "deposit"}; //!< Column names for money entering the account, when amounts are split into two columns.
+    const QStringList CURRENCY_COLUMN_NAMES = {"currency"}; //!< Column names for the currency of each row's amount, which statements rarely have.
+    const QString OFX_TRANSACTION_TAG = "<STMTTRN>"; //!< The tag opening each transaction of an OFX statement.
+    const QString OFX_DATE_TAG = "DTPOSTED"; //!< The OFX tag holding a transaction's posting date.
+    const QString OFX_AMOUNT_TAG = "TRNAMT"; //!< The OFX tag holding a transaction's amount.
+    const QString OFX_NAME_TAG = "NAME"; //!< The OFX tag holding a transaction's payee.
+    const QString OFX_MEMO_TAG = "MEMO"; //!< The OFX tag holding a transaction's memo, used when it has no payee.
+    const QString OFX_CURRENCY_TAG = "CURDEF"; //!< The OFX tag holding the currency of the statement's amounts.
+    const int OFX_DATE_LENGTH = 8; //!< The number of leading characters of an OFX date holding the day, the rest hold the time.
+    const QString EMPTY_STATEMENT_TEXT = "The statement is empty"; //!< Error for statements without any lines.
+    const QString MISSING_COLUMNS_TEXT = "The statement needs a header row naming its date, description, and amount columns"; //!< Error for CSV statements whose columns cannot be found.
+    const QString NO_TRANSACTIONS_TEXT = "No transactions were found in the statement"; //!< Error for OFX statements without any readable transactions.
+
+    /**
+     * @brief The Candidate struct holds a transaction and bill which have the same amount and are within the date window of each other, along with how well their names match.
+     */
+    struct Candidate
+    {
+        int transactionIndex = 0; //!< The index of the transaction.
+        int billIndex = 0; //!< The index of the bill.
+        int nameScore = 0; //!< The percentage of the bill name's trigrams found in the transaction's description.
+        int dayDistance = 0; //!< The number of days between the transaction and the bill's due date.
+    };
+
+    /**
+     * @brief The MatchChunk struct holds a range of transactions probed by one worker, and the candidates it found for them.
+     */
+    struct MatchChunk
+    {
+        int firstTransactionIndex = 0; //!< The index of the first transaction in the chunk.
+        int lastTransactionIndex = 0; //!< One past the index of the last transaction in the chunk.
+        QVector<Candidate> candidates; //!< The candidates whose names matched well enough.
+        qint64 comparedCount = 0; //!< The number of pairs compared by name.
+    };
+
+    /**
+     * @brief Combines an amount and its currency into the key bills are grouped by, so only amounts in the same currency are joined.
+     * @param p_amountCents - The amount in cents.
+     * @param p_currencyIndex - The CurrencyRegistry index of the currency.
+     * @return The key.
+     */
+    qint64 joinKey(qint64 p_amountCents, quint8 p_currencyIndex)
+    {
+        return p_amountCents * CurrencyRegistry::m_MAX_CURRENCY_COUNT + p_currencyIndex;
+    }
+
+    /**
+     * @brief Returns the index of the first column whose name contains any of the given names, trying the names in order.
+     * @param p_columnNames - The case folded column names of the file.
+     * @param p_candidateNames - The names to look for, in order of preference.
+     * @return The column index, or -1 if there is none.
+     */
+    int findColumn(const QStringList &p_columnNames, const QStringList &p_candidateNames)
+    {
+        for(const QString &candidateName : p_candidateNames)
+        {
+            for(int column = 0; column < p_columnNames.size(); column++)
+            {
+                if(p_columnNames.at(column).contains(candidateName))
+                {
+                    return column;
+                }
+            }
+        }
+
+        return -1;
+    }
+
+    /**
+     * @brief Returns the text following an OFX tag within a transaction block, up to the next tag or line break.
+     * @param p_block - The text of the transaction block.
+     * @param p_tagName - The tag's name, without angle brackets.
+     * @return The tag's trimmed value, empty if the block does not have the tag.
+     */
+    QString ofxValue(const QString &p_block, const QString &p_tagName)
+    {
+        int tagIndex = p_block.indexOf("<" + p_tagName + ">", 0, Qt::CaseInsensitive);
+
+        if(tagIndex < 0)
+        {
+            return QString();
+        }
+
+        int valueIndex = tagIndex + p_tagName.size() + 2;
+        int endIndex = valueIndex;
+
+        while(endIndex < p_block.size() && p_block.at(endIndex) != '<' && p_block.at(endIndex) != '\n' && p_block.at(endIndex) != '\r')
+        {
+            endIndex++;
+        }
+
+        return p_block.mid(valueIndex, endIndex - valueIndex).trimmed();
+    }
+}
+
+bool StatementReconciler::readStatement(const QString &p_filePath, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText)
+{
+    QFile statementFile(p_filePath);
+
+    if(!statementFile.open(QIODevice::ReadOnly))
+    {
+        p_errorText = statementFile.errorString();
+        return false;
+    }
+
+    QByteArray statementData = statementFile.readAll();
+    QString suffix = QFileInfo(p_filePath).suffix().toLower();
+
+    if(suffix == "ofx" || suffix == "qfx")
+    {
+        return parseOfx(statementData, p_statementCurrencyIndex, p_transactions, p_errorText);
+    }
+
+    return parseCsv(statementData, p_statementCurrencyIndex, p_transactions, p_errorText);
+}
+
+bool StatementReconciler::parseCsv(const QByteArray &p_csvData, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText)
+{
+    const QVector<QStringList> csvRecords = splitCsvRecords(QString::fromUtf8(p_csvData));
+
+    if(csvRecords.isEmpty())
+    {
+        p_errorText = EMPTY_STATEMENT_TEXT;
+        return false;
+    }
+
+    // Find the columns from the header row, whose names differ from bank to bank
+    QStringList columnNames = csvRecords.first();
+
+    for(QString &columnName : columnNames)
+    {
+        columnName = columnName.trimmed().toLower();
+    }
+
+    int dateColumn = findColumn(columnNames, DATE_COLUMN_NAMES);
+    int descriptionColumn = findColumn(columnNames, DESCRIPTION_COLUMN_NAMES);
+    int debitColumn = findColumn(columnNames, DEBIT_COLUMN_NAMES);
+    int creditColumn = findColumn(columnNames, CREDIT_COLUMN_NAMES);
+    int currencyColumn = findColumn(columnNames, CURRENCY_COLUMN_NAMES);
+
+    // Split debit and credit columns are preferred whenever both are found, otherwise the signed amount column must be named exactly
+    bool isAmountSplit = debitColumn >= 0 && creditColumn >= 0;
+    int amountColumn = isAmountSplit ? -1 : columnNames.indexOf(AMOUNT_COLUMN_NAME);
+
+    if(dateColumn < 0 || descriptionColumn < 0 || (!isAmountSplit && amountColumn < 0))
+    {
+        p_errorText = MISSING_COLUMNS_TEXT;
+        return false;
+    }
+
+    p_transactions.reserve(p_transactions.size() + csvRecords.size() - 1);
+
+    for(int recordIndex = 1; recordIndex < csvRecords.size(); recordIndex++)
+    {
+        const QStringList &fields = csvRecords.at(recordIndex);
+        StatementTransaction transaction;
+        transaction.date = parseStatementDate(fields.value(dateColumn));
+        transaction.description = fields.value(descriptionColumn).trimmed();
+
+        // Rows without a currency of their own are in the statement's currency
+        QString currencyCode = currencyColumn >= 0 ? CurrencyRegistry::normalizeCode(fields.value(currencyColumn)) : QString();
+        transaction.currencyIndex = currencyCode.isEmpty() ? p_statementCurrencyIndex : CurrencyRegistry::indexForCode(currencyCode);
+
+        // Debits are subtracted from credits when the amounts are split, otherwise the signed amount column is used
+        bool isAmountValid = true;
+
+        if(isAmountSplit)
+        {
+            qint64 debitCents = 0;
+            qint64 creditCents = 0;
+            isAmountValid = parseStatementAmount(fields.value(debitColumn), debitCents) && parseStatementAmount(fields.value(creditColumn), creditCents);
+            transaction.amountCents = creditCents - qAbs(debitCents);
+        }
+        else
+        {
+            isAmountValid = parseStatementAmount(fields.value(amountColumn), transaction.amountCents);
+        }
+
+        // Skip rows such as running balances or footers which are not transactions
+        if(transaction.date.isValid() && isAmountValid && transaction.amountCents != 0)
+        {
+            p_transactions.append(transaction);
+        }
+    }
+
+    return true;
+}
+
+bool StatementReconciler::parseOfx(const QByteArray &p_ofxData, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText)
+{
+    // Each transaction starts with its own tag, which SGML statements never close, so the text up to the next transaction is searched for its fields
+    const QStringList ofxBlocks = QString::fromUtf8(p_ofxData).split(OFX_TRANSACTION_TAG, Qt::SkipEmptyParts, Qt::CaseInsensitive);
+
+    // The statement's default currency comes before its first transaction
+    QString currencyCode = ofxBlocks.isEmpty() ? QString() : CurrencyRegistry::normalizeCode(ofxValue(ofxBlocks.first(), OFX_CURRENCY_TAG));
+    quint8 currencyIndex = currencyCode.isEmpty() ? p_statementCurrencyIndex : CurrencyRegistry::indexForCode(currencyCode);
+
+    for(int blockIndex = 1; blockIndex < ofxBlocks.size(); blockIndex++)
+    {
+        const QString &ofxBlock = ofxBlocks.at(blockIndex);
+        StatementTransaction transaction;
+        transaction.date = parseStatementDate(ofxValue(ofxBlock, OFX_DATE_TAG).left(OFX_DATE_LENGTH));
+        transaction.currencyIndex = currencyIndex;
+        transaction.description = ofxValue(ofxBlock, OFX_NAME_TAG);
+
+        if(transaction.description.isEmpty())
+        {
+            transaction.description = ofxValue(ofxBlock, OFX_MEMO_TAG);
+        }
+
+        if(transaction.date.isValid() && parseStatementAmount(ofxValue(ofxBlock, OFX_AMOUNT_TAG), transaction.amountCents) && transaction.amountCents != 0)
+        {
+            p_transactions.append(transaction);
+        }
+    }
+
+    if(p_transactions.isEmpty())
+    {
+        p_errorText = NO_TRANSACTIONS_TEXT;
+        return false;
+    }
+
+    return true;
+}
+
+StatementReconciler::Result StatementReconciler::reconcile(const QVector<StatementTransaction> &p_transactions, const QVector<ReconcileBill> &p_bills, int p_dateWindowDays,
+                                                           int p_minimumNameScore)
+{
+    Result result;
+    int billCount = p_bills.size();
+    int transactionCount = p_transactions.size();
+
+    // Build side of the join: group the bills by amount and currency, each group sorted by due date so the date window can be found by binary search
+    QVector<qint64> billDays(billCount);
+    QHash<qint64, QVector<int>> billIndexesByCents;
+    billIndexesByCents.reserve(billCount);
+
+    for(int billIndex = 0; billIndex < billCount; billIndex++)
+    {
+        billDays[billIndex] = p_bills.at(billIndex).dueDate.toJulianDay();
+
+        if(p_bills.at(billIndex).amountCents > 0 && p_bills.at(billIndex).dueDate.isValid())
+        {
+            billIndexesByCents[joinKey(p_bills.at(billIndex).amountCents, p_bills.at(billIndex).currencyIndex)].append(billIndex);
+        }
+    }
+
+    for(QVector<int> &billIndexes : billIndexesByCents)
+    {
+        std::sort(billIndexes.begin(), billIndexes.end(), [&billDays](int p_firstIndex, int p_secondIndex)
+        {
+            return billDays.at(p_firstIndex) < billDays.at(p_secondIndex) || (billDays.at(p_firstIndex) == billDays.at(p_secondIndex) && p_firstIndex < p_secondIndex);
+        });
+    }
+
+    // Each bill's trigrams are computed once up front, since a bill may be compared against many transactions
+    QVector<QVector<quint64>> billTrigrams(billCount);
+
+    for(int billIndex = 0; billIndex < billCount; billIndex++)
+    {
+        billTrigrams[billIndex] = nameTrigrams(p_bills.at(billIndex).name);
+    }
+
+    // Probe side of the join: each debit looks up the bills of its amount and currency and compares the names of those within the date window. Credits pay no bill
+    auto probeChunk = [&](MatchChunk &p_chunk)
+    {
+        for(int transactionIndex = p_chunk.firstTransactionIndex; transactionIndex < p_chunk.lastTransactionIndex; transactionIndex++)
+        {
+            const StatementTransaction &transaction = p_transactions.at(transactionIndex);
+
+            if(transaction.amountCents >= 0)
+            {
+                continue;
+            }
+
+            QHash<qint64, QVector<int>>::const_iterator bucketIterator = billIndexesByCents.constFind(joinKey(-transaction.amountCents, transaction.currencyIndex));
+
+            if(bucketIterator == billIndexesByCents.cend())
+            {
+                continue;
+            }
+
+            const QVector<int> &billIndexes = bucketIterator.value();
+            qint64 transactionDay = transaction.date.toJulianDay();
+            QVector<int>::const_iterator windowIterator = std::lower_bound(billIndexes.cbegin(), billIndexes.cend(), transactionDay - p_dateWindowDays,
+                                                                           [&billDays](int p_billIndex, qint64 p_day)
+            {
+                return billDays.at(p_billIndex) < p_day;
+            });
+
+            // The description's trigrams are only computed for transactions which have a bill in their window
+            QVector<quint64> descriptionTrigrams;
+
+            for(; windowIterator != billIndexes.cend() && billDays.at(*windowIterator) <= transactionDay + p_dateWindowDays; ++windowIterator)
+            {
+                if(descriptionTrigrams.isEmpty())
+                {
+                    descriptionTrigrams = nameTrigrams(transaction.description);
+                }
+
+                Candidate candidate;
+                candidate.transactionIndex = transactionIndex;
+                candidate.billIndex = *windowIterator;
+                candidate.nameScore = nameScore(billTrigrams.at(candidate.billIndex), descriptionTrigrams);
+                candidate.dayDistance = static_cast<int>(qAbs(billDays.at(candidate.billIndex) - transactionDay));
+                p_chunk.comparedCount++;
+
+                if(candidate.nameScore >= p_minimumNameScore)
+                {
+                    p_chunk.candidates.append(candidate);
+                }
+            }
+        }
+    };
+
+    // Split the transactions into one chunk per core, but only as many chunks as there are enough transactions for
+    int chunkCount = std::max(1, std::min(QThread::idealThreadCount(), transactionCount / m_MIN_TRANSACTIONS_PER_CHUNK));
+    int chunkSize = std::max(1, (transactionCount + chunkCount - 1) / chunkCount);
+    QVector<MatchChunk> chunks;
+
+    for(int firstTransactionIndex = 0; firstTransactionIndex < transactionCount; firstTransactionIndex += chunkSize)
+    {
+        MatchChunk chunk;
+        chunk.firstTransactionIndex = firstTransactionIndex;
+        chunk.lastTransactionIndex = std::min(firstTransactionIndex + chunkSize, transactionCount);
+        chunks.append(chunk);
+    }
+
+    // A single chunk is probed on the calling thread, several are probed concurrently
+    if(chunks.size() == 1)
+    {
+        probeChunk(chunks.first());
+    }
+    else if(chunks.size() > 1)
+    {
+        QtConcurrent::blockingMap(chunks, probeChunk);
+    }
+
+    // Merge the chunks and order the candidates from best to worst, breaking ties by index so the result does not depend on the number of cores
+    QVector<Candidate> candidates;
+
+    for(const MatchChunk &chunk : chunks)
+    {
+        candidates += chunk.candidates;
+        result.candidateCount += chunk.comparedCount;
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate &p_first, const Candidate &p_second)
+    {
+        if(p_first.nameScore != p_second.nameScore)
+        {
+            return p_first.nameScore > p_second.nameScore;
+        }
+
+        if(p_first.dayDistance != p_second.dayDistance)
+        {
+            return p_first.dayDistance < p_second.dayDistance;
+        }
+
+        return p_first.transactionIndex < p_second.transactionIndex || (p_first.transactionIndex == p_second.transactionIndex && p_first.billIndex < p_second.billIndex);
+    });
+
+    // Assign the best candidates first, skipping those whose transaction or bill was already taken
+    QVector<int> billIndexByTransaction(transactionCount, -1);
+    QVector<bool> isBillMatched(billCount, false);
+    QVector<Candidate> candidateByTransaction(transactionCount);
+
+    for(const Candidate &candidate : candidates)
+    {
+        if(billIndexByTransaction.at(candidate.transactionIndex) < 0 && !isBillMatched.at(candidate.billIndex))
+        {
+            billIndexByTransaction[candidate.transactionIndex] = candidate.billIndex;
+            candidateByTransaction[candidate.transactionIndex] = candidate;
+            isBillMatched[candidate.billIndex] = true;
+        }
+    }
+
+    // List the matches and what was left over on each side
+    for(int transactionIndex = 0; transactionIndex < transactionCount; transactionIndex++)
+    {
+        if(billIndexByTransaction.at(transactionIndex) < 0)
+        {
+            result.unmatchedTransactionIndexes.append(transactionIndex);
+            continue;
+        }
+
+        const Candidate &candidate = candidateByTransaction.at(transactionIndex);
+        result.matches.append({candidate.transactionIndex, candidate.billIndex, candidate.nameScore, candidate.dayDistance});
+    }
+
+    for(int billIndex = 0; billIndex < billCount; billIndex++)
+    {
+        if(!isBillMatched.at(billIndex))
+        {
+            result.unmatchedBillIndexes.append(billIndex);
+        }
+    }
+
+    return result;
+}
+
+QVector<QStringList> StatementReconciler::splitCsvRecords(const QString &p_csvText)
+{
+    QVector<QStringList> records;
+    QStringList fields;
+    QString field;
+    bool isQuoted = false;
+    bool isRecordEmpty = true;
+
+    for(int characterIndex = 0; characterIndex < p_csvText.size(); characterIndex++)
+    {
+        QChar character = p_csvText.at(characterIndex);
+
+        // Doubled quotes within a quoted field stand for a single quote
+        if(character == '"')
+        {
+            if(isQuoted && characterIndex + 1 < p_csvText.size() && p_csvText.at(characterIndex + 1) == '"')
+            {
+                field.append('"');
+                characterIndex++;
+            }
+            else
+            {
+                isQuoted = !isQuoted;
+            }
+
+            isRecordEmpty = false;
+        }
+
+        // Line breaks inside quotes belong to the field, any other ends the record, a "\r\n" counting as one
+        else if((character == '\n' || character == '\r') && !isQuoted)
+        {
+            if(!isRecordEmpty)
+            {
+                fields.append(field);
+                records.append(fields);
+            }
+
+            fields.clear();
+            field.clear();
+            isRecordEmpty = true;
+        }
+        else if(character == ',' && !isQuoted)
+        {
+            fields.append(field);
+            field.clear();
+            isRecordEmpty = false;
+        }
+        else
+        {
+            field.append(character);
+            isRecordEmpty = false;
+        }
+    }
+
+    // The last record may not end in a line break
+    if(!isRecordEmpty)
+    {
+        fields.append(field);
+        records.append(fields);
+    }
+
+    return records;
+}
+
+QDate StatementReconciler::parseStatementDate(const QString &p_dateText)
+{
+    QString dateText = p_dateText.trimmed();
+
+    for(const QString &dateFormat : DATE_FORMATS)
+    {
+        QDate date = QDate::fromString(dateText, dateFormat);
+
+        if(date.isValid())
+        {
+            // Two digit years are read as being in the current century
+            if(dateFormat.endsWith("yy") && !dateFormat.endsWith("yyyy") && date.year() < 2000)
+            {
+                date = date.addYears(100);
+            }
+
+            return date;
+        }
+    }
+
+    return QDate();
+}
+
+bool StatementReconciler::parseStatementAmount(const QString &p_amountText, qint64 &p_amountCents)
+{
+    QString amountText = p_amountText.trimmed();
+    p_amountCents = 0;
+
+    if(amountText.isEmpty())
+    {
+        return true;
+    }
+
+    // Accountants write negative amounts in parentheses
+    bool isNegative = amountText.startsWith('(') && amountText.endsWith(')');
+    amountText.remove(QRegularExpression("[^0-9.\\-]"));
+
+    bool isNumber = false;
+    double amount = amountText.toDouble(&isNumber);
+
+    if(!isNumber)
+    {
+        return false;
+    }
+
+    p_amountCents = qRound64((isNegative ? -qAbs(amount) : amount) * 100.0);
+    return true;
+}
+
+QVector<quint64> StatementReconciler::nameTrigrams(const QString &p_name)
+{
+    // Fold the name, replacing each run of characters other than letters and digits with a single space and padding it so word boundaries form trigrams
+    QString foldedName(" ");
+
+    for(QChar character : p_name.left(m_MAX_NAME_LENGTH).toCaseFolded())
+    {
+        if(character.isLetterOrNumber())
+        {
+            foldedName.append(character);
+        }
+        else if(!foldedName.endsWith(' '))
+        {
+            foldedName.append(' ');
+        }
+    }
+
+    if(!foldedName.endsWith(' '))
+    {
+        foldedName.append(' ');
+    }
+
+    // Pack each trigram's three UTF-16 code units into one integer
+    QVector<quint64> trigrams;
+    trigrams.reserve(foldedName.size());
+
+    for(int characterIndex = 0; characterIndex + 2 < foldedName.size(); characterIndex++)
+    {
+        trigrams.append((static_cast<quint64>(foldedName.at(characterIndex).unicode()) << 32) | (static_cast<quint64>(foldedName.at(characterIndex + 1).unicode()) << 16)
+                        | foldedName.at(characterIndex + 2).unicode());
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+int StatementReconciler::nameScore(const QVector<quint64> &p_billTrigrams, const QVector<quint64> &p_descriptionTrigrams)
+{
+    if(p_billTrigrams.isEmpty())
+    {
+        return 0;
+    }
+
+    // Walk both sorted lists together, counting the trigrams they share
+    int sharedCount = 0;
+    QVector<quint64>::const_iterator billIterator = p_billTrigrams.cbegin();
+    QVector<quint64>::const_iterator descriptionIterator = p_descriptionTrigrams.cbegin();
+
+    while(billIterator != p_billTrigrams.cend() && descriptionIterator != p_descriptionTrigrams.cend())
+    {
+        if(*billIterator < *descriptionIterator)
+        {
+            ++billIterator;
+        }
+        else if(*descriptionIterator < *billIterator)
+        {
+            ++descriptionIterator;
+        }
+        else
+        {
+            sharedCount++;
+            ++billIterator;
+            ++descriptionIterator;
+        }
+    }
+
+    return sharedCount * 100 / p_billTrigrams.size();
+}
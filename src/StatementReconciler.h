@@ -0,0 +1,166 @@
+/*##################################################################################
+#   File name:          StatementReconciler.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a StatementReconciler
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef STATEMENTRECONCILER_H
+#define STATEMENTRECONCILER_H
+
+// Local file includes
+#include "CurrencyRegistry.h"
+
+// Qt includes
+#include <QByteArray>
+#include <QDate>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The StatementReconciler class reads bank statement exports and matches their transactions to bills.
+ * Matching is a hash join on the amount in cents and its currency: bills are grouped by amount and currency and sorted by due date, so each debit only looks at bills of the same amount
+ * and currency due within the date window, found by binary search. The remaining candidates are compared by the share of the bill name's trigrams found in the transaction's description,
+ * with both names truncated so a comparison costs a bounded amount of work. Transactions are probed in parallel chunks, one per core, and the candidates are then
+ * assigned one to one, best first, so each transaction pays at most one bill and each bill is paid by at most one transaction.
+ */
+class StatementReconciler
+{
+
+public:
+
+    /**
+     * @brief The StatementTransaction struct holds one transaction read from a bank statement.
+     */
+    struct StatementTransaction
+    {
+        QDate date; //!< The date the transaction was posted.
+        qint64 amountCents = 0; //!< The amount of the transaction in cents, negative for money leaving the account.
+        quint8 currencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the currency the amount is in.
+        QString description; //!< The payee, name, or memo describing the transaction.
+    };
+
+    /**
+     * @brief The ReconcileBill struct holds the values of a bill which transactions are matched against.
+     */
+    struct ReconcileBill
+    {
+        QString billKey; //!< The bill map key of the bill.
+        QString name; //!< The bill's name.
+        QDate dueDate; //!< The bill's due date.
+        qint64 amountCents = 0; //!< The bill's amount due in cents, in the bill's own currency.
+        quint8 currencyIndex = CurrencyRegistry::m_DEFAULT_CURRENCY_INDEX; //!< The CurrencyRegistry index of the bill's currency.
+    };
+
+    /**
+     * @brief The Match struct pairs a transaction with the bill it paid.
+     */
+    struct Match
+    {
+        int transactionIndex = 0; //!< The index of the transaction.
+        int billIndex = 0; //!< The index of the bill.
+        int nameScore = 0; //!< The percentage of the bill name's trigrams found in the transaction's description.
+        int dayDistance = 0; //!< The number of days between the transaction and the bill's due date.
+    };
+
+    /**
+     * @brief The Result struct holds the outcome of reconciling a statement.
+     */
+    struct Result
+    {
+        QVector<Match> matches; //!< The matched pairs, ordered by transaction.
+        QVector<int> unmatchedTransactionIndexes; //!< The indexes of the transactions which did not match a bill, in increasing order.
+        QVector<int> unmatchedBillIndexes; //!< The indexes of the bills which did not match a transaction, in increasing order.
+        qint64 candidateCount = 0; //!< The number of pairs with the same amount and within the date window which were compared by name.
+    };
+
+    /**
+     * @brief Reads the transactions of a statement file, treating files ending in .ofx or .qfx as OFX and any other file as CSV.
+     * @param p_filePath - The path of the statement file.
+     * @param p_statementCurrencyIndex - The CurrencyRegistry index of the currency of transactions the statement does not give a currency for.
+     * @param p_transactions - Filled with the transactions read, in the order they appear.
+     * @param p_errorText - Set to why the file could not be read, if it could not be.
+     * @return True if the file was read.
+     */
+    static bool readStatement(const QString &p_filePath, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText);
+
+    /**
+     * @brief Parses a CSV statement whose first row names its columns. A date column, a description column, and either debit and credit columns or a column named exactly amount are required, the split columns being preferred.
+     * A currency column is optional. Quoted fields may hold commas, doubled quotes, and line breaks. Rows whose date or amount cannot be read are skipped.
+     * @param p_csvData - The contents of the file.
+     * @param p_statementCurrencyIndex - The CurrencyRegistry index of the currency of rows without a currency.
+     * @param p_transactions - Filled with the transactions read.
+     * @param p_errorText - Set to why the data could not be parsed, if it could not be.
+     * @return True if the columns were found.
+     */
+    static bool parseCsv(const QByteArray &p_csvData, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText);
+
+    /**
+     * @brief Parses the STMTTRN blocks of an OFX statement, in either its SGML or XML form. Amounts are in the statement's CURDEF currency.
+     * @param p_ofxData - The contents of the file.
+     * @param p_statementCurrencyIndex - The CurrencyRegistry index of the currency used if the statement has no CURDEF.
+     * @param p_transactions - Filled with the transactions read.
+     * @param p_errorText - Set to why the data could not be parsed, if it could not be.
+     * @return True if any transaction was found.
+     */
+    static bool parseOfx(const QByteArray &p_ofxData, quint8 p_statementCurrencyIndex, QVector<StatementTransaction> &p_transactions, QString &p_errorText);
+
+    /**
+     * @brief Matches debits to bills of the same amount and currency due within a number of days of the debit, whose names are similar enough to the debit's description.
+     * Credits, such as deposits and refunds, never pay a bill and are left unmatched.
+     * @param p_transactions - The statement's transactions.
+     * @param p_bills - The bills to match against.
+     * @param p_dateWindowDays - The most days a transaction may be posted before or after the bill's due date.
+     * @param p_minimumNameScore - The lowest percentage of the bill name's trigrams which must be found in the transaction's description.
+     * @return The matched pairs and the unmatched transactions and bills.
+     */
+    static Result reconcile(const QVector<StatementTransaction> &p_transactions, const QVector<ReconcileBill> &p_bills, int p_dateWindowDays, int p_minimumNameScore);
+
+private:
+
+    /**
+     * @brief Splits CSV text into records and their fields in one pass, so quoted fields may contain commas, doubled quotes, and line breaks. Blank lines are skipped.
+     * @param p_csvText - The text.
+     * @return The fields of each record, in order.
+     */
+    static QVector<QStringList> splitCsvRecords(const QString &p_csvText);
+
+    /**
+     * @brief Reads a date in any of the formats banks commonly export.
+     * @param p_dateText - The date text.
+     * @return The date, invalid if it could not be read.
+     */
+    static QDate parseStatementDate(const QString &p_dateText);
+
+    /**
+     * @brief Reads an amount such as "-1,234.56", "$42.50", or "(42.50)" into cents.
+     * @param p_amountText - The amount text.
+     * @param p_amountCents - Set to the amount in cents.
+     * @return True if the amount could be read. Empty text reads as zero.
+     */
+    static bool parseStatementAmount(const QString &p_amountText, qint64 &p_amountCents);
+
+    /**
+     * @brief Computes the distinct trigrams of a name after case folding it, padding it with spaces, and replacing runs of punctuation with a single space.
+     * Only the first characters of long names are used, bounding the cost of comparing them.
+     * @param p_name - The name or description.
+     * @return The trigrams, each encoded as an integer, in increasing order.
+     */
+    static QVector<quint64> nameTrigrams(const QString &p_name);
+
+    /**
+     * @brief Scores how much of a bill's name appears in a transaction's description.
+     * @param p_billTrigrams - The sorted trigrams of the bill's name.
+     * @param p_descriptionTrigrams - The sorted trigrams of the transaction's description.
+     * @return The percentage of the bill's trigrams found in the description.
+     */
+    static int nameScore(const QVector<quint64> &p_billTrigrams, const QVector<quint64> &p_descriptionTrigrams);
+
+    static constexpr int m_MAX_NAME_LENGTH = 64; //!< The most characters of a name or description compared, keeping each comparison bounded.
+    static constexpr int m_MIN_TRANSACTIONS_PER_CHUNK = 2000; //!< Fewer transactions than this are matched on the calling thread, since starting workers would cost more than it saves.
+};
+
+#endif // STATEMENTRECONCILER_H
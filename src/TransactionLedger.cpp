@@ -0,0 +1,502 @@
+/*##################################################################################
+#   File name:          TransactionLedger.cpp
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Source file for a TransactionLedger
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#include "TransactionLedger.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QPair>
+#include <QSaveFile>
+
+#include <algorithm>
+
+namespace
+{
+    const QDataStream::Version LEDGER_STREAM_VERSION = QDataStream::Qt_5_12; //!< Pinned so ledger files read the same across Qt versions.
+}
+
+void TransactionLedger::writeTransaction(QDataStream &p_stream, const Transaction &p_transaction)
+{
+    // Write the fields in a fixed order
+    p_stream << p_transaction.timestampMsecs << static_cast<quint8>(p_transaction.type) << p_transaction.amountCents << p_transaction.eventCount << p_transaction.billKey;
+}
+
+QString TransactionLedger::typeToString(TransactionType p_type)
+{
+    switch(p_type)
+    {
+        case Deposit :
+        {
+            return "Deposit";
+        }
+
+        case Fund :
+        {
+            return "Fund";
+        }
+
+        case Defund :
+        {
+            return "Defund";
+        }
+
+        case Delete :
+        {
+            return "Delete";
+        }
+
+        case Withdrawal :
+        {
+            return "Withdrawal";
+        }
+
+        default :
+        {
+            return "Checkpoint";
+        }
+    }
+}
+
+TransactionLedger::TransactionType TransactionLedger::depositTypeFor(qint64 p_amountCents)
+{
+    return p_amountCents < 0 ? Withdrawal : Deposit;
+}
+
+bool TransactionLedger::open(const QString &p_ledgerFilePath, qint64 p_currentAvailableCents)
+{
+    m_ledgerFilePath = p_ledgerFilePath;
+    m_transactions.clear();
+    m_compactionTriggerCount = m_COMPACTION_THRESHOLD;
+
+    QFile ledgerFile(m_ledgerFilePath);
+
+    // A missing ledger starts fresh from the current balance
+    if(!ledgerFile.exists())
+    {
+        return reset(p_currentAvailableCents);
+    }
+
+    // If the ledger cannot be opened or does not start with the ledger header, set it aside and start fresh rather than lose it
+    quint32 fileMagic = 0;
+    quint16 fileVersion = 0;
+    bool isHeaderValid = false;
+    qint64 completeRecordsEnd = 0;
+    qint64 ledgerFileSize = ledgerFile.size();
+
+    if(ledgerFile.open(QIODevice::ReadOnly))
+    {
+        QDataStream ledgerStream(&ledgerFile);
+        ledgerStream.setVersion(LEDGER_STREAM_VERSION);
+        ledgerStream >> fileMagic >> fileVersion;
+        isHeaderValid = ledgerStream.status() == QDataStream::Ok && fileMagic == m_LEDGER_FILE_MAGIC && fileVersion == m_LEDGER_FILE_VERSION;
+
+        // Read every complete transaction
+        while(isHeaderValid && !ledgerStream.atEnd())
+        {
+            Transaction transaction;
+            quint8 transactionType = 0;
+            ledgerStream >> transaction.timestampMsecs >> transactionType >> transaction.amountCents >> transaction.eventCount >> transaction.billKey;
+
+            // A partially written transaction at the end of the file is left over from an interrupted append and is dropped
+            if(ledgerStream.status() != QDataStream::Ok)
+            {
+                break;
+            }
+
+            transaction.type = static_cast<TransactionType>(transactionType);
+            m_transactions.append(transaction);
+            completeRecordsEnd = ledgerFile.pos();
+        }
+
+        ledgerFile.close();
+    }
+
+    if(!isHeaderValid || m_transactions.isEmpty())
+    {
+        QFile::remove(m_ledgerFilePath + ".corrupt");
+        QFile::rename(m_ledgerFilePath, m_ledgerFilePath + ".corrupt");
+        return reset(p_currentAvailableCents);
+    }
+
+    rebuildCheckpointIndex();
+
+    // Rewrite the file if a partial transaction had to be dropped, so later appends start on a record boundary
+    if(completeRecordsEnd < ledgerFileSize)
+    {
+        return rewriteFile(m_transactions);
+    }
+
+    return true;
+}
+
+bool TransactionLedger::reset(qint64 p_currentAvailableCents)
+{
+    // Start the history with an opening checkpoint holding the current balance
+    Transaction openingCheckpoint;
+    openingCheckpoint.timestampMsecs = QDateTime::currentMSecsSinceEpoch();
+    openingCheckpoint.type = Checkpoint;
+    openingCheckpoint.amountCents = p_currentAvailableCents;
+
+    QVector<Transaction> freshHistory;
+    freshHistory.append(openingCheckpoint);
+    return rewriteFile(freshHistory);
+}
+
+bool TransactionLedger::rewriteFile(const QVector<Transaction> &p_transactions)
+{
+    // Write to a temporary file which replaces the ledger only once it is complete, so a crash never leaves a half written history
+    QSaveFile ledgerFile(m_ledgerFilePath);
+
+    if(!ledgerFile.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    QDataStream ledgerStream(&ledgerFile);
+    ledgerStream.setVersion(LEDGER_STREAM_VERSION);
+    ledgerStream << m_LEDGER_FILE_MAGIC << m_LEDGER_FILE_VERSION;
+
+    for(const Transaction &transaction : p_transactions)
+    {
+        writeTransaction(ledgerStream, transaction);
+    }
+
+    if(!ledgerFile.commit())
+    {
+        return false;
+    }
+
+    // Adopt the rewritten history
+    m_transactions = p_transactions;
+    rebuildCheckpointIndex();
+    return true;
+}
+
+void TransactionLedger::rebuildCheckpointIndex()
+{
+    m_checkpointPositions.clear();
+    m_currentAvailableCents = 0;
+    m_transactionsSinceCheckpoint = 0;
+
+    // Replay the whole history once, noting where each checkpoint sits
+    for(int position = 0; position < m_transactions.size(); position++)
+    {
+        const Transaction &transaction = m_transactions.at(position);
+
+        if(transaction.type == Checkpoint)
+        {
+            m_checkpointPositions.append(position);
+            m_currentAvailableCents = transaction.amountCents;
+            m_transactionsSinceCheckpoint = 0;
+        }
+        else
+        {
+            m_currentAvailableCents += transaction.amountCents;
+            m_transactionsSinceCheckpoint++;
+        }
+    }
+}
+
+bool TransactionLedger::appendTransactions(const QVector<Transaction> &p_transactions)
+{
+    // Open the ledger file for appending only, earlier history is never rewritten by an append
+    QFile ledgerFile(m_ledgerFilePath);
+
+    if(!ledgerFile.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        return false;
+    }
+
+    // Write every transaction through the one open file
+    qint64 previousFileSize = ledgerFile.size();
+    QDataStream ledgerStream(&ledgerFile);
+    ledgerStream.setVersion(LEDGER_STREAM_VERSION);
+
+    for(const Transaction &transaction : p_transactions)
+    {
+        writeTransaction(ledgerStream, transaction);
+    }
+
+    ledgerFile.close();
+
+    // Cut off whatever part of the batch was written, so the file and the in-memory history still agree
+    if(ledgerStream.status() != QDataStream::Ok)
+    {
+        QFile::resize(m_ledgerFilePath, previousFileSize);
+        return false;
+    }
+
+    // Mirror the append in memory
+    m_transactions.append(p_transactions);
+    return true;
+}
+
+bool TransactionLedger::append(TransactionType p_type, qint64 p_amountCents, const QString &p_billKey)
+{
+    Transaction transaction;
+    transaction.type = p_type;
+    transaction.amountCents = p_amountCents;
+    transaction.billKey = p_billKey;
+    return appendBatch({transaction});
+}
+
+bool TransactionLedger::appendBatch(const QVector<Transaction> &p_transactions)
+{
+    if(m_ledgerFilePath.isEmpty())
+    {
+        return false;
+    }
+
+    // Checkpoints are only ever written by the ledger itself
+    for(const Transaction &transaction : p_transactions)
+    {
+        if(transaction.type == Checkpoint)
+        {
+            return false;
+        }
+    }
+
+    if(p_transactions.isEmpty())
+    {
+        return true;
+    }
+
+    // Keep timestamps non-decreasing even if the system clock steps backwards, since replay relies on chronological order
+    qint64 timestampMsecs = QDateTime::currentMSecsSinceEpoch();
+
+    if(!m_transactions.isEmpty())
+    {
+        timestampMsecs = std::max(timestampMsecs, m_transactions.last().timestampMsecs);
+    }
+
+    QVector<Transaction> appendedTransactions;
+    appendedTransactions.reserve(p_transactions.size() + p_transactions.size() / m_CHECKPOINT_INTERVAL + 1);
+    QVector<int> appendedCheckpointPositions;
+    qint64 currentAvailableCents = m_currentAvailableCents;
+    int transactionsSinceCheckpoint = m_transactionsSinceCheckpoint;
+
+    for(Transaction transaction : p_transactions)
+    {
+        transaction.timestampMsecs = timestampMsecs;
+        transaction.eventCount = 1;
+        appendedTransactions.append(transaction);
+        currentAvailableCents += transaction.amountCents;
+        transactionsSinceCheckpoint++;
+
+        // Periodically record the absolute balance so reconstructing any moment only replays a bounded number of transactions
+        if(transactionsSinceCheckpoint >= m_CHECKPOINT_INTERVAL)
+        {
+            Transaction checkpoint;
+            checkpoint.timestampMsecs = timestampMsecs;
+            checkpoint.type = Checkpoint;
+            checkpoint.amountCents = currentAvailableCents;
+            appendedCheckpointPositions.append(m_transactions.size() + appendedTransactions.size());
+            appendedTransactions.append(checkpoint);
+            transactionsSinceCheckpoint = 0;
+        }
+    }
+
+    // Write the whole batch, checkpoints included, with a single append
+    if(!appendTransactions(appendedTransactions))
+    {
+        return false;
+    }
+
+    m_checkpointPositions.append(appendedCheckpointPositions);
+    m_currentAvailableCents = currentAvailableCents;
+    m_transactionsSinceCheckpoint = transactionsSinceCheckpoint;
+
+    // Keep the ledger bounded by compacting everything older than the retention window
+    if(m_transactions.size() > m_compactionTriggerCount)
+    {
+        compact(QDateTime::currentDateTime().addDays(-m_RETAINED_DAYS));
+
+        // What is left is within the retention window, so wait for a further batch of entries before compacting again
+        m_compactionTriggerCount = std::max(m_COMPACTION_THRESHOLD, static_cast<int>(m_transactions.size()) + m_COMPACTION_HEADROOM);
+    }
+
+    return true;
+}
+
+qint64 TransactionLedger::availableCentsAt(const QDateTime &p_dateTime) const
+{
+    // An empty ledger has no history to replay
+    if(m_checkpointPositions.isEmpty())
+    {
+        return 0;
+    }
+
+    qint64 targetMsecs = p_dateTime.toMSecsSinceEpoch();
+
+    // Binary search for the last checkpoint at or before the target moment
+    QVector<int>::const_iterator checkpointIterator = std::upper_bound(m_checkpointPositions.cbegin(), m_checkpointPositions.cend(), targetMsecs, [this](qint64 p_targetMsecs, int p_position)
+    {
+        return p_targetMsecs < m_transactions.at(p_position).timestampMsecs;
+    });
+
+    // Moments before the history begins report the opening balance
+    if(checkpointIterator == m_checkpointPositions.cbegin())
+    {
+        return m_transactions.at(m_checkpointPositions.first()).amountCents;
+    }
+
+    int checkpointPosition = *(checkpointIterator - 1);
+    qint64 availableCents = m_transactions.at(checkpointPosition).amountCents;
+
+    // Replay the transactions after the checkpoint up to the target moment
+    for(int position = checkpointPosition + 1; position < m_transactions.size() && m_transactions.at(position).timestampMsecs <= targetMsecs; position++)
+    {
+        const Transaction &transaction = m_transactions.at(position);
+        availableCents = transaction.type == Checkpoint ? transaction.amountCents : availableCents + transaction.amountCents;
+    }
+
+    return availableCents;
+}
+
+QVector<TransactionLedger::Transaction> TransactionLedger::transactionsBetween(const QDateTime &p_from, const QDateTime &p_to) const
+{
+    QVector<Transaction> matchingTransactions;
+    qint64 fromMsecs = p_from.toMSecsSinceEpoch();
+    qint64 toMsecs = p_to.toMSecsSinceEpoch();
+
+    // The history is chronological, so binary search for the first transaction in range
+    QVector<Transaction>::const_iterator transactionIterator = std::lower_bound(m_transactions.cbegin(), m_transactions.cend(), fromMsecs, [](const Transaction &p_transaction, qint64 p_fromMsecs)
+    {
+        return p_transaction.timestampMsecs < p_fromMsecs;
+    });
+
+    // Collect transactions until the end of the range
+    for(; transactionIterator != m_transactions.cend() && transactionIterator->timestampMsecs <= toMsecs; ++transactionIterator)
+    {
+        if(transactionIterator->type != Checkpoint)
+        {
+            matchingTransactions.append(*transactionIterator);
+        }
+    }
+
+    return matchingTransactions;
+}
+
+QVector<TransactionLedger::Transaction> TransactionLedger::transactionsForBill(const QString &p_billKey) const
+{
+    QVector<Transaction> matchingTransactions;
+
+    // Collect every transaction naming the bill
+    for(const Transaction &transaction : m_transactions)
+    {
+        if(transaction.type != Checkpoint && transaction.billKey == p_billKey)
+        {
+            matchingTransactions.append(transaction);
+        }
+    }
+
+    return matchingTransactions;
+}
+
+bool TransactionLedger::compact(const QDateTime &p_cutoff)
+{
+    qint64 cutoffMsecs = p_cutoff.toMSecsSinceEpoch();
+    QVector<Transaction> compactedHistory;
+    qint64 runningAvailableCents = 0;
+
+    // Transactions of the day being folded, summed per (type, bill), in the order each group first appeared and keeping the time of its first transaction, so the groups stay in time order
+    QHash<QPair<quint8, QString>, int> dayGroupPositions;
+    QVector<Transaction> dayGroups;
+    qint64 currentDay = -1;
+    qint64 lastTimestampOfDay = 0;
+
+    // Emits the folded groups of a day followed by a checkpoint holding the balance at the end of that day, so replay after the cutoff always starts from a checkpoint
+    auto flushDay = [&]()
+    {
+        if(currentDay < 0)
+        {
+            return;
+        }
+
+        for(const Transaction &dayGroup : dayGroups)
+        {
+            compactedHistory.append(dayGroup);
+        }
+
+        Transaction endOfDayCheckpoint;
+        endOfDayCheckpoint.timestampMsecs = lastTimestampOfDay;
+        endOfDayCheckpoint.type = Checkpoint;
+        endOfDayCheckpoint.amountCents = runningAvailableCents;
+        compactedHistory.append(endOfDayCheckpoint);
+
+        dayGroups.clear();
+        dayGroupPositions.clear();
+    };
+
+    int position = 0;
+
+    // Fold every transaction before the cutoff
+    for(; position < m_transactions.size() && m_transactions.at(position).timestampMsecs < cutoffMsecs; position++)
+    {
+        const Transaction &transaction = m_transactions.at(position);
+        qint64 transactionDay = QDateTime::fromMSecsSinceEpoch(transaction.timestampMsecs).date().toJulianDay();
+
+        // Close off the previous day when a new one starts
+        if(transactionDay != currentDay)
+        {
+            flushDay();
+            currentDay = transactionDay;
+        }
+
+        lastTimestampOfDay = transaction.timestampMsecs;
+
+        // Checkpoints inside the compacted range are replaced by the end of day checkpoints
+        if(transaction.type == Checkpoint)
+        {
+            runningAvailableCents = transaction.amountCents;
+            continue;
+        }
+
+        runningAvailableCents += transaction.amountCents;
+
+        // Sum the transaction into its day group, creating the group if this is its first transaction today
+        QPair<quint8, QString> groupKey = qMakePair(static_cast<quint8>(transaction.type), transaction.billKey);
+        QHash<QPair<quint8, QString>, int>::const_iterator groupIterator = dayGroupPositions.constFind(groupKey);
+
+        if(groupIterator == dayGroupPositions.constEnd())
+        {
+            dayGroupPositions.insert(groupKey, dayGroups.size());
+            dayGroups.append(transaction);
+        }
+        else
+        {
+            Transaction &dayGroup = dayGroups[groupIterator.value()];
+            dayGroup.amountCents += transaction.amountCents;
+            dayGroup.eventCount += transaction.eventCount;
+        }
+    }
+
+    flushDay();
+
+    // Nothing older than the cutoff, so there is nothing to compact
+    if(position == 0)
+    {
+        return true;
+    }
+
+    // Keep every transaction after the cutoff as it is
+    for(; position < m_transactions.size(); position++)
+    {
+        compactedHistory.append(m_transactions.at(position));
+    }
+
+    return rewriteFile(compactedHistory);
+}
+
+int TransactionLedger::transactionCount() const
+{
+    // Return the number of entries, including checkpoints
+    return m_transactions.size();
+}
@@ -0,0 +1,183 @@
+/*##################################################################################
+#   File name:          TransactionLedger.h
+#   Created on:         10/19/2026
+#   Author:             stwomey
+#   Description:        Header file for a TransactionLedger
+#   Change History:     See https://github.com/SeanTwomey9/PersonalFinanceTool
+#   Relative Location:  PersonalFinanceTool/src/
+##################################################################################*/
+
+#ifndef TRANSACTIONLEDGER_H
+#define TRANSACTIONLEDGER_H
+
+#include <QDateTime>
+#include <QString>
+#include <QVector>
+
+class QDataStream;
+
+/**
+ * @brief The TransactionLedger class is an append-only history of every change to the total amount available: deposits, withdrawals, funding and defunding bills, and deleting bills.
+ * Every change is appended to a binary ledger file with its timestamp and signed amount in cents, and a checkpoint holding the absolute balance is appended periodically.
+ * The amount available at any moment is reconstructed by starting from the closest earlier checkpoint and replaying the transactions after it.
+ * Once the ledger grows past a threshold, transactions older than a retention window are compacted into one summed transaction per bill, type, and day followed by an end of day checkpoint.
+ * The next compaction waits for a further batch of entries, so a ledger whose recent history alone exceeds the threshold is not rewritten on every append.
+ * This keeps the file bounded while daily balances and per bill audit queries stay answerable.
+ */
+class TransactionLedger
+{
+
+public:
+
+    /**
+     * @brief The TransactionType enum lists the kinds of entries in the ledger.
+     */
+    enum TransactionType : quint8
+    {
+        Checkpoint = 0,
+        Deposit = 1,
+        Fund = 2,
+        Defund = 3,
+        Delete = 4,
+        Withdrawal = 5
+    };
+
+    /**
+     * @brief The Transaction struct is a single entry in the ledger.
+     */
+    struct Transaction
+    {
+        qint64 timestampMsecs = 0; //!< When the transaction happened, in milliseconds since the epoch.
+        TransactionType type = Checkpoint; //!< The kind of transaction.
+        qint64 amountCents = 0; //!< The change to the amount available in cents, or the absolute amount available for checkpoints.
+        quint32 eventCount = 1; //!< The number of original transactions summed into this one by compaction.
+        QString billKey; //!< The bill map key of the bill involved, empty for deposits and checkpoints.
+    };
+
+    /**
+     * @brief Opens a ledger file, reading its history into memory. If the file does not exist, it is created with an opening checkpoint.
+     * If the file is unreadable, it is set aside with a ".corrupt" suffix and a fresh ledger is started.
+     * @param p_ledgerFilePath - The path of the ledger file.
+     * @param p_currentAvailableCents - The current amount available, used as the opening balance of a new ledger.
+     * @return True if the ledger is ready to be appended to, false if the file could not be created.
+     */
+    bool open(const QString &p_ledgerFilePath, qint64 p_currentAvailableCents);
+
+    /**
+     * @brief Discards the history and starts a fresh ledger with an opening checkpoint.
+     * @param p_currentAvailableCents - The opening balance of the fresh ledger.
+     * @return True if the ledger file was rewritten successfully.
+     */
+    bool reset(qint64 p_currentAvailableCents);
+
+    /**
+     * @brief Appends a transaction timestamped with the current time, appending a checkpoint as well every few transactions.
+     * Compacts the ledger if it has grown past its size threshold.
+     * @param p_type - The kind of transaction, checkpoints are written automatically and are rejected here.
+     * @param p_amountCents - The change to the amount available in cents.
+     * @param p_billKey - The bill map key of the bill involved, empty for deposits.
+     * @return True if the transaction was written to the ledger file.
+     */
+    bool append(TransactionType p_type, qint64 p_amountCents, const QString &p_billKey = QString());
+
+    /**
+     * @brief Appends several transactions timestamped with the current time through a single write of the ledger file, with the checkpoints they bring due.
+     * Compacts the ledger if it has grown past its size threshold.
+     * @param p_transactions - The transactions in the order they happened, only their types, amounts, and bill keys being used. Checkpoints are rejected here.
+     * @return True if every transaction was written to the ledger file, false if none were.
+     */
+    bool appendBatch(const QVector<Transaction> &p_transactions);
+
+    /**
+     * @brief Reconstructs the amount available at a moment in time by replaying from the closest earlier checkpoint.
+     * @param p_dateTime - The moment to reconstruct.
+     * @return The amount available in cents, or the opening balance for moments before the history begins.
+     */
+    qint64 availableCentsAt(const QDateTime &p_dateTime) const;
+
+    /**
+     * @brief Returns the transactions within a time range, excluding checkpoints.
+     * @param p_from - The start of the range, inclusive.
+     * @param p_to - The end of the range, inclusive.
+     * @return The transactions in chronological order.
+     */
+    QVector<Transaction> transactionsBetween(const QDateTime &p_from, const QDateTime &p_to) const;
+
+    /**
+     * @brief Returns every transaction involving a bill.
+     * @param p_billKey - The bill map key of the bill.
+     * @return The transactions in chronological order.
+     */
+    QVector<Transaction> transactionsForBill(const QString &p_billKey) const;
+
+    /**
+     * @brief Compacts transactions before a cutoff into one summed transaction per bill, type, and day, each day ending with a checkpoint, then rewrites the ledger file.
+     * @param p_cutoff - Transactions at or after this moment are kept as they are.
+     * @return True if the ledger file was rewritten successfully.
+     */
+    bool compact(const QDateTime &p_cutoff);
+
+    /**
+     * @brief Returns the number of entries in the ledger, including checkpoints.
+     * @return The number of entries.
+     */
+    int transactionCount() const;
+
+    /**
+     * @brief Returns the human readable name of a transaction type.
+     * @param p_type - The transaction type.
+     * @return The name of the type.
+     */
+    static QString typeToString(TransactionType p_type);
+
+    /**
+     * @brief Returns the type a change to the amount available made directly, rather than by a bill, is recorded as.
+     * @param p_amountCents - The signed change in cents.
+     * @return Deposit for money added, Withdrawal for money taken out.
+     */
+    static TransactionType depositTypeFor(qint64 p_amountCents);
+
+private:
+
+    /**
+     * @brief Writes a transaction to a stream in the ledger file format.
+     * @param p_stream - The stream to write to.
+     * @param p_transaction - The transaction to write.
+     */
+    static void writeTransaction(QDataStream &p_stream, const Transaction &p_transaction);
+
+    /**
+     * @brief Appends entries to the ledger file, opening it once for all of them, and to the in-memory history. The file is cut back to its previous size if the write fails.
+     * @param p_transactions - The entries to append.
+     * @return True if every entry was written.
+     */
+    bool appendTransactions(const QVector<Transaction> &p_transactions);
+
+    /**
+     * @brief Replaces the ledger file with the given history, writing it atomically.
+     * @param p_transactions - The full history to write.
+     * @return True if the file was replaced.
+     */
+    bool rewriteFile(const QVector<Transaction> &p_transactions);
+
+    /**
+     * @brief Rebuilds the positions of the checkpoints and the running balance from the in-memory history.
+     */
+    void rebuildCheckpointIndex();
+
+    const quint32 m_LEDGER_FILE_MAGIC = 0x5046544C; //!< Identifies a ledger file, "PFTL" in ASCII.
+    const quint16 m_LEDGER_FILE_VERSION = 1; //!< The version of the ledger file format.
+    const int m_CHECKPOINT_INTERVAL = 256; //!< A checkpoint is appended after this many transactions.
+    const int m_COMPACTION_THRESHOLD = 100000; //!< The ledger is compacted once it holds more entries than this.
+    const int m_COMPACTION_HEADROOM = 25000; //!< How many more entries are appended after a compaction before the next one, so entries still inside the retention window are not rewritten on every append.
+    const int m_RETAINED_DAYS = 90; //!< Transactions newer than this many days are never compacted.
+
+    QString m_ledgerFilePath; //!< The path of the ledger file.
+    QVector<Transaction> m_transactions; //!< Every entry in the ledger, in chronological order.
+    QVector<int> m_checkpointPositions; //!< The positions of the checkpoints within the history, in chronological order.
+    qint64 m_currentAvailableCents = 0; //!< The amount available after the most recent entry.
+    int m_transactionsSinceCheckpoint = 0; //!< The number of transactions appended since the most recent checkpoint.
+    int m_compactionTriggerCount = m_COMPACTION_THRESHOLD; //!< The ledger is compacted once it holds more entries than this, raised past what each compaction leaves behind.
+};
+
+#endif // TRANSACTIONLEDGER_H
@@ -8,17 +8,50 @@
 ##################################################################################*/
 
 #include "MainWindow.h"
+#include "Profiler.h"
 
 #include <QApplication>
 
+namespace
+{
+    const QString PROFILE_SWITCH = "--profile"; //!< Command-line switch which reports the time and allocations of each phase on exit, optionally followed by "=<path>" for the JSON file.
+    const QString DEFAULT_PROFILE_FILE_NAME = "PersonalFinanceToolProfile.json"; //!< The JSON file written when --profile does not name one.
+}
+
 int main(int argc, char *argv[])
 {
     // Create the application object
     QApplication application(argc, argv);
 
+    // Look for the profiling switch, which must be enabled before the main window starts loading the config file
+    QString profileFilePath;
+
+    for(const QString &argument : QCoreApplication::arguments())
+    {
+        if(argument == PROFILE_SWITCH)
+        {
+            profileFilePath = DEFAULT_PROFILE_FILE_NAME;
+        }
+
+        else if(argument.startsWith(PROFILE_SWITCH + "="))
+        {
+            profileFilePath = argument.mid(PROFILE_SWITCH.size() + 1);
+        }
+    }
+
+    Profiler::setEnabled(!profileFilePath.isEmpty());
+
     // Create the main window object
     MainWindow window;
 
     // Start the main application thread
-    return application.exec();
+    int exitCode = application.exec();
+
+    // Report the phases once the application has finished
+    if(Profiler::isEnabled() && !Profiler::writeReport(profileFilePath))
+    {
+        qWarning("Could not write the profile to %s", qPrintable(profileFilePath));
+    }
+
+    return exitCode;
 }